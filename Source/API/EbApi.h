@@ -69,6 +69,8 @@ EbBool is a 32 bit quantity and is aligned on a 32 bit word boundary.
 
         // pic info
         uint32_t qp;
+        // On input, EB_IDR_PICTURE forces a key frame and EB_I_PICTURE an intra
+        // picture, closing the mini GOP early and restarting the intra period
         uint32_t pic_type;
 
         // pic flags
@@ -106,6 +108,9 @@ EbBool is a 32 bit quantity and is aligned on a 32 bit word boundary.
     //   for the three input picture planes.  However, for 10-bit unpacked planes the
     //   lumaExt, cbExt, and crExt fields should be used hold the extra 2-bits of
     //   precision while the luma, cb, and cr fields hold the 8-bit data.
+    // With semi_planar_input, cb holds the interleaved Cb Cr plane (NV12, P010)
+    //   with cbStride, cr is unused. Strides are in samples of the plane
+    //   element type, bytes for 8-bit and 16-bit words for 16-bit input.
     typedef struct EbSvtEncInput
     {
         // Hosts 8 bit or 16 bit input YUV420p / YUV420p10le
@@ -226,6 +231,20 @@ typedef struct EbSvtAv1EncConfiguration
      *
      * Default is 0. */
     uint32_t                 compressed_ten_bit_format;
+
+    /* Chroma of the input pictures in one plane of interleaved Cb Cr
+     * samples, NV12 for 8 bit and P010 for 10 bit input (with
+     * input_sample_shift 6). Not available with zero_copy_input.
+     *
+     * Default is 0. */
+    EbBool                   semi_planar_input;
+
+    /* Number of bits the samples of 16 bit input are shifted left within
+     * their 16 bit little-endian words, 0 for yuv420p10le and 6 for MSB
+     * aligned input such as P010. Only for 10 bit input.
+     *
+     * Default is 0. */
+    uint32_t                 input_sample_shift;
     /* Number of frames of sequence to be encoded. If number of frames is greater
      * than the number of frames in file, the encoder will loop to the beginning
      * and continue the encode.
@@ -363,6 +382,16 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is 0. */
     EbBool                   constrained_intra;
 
+    // Tiles
+    /* Log2 of the number of tile columns and tile rows the pictures are split
+     * in. The tiles are uniformly spaced in units of superblocks and coded
+     * independently of each other, so that a decoder can process them in
+     * parallel. The values are clamped to what the picture size allows.
+     *
+     * Default is 0. */
+    uint32_t                 tile_columns;
+    uint32_t                 tile_rows;
+
     // Rate Control
 
     /* Rate control mode.
@@ -453,9 +482,10 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is 0. */
     uint32_t                 level;
 
-    /* Assembly instruction set used by encoder.
+    /* Assembly instruction set used by encoder. The CPU is probed with
+    * CPUID, an SSE4.1 CPU at least is needed.
     *
-    * 0 = non-AVX2, C only.
+    * 0 = non-AVX2, kernels up to SSE4.2.
     * 1 = up to AVX512, auto-select highest assembly insturction set supported.
     *
     * Default is 1. */
@@ -483,6 +513,151 @@ typedef struct EbSvtAv1EncConfiguration
     int32_t                  injector_frame_rate;
     EbBool                   use_round_robin_thread_assignment;
 
+    /* Run every encoder process instance as a task on a shared pool of
+    * logical_processors work-stealing worker threads instead of one
+    * dedicated thread per process instance. A task waiting for a buffer
+    * gives its worker back to the other tasks.
+    *
+    * Default is 0. */
+    EbBool                   task_scheduler;
+
+    /* Number of logical processors the encoder is allowed to keep busy. The
+    * thread count of each process, the segment counts and the child picture
+    * control set pool are scaled from it, and it sets the number of task
+    * scheduler worker threads. Values above the number of logical processors
+    * of the system are clamped.
+    *
+    * 0 = all the logical processors of the system.
+    *
+    * Default is 0. */
+    uint32_t                 logical_processors;
+
+    /* Processor group (socket) the encoder threads run on, for dual socket
+    * systems.
+    *
+    * -1 = no restriction. Ignored when use_round_robin_thread_assignment is set.
+    *
+    * On Linux the socket is the NUMA node of the same index, the encoder
+    * threads are restricted to its processors and the encoder buffers are
+    * allocated on its memory.
+    *
+    * Default is -1. */
+    int32_t                  target_socket;
+
+    /* Linux only, list of logical processors the encoder threads are
+    * restricted to, such as "0-7,16-23". Overrides target_socket. The string
+    * has to stay valid until eb_init_encoder returns.
+    *
+    * NULL = no restriction.
+    *
+    * Default is NULL. */
+    const char              *processor_list;
+
+    /* Number of threads of each multi-instance process (number of tasks when
+    * task_scheduler is set), overriding the count derived from
+    * logical_processors.
+    *
+    * 0 = derived from logical_processors.
+    *
+    * Default is 0. */
+    uint32_t                 picture_analysis_threads;
+    uint32_t                 motion_estimation_threads;
+    uint32_t                 source_based_operations_threads;
+    uint32_t                 mode_decision_configuration_threads;
+    uint32_t                 enc_dec_threads;
+    uint32_t                 dlf_threads;
+    uint32_t                 cdef_threads;
+    uint32_t                 rest_threads;
+    uint32_t                 entropy_coding_threads;
+
+    /* Memory budget in MB for the picture control set, reference picture,
+    * input and output buffer pools. The pools are sized from the memory one
+    * picture takes at the configured resolution and bit depth, never below
+    * what the hierarchical levels and the look ahead distance need for the
+    * pipeline to keep running and never above the default sizes. Smaller
+    * pools shorten how far ahead of the encoding the input is buffered.
+    *
+    * 0 = default pool sizes.
+    *
+    * Default is 0. */
+    uint32_t                 memory_budget;
+
+    /* Start the pools and the inter-process fifos at the smallest size the
+    * pipeline needs and grow them on demand, when a process would otherwise
+    * wait for an object, up to the memory budget.
+    *
+    * Default is 0. */
+    EbBool                   elastic_pools;
+
+    /* Reference the planes of the input pictures in place instead of copying
+    * them in eb_svt_enc_send_picture. The planes have to follow the layout
+    * returned by eb_svt_enc_get_input_layout and stay valid until
+    * input_release_callback is called for the picture. The encoder writes the
+    * padding around the picture and may filter the picture samples (noise
+    * reduction). Only for 8 bit input.
+    *
+    * Default is 0. */
+    EbBool                   zero_copy_input;
+
+    /* Called from an encoder thread once the encoder no longer reads the
+    * planes of a picture sent with zero_copy_input, with
+    * input_release_context and the p_app_private and pts of its buffer
+    * header. Pictures still in the pipeline are released in
+    * eb_deinit_encoder. Must not call back into the encoder.
+    *
+    * Required with zero_copy_input. */
+    void                   (*input_release_callback)(
+        void                    *context,
+        void                    *p_app_private,
+        int64_t                  pts);
+    void                    *input_release_context;
+
+    /* Number of threads copying the input pictures in
+    * eb_svt_enc_send_picture, the calling thread included. Each picture is
+    * split in bands of at least 64 luma rows. Not used with zero_copy_input.
+    *
+    * 0 or 1 = the calling thread copies the whole picture.
+    *
+    * Default is 0. */
+    uint32_t                 input_copy_threads;
+
+    /* Initial size in bytes of the ring buffer the payloads of the output
+    * packets are written to. The ring grows when the packets the application
+    * holds fill it. The p_buffer of a packet is valid until the packet is
+    * released with eb_svt_release_out_buffer, n_alloc_len is n_filled_len.
+    * When the ring can not grow, the packet has no payload and its flags are
+    * EB_ENC_PACKETIZATION_ERROR6.
+    *
+    * 0 = the size of the largest packet at the configured resolution, else
+    * at least 65536.
+    *
+    * Default is 0. */
+    uint32_t                 packet_ring_size;
+
+    /* Deliver the output from the Packetization process instead of
+    * eb_svt_get_packet and eb_svt_get_recon, which then return
+    * EB_NoErrorEmptyQueue. packet_callback is called with each packet in
+    * decode order, the packet flagged EB_BUFFERFLAG_EOS last. With
+    * recon_enabled, recon_callback is called with each reconstructed picture,
+    * in the order the pictures finish, before the packet of the picture. The
+    * callbacks are called one at a time from an encoder thread, with
+    * output_callback_context. The application owns the buffer until it passes
+    * it to eb_svt_release_out_buffer, in the callback or later from any
+    * thread. A callback that blocks holds the encoder back, it must not send
+    * pictures or deinitialize the encoder.
+    *
+    * NULL = output through eb_svt_get_packet and eb_svt_get_recon.
+    *
+    * Default is NULL. */
+    void                   (*packet_callback)(
+        void                    *context,
+        EbBufferHeaderType      *p_buffer);
+    /* Required with packet_callback and recon_enabled. */
+    void                   (*recon_callback)(
+        void                    *context,
+        EbBufferHeaderType      *p_buffer);
+    void                    *output_callback_context;
+
     // Debug tools
 
     /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -491,9 +666,137 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is 0. */
     uint32_t                 recon_enabled;
 
+    /* Number of reconstructed pictures the encoder can output before the
+    * application takes them with eb_svt_get_recon or eb_svt_borrow_recon, and
+    * returns the borrowed ones. The encoder waits for a free picture once they
+    * are all in use.
+    *
+    * 0 = the number of reference pictures.
+    *
+    * Default is 0. */
+    uint32_t                 recon_buffer_count;
+
+    /* Path of a Chrome trace event file (chrome://tracing, Perfetto) the
+     * encoder writes at eb_deinit_encoder, with the process kernel iterations,
+     * EncDec segments and picture lifetimes of every library thread. The
+     * string has to stay valid until eb_init_encoder returns.
+     *
+     * NULL = no trace.
+     *
+     * Default is NULL. */
+    const char              *trace_file;
+
 } EbSvtAv1EncConfiguration;
 
 
+#define EB_MAX_PIPELINE_STAGES          16
+
+    /* Statistics of one process of the encoder pipeline (i.e. EncDec), summed
+    * over its threads since eb_init_encoder. Times are in microseconds. */
+    typedef struct EbSvtStageStats
+    {
+        // Process name
+        const char              *name;
+        uint32_t                 thread_count;
+
+        // Objects (pictures or segments) taken from the input queue
+        uint64_t                 processed_count;
+
+        // Time spent working on the objects
+        uint64_t                 active_time;
+
+        // Time spent waiting for the input queue, accounted once the wait
+        // ends
+        uint64_t                 input_blocked_time;
+
+        // Time spent waiting for an empty buffer from the next process
+        uint64_t                 output_blocked_time;
+
+        // Objects waiting in the input queue, now and at most
+        uint32_t                 queue_depth;
+        uint32_t                 max_queue_depth;
+    } EbSvtStageStats;
+
+    typedef struct EbSvtEncStats
+    {
+        // Time since eb_init_encoder in microseconds
+        uint64_t                 elapsed_time;
+
+        uint32_t                 stage_count;
+        EbSvtStageStats          stage_array[EB_MAX_PIPELINE_STAGES];
+    } EbSvtEncStats;
+
+    /* Layout of the input picture planes with zero_copy_input, in samples.
+    * The EbSvtEncInput plane pointers point to the top left sample of the
+    * picture. Each plane extends left_padding samples to the left and
+    * top_padding rows above it, and right_padding samples to the right and
+    * bot_padding rows below the width x height picture (half of each for the
+    * chroma planes). width and height are the source size rounded up to a
+    * multiple of 8. The first padding sample of each plane is aligned on
+    * alignment bytes.
+    *
+    * The encoder references up to max_pictures pictures at once, an
+    * application with fewer buffers may have to wait for input_release_callback
+    * before sending the next picture, and must have enough of them for the
+    * encoder to fill a mini GOP and its look ahead. */
+    typedef struct EbSvtInputLayout
+    {
+        uint32_t                 width;
+        uint32_t                 height;
+        uint32_t                 left_padding;
+        uint32_t                 right_padding;
+        uint32_t                 top_padding;
+        uint32_t                 bot_padding;
+
+        uint32_t                 y_stride;
+        uint32_t                 cb_stride;
+        uint32_t                 cr_stride;
+
+        uint32_t                 alignment;
+        uint32_t                 max_pictures;
+    } EbSvtInputLayout;
+
+    /* Planes of a reconstructed picture borrowed with eb_svt_borrow_recon, in
+    * the p_buffer of the picture. The width and height are the source ones,
+    * strides are in samples, bytes for 8-bit and 16-bit words for 10-bit. */
+    typedef struct EbSvtReconPlanes
+    {
+        uint8_t                 *luma;
+        uint8_t                 *cb;
+        uint8_t                 *cr;
+
+        uint32_t                 y_stride;
+        uint32_t                 cb_stride;
+        uint32_t                 cr_stride;
+
+        uint32_t                 width;
+        uint32_t                 height;
+    } EbSvtReconPlanes;
+
+#define EB_RATE_CONTROL_UPDATE_TARGET_BIT_RATE  0x00000001  // target_bit_rate
+#define EB_RATE_CONTROL_UPDATE_QP               0x00000002  // qp
+#define EB_RATE_CONTROL_UPDATE_QP_RANGE         0x00000004  // max_qp_allowed and min_qp_allowed
+#define EB_RATE_CONTROL_UPDATE_INTRA_PERIOD     0x00000008  // intra_period_length
+
+    /* Rate control settings applied with eb_svt_enc_update_rate_control from
+    * the input picture picture_number on (0 being the first picture sent).
+    * Only the settings selected by flags change, they have the meaning and
+    * ranges of the EbSvtAv1EncConfiguration fields: target_bit_rate and the
+    * QP range apply with rate_control_mode 1, qp with rate_control_mode 0.
+    * A new intra_period_length restarts the intra period at picture_number,
+    * which is coded as an intra picture. */
+    typedef struct EbSvtRateControlUpdate
+    {
+        uint64_t                 picture_number;
+        uint32_t                 flags;
+
+        uint32_t                 target_bit_rate;
+        uint32_t                 qp;
+        uint32_t                 max_qp_allowed;
+        uint32_t                 min_qp_allowed;
+        int32_t                  intra_period_length;
+    } EbSvtRateControlUpdate;
+
     /* STEP 1: Call the library to construct a Component Handle.
      *
      * Parameter:
@@ -541,7 +844,20 @@ typedef struct EbSvtAv1EncConfiguration
         EbComponentType           *svt_enc_component,
         EbBufferHeaderType       **output_stream_ptr);
 
+    /* OPTIONAL: Get the layout the input picture planes need with
+     * zero_copy_input, once the encoder is initialized.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *layout             Input picture layout. */
+    EB_API EbErrorType eb_svt_enc_get_input_layout(
+        EbComponentType      *svt_enc_component,
+        EbSvtInputLayout     *layout);
+
     /* STEP 4: Send the picture.
+     *
+     * Returns EB_ErrorBadParameter when the planes do not follow the layout
+     * of eb_svt_enc_get_input_layout with zero_copy_input.
      *
      * Parameter:
      * @ *svt_enc_component  Encoder handler.
@@ -564,7 +880,8 @@ typedef struct EbSvtAv1EncConfiguration
     /* STEP 5-1: Release output buffer back into the pool.
      *
      * Parameter:
-     * @ **p_buffer          Header pointer that contains the output packet to be released. */
+     * @ **p_buffer          Header pointer that contains the output packet, or the
+     *                       reconstructed picture passed to recon_callback, to be released. */
     EB_API void eb_svt_release_out_buffer(
         EbBufferHeaderType  **p_buffer);
 
@@ -577,6 +894,54 @@ typedef struct EbSvtAv1EncConfiguration
         EbComponentType      *svt_enc_component,
         EbBufferHeaderType   *p_buffer);
 
+    /* OPTIONAL: Borrow the next reconstructed picture in place, instead of
+     * copying it with eb_svt_get_recon. The picture is held until it is
+     * returned with eb_svt_release_out_buffer, the encoder waits once it has
+     * recon_buffer_count pictures out. Non-blocking call, returns
+     * EB_NoErrorEmptyQueue when no picture is ready.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ **p_buffer          Header pointer to return the picture with.
+     * @ *planes             Planes of the picture, can be NULL. */
+    EB_API EbErrorType eb_svt_borrow_recon(
+        EbComponentType      *svt_enc_component,
+        EbBufferHeaderType  **p_buffer,
+        EbSvtReconPlanes     *planes);
+
+    /* OPTIONAL: Change the rate control settings from an input picture on,
+    * while encoding. An update for a picture already sent applies from the
+    * next picture sent. Returns EB_ErrorBadParameter for settings out of
+    * range, or an intra_period_length change with an intra period of -1, and
+    * EB_ErrorInsufficientResources when too many updates are pending.
+    *
+    * Parameter:
+    * @ *svt_enc_component  Encoder handler.
+    * @ *update             Settings to apply, copied to the library. */
+    EB_API EbErrorType eb_svt_enc_update_rate_control(
+        EbComponentType          *svt_enc_component,
+        EbSvtRateControlUpdate   *update);
+
+    /* OPTIONAL: Get the statistics of each process of the encoder pipeline,
+     * to find the bottleneck stage and size the thread and segment counts.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *stats              Statistics since eb_init_encoder. */
+    EB_API EbErrorType eb_svt_get_stats(
+        EbComponentType      *svt_enc_component,
+        EbSvtEncStats        *stats);
+
+    /* OPTIONAL: Restrict the calling thread to a list of logical processors,
+     * parsed like processor_list, i.e. to keep the application thread feeding
+     * the encoder next to the encoder threads. Returns EB_ErrorBadParameter
+     * for a malformed list. Linux only, does nothing on the other platforms.
+     *
+     * Parameter:
+     * @ *processor_list     Processor ranges such as "0-7,16-23". */
+    EB_API EbErrorType eb_svt_assign_thread_affinity(
+        const char           *processor_list);
+
     /* STEP 6: Deinitialize encoder library.
      *
      * Parameter:
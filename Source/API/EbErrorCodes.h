@@ -160,6 +160,7 @@ extern "C" {
         EB_ENC_PACKETIZATION_ERROR3 = 0x1202,
         EB_ENC_PACKETIZATION_ERROR4 = 0x1203,
         EB_ENC_PACKETIZATION_ERROR5 = 0x1204,
+        EB_ENC_PACKETIZATION_ERROR6 = 0x1205,
 
         //EB_ENC_PM_ERRORS                  = 0x1300,
         EB_ENC_PM_ERROR0 = 0x1300,
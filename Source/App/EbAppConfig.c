@@ -9,6 +9,8 @@
 
 #include "EbAppConfig.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputReader.h"
+#include "EbAppOutputWriter.h"
 
 #ifdef _WIN32
 #else
@@ -31,6 +33,8 @@
 #define HEIGHT_TOKEN                    "-h"
 #define NUMBER_OF_PICTURES_TOKEN        "-n"
 #define BUFFERED_INPUT_TOKEN            "-nb"
+#define INPUT_READER_TOKEN              "-input-reader"
+#define PREFETCH_FRAMES_TOKEN           "-prefetch"
 #define BASE_LAYER_SWITCH_MODE_TOKEN    "-base-layer-switch-mode" // no Eval
 #define QP_TOKEN                        "-q"
 #define USE_QP_FILE_TOKEN               "-use-q-file"
@@ -75,6 +79,8 @@
 
 #define CONSTRAINED_INTRA_ENABLE_TOKEN  "-constrd-intra"
 #define IMPROVE_SHARPNESS_TOKEN         "-sharp"
+#define TILE_COLUMNS_TOKEN              "-tile-columns"
+#define TILE_ROWS_TOKEN                 "-tile-rows"
 #define HDR_INPUT_TOKEN                 "-hdr"
 #define ACCESS_UNIT_DELM_TOKEN          "-ua-delm"   // no Eval
 #define BUFF_PERIOD_TOKEN               "-pbuff"     // no Eval
@@ -95,7 +101,26 @@
 #define SPEED_CONTROL_TOKEN             "-speed-ctrl"
 #define ASM_TYPE_TOKEN                  "-asm"
 #define RR_THREAD_MGMNT                    "-rr"
+#define THREAD_MGMNT                    "-lp"
+#define TASK_SCHEDULER_TOKEN            "-task-sched"
+#define MEMORY_BUDGET_TOKEN             "-mem-budget"
+#define ELASTIC_POOLS_TOKEN             "-elastic-pools"
+#define PACKET_RING_SIZE_TOKEN          "-packet-ring"
+#define INPUT_COPY_THREADS_TOKEN        "-input-copy-threads"
+#define RECON_BUFFER_COUNT_TOKEN        "-recon-buffers"
+#define STAGE_STATS_TOKEN               "-stage-stats"
+#define TRACE_FILE_TOKEN                "-trace-file"
 #define TARGET_SOCKET                    "-ss"
+#define PROCESSOR_LIST_TOKEN            "-pin"
+#define PA_THREADS_TOKEN                "-pa-threads"
+#define ME_THREADS_TOKEN                "-me-threads"
+#define SBO_THREADS_TOKEN               "-sbo-threads"
+#define MDC_THREADS_TOKEN               "-mdc-threads"
+#define ED_THREADS_TOKEN                "-ed-threads"
+#define DLF_THREADS_TOKEN               "-dlf-threads"
+#define CDEF_THREADS_TOKEN              "-cdef-threads"
+#define REST_THREADS_TOKEN              "-rest-threads"
+#define EC_THREADS_TOKEN                "-ec-threads"
 #define CONFIG_FILE_COMMENT_CHAR    '#'
 #define CONFIG_FILE_NEWLINE_CHAR    '\n'
 #define CONFIG_FILE_RETURN_CHAR     '\r'
@@ -163,6 +188,8 @@ static void SetSeperateFields                   (const char *value, EbConfig_t *
 static void SetCfgSourceHeight                  (const char *value, EbConfig_t *cfg) {cfg->sourceHeight = strtoul(value, NULL, 0) >> cfg->separateFields;};
 static void SetCfgFramesToBeEncoded             (const char *value, EbConfig_t *cfg) {cfg->framesToBeEncoded = strtol(value,  NULL, 0) << cfg->separateFields;};
 static void SetBufferedInput                    (const char *value, EbConfig_t *cfg) {cfg->bufferedInput = (strtol(value, NULL, 0) != -1 && cfg->separateFields) ? strtol(value, NULL, 0) << cfg->separateFields : strtol(value, NULL, 0);};
+static void SetInputReader                      (const char *value, EbConfig_t *cfg) {cfg->inputReaderMode = strtoul(value, NULL, 0);};
+static void SetPrefetchFrames                   (const char *value, EbConfig_t *cfg) {cfg->prefetchFrames = strtoul(value, NULL, 0);};
 static void SetFrameRate                        (const char *value, EbConfig_t *cfg) {
     cfg->frameRate = strtoul(value, NULL, 0);
     if (cfg->frameRate > 1000 ){
@@ -214,6 +241,8 @@ static void SetHmeLevel2SearchAreaInWidthArray  (const char *value, EbConfig_t *
 static void SetHmeLevel2SearchAreaInHeightArray (const char *value, EbConfig_t *cfg) {cfg->hmeLevel2SearchAreaInHeightArray[cfg->hmeLevel2RowIndex++] = strtoul(value, NULL, 0);};
 static void SetEnableConstrainedIntra           (const char *value, EbConfig_t *cfg) {cfg->constrained_intra                                             = (EbBool)strtoul(value, NULL, 0);};
 static void SetImproveSharpness                 (const char *value, EbConfig_t *cfg) {cfg->improve_sharpness               = (EbBool)strtol(value,  NULL, 0);};
+static void SetTileColumns                      (const char *value, EbConfig_t *cfg) {cfg->tile_columns                    = strtoul(value, NULL, 0);};
+static void SetTileRows                         (const char *value, EbConfig_t *cfg) {cfg->tile_rows                       = strtoul(value, NULL, 0);};
 static void SetHighDynamicRangeInput            (const char *value, EbConfig_t *cfg) {cfg->high_dynamic_range_input            = strtol(value,  NULL, 0);};
 static void SetAccessUnitDelimiter              (const char *value, EbConfig_t *cfg) {cfg->access_unit_delimiter              = strtol(value,  NULL, 0);};
 static void SetBufferingPeriodSEI               (const char *value, EbConfig_t *cfg) {cfg->buffering_period_sei               = strtol(value,  NULL, 0);};
@@ -244,6 +273,39 @@ static void SetInjectorFrameRate                (const char *value, EbConfig_t *
 static void SetLatencyMode                      (const char *value, EbConfig_t *cfg)  {cfg->latencyMode               = (uint8_t)strtol(value, NULL, 0);};
 static void SetAsmType                          (const char *value, EbConfig_t *cfg)  {cfg->asmType                  = (uint32_t)strtoul(value, NULL, 0);};
 static void SetTargetSocket                     (const char *value, EbConfig_t *cfg)  {cfg->targetSocket              = (int32_t)strtol(value, NULL, 0);};
+static void SetProcessorList                    (const char *value, EbConfig_t *cfg)
+{
+    size_t size = strlen(value) + 1;
+
+    if (cfg->processorList) { free(cfg->processorList); }
+    cfg->processorList = (char*)malloc(size);
+    if (cfg->processorList) { EB_STRCPY(cfg->processorList, size, value); }
+};
+static void SetLogicalProcessors                (const char *value, EbConfig_t *cfg)  {cfg->logicalProcessors         = (uint32_t)strtoul(value, NULL, 0);};
+static void SetTaskScheduler                    (const char *value, EbConfig_t *cfg)  {cfg->taskScheduler             = (EbBool)strtoul(value, NULL, 0);};
+static void SetMemoryBudget                     (const char *value, EbConfig_t *cfg)  {cfg->memoryBudget              = (uint32_t)strtoul(value, NULL, 0);};
+static void SetElasticPools                     (const char *value, EbConfig_t *cfg)  {cfg->elasticPools              = (EbBool)strtoul(value, NULL, 0);};
+static void SetPacketRingSize                   (const char *value, EbConfig_t *cfg)  {cfg->packetRingSize            = (uint32_t)strtoul(value, NULL, 0);};
+static void SetInputCopyThreads                 (const char *value, EbConfig_t *cfg)  {cfg->inputCopyThreads          = (uint32_t)strtoul(value, NULL, 0);};
+static void SetReconBufferCount                 (const char *value, EbConfig_t *cfg)  {cfg->reconBufferCount          = (uint32_t)strtoul(value, NULL, 0);};
+static void SetStageStats                       (const char *value, EbConfig_t *cfg)  {cfg->stageStats                = (EbBool)strtoul(value, NULL, 0);};
+static void SetTraceFile                        (const char *value, EbConfig_t *cfg)
+{
+    size_t size = strlen(value) + 1;
+
+    if (cfg->traceFile) { free(cfg->traceFile); }
+    cfg->traceFile = (char*)malloc(size);
+    if (cfg->traceFile) { EB_STRCPY(cfg->traceFile, size, value); }
+};
+static void SetPictureAnalysisThreads           (const char *value, EbConfig_t *cfg)  {cfg->pictureAnalysisThreads          = (uint32_t)strtoul(value, NULL, 0);};
+static void SetMotionEstimationThreads          (const char *value, EbConfig_t *cfg)  {cfg->motionEstimationThreads         = (uint32_t)strtoul(value, NULL, 0);};
+static void SetSourceBasedOperationsThreads     (const char *value, EbConfig_t *cfg)  {cfg->sourceBasedOperationsThreads    = (uint32_t)strtoul(value, NULL, 0);};
+static void SetModeDecisionConfigurationThreads (const char *value, EbConfig_t *cfg)  {cfg->modeDecisionConfigurationThreads = (uint32_t)strtoul(value, NULL, 0);};
+static void SetEncDecThreads                    (const char *value, EbConfig_t *cfg)  {cfg->encDecThreads                   = (uint32_t)strtoul(value, NULL, 0);};
+static void SetDlfThreads                       (const char *value, EbConfig_t *cfg)  {cfg->dlfThreads                      = (uint32_t)strtoul(value, NULL, 0);};
+static void SetCdefThreads                      (const char *value, EbConfig_t *cfg)  {cfg->cdefThreads                     = (uint32_t)strtoul(value, NULL, 0);};
+static void SetRestThreads                      (const char *value, EbConfig_t *cfg)  {cfg->restThreads                     = (uint32_t)strtoul(value, NULL, 0);};
+static void SetEntropyCodingThreads             (const char *value, EbConfig_t *cfg)  {cfg->entropyCodingThreads            = (uint32_t)strtoul(value, NULL, 0);};
 
 enum cfg_type{
     SINGLE_INPUT,   // Configuration parameters that have only 1 value input
@@ -283,6 +345,8 @@ config_entry_t config_entry[] = {
     // Prediction Structure
     { SINGLE_INPUT, NUMBER_OF_PICTURES_TOKEN, "FrameToBeEncoded", SetCfgFramesToBeEncoded },
     { SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "BufferedInput", SetBufferedInput },
+    { SINGLE_INPUT, INPUT_READER_TOKEN, "InputReader", SetInputReader },
+    { SINGLE_INPUT, PREFETCH_FRAMES_TOKEN, "PrefetchFrames", SetPrefetchFrames },
     { SINGLE_INPUT, BASE_LAYER_SWITCH_MODE_TOKEN, "BaseLayerSwitchMode", SetBaseLayerSwitchMode },
     { SINGLE_INPUT, ENCMODE_TOKEN, "EncoderMode", SetencMode},
     { SINGLE_INPUT, INTRA_PERIOD_TOKEN, "IntraPeriod", SetCfgIntraPeriod },
@@ -333,9 +397,31 @@ config_entry_t config_entry[] = {
     // MD Parameters
     { SINGLE_INPUT, CONSTRAINED_INTRA_ENABLE_TOKEN, "ConstrainedIntra", SetEnableConstrainedIntra},
 
+    // Tiles
+    { SINGLE_INPUT, TILE_COLUMNS_TOKEN, "TileColumns", SetTileColumns },
+    { SINGLE_INPUT, TILE_ROWS_TOKEN, "TileRows", SetTileRows },
+
     // Thread Management
-//    { SINGLE_INPUT, THREAD_MGMNT, "logicalProcessors", SetLogicalProcessors },
+    { SINGLE_INPUT, THREAD_MGMNT, "LogicalProcessors", SetLogicalProcessors },
+    { SINGLE_INPUT, TASK_SCHEDULER_TOKEN, "TaskScheduler", SetTaskScheduler },
+    { SINGLE_INPUT, MEMORY_BUDGET_TOKEN, "MemoryBudget", SetMemoryBudget },
+    { SINGLE_INPUT, ELASTIC_POOLS_TOKEN, "ElasticPools", SetElasticPools },
+    { SINGLE_INPUT, PACKET_RING_SIZE_TOKEN, "PacketRingSize", SetPacketRingSize },
+    { SINGLE_INPUT, INPUT_COPY_THREADS_TOKEN, "InputCopyThreads", SetInputCopyThreads },
+    { SINGLE_INPUT, RECON_BUFFER_COUNT_TOKEN, "ReconBufferCount", SetReconBufferCount },
+    { SINGLE_INPUT, STAGE_STATS_TOKEN, "StageStats", SetStageStats },
+    { SINGLE_INPUT, TRACE_FILE_TOKEN, "TraceFile", SetTraceFile },
     { SINGLE_INPUT, TARGET_SOCKET, "TargetSocket", SetTargetSocket },
+    { SINGLE_INPUT, PROCESSOR_LIST_TOKEN, "ProcessorList", SetProcessorList },
+    { SINGLE_INPUT, PA_THREADS_TOKEN, "PictureAnalysisThreads", SetPictureAnalysisThreads },
+    { SINGLE_INPUT, ME_THREADS_TOKEN, "MotionEstimationThreads", SetMotionEstimationThreads },
+    { SINGLE_INPUT, SBO_THREADS_TOKEN, "SourceBasedOperationsThreads", SetSourceBasedOperationsThreads },
+    { SINGLE_INPUT, MDC_THREADS_TOKEN, "ModeDecisionConfigurationThreads", SetModeDecisionConfigurationThreads },
+    { SINGLE_INPUT, ED_THREADS_TOKEN, "EncDecThreads", SetEncDecThreads },
+    { SINGLE_INPUT, DLF_THREADS_TOKEN, "DlfThreads", SetDlfThreads },
+    { SINGLE_INPUT, CDEF_THREADS_TOKEN, "CdefThreads", SetCdefThreads },
+    { SINGLE_INPUT, REST_THREADS_TOKEN, "RestThreads", SetRestThreads },
+    { SINGLE_INPUT, EC_THREADS_TOKEN, "EntropyCodingThreads", SetEntropyCodingThreads },
 
     // Optional Features
 
@@ -400,6 +486,10 @@ void EbConfigCtor(EbConfig_t *config_ptr)
     config_ptr->framesToBeEncoded                    = 0;
     config_ptr->bufferedInput                        = -1;
     config_ptr->sequenceBuffer                       = 0;
+    config_ptr->inputReaderMode                      = INPUT_READER_STDIO;
+    config_ptr->prefetchFrames                       = 8;
+    config_ptr->inputReader                          = NULL;
+    config_ptr->outputWriter                         = NULL;
     config_ptr->latencyMode                          = 0;
 
     // Interlaced Video
@@ -454,6 +544,8 @@ void EbConfigCtor(EbConfig_t *config_ptr)
     config_ptr->hmeLevel2SearchAreaInHeightArray[0]  = 1;
     config_ptr->hmeLevel2SearchAreaInHeightArray[1]  = 1;
     config_ptr->constrained_intra                    = 0;
+    config_ptr->tile_columns                         = 0;
+    config_ptr->tile_rows                            = 0;
     config_ptr->film_grain_denoise_strength          = 0;
 
     // Thresholds
@@ -500,12 +592,33 @@ void EbConfigCtor(EbConfig_t *config_ptr)
     config_ptr->performanceContext.maxLatency        = 0;
     config_ptr->performanceContext.totalLatency      = 0;
     config_ptr->performanceContext.byteCount         = 0;
+    config_ptr->performanceContext.maxOutputQueueCount = 0;
+    config_ptr->performanceContext.maxOutputQueueSize  = 0;
 
     // ASM Type
     config_ptr->asmType                              = 1;
 
     config_ptr->stopEncoder                          = 0;
-    config_ptr->targetSocket                         = 1;
+    config_ptr->targetSocket                         = -1;
+    config_ptr->processorList                        = (char *)NULL;
+    config_ptr->logicalProcessors                    = 0;
+    config_ptr->taskScheduler                        = EB_FALSE;
+    config_ptr->memoryBudget                         = 0;
+    config_ptr->elasticPools                         = EB_FALSE;
+    config_ptr->packetRingSize                       = 0;
+    config_ptr->inputCopyThreads                     = 0;
+    config_ptr->reconBufferCount                     = 0;
+    config_ptr->stageStats                           = EB_FALSE;
+    config_ptr->traceFile                            = (char *)NULL;
+    config_ptr->pictureAnalysisThreads               = 0;
+    config_ptr->motionEstimationThreads              = 0;
+    config_ptr->sourceBasedOperationsThreads         = 0;
+    config_ptr->modeDecisionConfigurationThreads     = 0;
+    config_ptr->encDecThreads                        = 0;
+    config_ptr->dlfThreads                           = 0;
+    config_ptr->cdefThreads                          = 0;
+    config_ptr->restThreads                          = 0;
+    config_ptr->entropyCodingThreads                 = 0;
     config_ptr->processedFrameCount                  = 0;
     config_ptr->processedByteCount                   = 0;
 
@@ -524,11 +637,17 @@ void EbConfigDtor(EbConfig_t *config_ptr)
         config_ptr->configFile = (FILE *) NULL;
     }
 
+    // Stop reading before the input is closed
+    InputReaderDtor(config_ptr);
+
     if (config_ptr->inputFile) {
         if (config_ptr->inputFile != stdin) fclose(config_ptr->inputFile);
         config_ptr->inputFile = (FILE *) NULL;
     }
 
+    // Write the queued output before the files are closed
+    OutputWriterDtor(config_ptr);
+
     if (config_ptr->bitstreamFile) {
         fclose(config_ptr->bitstreamFile);
         config_ptr->bitstreamFile = (FILE *) NULL;
@@ -549,6 +668,16 @@ void EbConfigDtor(EbConfig_t *config_ptr)
         config_ptr->qpFile = (FILE *)NULL;
     }
 
+    if (config_ptr->processorList) {
+        free(config_ptr->processorList);
+        config_ptr->processorList = (char *)NULL;
+    }
+
+    if (config_ptr->traceFile) {
+        free(config_ptr->traceFile);
+        config_ptr->traceFile = (char *)NULL;
+    }
+
     return;
 }
 
@@ -788,6 +917,16 @@ static EbErrorType VerifySettings(EbConfig_t *config, uint32_t channelNumber)
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->inputReaderMode > INPUT_READER_THREAD) {
+        fprintf(config->errorLogFile, "Error instance %u: Invalid InputReader [0 - 2]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->prefetchFrames == 0 || config->prefetchFrames > INPUT_READER_MAX_PREFETCH) {
+        fprintf(config->errorLogFile, "Error instance %u: Invalid PrefetchFrames [1 - %u]\n", channelNumber + 1, INPUT_READER_MAX_PREFETCH);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->use_qp_file == EB_TRUE && config->qpFile == NULL) {
         fprintf(config->errorLogFile, "Error instance %u: Could not find QP file, UseQpFile is set to 1\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
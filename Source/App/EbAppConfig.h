@@ -201,6 +201,9 @@ typedef struct EbPerformanceContext_s {
 
     uint64_t                  byteCount;
 
+    uint32_t                  maxOutputQueueCount;     // high-water mark of the output writer queue
+    uint64_t                  maxOutputQueueSize;
+
 }EbPerformanceContext_t;
 
 typedef struct EbConfig_s
@@ -240,6 +243,10 @@ typedef struct EbConfig_s
     int32_t                  framesEncoded;
     int32_t                  bufferedInput;
     uint8_t                **sequenceBuffer;
+    uint32_t                 inputReaderMode;
+    uint32_t                 prefetchFrames;
+    struct EbInputReader_s  *inputReader;
+    struct EbOutputWriter_s *outputWriter;
 
     uint8_t                  latencyMode;
 
@@ -321,6 +328,11 @@ typedef struct EbConfig_s
      ****************************************/
     EbBool                  constrained_intra;
 
+    /****************************************
+     * Tiles
+     ****************************************/
+    uint32_t                 tile_columns;
+    uint32_t                 tile_rows;
 
     /****************************************
      * Rate Control
@@ -376,6 +388,24 @@ typedef struct EbConfig_s
     uint32_t                active_channel_count;
     uint32_t                logicalProcessors;
     int32_t                 targetSocket;
+    char                   *processorList;
+    EbBool                  taskScheduler;
+    uint32_t                memoryBudget;
+    EbBool                  elasticPools;
+    uint32_t                packetRingSize;
+    uint32_t                inputCopyThreads;
+    uint32_t                reconBufferCount;
+    EbBool                  stageStats;
+    char                   *traceFile;
+    uint32_t                pictureAnalysisThreads;
+    uint32_t                motionEstimationThreads;
+    uint32_t                sourceBasedOperationsThreads;
+    uint32_t                modeDecisionConfigurationThreads;
+    uint32_t                encDecThreads;
+    uint32_t                dlfThreads;
+    uint32_t                cdefThreads;
+    uint32_t                restThreads;
+    uint32_t                entropyCodingThreads;
     EbBool                 stopEncoder;         // to signal CTRL+C Event, need to stop encoding.
 
     uint64_t                processedFrameCount;
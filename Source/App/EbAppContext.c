@@ -11,6 +11,8 @@
 
 #include "EbAppContext.h"
 #include "EbAppConfig.h"
+#include "EbAppInputReader.h"
+#include "EbAppOutputWriter.h"
 
 
 #define INPUT_SIZE_576p_TH                0x90000        // 0.58 Million
@@ -197,6 +199,8 @@ EbErrorType CopyConfigurationParameters(
     callbackData->ebEncParameters.hme_level0_total_search_area_width = config->hmeLevel0TotalSearchAreaWidth;
     callbackData->ebEncParameters.hme_level0_total_search_area_height = config->hmeLevel0TotalSearchAreaHeight;
     callbackData->ebEncParameters.constrained_intra = (EbBool)config->constrained_intra;
+    callbackData->ebEncParameters.tile_columns = config->tile_columns;
+    callbackData->ebEncParameters.tile_rows = config->tile_rows;
     callbackData->ebEncParameters.channel_id = config->channel_id;
     callbackData->ebEncParameters.active_channel_count = config->active_channel_count;
     callbackData->ebEncParameters.improve_sharpness = (uint8_t)config->improve_sharpness;
@@ -216,7 +220,26 @@ EbErrorType CopyConfigurationParameters(
     callbackData->ebEncParameters.injector_frame_rate = config->injector_frame_rate;
     callbackData->ebEncParameters.speed_control_flag = config->speed_control_flag;
     callbackData->ebEncParameters.asm_type = config->asmType;
+    callbackData->ebEncParameters.task_scheduler = config->taskScheduler;
+    callbackData->ebEncParameters.memory_budget = config->memoryBudget;
+    callbackData->ebEncParameters.elastic_pools = config->elasticPools;
+    callbackData->ebEncParameters.packet_ring_size = config->packetRingSize;
+    callbackData->ebEncParameters.input_copy_threads = config->inputCopyThreads;
+    callbackData->ebEncParameters.recon_buffer_count = config->reconBufferCount;
+    callbackData->ebEncParameters.logical_processors = config->logicalProcessors;
+    callbackData->ebEncParameters.target_socket = config->targetSocket;
+    callbackData->ebEncParameters.processor_list = config->processorList;
+    callbackData->ebEncParameters.picture_analysis_threads = config->pictureAnalysisThreads;
+    callbackData->ebEncParameters.motion_estimation_threads = config->motionEstimationThreads;
+    callbackData->ebEncParameters.source_based_operations_threads = config->sourceBasedOperationsThreads;
+    callbackData->ebEncParameters.mode_decision_configuration_threads = config->modeDecisionConfigurationThreads;
+    callbackData->ebEncParameters.enc_dec_threads = config->encDecThreads;
+    callbackData->ebEncParameters.dlf_threads = config->dlfThreads;
+    callbackData->ebEncParameters.cdef_threads = config->cdefThreads;
+    callbackData->ebEncParameters.rest_threads = config->restThreads;
+    callbackData->ebEncParameters.entropy_coding_threads = config->entropyCodingThreads;
     callbackData->ebEncParameters.recon_enabled = config->reconFile ? EB_TRUE : EB_FALSE;
+    callbackData->ebEncParameters.trace_file = config->traceFile;
 
     for (hmeRegionIndex = 0; hmeRegionIndex < callbackData->ebEncParameters.number_hme_search_region_in_width; ++hmeRegionIndex) {
         callbackData->ebEncParameters.hme_level0_search_area_in_width_array[hmeRegionIndex] = config->hmeLevel0SearchAreaInWidthArray[hmeRegionIndex];
@@ -317,7 +340,7 @@ EbErrorType AllocateInputBuffers(
 
         EB_APP_MALLOC(uint8_t*, callbackData->inputBufferPool->p_buffer, sizeof(EbSvtEncInput), EB_N_PTR, EB_ErrorInsufficientResources);
 
-        if (config->bufferedInput == -1) {
+        if (config->bufferedInput == -1 && config->inputReader == NULL) {
 
             // Allocate frame buffer for the p_buffer
             AllocateFrameBuffer(
@@ -332,33 +355,6 @@ EbErrorType AllocateInputBuffers(
 
     return return_error;
 }
-EbErrorType AllocateOutputReconBuffers(
-    EbConfig_t                *config,
-    EbAppContext_t            *callbackData)
-{
-
-    EbErrorType   return_error = EB_ErrorNone;
-    const size_t lumaSize =
-        config->inputPaddedWidth    *
-        config->inputPaddedHeight;
-    // both u and v
-    const size_t chromaSize = lumaSize >> 1;
-    const size_t tenBit = (config->encoderBitDepth > 8);
-    const size_t frameSize = (lumaSize + chromaSize) << tenBit;
-
-// ... Recon Port
-    EB_APP_MALLOC(EbBufferHeaderType*, callbackData->reconBuffer, sizeof(EbBufferHeaderType), EB_N_PTR, EB_ErrorInsufficientResources);
-
-    // Initialize Header
-    callbackData->reconBuffer->size = sizeof(EbBufferHeaderType);
-
-    EB_APP_MALLOC(uint8_t*, callbackData->reconBuffer->p_buffer, frameSize, EB_N_PTR, EB_ErrorInsufficientResources);
-
-    callbackData->reconBuffer->n_alloc_len = (uint32_t)frameSize;
-    callbackData->reconBuffer->p_app_private = NULL;
-    return return_error;
-}
-
 EbErrorType AllocateOutputBuffers(
     EbConfig_t                *config,
     EbAppContext_t            *callbackData)
@@ -613,17 +609,24 @@ EbErrorType InitEncoder(
 
     ///********************** APPLICATION INIT [START] ******************///
 
-    // STEP 6: Allocate input buffers carrying the yuv frames in
-    return_error = AllocateInputBuffers(
-        config,
-        callbackData);
+    // Start the input reader, its frames are the input buffers
+    return_error = InputReaderCtor(
+        config);
 
     if (return_error != EB_ErrorNone) {
         return return_error;
     }
 
-    // STEP 7: Allocate output buffers carrying the bitstream out
-    return_error = AllocateOutputBuffers(
+    // Start the thread writing the bitstream and recon files
+    return_error = OutputWriterCtor(
+        config);
+
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+
+    // STEP 6: Allocate input buffers carrying the yuv frames in
+    return_error = AllocateInputBuffers(
         config,
         callbackData);
 
@@ -631,8 +634,8 @@ EbErrorType InitEncoder(
         return return_error;
     }
 
-    // STEP 8: Allocate output Recon Buffer
-    return_error = AllocateOutputReconBuffers(
+    // STEP 7: Allocate output buffers carrying the bitstream out
+    return_error = AllocateOutputBuffers(
         config,
         callbackData);
 
@@ -28,7 +28,6 @@ typedef struct EbAppContext_s {
     // Buffer Pools
     EbBufferHeaderType                *inputBufferPool;
     EbBufferHeaderType                *streamBufferPool;
-    EbBufferHeaderType                *reconBuffer;
 
     // Instance Index
     uint8_t                            instanceIdx;
@@ -0,0 +1,524 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/***************************************
+ * Includes
+ ***************************************/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <Windows.h>
+#include <io.h>
+#else
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "EbAppInputReader.h"
+
+/***************************************
+ * Macros
+ ***************************************/
+#define YUV4MPEG2_IND_SIZE          9
+#define Y4M_LINE_MAX                256
+#define PIPE_READ_AHEAD_MAX         (16 << 20)
+
+#ifdef _WIN32
+#define READER_LOCK(r)              EnterCriticalSection(&(r)->lock)
+#define READER_UNLOCK(r)            LeaveCriticalSection(&(r)->lock)
+#define READER_WAIT(r, cond)        SleepConditionVariableCS(&(r)->cond, &(r)->lock, INFINITE)
+#define READER_SIGNAL(r, cond)      WakeConditionVariable(&(r)->cond)
+#else
+#define READER_LOCK(r)              pthread_mutex_lock(&(r)->lock)
+#define READER_UNLOCK(r)            pthread_mutex_unlock(&(r)->lock)
+#define READER_WAIT(r, cond)        pthread_cond_wait(&(r)->cond, &(r)->lock)
+#define READER_SIGNAL(r, cond)      pthread_cond_signal(&(r)->cond)
+#endif
+
+typedef struct EbInputReader_s {
+    uint32_t                 mode;
+    FILE                    *file;
+    EbBool                   y4m;
+    EbBool                   seekable;
+    uint32_t                 is16bit;
+    uint64_t                 lumaSize;
+    uint64_t                 frameSize;
+    uint64_t                 firstFrameOffset;
+    uint32_t                 prefetchFrames;
+
+    // Memory mapped file
+    uint8_t                 *mapPtr;
+    uint64_t                 mapSize;
+    uint64_t                 nextOffset;
+    uint64_t                 pageSize;
+#ifdef _WIN32
+    HANDLE                   mapHandle;
+#endif
+
+    // Reader thread, a ring of prefetchFrames frames
+    uint8_t                **frameArray;
+    uint32_t                 readIndex;
+    uint32_t                 writeIndex;
+    uint32_t                 fullCount;
+    EbBool                   endOfInput;
+    EbBool                   stop;
+    const unsigned char     *prefixPtr;         // first bytes of a pipe, already read
+    uint32_t                 prefixSize;
+    EbBool                   frameLineRead;     // FRAME line of the next frame of a pipe, already read
+#ifdef _WIN32
+    HANDLE                   threadHandle;
+    CRITICAL_SECTION         lock;
+    CONDITION_VARIABLE       notEmpty;
+    CONDITION_VARIABLE       notFull;
+#else
+    pthread_t                threadHandle;
+    pthread_mutex_t          lock;
+    pthread_cond_t           notEmpty;
+    pthread_cond_t           notFull;
+#endif
+} EbInputReader_t;
+
+/***************************************
+ * Helpers
+ ***************************************/
+static EbBool IsRegularFile(FILE *file)
+{
+#ifdef _WIN32
+    return GetFileType((HANDLE)_get_osfhandle(_fileno(file))) == FILE_TYPE_DISK ? EB_TRUE : EB_FALSE;
+#else
+    struct stat fileStat;
+
+    if (fstat(fileno(file), &fileStat) != 0)
+        return EB_FALSE;
+    return S_ISREG(fileStat.st_mode) ? EB_TRUE : EB_FALSE;
+#endif
+}
+
+// Skips a y4m header or FRAME line, EB_FALSE at the end of the input
+static EbBool SkipY4mLine(FILE *file)
+{
+    int32_t  c;
+    uint32_t length = 0;
+
+    do {
+        c = fgetc(file);
+        if (c == EOF)
+            return EB_FALSE;
+    } while (c != '\n' && ++length < Y4M_LINE_MAX);
+
+    return c == '\n' ? EB_TRUE : EB_FALSE;
+}
+
+/***************************************
+ * Memory mapped file
+ ***************************************/
+static EbErrorType MapInputFile(EbInputReader_t *reader)
+{
+    uint8_t *lineEnd;
+
+#ifdef _WIN32
+    HANDLE        fileHandle = (HANDLE)_get_osfhandle(_fileno(reader->file));
+    LARGE_INTEGER fileSize;
+    SYSTEM_INFO   systemInfo;
+
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        return EB_ErrorInsufficientResources;
+    reader->mapSize = (uint64_t)fileSize.QuadPart;
+    reader->mapHandle = CreateFileMapping(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (reader->mapHandle == NULL)
+        return EB_ErrorInsufficientResources;
+    reader->mapPtr = (uint8_t*)MapViewOfFile(reader->mapHandle, FILE_MAP_READ, 0, 0, 0);
+    if (reader->mapPtr == NULL) {
+        CloseHandle(reader->mapHandle);
+        return EB_ErrorInsufficientResources;
+    }
+    GetSystemInfo(&systemInfo);
+    reader->pageSize = systemInfo.dwPageSize;
+#else
+    struct stat fileStat;
+
+    if (fstat(fileno(reader->file), &fileStat) != 0 || fileStat.st_size == 0 || (uint64_t)fileStat.st_size != (uint64_t)(size_t)fileStat.st_size)
+        return EB_ErrorInsufficientResources;
+    reader->mapSize = (uint64_t)fileStat.st_size;
+    reader->mapPtr = (uint8_t*)mmap(NULL, (size_t)reader->mapSize, PROT_READ, MAP_PRIVATE, fileno(reader->file), 0);
+    if (reader->mapPtr == (uint8_t*)MAP_FAILED) {
+        reader->mapPtr = NULL;
+        return EB_ErrorInsufficientResources;
+    }
+    reader->pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+    madvise(reader->mapPtr, (size_t)reader->mapSize, MADV_SEQUENTIAL);
+#endif
+
+    // The frames of a y4m file follow the header line
+    reader->firstFrameOffset = 0;
+    if (reader->y4m) {
+        lineEnd = (uint8_t*)memchr(reader->mapPtr, '\n', (size_t)(reader->mapSize < Y4M_LINE_MAX ? reader->mapSize : Y4M_LINE_MAX));
+        if (lineEnd)
+            reader->firstFrameOffset = (uint64_t)(lineEnd - reader->mapPtr) + 1;
+    }
+    reader->nextOffset = reader->firstFrameOffset;
+
+    return EB_ErrorNone;
+}
+
+static void UnmapInputFile(EbInputReader_t *reader)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(reader->mapPtr);
+    CloseHandle(reader->mapHandle);
+#else
+    munmap(reader->mapPtr, (size_t)reader->mapSize);
+#endif
+}
+
+// Offset of the next complete frame of the mapping, loops to the first frame
+static EbBool NextMappedFrame(EbInputReader_t *reader, uint64_t *frameOffset)
+{
+    uint64_t offset = reader->nextOffset;
+    uint32_t pass;
+
+    for (pass = 0; pass < 2; ++pass) {
+        EbBool   found = EB_TRUE;
+
+        if (reader->y4m) {
+            uint64_t remaining = reader->mapSize - offset;
+            uint8_t *linePtr = reader->mapPtr + offset;
+            uint8_t *lineEnd = (remaining > 5 && !memcmp(linePtr, "FRAME", 5)) ?
+                (uint8_t*)memchr(linePtr, '\n', (size_t)(remaining < Y4M_LINE_MAX ? remaining : Y4M_LINE_MAX)) :
+                NULL;
+
+            if (lineEnd)
+                offset += (uint64_t)(lineEnd - linePtr) + 1;
+            else
+                found = EB_FALSE;
+        }
+
+        if (found && reader->mapSize - offset >= reader->frameSize) {
+            *frameOffset = offset;
+            reader->nextOffset = offset + reader->frameSize;
+            return EB_TRUE;
+        }
+
+        // End of the file, loop over again
+        offset = reader->firstFrameOffset;
+    }
+
+    return EB_FALSE;
+}
+
+/***************************************
+ * Reader thread
+ ***************************************/
+static EbBool ReadFrame(EbInputReader_t *reader, uint8_t *framePtr)
+{
+    uint32_t pass;
+
+    for (pass = 0; pass < 2; ++pass) {
+        if (!reader->y4m || reader->frameLineRead || SkipY4mLine(reader->file)) {
+            uint64_t prefixSize = reader->prefixSize;
+
+            reader->frameLineRead = EB_FALSE;
+
+            if (prefixSize) {
+                memcpy(framePtr, reader->prefixPtr, (size_t)prefixSize);
+                reader->prefixSize = 0;
+            }
+            if (fread(framePtr + prefixSize, 1, (size_t)(reader->frameSize - prefixSize), reader->file) == reader->frameSize - prefixSize)
+                return EB_TRUE;
+        }
+
+        // End of the input, loop over files
+        if (!reader->seekable)
+            return EB_FALSE;
+        fseeko64(reader->file, (long)reader->firstFrameOffset, SEEK_SET);
+    }
+
+    return EB_FALSE;
+}
+
+static void ReaderKernel(EbInputReader_t *reader)
+{
+    uint8_t *framePtr;
+    EbBool   frameRead;
+
+    for (;;) {
+        READER_LOCK(reader);
+        while (reader->fullCount == reader->prefetchFrames && !reader->stop)
+            READER_WAIT(reader, notFull);
+        if (reader->stop) {
+            READER_UNLOCK(reader);
+            return;
+        }
+        framePtr = reader->frameArray[reader->writeIndex];
+        READER_UNLOCK(reader);
+
+        frameRead = ReadFrame(reader, framePtr);
+
+        READER_LOCK(reader);
+        if (frameRead) {
+            reader->writeIndex = (reader->writeIndex + 1) % reader->prefetchFrames;
+            ++reader->fullCount;
+        }
+        else
+            reader->endOfInput = EB_TRUE;
+        READER_SIGNAL(reader, notEmpty);
+        READER_UNLOCK(reader);
+
+        if (!frameRead)
+            return;
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI ReaderThread(LPVOID context)
+{
+    ReaderKernel((EbInputReader_t*)context);
+    return 0;
+}
+#else
+static void* ReaderThread(void *context)
+{
+    ReaderKernel((EbInputReader_t*)context);
+    return NULL;
+}
+#endif
+
+static EbErrorType StartReaderThread(EbInputReader_t *reader, EbConfig_t *config)
+{
+    uint32_t frameIndex;
+
+    reader->frameArray = (uint8_t**)calloc(reader->prefetchFrames, sizeof(uint8_t*));
+    if (reader->frameArray == NULL)
+        return EB_ErrorInsufficientResources;
+    for (frameIndex = 0; frameIndex < reader->prefetchFrames; ++frameIndex) {
+        reader->frameArray[frameIndex] = (uint8_t*)malloc((size_t)reader->frameSize);
+        if (reader->frameArray[frameIndex] == NULL)
+            return EB_ErrorInsufficientResources;
+    }
+
+    if (reader->seekable) {
+        // Start from the first frame, the frame count was taken at the end of the file
+        fseeko64(reader->file, 0, SEEK_SET);
+        if (reader->y4m)
+            SkipY4mLine(reader->file);
+        reader->firstFrameOffset = (uint64_t)ftello64(reader->file);
+#if defined(POSIX_FADV_SEQUENTIAL)
+        posix_fadvise(fileno(reader->file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+    else {
+        // The y4m check read the first bytes of the pipe, the y4m header
+        //   parsing the FRAME line of the first frame
+        if (!reader->y4m) {
+            reader->prefixPtr = config->y4mBuf;
+            reader->prefixSize = YUV4MPEG2_IND_SIZE;
+        }
+        else
+            reader->frameLineRead = EB_TRUE;
+#if defined(F_SETPIPE_SZ)
+        {
+            // Let the writer of the pipe run ahead by up to a few frames
+            uint64_t pipeSize = reader->frameSize * reader->prefetchFrames;
+
+            if (pipeSize > PIPE_READ_AHEAD_MAX)
+                pipeSize = PIPE_READ_AHEAD_MAX;
+            while (pipeSize >= 65536 && fcntl(fileno(reader->file), F_SETPIPE_SZ, (int)pipeSize) < 0)
+                pipeSize >>= 1;
+        }
+#endif
+    }
+
+#ifdef _WIN32
+    InitializeCriticalSection(&reader->lock);
+    InitializeConditionVariable(&reader->notEmpty);
+    InitializeConditionVariable(&reader->notFull);
+    reader->threadHandle = CreateThread(NULL, 0, ReaderThread, reader, 0, NULL);
+    if (reader->threadHandle == NULL) {
+        DeleteCriticalSection(&reader->lock);
+        return EB_ErrorInsufficientResources;
+    }
+#else
+    pthread_mutex_init(&reader->lock, NULL);
+    pthread_cond_init(&reader->notEmpty, NULL);
+    pthread_cond_init(&reader->notFull, NULL);
+    if (pthread_create(&reader->threadHandle, NULL, ReaderThread, reader) != 0) {
+        pthread_cond_destroy(&reader->notFull);
+        pthread_cond_destroy(&reader->notEmpty);
+        pthread_mutex_destroy(&reader->lock);
+        return EB_ErrorInsufficientResources;
+    }
+#endif
+
+    return EB_ErrorNone;
+}
+
+static void StopReaderThread(EbInputReader_t *reader)
+{
+    READER_LOCK(reader);
+    reader->stop = EB_TRUE;
+    READER_SIGNAL(reader, notFull);
+    READER_UNLOCK(reader);
+
+#ifdef _WIN32
+    WaitForSingleObject(reader->threadHandle, INFINITE);
+    CloseHandle(reader->threadHandle);
+    DeleteCriticalSection(&reader->lock);
+#else
+    pthread_join(reader->threadHandle, NULL);
+    pthread_cond_destroy(&reader->notFull);
+    pthread_cond_destroy(&reader->notEmpty);
+    pthread_mutex_destroy(&reader->lock);
+#endif
+}
+
+static void FreeReader(EbInputReader_t *reader)
+{
+    uint32_t frameIndex;
+
+    if (reader->frameArray) {
+        for (frameIndex = 0; frameIndex < reader->prefetchFrames; ++frameIndex)
+            free(reader->frameArray[frameIndex]);
+        free(reader->frameArray);
+    }
+    free(reader);
+}
+
+/***************************************
+ * Input reader
+ ***************************************/
+EbErrorType InputReaderCtor(
+    EbConfig_t                  *config)
+{
+    EbInputReader_t *reader;
+    EbErrorType      return_error;
+
+    config->inputReader = NULL;
+    if (config->inputReaderMode == INPUT_READER_STDIO || config->bufferedInput != -1)
+        return EB_ErrorNone;
+
+    if (config->separateFields || (config->encoderBitDepth > 8 && config->compressedTenBitFormat)) {
+        printf("\nWarning: InputReader %u does not read field separated and compressed 10 bit inputs, reading from the encoding thread", config->inputReaderMode);
+        return EB_ErrorNone;
+    }
+
+    reader = (EbInputReader_t*)calloc(1, sizeof(EbInputReader_t));
+    if (reader == NULL)
+        return EB_ErrorInsufficientResources;
+
+    reader->file = config->inputFile;
+    reader->y4m = config->y4mInput;
+    reader->seekable = IsRegularFile(config->inputFile);
+    reader->is16bit = config->encoderBitDepth > 8;
+    reader->lumaSize = ((uint64_t)config->inputPaddedWidth * config->inputPaddedHeight) << reader->is16bit;
+    reader->frameSize = (reader->lumaSize * 3) >> 1;
+    reader->prefetchFrames = config->prefetchFrames;
+
+    // Pipes and the files that fail to map use the reader thread
+    reader->mode = config->inputReaderMode;
+    if (reader->mode == INPUT_READER_MMAP && (!reader->seekable || MapInputFile(reader) != EB_ErrorNone))
+        reader->mode = INPUT_READER_THREAD;
+
+    if (reader->mode == INPUT_READER_THREAD) {
+        return_error = StartReaderThread(reader, config);
+        if (return_error != EB_ErrorNone) {
+            FreeReader(reader);
+            return return_error;
+        }
+    }
+
+    config->inputReader = reader;
+
+    return EB_ErrorNone;
+}
+
+void InputReaderDtor(
+    EbConfig_t                  *config)
+{
+    EbInputReader_t *reader = config->inputReader;
+
+    if (reader == NULL)
+        return;
+
+    if (reader->mode == INPUT_READER_MMAP)
+        UnmapInputFile(reader);
+    else
+        StopReaderThread(reader);
+
+    FreeReader(reader);
+    config->inputReader = NULL;
+}
+
+EbBool InputReaderGetFrame(
+    EbConfig_t                  *config,
+    EbBufferHeaderType          *headerPtr)
+{
+    EbInputReader_t *reader = config->inputReader;
+    EbSvtEncInput   *inputPtr = (EbSvtEncInput*)headerPtr->p_buffer;
+    uint8_t         *framePtr;
+
+    if (reader->mode == INPUT_READER_MMAP) {
+        uint64_t frameOffset;
+
+        if (!NextMappedFrame(reader, &frameOffset))
+            return EB_FALSE;
+        framePtr = reader->mapPtr + frameOffset;
+
+#ifndef _WIN32
+        {
+            // Page in the next frames ahead of the encoding thread
+            uint64_t prefetchStart = (frameOffset + reader->frameSize) & ~(reader->pageSize - 1);
+            uint64_t prefetchEnd = frameOffset + reader->frameSize * (reader->prefetchFrames + 1);
+
+            if (prefetchEnd > reader->mapSize)
+                prefetchEnd = reader->mapSize;
+            if (prefetchEnd > prefetchStart)
+                madvise(reader->mapPtr + prefetchStart, (size_t)(prefetchEnd - prefetchStart), MADV_WILLNEED);
+        }
+#endif
+    }
+    else {
+        READER_LOCK(reader);
+        while (reader->fullCount == 0 && !reader->endOfInput)
+            READER_WAIT(reader, notEmpty);
+        if (reader->fullCount == 0) {
+            READER_UNLOCK(reader);
+            return EB_FALSE;
+        }
+        framePtr = reader->frameArray[reader->readIndex];
+        READER_UNLOCK(reader);
+    }
+
+    inputPtr->yStride = config->inputPaddedWidth;
+    inputPtr->cbStride = config->inputPaddedWidth >> 1;
+    inputPtr->crStride = config->inputPaddedWidth >> 1;
+    inputPtr->luma = framePtr + ((config->inputPaddedWidth*TOP_INPUT_PADDING + LEFT_INPUT_PADDING) << reader->is16bit);
+    inputPtr->cb = framePtr + reader->lumaSize + (((config->inputPaddedWidth >> 1)*(TOP_INPUT_PADDING >> 1) + (LEFT_INPUT_PADDING >> 1)) << reader->is16bit);
+    inputPtr->cr = framePtr + reader->lumaSize + (reader->lumaSize >> 2) + (((config->inputPaddedWidth >> 1)*(TOP_INPUT_PADDING >> 1) + (LEFT_INPUT_PADDING >> 1)) << reader->is16bit);
+    headerPtr->n_filled_len = (uint32_t)reader->frameSize;
+
+    return EB_TRUE;
+}
+
+void InputReaderReleaseFrame(
+    EbConfig_t                  *config)
+{
+    EbInputReader_t *reader = config->inputReader;
+
+    if (reader->mode == INPUT_READER_MMAP)
+        return;
+
+    READER_LOCK(reader);
+    reader->readIndex = (reader->readIndex + 1) % reader->prefetchFrames;
+    --reader->fullCount;
+    READER_SIGNAL(reader, notFull);
+    READER_UNLOCK(reader);
+}
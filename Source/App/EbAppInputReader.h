@@ -0,0 +1,38 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppInputReader_h
+#define EbAppInputReader_h
+
+#include "EbAppConfig.h"
+
+/****************************************
+* Input readers
+****************************************/
+#define INPUT_READER_STDIO          0   // fread on the encoding thread
+#define INPUT_READER_MMAP           1   // memory mapped file, pipes use the reader thread
+#define INPUT_READER_THREAD         2   // reader thread filling a ring of frames
+#define INPUT_READER_MAX_PREFETCH   256
+
+/* Creates the input reader selected by config->inputReader. Field separated
+ * and compressed 10 bit inputs keep the stdio reads. */
+extern EbErrorType InputReaderCtor(
+    EbConfig_t                  *config);
+
+extern void InputReaderDtor(
+    EbConfig_t                  *config);
+
+/* Points the planes of the input buffer to the next frame, in place in the
+ * mapping or in the ring. Loops to the first frame at the end of a file,
+ * returns EB_FALSE at the end of a pipe. */
+extern EbBool InputReaderGetFrame(
+    EbConfig_t                  *config,
+    EbBufferHeaderType          *headerPtr);
+
+/* Gives the frame back to the reader once it is sent to the encoder */
+extern void InputReaderReleaseFrame(
+    EbConfig_t                  *config);
+
+#endif // EbAppInputReader_h
@@ -16,8 +16,12 @@
 /***************************************
  * Includes
  ***************************************/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <signal.h>
 #include <stdint.h>
 #include "EbAppConfig.h"
@@ -52,6 +56,9 @@ extern APPEXITCONDITIONTYPE ProcessOutputStreamBuffer(
     EbAppContext_t         *appCallBack,
     uint8_t           pic_send_done);
 
+extern void PrintStageStats(
+    EbAppContext_t         *appCallBack);
+
 volatile int32_t keepRunning = 1;
 
 void EventHandler(int32_t dummy) {
@@ -70,6 +77,20 @@ void AssignAppThreadGroup(uint8_t targetSocket) {
         groupAffinity.Group = targetSocket;
         SetThreadGroupAffinity(GetCurrentThread(), &groupAffinity, NULL);
     }
+#elif defined(__linux__)
+    // The socket is the NUMA node of the same index, nothing to do on
+    //   single node systems
+    char  path[64];
+    char  list[1024];
+    FILE *file;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", targetSocket);
+    file = fopen(path, "r");
+    if (file == NULL)
+        return;
+    if (fgets(list, sizeof(list), file))
+        eb_svt_assign_thread_affinity(list);
+    fclose(file);
 #else
     (void)targetSocket;
     return;
@@ -146,7 +167,9 @@ int32_t main(int32_t argc, char* argv[])
         if (return_error == EB_ErrorNone) {
 
             // Set main thread affinity
-            if (configs[0]->targetSocket != -1)
+            if (configs[0]->processorList)
+                eb_svt_assign_thread_affinity(configs[0]->processorList);
+            else if (configs[0]->targetSocket != -1)
                 AssignAppThreadGroup(configs[0]->targetSocket);
 
             // Init the Encoder
@@ -289,6 +312,12 @@ int32_t main(int32_t argc, char* argv[])
                                 (uint32_t)(configs[instanceCount]->performanceContext.maxLatency));
 
                         }
+                        if (configs[instanceCount]->bitstreamFile || configs[instanceCount]->reconFile)
+                            printf("Max Output Queue:\t%u buffers, %llu bytes\n",
+                                configs[instanceCount]->performanceContext.maxOutputQueueCount,
+                                (unsigned long long)configs[instanceCount]->performanceContext.maxOutputQueueSize);
+                        if (configs[instanceCount]->stageStats)
+                            PrintStageStats(appCallbacks[instanceCount]);
                     }
                     else {
                         printf("\nChannel %u Encoding Interrupted\n", (uint32_t)(instanceCount + 1));
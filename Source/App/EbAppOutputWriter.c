@@ -0,0 +1,263 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "EbAppOutputWriter.h"
+
+/***************************************
+ * Macros
+ ***************************************/
+// Queue limits, OutputWriterQueue blocks until the buffer fits. A buffer
+//   larger than OUTPUT_WRITER_MAX_QUEUE_SIZE waits for an empty queue.
+#define OUTPUT_WRITER_MAX_QUEUE_COUNT   256
+#define OUTPUT_WRITER_MAX_QUEUE_SIZE    (64 << 20)
+
+#ifdef _WIN32
+#define WRITER_LOCK(w)              EnterCriticalSection(&(w)->lock)
+#define WRITER_UNLOCK(w)            LeaveCriticalSection(&(w)->lock)
+#define WRITER_WAIT(w)              SleepConditionVariableCS(&(w)->notEmpty, &(w)->lock, INFINITE)
+#define WRITER_SIGNAL(w)            WakeConditionVariable(&(w)->notEmpty)
+#define WRITER_WAIT_NOT_FULL(w)     SleepConditionVariableCS(&(w)->notFull, &(w)->lock, INFINITE)
+#define WRITER_SIGNAL_NOT_FULL(w)   WakeAllConditionVariable(&(w)->notFull)
+#else
+#define WRITER_LOCK(w)              pthread_mutex_lock(&(w)->lock)
+#define WRITER_UNLOCK(w)            pthread_mutex_unlock(&(w)->lock)
+#define WRITER_WAIT(w)              pthread_cond_wait(&(w)->notEmpty, &(w)->lock)
+#define WRITER_SIGNAL(w)            pthread_cond_signal(&(w)->notEmpty)
+#define WRITER_WAIT_NOT_FULL(w)     pthread_cond_wait(&(w)->notFull, &(w)->lock)
+#define WRITER_SIGNAL_NOT_FULL(w)   pthread_cond_broadcast(&(w)->notFull)
+#endif
+
+typedef struct EbOutputBuffer_s {
+    struct EbOutputBuffer_s *nextPtr;
+    FILE                    *file;
+    int64_t                  offset;
+    uint32_t                 size;
+    uint8_t                  data[1];
+} EbOutputBuffer_t;
+
+typedef struct EbOutputWriter_s {
+    // Queue of the buffers to write, the head is written by the thread
+    EbOutputBuffer_t        *headPtr;
+    EbOutputBuffer_t        *tailPtr;
+    uint32_t                 queueCount;
+    uint64_t                 queueSize;
+    EbBool                   stop;
+    EbBool                   error;
+#ifdef _WIN32
+    HANDLE                   threadHandle;
+    CRITICAL_SECTION         lock;
+    CONDITION_VARIABLE       notEmpty;
+    CONDITION_VARIABLE       notFull;
+#else
+    pthread_t                threadHandle;
+    pthread_mutex_t          lock;
+    pthread_cond_t           notEmpty;
+    pthread_cond_t           notFull;
+#endif
+} EbOutputWriter_t;
+
+/***************************************
+ * Writer thread
+ ***************************************/
+static void WriterKernel(EbOutputWriter_t *writer)
+{
+    EbOutputBuffer_t *bufferPtr;
+    EbBool            error;
+
+    for (;;) {
+        WRITER_LOCK(writer);
+        while (writer->headPtr == NULL && !writer->stop)
+            WRITER_WAIT(writer);
+        bufferPtr = writer->headPtr;
+        error = writer->error;
+        WRITER_UNLOCK(writer);
+
+        // The queue is empty once stopped
+        if (bufferPtr == NULL)
+            break;
+
+        // The recon frames are written at the offset of their picture number
+        if (!error && bufferPtr->offset != OUTPUT_WRITER_APPEND && fseeko64(bufferPtr->file, bufferPtr->offset, SEEK_SET) != 0) {
+            printf("\nError in fseeko64 offset %lld\n", (long long)bufferPtr->offset);
+            error = EB_TRUE;
+        }
+        if (!error && fwrite(bufferPtr->data, 1, bufferPtr->size, bufferPtr->file) != bufferPtr->size) {
+            printf("\nError writing %u bytes of output\n", bufferPtr->size);
+            error = EB_TRUE;
+        }
+
+        WRITER_LOCK(writer);
+        writer->headPtr = bufferPtr->nextPtr;
+        if (writer->headPtr == NULL)
+            writer->tailPtr = NULL;
+        --writer->queueCount;
+        writer->queueSize -= bufferPtr->size;
+        writer->error = error;
+        WRITER_SIGNAL_NOT_FULL(writer);
+        WRITER_UNLOCK(writer);
+
+        free(bufferPtr);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI WriterThread(LPVOID context)
+{
+    WriterKernel((EbOutputWriter_t*)context);
+    return 0;
+}
+#else
+static void* WriterThread(void *context)
+{
+    WriterKernel((EbOutputWriter_t*)context);
+    return NULL;
+}
+#endif
+
+/***************************************
+ * Output writer
+ ***************************************/
+EbErrorType OutputWriterCtor(
+    EbConfig_t                  *config)
+{
+    EbOutputWriter_t *writer;
+
+    config->outputWriter = NULL;
+    if (config->bitstreamFile == NULL && config->reconFile == NULL)
+        return EB_ErrorNone;
+
+    writer = (EbOutputWriter_t*)calloc(1, sizeof(EbOutputWriter_t));
+    if (writer == NULL)
+        return EB_ErrorInsufficientResources;
+
+#ifdef _WIN32
+    InitializeCriticalSection(&writer->lock);
+    InitializeConditionVariable(&writer->notEmpty);
+    InitializeConditionVariable(&writer->notFull);
+    writer->threadHandle = CreateThread(NULL, 0, WriterThread, writer, 0, NULL);
+    if (writer->threadHandle == NULL) {
+        DeleteCriticalSection(&writer->lock);
+        free(writer);
+        return EB_ErrorInsufficientResources;
+    }
+#else
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->notEmpty, NULL);
+    pthread_cond_init(&writer->notFull, NULL);
+    if (pthread_create(&writer->threadHandle, NULL, WriterThread, writer) != 0) {
+        pthread_cond_destroy(&writer->notFull);
+        pthread_cond_destroy(&writer->notEmpty);
+        pthread_mutex_destroy(&writer->lock);
+        free(writer);
+        return EB_ErrorInsufficientResources;
+    }
+#endif
+
+    config->outputWriter = writer;
+
+    return EB_ErrorNone;
+}
+
+void OutputWriterDtor(
+    EbConfig_t                  *config)
+{
+    EbOutputWriter_t *writer = config->outputWriter;
+
+    if (writer == NULL)
+        return;
+
+    WRITER_LOCK(writer);
+    writer->stop = EB_TRUE;
+    WRITER_SIGNAL(writer);
+    WRITER_UNLOCK(writer);
+
+#ifdef _WIN32
+    WaitForSingleObject(writer->threadHandle, INFINITE);
+    CloseHandle(writer->threadHandle);
+    DeleteCriticalSection(&writer->lock);
+#else
+    pthread_join(writer->threadHandle, NULL);
+    pthread_cond_destroy(&writer->notFull);
+    pthread_cond_destroy(&writer->notEmpty);
+    pthread_mutex_destroy(&writer->lock);
+#endif
+
+    free(writer);
+    config->outputWriter = NULL;
+}
+
+EbErrorType OutputWriterQueue(
+    EbConfig_t                  *config,
+    FILE                        *file,
+    int64_t                      offset,
+    const uint8_t               *headerPtr,
+    uint32_t                     headerSize,
+    const uint8_t               *dataPtr,
+    uint32_t                     dataSize)
+{
+    EbOutputWriter_t *writer = config->outputWriter;
+    EbOutputBuffer_t *bufferPtr;
+    EbErrorType       return_error = EB_ErrorNone;
+
+    if (file == NULL)
+        return EB_ErrorNone;
+
+    bufferPtr = (EbOutputBuffer_t*)malloc(sizeof(EbOutputBuffer_t) + headerSize + dataSize);
+    if (bufferPtr == NULL)
+        return EB_ErrorInsufficientResources;
+
+    bufferPtr->nextPtr = NULL;
+    bufferPtr->file = file;
+    bufferPtr->offset = offset;
+    bufferPtr->size = headerSize + dataSize;
+    if (headerSize)
+        memcpy(bufferPtr->data, headerPtr, headerSize);
+    if (dataSize)
+        memcpy(bufferPtr->data + headerSize, dataPtr, dataSize);
+
+    WRITER_LOCK(writer);
+    while (writer->queueCount && !writer->error &&
+        (writer->queueCount >= OUTPUT_WRITER_MAX_QUEUE_COUNT || writer->queueSize + bufferPtr->size > OUTPUT_WRITER_MAX_QUEUE_SIZE))
+        WRITER_WAIT_NOT_FULL(writer);
+
+    if (writer->error) {
+        return_error = EB_ErrorUndefined;
+    }
+    else {
+        if (writer->tailPtr)
+            writer->tailPtr->nextPtr = bufferPtr;
+        else
+            writer->headPtr = bufferPtr;
+        writer->tailPtr = bufferPtr;
+        ++writer->queueCount;
+        writer->queueSize += bufferPtr->size;
+
+        // High-water mark of the queue, in buffers and bytes
+        if (writer->queueCount > config->performanceContext.maxOutputQueueCount)
+            config->performanceContext.maxOutputQueueCount = writer->queueCount;
+        if (writer->queueSize > config->performanceContext.maxOutputQueueSize)
+            config->performanceContext.maxOutputQueueSize = writer->queueSize;
+
+        WRITER_SIGNAL(writer);
+        bufferPtr = NULL;
+    }
+    WRITER_UNLOCK(writer);
+
+    free(bufferPtr);
+
+    return return_error;
+}
@@ -0,0 +1,34 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppOutputWriter_h
+#define EbAppOutputWriter_h
+
+#include "EbAppConfig.h"
+
+#define OUTPUT_WRITER_APPEND        -1  // write at the current position of the file
+
+/* Starts the thread writing the bitstream and recon files */
+extern EbErrorType OutputWriterCtor(
+    EbConfig_t                  *config);
+
+/* Writes the queued buffers out and stops the thread */
+extern void OutputWriterDtor(
+    EbConfig_t                  *config);
+
+/* Copies headerSize bytes of headerPtr then dataSize bytes of dataPtr to the
+ * queue of the writer, to be written at offset in file. The buffers can be
+ * released on return. Blocks while the queue is full. Fails once a write
+ * failed. */
+extern EbErrorType OutputWriterQueue(
+    EbConfig_t                  *config,
+    FILE                        *file,
+    int64_t                      offset,
+    const uint8_t               *headerPtr,
+    uint32_t                     headerSize,
+    const uint8_t               *dataPtr,
+    uint32_t                     dataSize);
+
+#endif // EbAppOutputWriter_h
@@ -14,6 +14,8 @@
 #include "EbAppConfig.h"
 #include "EbErrorCodes.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputReader.h"
+#include "EbAppOutputWriter.h"
 
 #include "EbTime.h"
 /***************************************
@@ -221,6 +223,14 @@ void LogErrorOutput(
         fprintf(errorLogFile, "Error: EncodeSplitFlag: context too large!\n");
         break;
 
+    case EB_ENC_EC_ERROR17:
+        fprintf(errorLogFile, "Error: EncodeSliceFinish: tile bitstream larger than its buffer!\n");
+        break;
+
+    case EB_ENC_EC_ERROR18:
+        fprintf(errorLogFile, "Error: WriteFrameHeaderAv1: frame bitstream larger than its buffer!\n");
+        break;
+
     case EB_ENC_EC_ERROR26:
         fprintf(errorLogFile, "Error: Level not recognized!\n");
         break;
@@ -420,6 +430,9 @@ void LogErrorOutput(
     case EB_ENC_PACKETIZATION_ERROR5:
         fprintf(errorLogFile, "Error: Stream Fifo is starving..deadlock, increase EB_outputStreamBufferFifoInitCount APP_ENCODERSTREAMBUFFERCOUNT \n");
         break;
+    case EB_ENC_PACKETIZATION_ERROR6:
+        fprintf(errorLogFile, "Error: PacketizationProcess: Out of memory for the packet payload!\n");
+        break;
 
         // EB_ENC_PM_ERRORS:
     case EB_ENC_PM_ERROR0:
@@ -1166,6 +1179,25 @@ void SendQpOnTheFly(
     return;
 }
 
+//************************************/
+// SendEndOfStream
+// Sends the end of sequence, without picture
+/************************************/
+static void SendEndOfStream(
+    EbComponentType        *componentHandle,
+    EbBufferHeaderType     *headerPtr)
+{
+    headerPtr->n_alloc_len    = 0;
+    headerPtr->n_filled_len   = 0;
+    headerPtr->n_tick_count   = 0;
+    headerPtr->p_app_private  = NULL;
+    headerPtr->flags       = EB_BUFFERFLAG_EOS;
+    headerPtr->p_buffer      = NULL;
+    headerPtr->pic_type    = EB_INVALID_PICTURE;
+
+    eb_svt_enc_send_picture(componentHandle, headerPtr);
+}
+
 //************************************/
 // ProcessInputBuffer
 // Reads yuv frames from file and copy
@@ -1202,10 +1234,17 @@ APPEXITCONDITIONTYPE ProcessInputBuffer(
 
     // If there are bytes left to encode, configure the header
     if (remainingByteCount != 0 && config->stopEncoder == EB_FALSE) {
-        ReadInputFrames(
-            config,
-            is16bit,
-            headerPtr);
+        if (config->inputReader == NULL)
+            ReadInputFrames(
+                config,
+                is16bit,
+                headerPtr);
+        else if (InputReaderGetFrame(config, headerPtr) == EB_FALSE) {
+            // End of the pipe, the stream ends with the frames read so far
+            config->framesToBeEncoded = (int64_t)config->processedFrameCount;
+            SendEndOfStream(componentHandle, headerPtr);
+            return APP_ExitConditionFinished;
+        }
 
         // Update the context parameters
         config->processedByteCount += headerPtr->n_filled_len;
@@ -1231,19 +1270,12 @@ APPEXITCONDITIONTYPE ProcessInputBuffer(
         // Send the picture
         eb_svt_enc_send_picture(componentHandle, headerPtr);
 
-        if ((config->processedFrameCount == (uint64_t)config->framesToBeEncoded) || config->stopEncoder) {
-
-            headerPtr->n_alloc_len    = 0;
-            headerPtr->n_filled_len   = 0;
-            headerPtr->n_tick_count   = 0;
-            headerPtr->p_app_private  = NULL;
-            headerPtr->flags       = EB_BUFFERFLAG_EOS;
-            headerPtr->p_buffer      = NULL;
-            headerPtr->pic_type    = EB_INVALID_PICTURE;
-
-            eb_svt_enc_send_picture(componentHandle, headerPtr);
+        // The encoder copied the frame
+        if (config->inputReader)
+            InputReaderReleaseFrame(config);
 
-        }
+        if ((config->processedFrameCount == (uint64_t)config->framesToBeEncoded) || config->stopEncoder)
+            SendEndOfStream(componentHandle, headerPtr);
 
         return_value = (headerPtr->flags == EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : return_value;
 
@@ -1274,7 +1306,7 @@ static __inline void mem_put_le16(void *vmem, int32_t val) {
     mem[1] = (uint8_t)((val >> 8) & 0xff);
 }
 
-static void write_ivf_stream_header(EbConfig_t *config)
+static EbErrorType write_ivf_stream_header(EbConfig_t *config)
 {
     char header[32];
     header[0] = 'D';
@@ -1293,13 +1325,11 @@ static void write_ivf_stream_header(EbConfig_t *config)
     mem_put_le32(header + 24, 0);               // length
     mem_put_le32(header + 28, 0);               // unused
     //config->performanceContext.byteCount += 32;
-    if (config->bitstreamFile)
-        fwrite(header, 1, 32, config->bitstreamFile);
 
-    return;
+    return OutputWriterQueue(config, config->bitstreamFile, OUTPUT_WRITER_APPEND, (uint8_t*)header, 32, NULL, 0);
 }
 
-static void write_ivf_frame_header(EbConfig_t *config, uint32_t byte_count){
+static EbErrorType write_ivf_frame(EbConfig_t *config, const uint8_t *frame_ptr, uint32_t byte_count){
     char header[12];
     int32_t write_location = 0;
 
@@ -1311,8 +1341,7 @@ static void write_ivf_frame_header(EbConfig_t *config, uint32_t byte_count){
     write_location = write_location + 4;
     //config->performanceContext.byteCount += write_location;
 
-    if (config->bitstreamFile)
-        fwrite(header, 1, 12, config->bitstreamFile);
+    return OutputWriterQueue(config, config->bitstreamFile, OUTPUT_WRITER_APPEND, (uint8_t*)header, 12, frame_ptr, byte_count);
 }
 #define OBU_FRAME_HEADER_SIZE   3
 #define TD_SPS_SIZE             17
@@ -1326,6 +1355,7 @@ APPEXITCONDITIONTYPE ProcessOutputStreamBuffer(
     EbComponentType        *componentHandle = (EbComponentType*)appCallBack->svtEncoderHandle;
     APPEXITCONDITIONTYPE    return_value    = APP_ExitConditionNone;
     EbErrorType             stream_status   = EB_ErrorNone;
+    EbErrorType             write_status    = EB_ErrorNone;
     // Per channel variables
     FILE                   *streamFile       = config->bitstreamFile;
 
@@ -1372,27 +1402,21 @@ APPEXITCONDITIONTYPE ProcessOutputStreamBuffer(
             finishuTime,
             &config->performanceContext.total_encode_time);
 
-        // Write Stream Data to file
+        // Queue the Stream Data to the writer, the packet is released right away
         if (streamFile) {
-            if (config->performanceContext.frameCount == 1){
-                write_ivf_stream_header(config);
+            if (config->performanceContext.frameCount == 1)
+                write_status = write_ivf_stream_header(config);
 #if !IVF_FRAME_HEADER_IN_LIB
-            }
-
             if (headerPtr->flags & EB_BUFFERFLAG_SHOW_EXT){
-                write_ivf_frame_header(config, headerPtr->n_filled_len - OBU_FRAME_HEADER_SIZE);
-                fwrite(headerPtr->p_buffer, 1, headerPtr->n_filled_len - OBU_FRAME_HEADER_SIZE, streamFile);
-                write_ivf_frame_header(config, OBU_FRAME_HEADER_SIZE);
-                fwrite(headerPtr->p_buffer + headerPtr->n_filled_len - OBU_FRAME_HEADER_SIZE, 1, OBU_FRAME_HEADER_SIZE, streamFile);
-            }else{
-                write_ivf_frame_header(config, headerPtr->n_filled_len);
+                if (write_status == EB_ErrorNone)
+                    write_status = write_ivf_frame(config, headerPtr->p_buffer, headerPtr->n_filled_len - OBU_FRAME_HEADER_SIZE);
+                if (write_status == EB_ErrorNone)
+                    write_status = write_ivf_frame(config, headerPtr->p_buffer + headerPtr->n_filled_len - OBU_FRAME_HEADER_SIZE, OBU_FRAME_HEADER_SIZE);
+            }else if (write_status == EB_ErrorNone)
+                write_status = write_ivf_frame(config, headerPtr->p_buffer, headerPtr->n_filled_len);
 #else
-            }
-#endif
-
-                fwrite(headerPtr->p_buffer, 1, headerPtr->n_filled_len, streamFile);
-#if !IVF_FRAME_HEADER_IN_LIB
-            }
+            if (write_status == EB_ErrorNone)
+                write_status = OutputWriterQueue(config, streamFile, OUTPUT_WRITER_APPEND, NULL, 0, headerPtr->p_buffer, headerPtr->n_filled_len);
 #endif
         }
         config->performanceContext.byteCount += headerPtr->n_filled_len;
@@ -1400,6 +1424,8 @@ APPEXITCONDITIONTYPE ProcessOutputStreamBuffer(
         // Update Output Port Activity State
         *portState = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_PortInactive : *portState;
         return_value = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : APP_ExitConditionNone;
+        if (write_status != EB_ErrorNone)
+            return_value = APP_ExitConditionError;
 
         // Release the output buffer
         eb_svt_release_out_buffer(&headerPtr);
@@ -1432,40 +1458,67 @@ APPEXITCONDITIONTYPE ProcessOutputReconBuffer(
     EbConfig_t             *config,
     EbAppContext_t         *appCallBack)
 {
-    EbBufferHeaderType    *headerPtr = appCallBack->reconBuffer; // needs to change for buffered input
+    EbBufferHeaderType    *headerPtr = NULL;
     EbComponentType       *componentHandle = (EbComponentType*)appCallBack->svtEncoderHandle;
     APPEXITCONDITIONTYPE    return_value = APP_ExitConditionNone;
     EbErrorType            recon_status = EB_ErrorNone;
-    int32_t fseekReturnVal;
-    // non-blocking call until all input frames are sent
-    recon_status = eb_svt_get_recon(componentHandle, headerPtr);
+    // non-blocking call, the picture is read in place until it is released
+    recon_status = eb_svt_borrow_recon(componentHandle, &headerPtr, NULL);
 
     if (recon_status == EB_ErrorMax) {
         printf("\n");
         LogErrorOutput(
             config->errorLogFile,
-            headerPtr->flags);
+            headerPtr ? headerPtr->flags : 0);
+        if (headerPtr)
+            eb_svt_release_out_buffer(&headerPtr);
         return APP_ExitConditionError;
     }
     else if (recon_status != EB_NoErrorEmptyQueue) {
-        //Sets the File position to the beginning of the file.
-        rewind(config->reconFile);
-        uint64_t frameNum = headerPtr->pts;
-        while (frameNum>0) {
-            fseekReturnVal = fseeko64(config->reconFile, headerPtr->n_filled_len, SEEK_CUR);
-
-            if (fseekReturnVal != 0) {
-                printf("Error in fseeko64  returnVal %i\n", fseekReturnVal);
-                return APP_ExitConditionError;
-            }
-            frameNum = frameNum - 1;
-        }
-
-        fwrite(headerPtr->p_buffer, 1, headerPtr->n_filled_len, config->reconFile);
+        // The writer seeks to the frame of the picture number
+        if (OutputWriterQueue(config, config->reconFile, (int64_t)(headerPtr->pts * headerPtr->n_filled_len), NULL, 0, headerPtr->p_buffer, headerPtr->n_filled_len) != EB_ErrorNone)
+            return_value = APP_ExitConditionError;
 
         // Update Output Port Activity State
-        return_value = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : APP_ExitConditionNone;
+        else
+            return_value = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : APP_ExitConditionNone;
+
+        // Return the picture to the encoder
+        eb_svt_release_out_buffer(&headerPtr);
     }
     return return_value;
 }
 
+/***************************************
+* Print the utilization of each process of the encoder pipeline, in
+*   percent of the encoding time of all its threads. Idle is the time
+*   left, mostly spent waiting for the input queue.
+***************************************/
+void PrintStageStats(
+    EbAppContext_t         *appCallBack)
+{
+    EbSvtEncStats  stats;
+    uint32_t       stageIndex;
+
+    if (eb_svt_get_stats(appCallBack->svtEncoderHandle, &stats) != EB_ErrorNone || stats.elapsed_time == 0)
+        return;
+
+    printf("\n%-26s %7s %9s %8s %10s %8s %9s\n", "Stage", "Threads", "Items", "Active%", "OutBlock%", "Idle%", "MaxQueue");
+    for (stageIndex = 0; stageIndex < stats.stage_count; ++stageIndex) {
+        const EbSvtStageStats *stagePtr = &stats.stage_array[stageIndex];
+        double threadTime = (double)stats.elapsed_time * (stagePtr->thread_count ? stagePtr->thread_count : 1) / 100;
+        double active = stagePtr->active_time / threadTime;
+        double outputBlocked = stagePtr->output_blocked_time / threadTime;
+        double idle = 100 - active - outputBlocked;
+
+        printf("%-26s %7u %9llu %8.1f %10.1f %8.1f %9u\n",
+            stagePtr->name,
+            stagePtr->thread_count,
+            (unsigned long long)stagePtr->processed_count,
+            active,
+            outputBlocked,
+            idle < 0 ? 0 : idle,
+            stagePtr->max_queue_depth);
+    }
+    fflush(stdout);
+}
@@ -0,0 +1,621 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+
+/***********************************************************************************/
+// Loop filters working on up to 4 consecutive 4-sample edge segments at once.
+// Each of the 16 positions along the edge is held in a 16-bit lane, so the same
+// arithmetic serves the 8-bit path (bd = 8) and the high bit depth path, and
+// matches the C reference filters bit-exactly.
+
+static INLINE __m256i abs_diff_epi16(const __m256i a, const __m256i b) {
+    return _mm256_abs_epi16(_mm256_sub_epi16(a, b));
+}
+
+static INLINE __m256i clamp_epi16(const __m256i x, const __m256i lo,
+    const __m256i hi) {
+    return _mm256_min_epi16(_mm256_max_epi16(x, lo), hi);
+}
+
+// p[i] / q[i] hold the i-th sample before / after the edge and are updated in
+// place with the result of the taps-long filter.
+static INLINE void lpf_filter_avx2(__m256i *p, __m256i *q, const int32_t taps,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    const int32_t bd) {
+    const int32_t shift = bd - 8;
+    const __m256i ones = _mm256_set1_epi16(-1);
+    const __m256i blimit16 = _mm256_set1_epi16((int16_t)(*blimit << shift));
+    const __m256i limit16 = _mm256_set1_epi16((int16_t)(*limit << shift));
+    const __m256i thresh16 = _mm256_set1_epi16((int16_t)(*thresh << shift));
+    const __m256i flat_thresh = _mm256_set1_epi16((int16_t)(1 << shift));
+    const __m256i offset = _mm256_set1_epi16((int16_t)(0x80 << shift));
+    const __m256i clamp_lo = _mm256_set1_epi16((int16_t)-(128 << shift));
+    const __m256i clamp_hi = _mm256_set1_epi16((int16_t)((128 << shift) - 1));
+    const __m256i four = _mm256_set1_epi16(4);
+    const __m256i three = _mm256_set1_epi16(3);
+    __m256i max_ad, hev, mask, flat, flat_mask;
+    __m256i ps1, ps0, qs0, qs1, filter, filter1, filter2;
+    __m256i op1, op0, oq0, oq1;
+
+    max_ad = _mm256_max_epi16(abs_diff_epi16(p[1], p[0]),
+        abs_diff_epi16(q[1], q[0]));
+    hev = _mm256_cmpgt_epi16(max_ad, thresh16);
+    flat = max_ad;
+    if (taps >= 6) {
+        max_ad = _mm256_max_epi16(max_ad, abs_diff_epi16(p[2], p[1]));
+        max_ad = _mm256_max_epi16(max_ad, abs_diff_epi16(q[2], q[1]));
+        flat = _mm256_max_epi16(flat, abs_diff_epi16(p[2], p[0]));
+        flat = _mm256_max_epi16(flat, abs_diff_epi16(q[2], q[0]));
+    }
+    if (taps >= 8) {
+        max_ad = _mm256_max_epi16(max_ad, abs_diff_epi16(p[3], p[2]));
+        max_ad = _mm256_max_epi16(max_ad, abs_diff_epi16(q[3], q[2]));
+        flat = _mm256_max_epi16(flat, abs_diff_epi16(p[3], p[0]));
+        flat = _mm256_max_epi16(flat, abs_diff_epi16(q[3], q[0]));
+    }
+    mask = _mm256_add_epi16(
+        _mm256_slli_epi16(abs_diff_epi16(p[0], q[0]), 1),
+        _mm256_srli_epi16(abs_diff_epi16(p[1], q[1]), 1));
+    mask = _mm256_or_si256(_mm256_cmpgt_epi16(max_ad, limit16),
+        _mm256_cmpgt_epi16(mask, blimit16));
+    mask = _mm256_xor_si256(mask, ones);
+
+    // 4-tap filter
+    ps1 = _mm256_sub_epi16(p[1], offset);
+    ps0 = _mm256_sub_epi16(p[0], offset);
+    qs0 = _mm256_sub_epi16(q[0], offset);
+    qs1 = _mm256_sub_epi16(q[1], offset);
+
+    filter = _mm256_and_si256(
+        clamp_epi16(_mm256_sub_epi16(ps1, qs1), clamp_lo, clamp_hi), hev);
+    filter = _mm256_add_epi16(filter,
+        _mm256_mullo_epi16(_mm256_sub_epi16(qs0, ps0), three));
+    filter = _mm256_and_si256(clamp_epi16(filter, clamp_lo, clamp_hi), mask);
+    filter1 = _mm256_srai_epi16(
+        clamp_epi16(_mm256_add_epi16(filter, four), clamp_lo, clamp_hi), 3);
+    filter2 = _mm256_srai_epi16(
+        clamp_epi16(_mm256_add_epi16(filter, three), clamp_lo, clamp_hi), 3);
+
+    oq0 = _mm256_add_epi16(
+        clamp_epi16(_mm256_sub_epi16(qs0, filter1), clamp_lo, clamp_hi), offset);
+    op0 = _mm256_add_epi16(
+        clamp_epi16(_mm256_add_epi16(ps0, filter2), clamp_lo, clamp_hi), offset);
+
+    filter = _mm256_srai_epi16(
+        _mm256_add_epi16(filter1, _mm256_set1_epi16(1)), 1);
+    filter = _mm256_andnot_si256(hev, filter);
+
+    oq1 = _mm256_add_epi16(
+        clamp_epi16(_mm256_sub_epi16(qs1, filter), clamp_lo, clamp_hi), offset);
+    op1 = _mm256_add_epi16(
+        clamp_epi16(_mm256_add_epi16(ps1, filter), clamp_lo, clamp_hi), offset);
+
+    flat_mask = _mm256_andnot_si256(_mm256_cmpgt_epi16(flat, flat_thresh), mask);
+    if (taps == 4 || _mm256_testz_si256(flat_mask, flat_mask)) {
+        p[1] = op1;
+        p[0] = op0;
+        q[0] = oq0;
+        q[1] = oq1;
+        return;
+    }
+
+    if (taps == 6) {
+        // 5-tap filter [1, 2, 2, 2, 1]
+        __m256i sum;
+        sum = _mm256_add_epi16(_mm256_mullo_epi16(p[2], three), four);
+        sum = _mm256_add_epi16(sum, _mm256_slli_epi16(_mm256_add_epi16(p[1], p[0]), 1));
+        sum = _mm256_add_epi16(sum, q[0]);
+        op1 = _mm256_blendv_epi8(op1, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_slli_epi16(p[2], 1));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(q[0], q[1]));
+        op0 = _mm256_blendv_epi8(op0, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[2], p[1]));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(q[1], q[2]));
+        oq0 = _mm256_blendv_epi8(oq0, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[1], p[0]));
+        sum = _mm256_add_epi16(sum, _mm256_slli_epi16(q[2], 1));
+        oq1 = _mm256_blendv_epi8(oq1, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        p[1] = op1;
+        p[0] = op0;
+        q[0] = oq0;
+        q[1] = oq1;
+        return;
+    }
+
+    {
+        // 7-tap filter [1, 1, 1, 2, 1, 1, 1]
+        __m256i sum;
+        __m256i op2, oq2;
+        sum = _mm256_add_epi16(_mm256_mullo_epi16(p[3], three), four);
+        sum = _mm256_add_epi16(sum, _mm256_slli_epi16(p[2], 1));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(p[1], p[0]));
+        sum = _mm256_add_epi16(sum, q[0]);
+        op2 = _mm256_blendv_epi8(p[2], _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[3], p[2]));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(p[1], q[1]));
+        op1 = _mm256_blendv_epi8(op1, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[3], p[1]));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(p[0], q[2]));
+        op0 = _mm256_blendv_epi8(op0, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[3], p[0]));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(q[0], q[3]));
+        oq0 = _mm256_blendv_epi8(oq0, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[2], q[0]));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(q[1], q[3]));
+        oq1 = _mm256_blendv_epi8(oq1, _mm256_srli_epi16(sum, 3), flat_mask);
+
+        sum = _mm256_sub_epi16(sum, _mm256_add_epi16(p[1], q[1]));
+        sum = _mm256_add_epi16(sum, _mm256_add_epi16(q[2], q[3]));
+        oq2 = _mm256_blendv_epi8(q[2], _mm256_srli_epi16(sum, 3), flat_mask);
+
+        if (taps == 14) {
+            // 13-tap filter [1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1]
+            __m256i flat2;
+            flat2 = _mm256_max_epi16(abs_diff_epi16(p[4], p[0]),
+                abs_diff_epi16(q[4], q[0]));
+            flat2 = _mm256_max_epi16(flat2, abs_diff_epi16(p[5], p[0]));
+            flat2 = _mm256_max_epi16(flat2, abs_diff_epi16(q[5], q[0]));
+            flat2 = _mm256_max_epi16(flat2, abs_diff_epi16(p[6], p[0]));
+            flat2 = _mm256_max_epi16(flat2, abs_diff_epi16(q[6], q[0]));
+            flat2 = _mm256_andnot_si256(_mm256_cmpgt_epi16(flat2, flat_thresh),
+                flat_mask);
+
+            if (!_mm256_testz_si256(flat2, flat2)) {
+                // The sums reach 16 * 4095, so they are kept as unsigned 16-bit
+                // values and shifted logically.
+                __m256i o[12];
+                int32_t i;
+                sum = _mm256_add_epi16(_mm256_mullo_epi16(p[6], _mm256_set1_epi16(7)),
+                    _mm256_set1_epi16(8));
+                sum = _mm256_add_epi16(sum, _mm256_slli_epi16(_mm256_add_epi16(p[5], p[4]), 1));
+                sum = _mm256_add_epi16(sum, _mm256_add_epi16(p[3], p[2]));
+                sum = _mm256_add_epi16(sum, _mm256_add_epi16(p[1], p[0]));
+                sum = _mm256_add_epi16(sum, q[0]);
+                o[0] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_slli_epi16(p[6], 1)),
+                    _mm256_add_epi16(p[3], q[1]));
+                o[1] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[6], p[5])),
+                    _mm256_add_epi16(p[2], q[2]));
+                o[2] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[6], p[4])),
+                    _mm256_add_epi16(p[1], q[3]));
+                o[3] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[6], p[3])),
+                    _mm256_add_epi16(p[0], q[4]));
+                o[4] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[6], p[2])),
+                    _mm256_add_epi16(q[0], q[5]));
+                o[5] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[6], p[1])),
+                    _mm256_add_epi16(q[1], q[6]));
+                o[6] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[5], p[0])),
+                    _mm256_add_epi16(q[2], q[6]));
+                o[7] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[4], q[0])),
+                    _mm256_add_epi16(q[3], q[6]));
+                o[8] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[3], q[1])),
+                    _mm256_add_epi16(q[4], q[6]));
+                o[9] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[2], q[2])),
+                    _mm256_add_epi16(q[5], q[6]));
+                o[10] = sum;
+                sum = _mm256_add_epi16(_mm256_sub_epi16(sum, _mm256_add_epi16(p[1], q[3])),
+                    _mm256_slli_epi16(q[6], 1));
+                o[11] = sum;
+                for (i = 0; i < 12; i++)
+                    o[i] = _mm256_srli_epi16(o[i], 4);
+
+                p[5] = _mm256_blendv_epi8(p[5], o[0], flat2);
+                p[4] = _mm256_blendv_epi8(p[4], o[1], flat2);
+                p[3] = _mm256_blendv_epi8(p[3], o[2], flat2);
+                op2 = _mm256_blendv_epi8(op2, o[3], flat2);
+                op1 = _mm256_blendv_epi8(op1, o[4], flat2);
+                op0 = _mm256_blendv_epi8(op0, o[5], flat2);
+                oq0 = _mm256_blendv_epi8(oq0, o[6], flat2);
+                oq1 = _mm256_blendv_epi8(oq1, o[7], flat2);
+                oq2 = _mm256_blendv_epi8(oq2, o[8], flat2);
+                q[3] = _mm256_blendv_epi8(q[3], o[9], flat2);
+                q[4] = _mm256_blendv_epi8(q[4], o[10], flat2);
+                q[5] = _mm256_blendv_epi8(q[5], o[11], flat2);
+            }
+        }
+
+        p[2] = op2;
+        p[1] = op1;
+        p[0] = op0;
+        q[0] = oq0;
+        q[1] = oq1;
+        q[2] = oq2;
+    }
+}
+
+// Transposes the 8x8 16-bit blocks held in each 128-bit lane of x[0..7].
+static INLINE void transpose_8x8_lanes_avx2(const __m256i *x, __m256i *out) {
+    const __m256i a0 = _mm256_unpacklo_epi16(x[0], x[1]);
+    const __m256i a1 = _mm256_unpackhi_epi16(x[0], x[1]);
+    const __m256i a2 = _mm256_unpacklo_epi16(x[2], x[3]);
+    const __m256i a3 = _mm256_unpackhi_epi16(x[2], x[3]);
+    const __m256i a4 = _mm256_unpacklo_epi16(x[4], x[5]);
+    const __m256i a5 = _mm256_unpackhi_epi16(x[4], x[5]);
+    const __m256i a6 = _mm256_unpacklo_epi16(x[6], x[7]);
+    const __m256i a7 = _mm256_unpackhi_epi16(x[6], x[7]);
+    const __m256i b0 = _mm256_unpacklo_epi32(a0, a2);
+    const __m256i b1 = _mm256_unpackhi_epi32(a0, a2);
+    const __m256i b2 = _mm256_unpacklo_epi32(a1, a3);
+    const __m256i b3 = _mm256_unpackhi_epi32(a1, a3);
+    const __m256i b4 = _mm256_unpacklo_epi32(a4, a6);
+    const __m256i b5 = _mm256_unpackhi_epi32(a4, a6);
+    const __m256i b6 = _mm256_unpacklo_epi32(a5, a7);
+    const __m256i b7 = _mm256_unpackhi_epi32(a5, a7);
+    out[0] = _mm256_unpacklo_epi64(b0, b4);
+    out[1] = _mm256_unpackhi_epi64(b0, b4);
+    out[2] = _mm256_unpacklo_epi64(b1, b5);
+    out[3] = _mm256_unpackhi_epi64(b1, b5);
+    out[4] = _mm256_unpacklo_epi64(b2, b6);
+    out[5] = _mm256_unpackhi_epi64(b2, b6);
+    out[6] = _mm256_unpacklo_epi64(b3, b7);
+    out[7] = _mm256_unpackhi_epi64(b3, b7);
+}
+
+// Loads / stores n (4, 8, 12 or 16) consecutive samples as 16-bit lanes.
+static INLINE __m256i load_u8_n(const uint8_t *s, const int32_t n) {
+    __m128i v;
+    if (n == 16)
+        v = _mm_loadu_si128((const __m128i *)s);
+    else if (n == 4)
+        v = _mm_cvtsi32_si128(*(const int32_t *)s);
+    else {
+        v = _mm_loadl_epi64((const __m128i *)s);
+        if (n == 12)
+            v = _mm_insert_epi32(v, *(const int32_t *)(s + 8), 2);
+    }
+    return _mm256_cvtepu8_epi16(v);
+}
+
+static INLINE void store_u8_n(uint8_t *s, const __m256i x, const int32_t n) {
+    const __m128i v = _mm_packus_epi16(_mm256_castsi256_si128(x),
+        _mm256_extracti128_si256(x, 1));
+    if (n == 16)
+        _mm_storeu_si128((__m128i *)s, v);
+    else if (n == 4)
+        *(int32_t *)s = _mm_cvtsi128_si32(v);
+    else {
+        _mm_storel_epi64((__m128i *)s, v);
+        if (n == 12)
+            *(int32_t *)(s + 8) = _mm_extract_epi32(v, 2);
+    }
+}
+
+static INLINE __m256i load_u16_n(const uint16_t *s, const int32_t n) {
+    if (n == 16)
+        return _mm256_loadu_si256((const __m256i *)s);
+    if (n == 4)
+        return _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)s));
+    if (n == 8)
+        return _mm256_inserti128_si256(_mm256_setzero_si256(),
+            _mm_loadu_si128((const __m128i *)s), 0);
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)s)),
+        _mm_loadl_epi64((const __m128i *)(s + 8)), 1);
+}
+
+static INLINE void store_u16_n(uint16_t *s, const __m256i x, const int32_t n) {
+    if (n == 16)
+        _mm256_storeu_si256((__m256i *)s, x);
+    else if (n == 4)
+        _mm_storel_epi64((__m128i *)s, _mm256_castsi256_si128(x));
+    else {
+        _mm_storeu_si128((__m128i *)s, _mm256_castsi256_si128(x));
+        if (n == 12)
+            _mm_storel_epi64((__m128i *)(s + 8), _mm256_extracti128_si256(x, 1));
+    }
+}
+
+// Number of samples on each side of the edge that the filter may modify
+static INLINE int32_t lpf_modified_taps(const int32_t taps) {
+    return taps == 14 ? 6 : taps == 8 ? 3 : 2;
+}
+
+static INLINE void lpf_horizontal_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, const int32_t taps) {
+    const int32_t read = taps == 14 ? 7 : taps / 2;
+    const int32_t write = lpf_modified_taps(taps);
+    __m256i p[7], q[7];
+    int32_t i;
+
+    while (count > 0) {
+        const int32_t n = AOMMIN(count, 4) * 4;
+        for (i = 0; i < read; i++) {
+            p[i] = load_u8_n(s - (i + 1) * pitch, n);
+            q[i] = load_u8_n(s + i * pitch, n);
+        }
+        lpf_filter_avx2(p, q, taps, blimit, limit, thresh, 8);
+        for (i = 0; i < write; i++) {
+            store_u8_n(s - (i + 1) * pitch, p[i], n);
+            store_u8_n(s + i * pitch, q[i], n);
+        }
+        s += n;
+        count -= 4;
+    }
+}
+
+static INLINE void highbd_lpf_horizontal_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd, const int32_t taps) {
+    const int32_t read = taps == 14 ? 7 : taps / 2;
+    const int32_t write = lpf_modified_taps(taps);
+    __m256i p[7], q[7];
+    int32_t i;
+
+    while (count > 0) {
+        const int32_t n = AOMMIN(count, 4) * 4;
+        for (i = 0; i < read; i++) {
+            p[i] = load_u16_n(s - (i + 1) * pitch, n);
+            q[i] = load_u16_n(s + i * pitch, n);
+        }
+        lpf_filter_avx2(p, q, taps, blimit, limit, thresh, bd);
+        for (i = 0; i < write; i++) {
+            store_u16_n(s - (i + 1) * pitch, p[i], n);
+            store_u16_n(s + i * pitch, q[i], n);
+        }
+        s += n;
+        count -= 4;
+    }
+}
+
+// Vertical edges: the rows around the edge are loaded (8 samples starting at
+// s - 4, or 16 starting at s - 8 for the 14-tap filter), transposed so each
+// column becomes one vector of up to 16 rows, filtered and transposed back.
+static INLINE void lpf_vertical_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, const int32_t taps) {
+    __m256i x[16], c[16], p[7], q[7];
+    int32_t i;
+
+    while (count > 0) {
+        const int32_t rows = AOMMIN(count, 4) * 4;
+        if (taps == 14) {
+            __m256i r[16];
+            for (i = 0; i < 16; i++)
+                r[i] = i < rows ? _mm256_cvtepu8_epi16(
+                    _mm_loadu_si128((const __m128i *)(s - 8 + i * pitch))) :
+                    _mm256_setzero_si256();
+            for (i = 0; i < 8; i++) {
+                x[i] = _mm256_permute2x128_si256(r[i], r[i + 8], 0x20);
+                x[i + 8] = _mm256_permute2x128_si256(r[i], r[i + 8], 0x31);
+            }
+            transpose_8x8_lanes_avx2(x, c);
+            transpose_8x8_lanes_avx2(x + 8, c + 8);
+            for (i = 0; i < 7; i++) {
+                p[i] = c[7 - i];
+                q[i] = c[8 + i];
+            }
+            lpf_filter_avx2(p, q, taps, blimit, limit, thresh, 8);
+            for (i = 0; i < 7; i++) {
+                c[7 - i] = p[i];
+                c[8 + i] = q[i];
+            }
+            transpose_8x8_lanes_avx2(c, x);
+            transpose_8x8_lanes_avx2(c + 8, x + 8);
+            for (i = 0; i < 8; i++) {
+                r[i] = _mm256_permute2x128_si256(x[i], x[i + 8], 0x20);
+                r[i + 8] = _mm256_permute2x128_si256(x[i], x[i + 8], 0x31);
+            }
+            for (i = 0; i < rows; i++)
+                _mm_storeu_si128((__m128i *)(s - 8 + i * pitch),
+                    _mm_packus_epi16(_mm256_castsi256_si128(r[i]),
+                        _mm256_extracti128_si256(r[i], 1)));
+        }
+        else {
+            for (i = 0; i < 8; i++) {
+                const __m128i lo = i < rows ? _mm_cvtepu8_epi16(
+                    _mm_loadl_epi64((const __m128i *)(s - 4 + i * pitch))) :
+                    _mm_setzero_si128();
+                const __m128i hi = i + 8 < rows ? _mm_cvtepu8_epi16(
+                    _mm_loadl_epi64((const __m128i *)(s - 4 + (i + 8) * pitch))) :
+                    _mm_setzero_si128();
+                x[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            }
+            transpose_8x8_lanes_avx2(x, c);
+            for (i = 0; i < 4; i++) {
+                p[i] = c[3 - i];
+                q[i] = c[4 + i];
+            }
+            lpf_filter_avx2(p, q, taps, blimit, limit, thresh, 8);
+            for (i = 0; i < 4; i++) {
+                c[3 - i] = p[i];
+                c[4 + i] = q[i];
+            }
+            transpose_8x8_lanes_avx2(c, x);
+            for (i = 0; i < rows; i++) {
+                const __m128i v = i < 8 ? _mm256_castsi256_si128(x[i]) :
+                    _mm256_extracti128_si256(x[i - 8], 1);
+                _mm_storel_epi64((__m128i *)(s - 4 + i * pitch),
+                    _mm_packus_epi16(v, v));
+            }
+        }
+        s += 16 * pitch;
+        count -= 4;
+    }
+}
+
+static INLINE void highbd_lpf_vertical_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd, const int32_t taps) {
+    __m256i x[16], c[16], p[7], q[7];
+    int32_t i;
+
+    while (count > 0) {
+        const int32_t rows = AOMMIN(count, 4) * 4;
+        if (taps == 14) {
+            __m256i r[16];
+            for (i = 0; i < 16; i++)
+                r[i] = i < rows ?
+                    _mm256_loadu_si256((const __m256i *)(s - 8 + i * pitch)) :
+                    _mm256_setzero_si256();
+            for (i = 0; i < 8; i++) {
+                x[i] = _mm256_permute2x128_si256(r[i], r[i + 8], 0x20);
+                x[i + 8] = _mm256_permute2x128_si256(r[i], r[i + 8], 0x31);
+            }
+            transpose_8x8_lanes_avx2(x, c);
+            transpose_8x8_lanes_avx2(x + 8, c + 8);
+            for (i = 0; i < 7; i++) {
+                p[i] = c[7 - i];
+                q[i] = c[8 + i];
+            }
+            lpf_filter_avx2(p, q, taps, blimit, limit, thresh, bd);
+            for (i = 0; i < 7; i++) {
+                c[7 - i] = p[i];
+                c[8 + i] = q[i];
+            }
+            transpose_8x8_lanes_avx2(c, x);
+            transpose_8x8_lanes_avx2(c + 8, x + 8);
+            for (i = 0; i < 8; i++) {
+                r[i] = _mm256_permute2x128_si256(x[i], x[i + 8], 0x20);
+                r[i + 8] = _mm256_permute2x128_si256(x[i], x[i + 8], 0x31);
+            }
+            for (i = 0; i < rows; i++)
+                _mm256_storeu_si256((__m256i *)(s - 8 + i * pitch), r[i]);
+        }
+        else {
+            for (i = 0; i < 8; i++) {
+                const __m128i lo = i < rows ?
+                    _mm_loadu_si128((const __m128i *)(s - 4 + i * pitch)) :
+                    _mm_setzero_si128();
+                const __m128i hi = i + 8 < rows ?
+                    _mm_loadu_si128((const __m128i *)(s - 4 + (i + 8) * pitch)) :
+                    _mm_setzero_si128();
+                x[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            }
+            transpose_8x8_lanes_avx2(x, c);
+            for (i = 0; i < 4; i++) {
+                p[i] = c[3 - i];
+                q[i] = c[4 + i];
+            }
+            lpf_filter_avx2(p, q, taps, blimit, limit, thresh, bd);
+            for (i = 0; i < 4; i++) {
+                c[3 - i] = p[i];
+                c[4 + i] = q[i];
+            }
+            transpose_8x8_lanes_avx2(c, x);
+            for (i = 0; i < rows; i++)
+                _mm_storeu_si128((__m128i *)(s - 4 + i * pitch), i < 8 ?
+                    _mm256_castsi256_si128(x[i]) :
+                    _mm256_extracti128_si256(x[i - 8], 1));
+        }
+        s += 16 * pitch;
+        count -= 4;
+    }
+}
+
+void aom_lpf_horizontal_4_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, 4);
+}
+
+void aom_lpf_horizontal_6_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, 6);
+}
+
+void aom_lpf_horizontal_8_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, 8);
+}
+
+void aom_lpf_horizontal_14_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, 14);
+}
+
+void aom_lpf_vertical_4_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, 4);
+}
+
+void aom_lpf_vertical_6_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, 6);
+}
+
+void aom_lpf_vertical_8_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, 8);
+}
+
+void aom_lpf_vertical_14_multi_avx2(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, 14);
+}
+
+void aom_highbd_lpf_horizontal_4_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, bd, 4);
+}
+
+void aom_highbd_lpf_horizontal_6_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, bd, 6);
+}
+
+void aom_highbd_lpf_horizontal_8_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, bd, 8);
+}
+
+void aom_highbd_lpf_horizontal_14_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_horizontal_avx2(s, pitch, blimit, limit, thresh, count, bd, 14);
+}
+
+void aom_highbd_lpf_vertical_4_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, bd, 4);
+}
+
+void aom_highbd_lpf_vertical_6_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, bd, 6);
+}
+
+void aom_highbd_lpf_vertical_8_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, bd, 8);
+}
+
+void aom_highbd_lpf_vertical_14_multi_avx2(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    highbd_lpf_vertical_avx2(s, pitch, blimit, limit, thresh, count, bd, 14);
+}
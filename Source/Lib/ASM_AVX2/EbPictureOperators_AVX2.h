@@ -41,6 +41,56 @@ extern "C" {
         uint32_t     width,
         uint32_t     height);
 
+    void EB_ENC_msbUnPack2D_AVX2_INTRIN(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *out8BitBuffer,
+        uint8_t       *outnBitBuffer,
+        uint32_t       out8Stride,
+        uint32_t       outnStride,
+        uint32_t       width,
+        uint32_t       height);
+
+    void EB_ENC_UnPack8BitData_AVX2_INTRIN(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *out8BitBuffer,
+        uint32_t       out8Stride,
+        uint32_t       width,
+        uint32_t       height);
+
+    void EB_ENC_msbUnPackShift2D_AVX2_INTRIN(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *out8BitBuffer,
+        uint8_t       *outnBitBuffer,
+        uint32_t       out8Stride,
+        uint32_t       outnStride,
+        uint32_t       shift,
+        uint32_t       width,
+        uint32_t       height);
+
+    void EB_ENC_Deinterleave2D_AVX2_INTRIN(
+        uint8_t       *inBuffer,
+        uint32_t       inStride,
+        uint8_t       *outCbBuffer,
+        uint8_t       *outCrBuffer,
+        uint32_t       outStride,
+        uint32_t       width,
+        uint32_t       height);
+
+    void EB_ENC_msbUnPackDeinterleave2D_AVX2_INTRIN(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *outCb8BitBuffer,
+        uint8_t       *outCr8BitBuffer,
+        uint8_t       *outCbnBitBuffer,
+        uint8_t       *outCrnBitBuffer,
+        uint32_t       out8Stride,
+        uint32_t       outnStride,
+        uint32_t       shift,
+        uint32_t       width,
+        uint32_t       height);
 
     void UnpackAvg_AVX2_INTRIN(
         uint16_t *ref16L0,
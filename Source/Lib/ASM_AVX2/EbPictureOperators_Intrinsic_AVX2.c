@@ -543,6 +543,205 @@ void EB_ENC_msbPack2D_AVX2_INTRIN_AL(
     }
 }
 
+// Stores 32 10 bit samples as 8 bit and 2 bit (in the MSBs) samples
+static INLINE void UnPackStore32_AVX2(
+    __m256i        inPixel0,
+    __m256i        inPixel1,
+    uint8_t       *out8BitBuffer,
+    uint8_t       *outnBitBuffer)
+{
+    const __m256i mask2Bit = _mm256_set1_epi16(0x0003);
+    __m256i out8Bit, outnBit;
+
+    out8Bit = _mm256_packus_epi16(_mm256_srli_epi16(inPixel0, 2), _mm256_srli_epi16(inPixel1, 2));
+    outnBit = _mm256_packus_epi16(
+        _mm256_slli_epi16(_mm256_and_si256(inPixel0, mask2Bit), 6),
+        _mm256_slli_epi16(_mm256_and_si256(inPixel1, mask2Bit), 6));
+
+    // packus works within the 128 bit lanes
+    _mm256_storeu_si256((__m256i*)out8BitBuffer, _mm256_permute4x64_epi64(out8Bit, 0xD8));
+    _mm256_storeu_si256((__m256i*)outnBitBuffer, _mm256_permute4x64_epi64(outnBit, 0xD8));
+}
+
+void EB_ENC_msbUnPack2D_AVX2_INTRIN(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *out8BitBuffer,
+    uint8_t       *outnBitBuffer,
+    uint32_t       out8Stride,
+    uint32_t       outnStride,
+    uint32_t       width,
+    uint32_t       height)
+{
+    const __m256i mask10Bit = _mm256_set1_epi16(0x03FF);
+    __m256i inPixel0, inPixel1;
+    uint32_t x, y;
+    uint16_t inPixel;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            inPixel0 = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(in16BitBuffer + x)), mask10Bit);
+            inPixel1 = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(in16BitBuffer + x + 16)), mask10Bit);
+            UnPackStore32_AVX2(inPixel0, inPixel1, out8BitBuffer + x, outnBitBuffer + x);
+        }
+        for (; x < width; x++) {
+            inPixel = in16BitBuffer[x];
+            out8BitBuffer[x] = (uint8_t)(inPixel >> 2);
+            outnBitBuffer[x] = (uint8_t)(inPixel << 6);
+        }
+        in16BitBuffer += inStride;
+        out8BitBuffer += out8Stride;
+        outnBitBuffer += outnStride;
+    }
+}
+
+void EB_ENC_UnPack8BitData_AVX2_INTRIN(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *out8BitBuffer,
+    uint32_t       out8Stride,
+    uint32_t       width,
+    uint32_t       height)
+{
+    const __m256i mask8Bit = _mm256_set1_epi16(0x00FF);
+    __m256i inPixel0, inPixel1;
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            inPixel0 = _mm256_and_si256(_mm256_srli_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + x)), 2), mask8Bit);
+            inPixel1 = _mm256_and_si256(_mm256_srli_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + x + 16)), 2), mask8Bit);
+            _mm256_storeu_si256((__m256i*)(out8BitBuffer + x), _mm256_permute4x64_epi64(_mm256_packus_epi16(inPixel0, inPixel1), 0xD8));
+        }
+        for (; x < width; x++)
+            out8BitBuffer[x] = (uint8_t)(in16BitBuffer[x] >> 2);
+        in16BitBuffer += inStride;
+        out8BitBuffer += out8Stride;
+    }
+}
+
+void EB_ENC_msbUnPackShift2D_AVX2_INTRIN(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *out8BitBuffer,
+    uint8_t       *outnBitBuffer,
+    uint32_t       out8Stride,
+    uint32_t       outnStride,
+    uint32_t       shift,
+    uint32_t       width,
+    uint32_t       height)
+{
+    const __m128i shiftCount = _mm_cvtsi32_si128(shift);
+    const __m256i mask10Bit = _mm256_set1_epi16(0x03FF);
+    __m256i inPixel0, inPixel1;
+    uint32_t x, y;
+    uint16_t inPixel;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            inPixel0 = _mm256_and_si256(_mm256_srl_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + x)), shiftCount), mask10Bit);
+            inPixel1 = _mm256_and_si256(_mm256_srl_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + x + 16)), shiftCount), mask10Bit);
+            UnPackStore32_AVX2(inPixel0, inPixel1, out8BitBuffer + x, outnBitBuffer + x);
+        }
+        for (; x < width; x++) {
+            inPixel = (in16BitBuffer[x] >> shift) & 0x3FF;
+            out8BitBuffer[x] = (uint8_t)(inPixel >> 2);
+            outnBitBuffer[x] = (uint8_t)(inPixel << 6);
+        }
+        in16BitBuffer += inStride;
+        out8BitBuffer += out8Stride;
+        outnBitBuffer += outnStride;
+    }
+}
+
+void EB_ENC_Deinterleave2D_AVX2_INTRIN(
+    uint8_t       *inBuffer,
+    uint32_t       inStride,
+    uint8_t       *outCbBuffer,
+    uint8_t       *outCrBuffer,
+    uint32_t       outStride,
+    uint32_t       width,
+    uint32_t       height)
+{
+    const __m256i maskLow = _mm256_set1_epi16(0x00FF);
+    __m256i inPixel0, inPixel1, outCb, outCr;
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            inPixel0 = _mm256_loadu_si256((__m256i*)(inBuffer + 2 * x));
+            inPixel1 = _mm256_loadu_si256((__m256i*)(inBuffer + 2 * x + 32));
+            outCb = _mm256_packus_epi16(_mm256_and_si256(inPixel0, maskLow), _mm256_and_si256(inPixel1, maskLow));
+            outCr = _mm256_packus_epi16(_mm256_srli_epi16(inPixel0, 8), _mm256_srli_epi16(inPixel1, 8));
+            _mm256_storeu_si256((__m256i*)(outCbBuffer + x), _mm256_permute4x64_epi64(outCb, 0xD8));
+            _mm256_storeu_si256((__m256i*)(outCrBuffer + x), _mm256_permute4x64_epi64(outCr, 0xD8));
+        }
+        for (; x < width; x++) {
+            outCbBuffer[x] = inBuffer[2 * x];
+            outCrBuffer[x] = inBuffer[2 * x + 1];
+        }
+        inBuffer += inStride;
+        outCbBuffer += outStride;
+        outCrBuffer += outStride;
+    }
+}
+
+void EB_ENC_msbUnPackDeinterleave2D_AVX2_INTRIN(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *outCb8BitBuffer,
+    uint8_t       *outCr8BitBuffer,
+    uint8_t       *outCbnBitBuffer,
+    uint8_t       *outCrnBitBuffer,
+    uint32_t       out8Stride,
+    uint32_t       outnStride,
+    uint32_t       shift,
+    uint32_t       width,
+    uint32_t       height)
+{
+    const __m128i shiftCount = _mm_cvtsi32_si128(shift);
+    const __m256i mask10Bit = _mm256_set1_epi32(0x03FF);
+    __m256i inPixel0, inPixel1, inPixel2, inPixel3;
+    __m256i inCb0, inCb1, inCr0, inCr1;
+    uint32_t x, y;
+    uint16_t inCbPixel, inCrPixel;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            // One Cb Cr pair per 32 bit element, Cb in the low half
+            inPixel0 = _mm256_srl_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + 2 * x)), shiftCount);
+            inPixel1 = _mm256_srl_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + 2 * x + 16)), shiftCount);
+            inPixel2 = _mm256_srl_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + 2 * x + 32)), shiftCount);
+            inPixel3 = _mm256_srl_epi16(_mm256_loadu_si256((__m256i*)(in16BitBuffer + 2 * x + 48)), shiftCount);
+
+            inCb0 = _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(inPixel0, mask10Bit), _mm256_and_si256(inPixel1, mask10Bit)), 0xD8);
+            inCb1 = _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_and_si256(inPixel2, mask10Bit), _mm256_and_si256(inPixel3, mask10Bit)), 0xD8);
+            inCr0 = _mm256_permute4x64_epi64(_mm256_packus_epi32(
+                _mm256_and_si256(_mm256_srli_epi32(inPixel0, 16), mask10Bit),
+                _mm256_and_si256(_mm256_srli_epi32(inPixel1, 16), mask10Bit)), 0xD8);
+            inCr1 = _mm256_permute4x64_epi64(_mm256_packus_epi32(
+                _mm256_and_si256(_mm256_srli_epi32(inPixel2, 16), mask10Bit),
+                _mm256_and_si256(_mm256_srli_epi32(inPixel3, 16), mask10Bit)), 0xD8);
+
+            UnPackStore32_AVX2(inCb0, inCb1, outCb8BitBuffer + x, outCbnBitBuffer + x);
+            UnPackStore32_AVX2(inCr0, inCr1, outCr8BitBuffer + x, outCrnBitBuffer + x);
+        }
+        for (; x < width; x++) {
+            inCbPixel = (in16BitBuffer[2 * x] >> shift) & 0x3FF;
+            inCrPixel = (in16BitBuffer[2 * x + 1] >> shift) & 0x3FF;
+            outCb8BitBuffer[x] = (uint8_t)(inCbPixel >> 2);
+            outCr8BitBuffer[x] = (uint8_t)(inCrPixel >> 2);
+            outCbnBitBuffer[x] = (uint8_t)(inCbPixel << 6);
+            outCrnBitBuffer[x] = (uint8_t)(inCrPixel << 6);
+        }
+        in16BitBuffer += inStride;
+        outCb8BitBuffer += out8Stride;
+        outCr8BitBuffer += out8Stride;
+        outCbnBitBuffer += outnStride;
+        outCrnBitBuffer += outnStride;
+    }
+}
+
 #define ALSTORE  1
 #define B256     1
 
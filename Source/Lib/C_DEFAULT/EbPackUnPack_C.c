@@ -149,6 +149,86 @@ void EB_ENC_msbUnPack2D(
     }
 
 }
+/************************************************
+* unpack 10 bit samples shifted left by shift bits
+* within their 16 bit words
+************************************************/
+void EB_ENC_msbUnPackShift2D(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *out8BitBuffer,
+    uint8_t       *outnBitBuffer,
+    uint32_t       out8Stride,
+    uint32_t       outnStride,
+    uint32_t       shift,
+    uint32_t       width,
+    uint32_t       height)
+{
+    uint64_t   j, k;
+    uint16_t   inPixel;
+    for (j = 0; j < height; j++)
+    {
+        for (k = 0; k < width; k++)
+        {
+            inPixel = (in16BitBuffer[k + j * inStride] >> shift) & 0x3FF;
+            out8BitBuffer[k + j * out8Stride] = (uint8_t)(inPixel >> 2);
+            outnBitBuffer[k + j * outnStride] = (uint8_t)(inPixel << 6);
+        }
+    }
+}
+/************************************************
+* split interleaved Cb Cr 8 bit data
+************************************************/
+void EB_ENC_Deinterleave2D(
+    uint8_t       *inBuffer,
+    uint32_t       inStride,
+    uint8_t       *outCbBuffer,
+    uint8_t       *outCrBuffer,
+    uint32_t       outStride,
+    uint32_t       width,
+    uint32_t       height)
+{
+    uint64_t   j, k;
+    for (j = 0; j < height; j++)
+    {
+        for (k = 0; k < width; k++)
+        {
+            outCbBuffer[k + j * outStride] = inBuffer[2 * k + j * inStride];
+            outCrBuffer[k + j * outStride] = inBuffer[2 * k + 1 + j * inStride];
+        }
+    }
+}
+/************************************************
+* split and unpack interleaved Cb Cr 10 bit data
+************************************************/
+void EB_ENC_msbUnPackDeinterleave2D(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *outCb8BitBuffer,
+    uint8_t       *outCr8BitBuffer,
+    uint8_t       *outCbnBitBuffer,
+    uint8_t       *outCrnBitBuffer,
+    uint32_t       out8Stride,
+    uint32_t       outnStride,
+    uint32_t       shift,
+    uint32_t       width,
+    uint32_t       height)
+{
+    uint64_t   j, k;
+    uint16_t   inCbPixel, inCrPixel;
+    for (j = 0; j < height; j++)
+    {
+        for (k = 0; k < width; k++)
+        {
+            inCbPixel = (in16BitBuffer[2 * k + j * inStride] >> shift) & 0x3FF;
+            inCrPixel = (in16BitBuffer[2 * k + 1 + j * inStride] >> shift) & 0x3FF;
+            outCb8BitBuffer[k + j * out8Stride] = (uint8_t)(inCbPixel >> 2);
+            outCr8BitBuffer[k + j * out8Stride] = (uint8_t)(inCrPixel >> 2);
+            outCbnBitBuffer[k + j * outnStride] = (uint8_t)(inCbPixel << 6);
+            outCrnBitBuffer[k + j * outnStride] = (uint8_t)(inCrPixel << 6);
+        }
+    }
+}
 void UnPack8BitData(
     uint16_t      *in16BitBuffer,
     uint32_t       inStride,
@@ -15,6 +15,7 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "EbDefinitions.h"
 #include "EbBitstreamUnit.h"
@@ -60,43 +61,26 @@ EbErrorType output_bitstream_reset(
 }
 
 /**********************************
- * Output RBSP to payload
- *   Intended to be used in CABAC
+ * Set Bitstream Buffer
  **********************************/
-EbErrorType output_bitstream_rbsp_to_payload(
+void output_bitstream_set_buffer(
     OutputBitstreamUnit_t   *bitstream_ptr,
-    EbByte                  output_buffer,
-    uint32_t                *output_buffer_index,
-    uint32_t                *output_buffer_size,
-    uint32_t                 start_location)
+    uint8_t                 *buffer,
+    uint32_t                 size)
 {
-    EbErrorType return_error = EB_ErrorNone;
-    uint32_t  buffer_written_bytes_count = (uint32_t)(bitstream_ptr->bufferAv1 - bitstream_ptr->bufferBeginAv1);
-    uint32_t  write_location = start_location;
-    uint32_t  read_location = start_location;
-    EbByte read_byte_ptr;
-    EbByte write_byte_ptr;
-    // IVF data
-    read_byte_ptr = (EbByte)bitstream_ptr->bufferBeginAv1;
-    write_byte_ptr = &output_buffer[*output_buffer_index];
-    //frame_count++;
-    while ((read_location < buffer_written_bytes_count)) {
-        if ((*output_buffer_index) < (*output_buffer_size)) {
-            write_byte_ptr[write_location++] = read_byte_ptr[read_location];
-            *output_buffer_index += 1;
-        }
-        read_location++;
-    }
-
-    return return_error;
+    bitstream_ptr->size = size;
+    bitstream_ptr->writtenBitsCount = 0;
+    bitstream_ptr->bufferBeginAv1 = buffer;
+    bitstream_ptr->bufferAv1 = buffer;
 }
 /********************************************************************************************************************************/
 /********************************************************************************************************************************/
 /********************************************************************************************************************************/
 /********************************************************************************************************************************/
 // daalaboolwriter.c
-void aom_daala_start_encode(daala_writer *br, uint8_t *source) {
+void aom_daala_start_encode(daala_writer *br, uint8_t *source, uint32_t size) {
     br->buffer = source;
+    br->size = size;
     br->pos = 0;
     od_ec_enc_init(&br->ec, 62025);
 }
@@ -107,6 +91,12 @@ int32_t aom_daala_stop_encode(daala_writer *br) {
     uint8_t *daala_data;
     daala_data = od_ec_enc_done(&br->ec, &daala_bytes);
     nb_bits = od_ec_enc_tell(&br->ec);
+    // The coder grows its own buffer, the copy must fit the caller's
+    if (daala_data == NULL || daala_bytes > br->size) {
+        br->pos = 0;
+        od_ec_enc_clear(&br->ec);
+        return -1;
+    }
     memcpy(br->buffer, daala_data, daala_bytes);
     br->pos = daala_bytes;
     od_ec_enc_clear(&br->ec);
@@ -26,6 +26,11 @@ extern "C" {
         uint8_t     *bufferAv1;                             // the byte buffer
     } OutputBitstreamUnit_t;
 
+    // Count of bytes written since the last reset
+    static INLINE uint32_t output_bitstream_written_bytes(OutputBitstreamUnit_t *bitstreamPtr) {
+        return (uint32_t)(bitstreamPtr->bufferAv1 - bitstreamPtr->bufferBeginAv1);
+    }
+
     /**********************************
      * Extern Function Declarations
      **********************************/
@@ -36,14 +41,11 @@ extern "C" {
 
     extern EbErrorType output_bitstream_reset(OutputBitstreamUnit_t *bitstreamPtr);
 
-
-
-    extern EbErrorType output_bitstream_rbsp_to_payload(
+    // Writes go to size bytes at buffer, owned by the caller
+    extern void output_bitstream_set_buffer(
         OutputBitstreamUnit_t *bitstreamPtr,
-        EbByte                outputBuffer,
-        uint32_t                *outputBufferIndex,
-        uint32_t                *outputBufferSize,
-        uint32_t                 startLocation);
+        uint8_t               *buffer,
+        uint32_t               size);
 
     /********************************************************************************************************************************/
     /********************************************************************************************************************************/
@@ -245,13 +247,14 @@ on a larger type, you can speed up the decoder by using it here.*/
     struct daala_writer {
         uint32_t pos;
         uint8_t *buffer;
+        uint32_t size;      // bytes available at buffer
         od_ec_enc ec;
         uint8_t allow_update_cdf;
     };
 
     typedef struct daala_writer daala_writer;
 
-    void aom_daala_start_encode(daala_writer *w, uint8_t *buffer);
+    void aom_daala_start_encode(daala_writer *w, uint8_t *buffer, uint32_t size);
     int32_t aom_daala_stop_encode(daala_writer *w);
 
     static INLINE void aom_daala_write(daala_writer *w, int32_t bit, int32_t prob) {
@@ -312,8 +315,8 @@ on a larger type, you can speed up the decoder by using it here.*/
         token_stats->cost = 0;
     }
 
-    static INLINE void aom_start_encode(aom_writer *bc, uint8_t *buffer) {
-        aom_daala_start_encode(bc, buffer);
+    static INLINE void aom_start_encode(aom_writer *bc, uint8_t *buffer, uint32_t size) {
+        aom_daala_start_encode(bc, buffer, size);
     }
 
     static INLINE int32_t aom_stop_encode(aom_writer *bc) {
@@ -427,6 +427,9 @@ void* cdef_kernel(void *input_ptr)
     //// Output
     EbObjectWrapper_t                       *cdef_results_wrapper_ptr;
     CdefResults_t                           *cdef_results_ptr;
+#if CDEF_M
+    EbBool                                   last_segment;
+#endif
 
     // SB Loop variables
 
@@ -441,6 +444,7 @@ void* cdef_kernel(void *input_ptr)
         dlf_results_ptr = (DlfResults_t*)dlf_results_wrapper_ptr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)dlf_results_ptr->picture_control_set_wrapper_ptr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, dlf_results_ptr->segment_index);
 
         EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
         Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
@@ -466,12 +470,18 @@ void* cdef_kernel(void *input_ptr)
 #endif
 
         //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
+        //the last segment finishes the picture outside of the mutex so that it can wait for its output buffers
         EbBlockOnMutex(picture_control_set_ptr->cdef_search_mutex);
 
         picture_control_set_ptr->tot_seg_searched_cdef++;
-        if (picture_control_set_ptr->tot_seg_searched_cdef == picture_control_set_ptr->cdef_segments_total_count)
+        last_segment = (picture_control_set_ptr->tot_seg_searched_cdef == picture_control_set_ptr->cdef_segments_total_count) ? EB_TRUE : EB_FALSE;
+
+        EbReleaseMutex(picture_control_set_ptr->cdef_search_mutex);
+
+        if (last_segment)
         {
 #endif
+            EbTraceBegin("CdefFinish", picture_control_set_ptr->picture_number, 0);
 
            // printf("    CDEF all seg here  %i\n", picture_control_set_ptr->picture_number);
 
@@ -622,10 +632,10 @@ void* cdef_kernel(void *input_ptr)
         // Post Cdef Results
         EbPostFullObject(cdefResultsWrapperPtr);
 #endif
+            EbTraceEnd("CdefFinish");
 
 #if CDEF_M
         }
-        EbReleaseMutex(picture_control_set_ptr->cdef_search_mutex);
 #endif
 
         // Release Dlf Results
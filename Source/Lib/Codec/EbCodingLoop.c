@@ -41,6 +41,7 @@ extern void av1_predict_intra_block(
     uint8_t                     intra_chroma_left_mode,
     uint8_t                     intra_chroma_top_mode,
     const BlockGeom            *blk_geom,
+    const TileInfo             *tile,
     const Av1Common *cm,
     int32_t wpx,
     int32_t hpx,
@@ -2166,8 +2167,8 @@ EbErrorType QpmDeriveBeaAndSkipQpmFlagLcu(
 #else
     uint8_t                           picture_qp = picture_control_set_ptr->picture_qp;
 
-    uint8_t                           min_qp_allowed = (uint8_t)sequence_control_set_ptr->static_config.min_qp_allowed;
-    uint8_t                           max_qp_allowed = (uint8_t)sequence_control_set_ptr->static_config.max_qp_allowed;
+    uint8_t                           min_qp_allowed = picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed;
+    uint8_t                           max_qp_allowed = picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed;
 #endif
 
 
@@ -2415,8 +2416,8 @@ EbErrorType EncQpmDeriveDeltaQPForEachLeafLcu(
     int64_t                          complexityDistance;
     int8_t                           delta_qp = 0;
     uint8_t                           qpmQp = (uint8_t)context_ptr->qpmQp;
-    uint8_t                           min_qp_allowed = (uint8_t)sequence_control_set_ptr->static_config.min_qp_allowed;
-    uint8_t                           max_qp_allowed = (uint8_t)sequence_control_set_ptr->static_config.max_qp_allowed;
+    uint8_t                           min_qp_allowed = picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed;
+    uint8_t                           max_qp_allowed = picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed;
     uint8_t                           cu_qp;
 
 #if ENCODER_MODE_CLEANUP
@@ -3295,6 +3296,7 @@ EB_EXTERN void AV1EncodePass(
                                         cu_ptr->prediction_unit_array[0].intra_chroma_left_mode,
                                         cu_ptr->prediction_unit_array[0].intra_chroma_top_mode,
                                         context_ptr->blk_geom,
+                                        &sb_ptr->tile_info,
                                         picture_control_set_ptr->parent_pcs_ptr->av1_cm,                  //const Av1Common *cm,
                                         plane ? blk_geom->bwidth_uv : blk_geom->bwidth,                   //int32_t wpx,
                                         plane ? blk_geom->bheight_uv : blk_geom->bheight,                  //int32_t hpx,
@@ -212,6 +212,8 @@ extern "C" {
         int32_t mi_row_start, mi_row_end;
         int32_t mi_col_start, mi_col_end;
         int32_t tg_horz_boundary;
+        int32_t tile_row;
+        int32_t tile_col;
     } TileInfo;
     typedef struct MacroBlockD {
         // block dimension in the unit of mode_info.
@@ -369,6 +371,9 @@ extern "C" {
         // Quantized Coefficients
         EbPictureBufferDesc_t          *quantized_coeff;
 
+        // Tile of the SB
+        TileInfo                        tile_info;
+
     } LargestCodingUnit_t;
 
     extern EbErrorType largest_coding_unit_ctor(
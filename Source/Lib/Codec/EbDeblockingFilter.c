@@ -23,6 +23,7 @@
 #include "EbSequenceControlSet.h"
 #include "EbReferenceObject.h"
 #include "EbDeblockingFilter.h"
+#include "aom_dsp_rtcd.h"
 
 #define   convertToChromaQp(iQpY)  ( ((iQpY) < 0) ? (iQpY) : (((iQpY) > 57) ? ((iQpY)-6) : (int32_t)(MapChromaQp((uint32_t)iQpY))) )
 
@@ -263,6 +264,22 @@ void aom_lpf_horizontal_6_c(uint8_t *s, int32_t p, const uint8_t *blimit,
     }
 }
 
+void aom_lpf_vertical_6_c(uint8_t *s, int32_t pitch, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh) {
+    int32_t i;
+    int32_t count = 4;
+
+    for (i = 0; i < count; ++i) {
+        const uint8_t p2 = s[-3], p1 = s[-2], p0 = s[-1];
+        const uint8_t q0 = s[0], q1 = s[1], q2 = s[2];
+        const int8_t mask =
+            filter_mask3_chroma(*limit, *blimit, p2, p1, p0, q0, q1, q2);
+        const int8_t flat = flat_mask3_chroma(1, p2, p1, p0, q0, q1, q2);
+        filter6(mask, *thresh, flat, s - 3, s - 2, s - 1, s, s + 1, s + 2);
+        s += pitch;
+    }
+}
+
 void aom_lpf_horizontal_8_c(uint8_t *s, int32_t p, const uint8_t *blimit,
     const uint8_t *limit, const uint8_t *thresh) {
     int32_t i;
@@ -366,6 +383,32 @@ static INLINE void filter14(int8_t mask, uint8_t thresh, int8_t flat,
 }
 
 
+static void mb_lpf_horizontal_edge_w(uint8_t *s, int32_t p, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    int32_t i;
+
+    for (i = 0; i < count; ++i) {
+        const uint8_t p6 = s[-7 * p], p5 = s[-6 * p], p4 = s[-5 * p],
+            p3 = s[-4 * p], p2 = s[-3 * p], p1 = s[-2 * p], p0 = s[-p];
+        const uint8_t q0 = s[0 * p], q1 = s[1 * p], q2 = s[2 * p], q3 = s[3 * p],
+            q4 = s[4 * p], q5 = s[5 * p], q6 = s[6 * p];
+        const int8_t mask =
+            filter_mask(*limit, *blimit, p3, p2, p1, p0, q0, q1, q2, q3);
+        const int8_t flat = flat_mask4(1, p3, p2, p1, p0, q0, q1, q2, q3);
+        const int8_t flat2 = flat_mask4(1, p6, p5, p4, p0, q0, q4, q5, q6);
+
+        filter14(mask, *thresh, flat, flat2, s - 7 * p, s - 6 * p, s - 5 * p,
+            s - 4 * p, s - 3 * p, s - 2 * p, s - 1 * p, s, s + 1 * p, s + 2 * p,
+            s + 3 * p, s + 4 * p, s + 5 * p, s + 6 * p);
+        ++s;
+    }
+}
+
+void aom_lpf_horizontal_14_c(uint8_t *s, int32_t p, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh) {
+    mb_lpf_horizontal_edge_w(s, p, blimit, limit, thresh, 4);
+}
 
 static void mb_lpf_vertical_edge_w(uint8_t *s, int32_t p, const uint8_t *blimit,
     const uint8_t *limit, const uint8_t *thresh,
@@ -388,6 +431,10 @@ static void mb_lpf_vertical_edge_w(uint8_t *s, int32_t p, const uint8_t *blimit,
     }
 }
 
+void aom_lpf_vertical_14_c(uint8_t *s, int32_t p, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh) {
+    mb_lpf_vertical_edge_w(s, p, blimit, limit, thresh, 4);
+}
 
 void aom_lpf_vertical_14_dual_c(uint8_t *s, int32_t p, const uint8_t *blimit,
     const uint8_t *limit, const uint8_t *thresh) {
@@ -635,6 +682,44 @@ void aom_highbd_lpf_vertical_8_c(uint16_t *s, int32_t pitch, const uint8_t *blim
     }
 }
 
+void aom_highbd_lpf_horizontal_6_c(uint16_t *s, int32_t p, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh,
+    int32_t bd) {
+    int32_t i;
+    int32_t count = 4;
+
+    for (i = 0; i < count; ++i) {
+        const uint16_t p2 = s[-3 * p], p1 = s[-2 * p], p0 = s[-p];
+        const uint16_t q0 = s[0 * p], q1 = s[1 * p], q2 = s[2 * p];
+        const int8_t mask =
+            highbd_filter_mask3_chroma(*limit, *blimit, p2, p1, p0, q0, q1, q2, bd);
+        const int8_t flat =
+            highbd_flat_mask3_chroma(1, p2, p1, p0, q0, q1, q2, bd);
+        highbd_filter6(mask, *thresh, flat, s - 3 * p, s - 2 * p, s - 1 * p, s,
+            s + 1 * p, s + 2 * p, bd);
+        ++s;
+    }
+}
+
+void aom_highbd_lpf_vertical_6_c(uint16_t *s, int32_t pitch, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh,
+    int32_t bd) {
+    int32_t i;
+    int32_t count = 4;
+
+    for (i = 0; i < count; ++i) {
+        const uint16_t p2 = s[-3], p1 = s[-2], p0 = s[-1];
+        const uint16_t q0 = s[0], q1 = s[1], q2 = s[2];
+        const int8_t mask =
+            highbd_filter_mask3_chroma(*limit, *blimit, p2, p1, p0, q0, q1, q2, bd);
+        const int8_t flat =
+            highbd_flat_mask3_chroma(1, p2, p1, p0, q0, q1, q2, bd);
+        highbd_filter6(mask, *thresh, flat, s - 3, s - 2, s - 1, s, s + 1, s + 2,
+            bd);
+        s += pitch;
+    }
+}
+
 
 static INLINE void highbd_filter14(int8_t mask, uint8_t thresh, int8_t flat,
     int8_t flat2, uint16_t *op6, uint16_t *op5,
@@ -697,6 +782,203 @@ static INLINE void highbd_filter14(int8_t mask, uint8_t thresh, int8_t flat,
     }
 }
 
+void aom_highbd_lpf_horizontal_14_c(uint16_t *s, int32_t p, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh,
+    int32_t bd) {
+    int32_t i;
+    int32_t count = 4;
+
+    for (i = 0; i < count; ++i) {
+        const uint16_t p6 = s[-7 * p], p5 = s[-6 * p], p4 = s[-5 * p],
+            p3 = s[-4 * p], p2 = s[-3 * p], p1 = s[-2 * p], p0 = s[-p];
+        const uint16_t q0 = s[0 * p], q1 = s[1 * p], q2 = s[2 * p], q3 = s[3 * p],
+            q4 = s[4 * p], q5 = s[5 * p], q6 = s[6 * p];
+        const int8_t mask =
+            highbd_filter_mask(*limit, *blimit, p3, p2, p1, p0, q0, q1, q2, q3, bd);
+        const int8_t flat =
+            highbd_flat_mask4(1, p3, p2, p1, p0, q0, q1, q2, q3, bd);
+        const int8_t flat2 =
+            highbd_flat_mask4(1, p6, p5, p4, p0, q0, q4, q5, q6, bd);
+
+        highbd_filter14(mask, *thresh, flat, flat2, s - 7 * p, s - 6 * p,
+            s - 5 * p, s - 4 * p, s - 3 * p, s - 2 * p, s - 1 * p, s, s + 1 * p,
+            s + 2 * p, s + 3 * p, s + 4 * p, s + 5 * p, s + 6 * p, bd);
+        ++s;
+    }
+}
+
+void aom_highbd_lpf_vertical_14_c(uint16_t *s, int32_t pitch, const uint8_t *blimit,
+    const uint8_t *limit, const uint8_t *thresh,
+    int32_t bd) {
+    int32_t i;
+    int32_t count = 4;
+
+    for (i = 0; i < count; ++i) {
+        const uint16_t p6 = s[-7], p5 = s[-6], p4 = s[-5], p3 = s[-4],
+            p2 = s[-3], p1 = s[-2], p0 = s[-1];
+        const uint16_t q0 = s[0], q1 = s[1], q2 = s[2], q3 = s[3], q4 = s[4],
+            q5 = s[5], q6 = s[6];
+        const int8_t mask =
+            highbd_filter_mask(*limit, *blimit, p3, p2, p1, p0, q0, q1, q2, q3, bd);
+        const int8_t flat =
+            highbd_flat_mask4(1, p3, p2, p1, p0, q0, q1, q2, q3, bd);
+        const int8_t flat2 =
+            highbd_flat_mask4(1, p6, p5, p4, p0, q0, q4, q5, q6, bd);
+
+        highbd_filter14(mask, *thresh, flat, flat2, s - 7, s - 6, s - 5, s - 4,
+            s - 3, s - 2, s - 1, s, s + 1, s + 2, s + 3, s + 4, s + 5, s + 6, bd);
+        s += pitch;
+    }
+}
+
+
+
+// Filter count consecutive 4-sample segments of an edge sharing the same
+// filter length and limits: along x for horizontal edges, along y for
+// vertical edges.
+void aom_lpf_horizontal_4_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_horizontal_4_c(s, pitch, blimit, limit, thresh);
+        s += 4;
+    }
+}
+
+void aom_lpf_horizontal_6_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_horizontal_6_c(s, pitch, blimit, limit, thresh);
+        s += 4;
+    }
+}
+
+void aom_lpf_horizontal_8_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_horizontal_8_c(s, pitch, blimit, limit, thresh);
+        s += 4;
+    }
+}
+
+void aom_lpf_horizontal_14_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_horizontal_14_c(s, pitch, blimit, limit, thresh);
+        s += 4;
+    }
+}
+
+void aom_lpf_vertical_4_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_vertical_4_c(s, pitch, blimit, limit, thresh);
+        s += 4 * pitch;
+    }
+}
+
+void aom_lpf_vertical_6_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_vertical_6_c(s, pitch, blimit, limit, thresh);
+        s += 4 * pitch;
+    }
+}
+
+void aom_lpf_vertical_8_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_vertical_8_c(s, pitch, blimit, limit, thresh);
+        s += 4 * pitch;
+    }
+}
+
+void aom_lpf_vertical_14_multi_c(uint8_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_lpf_vertical_14_c(s, pitch, blimit, limit, thresh);
+        s += 4 * pitch;
+    }
+}
+
+void aom_highbd_lpf_horizontal_4_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_horizontal_4_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4;
+    }
+}
+
+void aom_highbd_lpf_horizontal_6_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_horizontal_6_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4;
+    }
+}
+
+void aom_highbd_lpf_horizontal_8_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_horizontal_8_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4;
+    }
+}
+
+void aom_highbd_lpf_horizontal_14_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_horizontal_14_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4;
+    }
+}
+
+void aom_highbd_lpf_vertical_4_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_vertical_4_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4 * pitch;
+    }
+}
+
+void aom_highbd_lpf_vertical_6_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_vertical_6_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4 * pitch;
+    }
+}
+
+void aom_highbd_lpf_vertical_8_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_vertical_8_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4 * pitch;
+    }
+}
+
+void aom_highbd_lpf_vertical_14_multi_c(uint16_t *s, int32_t pitch,
+    const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh,
+    int32_t count, int32_t bd) {
+    for (int32_t i = 0; i < count; ++i) {
+        aom_highbd_lpf_vertical_14_c(s, pitch, blimit, limit, thresh, bd);
+        s += 4 * pitch;
+    }
+}
 
 
 //**********************************************************************************************************************//
@@ -708,8 +990,6 @@ static INLINE void highbd_filter14(int8_t mask, uint8_t thresh, int8_t flat,
 //};
 
 
-typedef enum EDGE_DIR { VERT_EDGE = 0, HORZ_EDGE = 1, NUM_EDGE_DIRS } EDGE_DIR;
-
 static const int32_t mode_lf_lut[] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // INTRA_MODES
     1, 1, 0, 1,                             // INTER_MODES (GLOBALMV == 0)
@@ -1122,6 +1402,96 @@ static TxSize set_lpf_parameters(
     return ts;
 }
 
+// Filter count consecutive edge segments sharing the filter length and limits
+// of params, stacked along y for vertical edges and along x for horizontal ones
+static void filter_edge_segments(
+    const EDGE_DIR edge_dir, uint8_t *p, const int32_t dst_stride,
+    const AV1_DEBLOCKING_PARAMETERS *const params, const int32_t count,
+    const EbBool is16bit, const int32_t bit_depth) {
+    uint16_t *p16 = (uint16_t*)p;//CONVERT_TO_SHORTPTR(p)
+    const uint8_t *const blimit = params->mblim;
+    const uint8_t *const limit = params->lim;
+    const uint8_t *const thresh = params->hev_thr;
+
+    switch (params->filter_length) {
+        // apply 4-tap filtering
+    case 4:
+        if (edge_dir == VERT_EDGE) {
+            if (is16bit)
+                aom_highbd_lpf_vertical_4_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_vertical_4_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        else {
+            if (is16bit)
+                aom_highbd_lpf_horizontal_4_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_horizontal_4_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        break;
+        // apply 6-tap filtering, chroma plane only
+    case 6:
+        if (edge_dir == VERT_EDGE) {
+            if (is16bit)
+                aom_highbd_lpf_vertical_6_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_vertical_6_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        else {
+            if (is16bit)
+                aom_highbd_lpf_horizontal_6_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_horizontal_6_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        break;
+        // apply 8-tap filtering
+    case 8:
+        if (edge_dir == VERT_EDGE) {
+            if (is16bit)
+                aom_highbd_lpf_vertical_8_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_vertical_8_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        else {
+            if (is16bit)
+                aom_highbd_lpf_horizontal_8_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_horizontal_8_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        break;
+        // apply 14-tap filtering
+    case 14:
+        if (edge_dir == VERT_EDGE) {
+            if (is16bit)
+                aom_highbd_lpf_vertical_14_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_vertical_14_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        else {
+            if (is16bit)
+                aom_highbd_lpf_horizontal_14_multi(p16, dst_stride, blimit, limit, thresh, count, bit_depth);
+            else
+                aom_lpf_horizontal_14_multi(p, dst_stride, blimit, limit, thresh, count);
+        }
+        break;
+        // no filtering
+    default: break;
+    }
+}
+
+// Number of segments following params[0] (spaced by step) that share its
+// filter length and limits, up to max_count
+static INLINE int32_t count_edge_segments(
+    const AV1_DEBLOCKING_PARAMETERS *const params, const int32_t step,
+    const int32_t max_count) {
+    int32_t count = 1;
+    while (count < max_count &&
+        params[count * step].filter_length == params->filter_length &&
+        params[count * step].mblim == params->mblim)
+        ++count;
+    return count;
+}
+
 void av1_filter_block_plane_vert(
     const PictureControlSet_t *const  pcsPtr,
     const MacroBlockD *const xd, const int32_t plane,
@@ -1137,8 +1507,10 @@ void av1_filter_block_plane_vert(
     const int32_t dst_stride = plane_ptr->dst.stride;
     const int32_t y_range = scsPtr->sb_size == BLOCK_128X128 ? (MAX_MIB_SIZE >> scale_vert) : (SB64_MIB_SIZE >> scale_vert);
     const int32_t x_range = scsPtr->sb_size == BLOCK_128X128 ? (MAX_MIB_SIZE >> scale_horz) : (SB64_MIB_SIZE >> scale_horz);
+    AV1_DEBLOCKING_PARAMETERS params[MAX_MIB_SIZE][MAX_MIB_SIZE];
+
+    // gather the edge parameters of every 4x4 unit first
     for (int32_t y = 0; y < y_range; y += row_step) {
-        uint8_t *p = dst_ptr + ((y * MI_SIZE * dst_stride) << plane_ptr->is16Bit);
         for (int32_t x = 0; x < x_range;) {
             // inner loop always filter vertical edges in a MI block. If MI size
             // is 8x8, it will filter the vertical edge aligned with a 8x8 block.
@@ -1148,98 +1520,46 @@ void av1_filter_block_plane_vert(
             const uint32_t curr_y = ((mi_row * MI_SIZE) >> scale_vert) + y * MI_SIZE;
             uint32_t advance_units;
             TxSize tx_size;
-            AV1_DEBLOCKING_PARAMETERS params;
-            memset(&params, 0, sizeof(params));
+            AV1_DEBLOCKING_PARAMETERS *const curr_params = &params[y][x];
+            memset(curr_params, 0, sizeof(*curr_params));
 
             tx_size =
-                set_lpf_parameters(&params, ((uint64_t)1 << scale_horz), pcsPtr, xd,
+                set_lpf_parameters(curr_params, ((uint64_t)1 << scale_horz), pcsPtr, xd,
                     VERT_EDGE, curr_x, curr_y, plane, plane_ptr);
             if (tx_size == TX_INVALID) {
-                params.filter_length = 0;
+                curr_params->filter_length = 0;
                 tx_size = TX_4X4;
             }
+            assert(curr_params->filter_length != 6 || plane != 0);
 
-            switch (params.filter_length) {
-                // apply 4-tap filtering
-            case 4:
-                if (is16bit)
-                    aom_highbd_lpf_vertical_4(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_vertical_4(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-            case 6:  // apply 6-tap filter for chroma plane only
-                assert(plane != 0);
-                if (is16bit)
-                    aom_highbd_lpf_vertical_6(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_vertical_6(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // apply 8-tap filtering
-            case 8:
-                if (is16bit)
-                    aom_highbd_lpf_vertical_8(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_vertical_8(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // apply 14-tap filtering
-            case 14:
-                if (is16bit)
-                    aom_highbd_lpf_vertical_14(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_vertical_14(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // no filtering
-            default: break;
-            }
-            // advance the destination pointer
+            // advance to the next edge, the units inside the transform block
+            // have no vertical edge
             ASSERT(tx_size < TX_SIZES_ALL);
             advance_units = tx_size_wide_unit[tx_size];
-            x += advance_units;
-            p += ((advance_units * MI_SIZE) << plane_ptr->is16Bit);
+            for (x++; --advance_units && x < x_range; x++)
+                params[y][x].filter_length = 0;
+        }
+    }
+
+    // then filter the edges column by column, so each row still sees its
+    // edges from left to right, with the segments stacked along y batched
+    for (int32_t x = 0; x < x_range; x++) {
+        for (int32_t y = 0; y < y_range;) {
+            int32_t count;
+            if (!params[y][x].filter_length) {
+                y += row_step;
+                continue;
+            }
+            count = count_edge_segments(&params[y][x], MAX_MIB_SIZE, y_range - y);
+            filter_edge_segments(
+                VERT_EDGE,
+                dst_ptr + ((y * MI_SIZE * dst_stride + x * MI_SIZE) << plane_ptr->is16Bit),
+                dst_stride,
+                &params[y][x],
+                count,
+                is16bit,
+                scsPtr->static_config.encoder_bit_depth);
+            y += count;
         }
     }
 }
@@ -1260,8 +1580,10 @@ void av1_filter_block_plane_horz(
     const int32_t y_range = scsPtr->sb_size == BLOCK_128X128 ? (MAX_MIB_SIZE >> scale_vert) : (SB64_MIB_SIZE >> scale_vert);
     const int32_t x_range = scsPtr->sb_size == BLOCK_128X128 ? (MAX_MIB_SIZE >> scale_horz) : (SB64_MIB_SIZE >> scale_horz);
     uint32_t mi_stride = pcsPtr->parent_pcs_ptr->sequence_control_set_ptr->picture_width_in_sb*(BLOCK_SIZE_64 >> MI_SIZE_LOG2);
+    AV1_DEBLOCKING_PARAMETERS params[MAX_MIB_SIZE][MAX_MIB_SIZE];
+
+    // gather the edge parameters of every 4x4 unit first
     for (int32_t x = 0; x < x_range; x += col_step) {
-        uint8_t *p = dst_ptr + ((x * MI_SIZE) << plane_ptr->is16Bit);
         for (int32_t y = 0; y < y_range;) {
             // inner loop always filter vertical edges in a MI block. If MI size
             // is 8x8, it will first filter the vertical edge aligned with a 8x8
@@ -1271,13 +1593,12 @@ void av1_filter_block_plane_horz(
             const uint32_t curr_y = ((mi_row * MI_SIZE) >> scale_vert) + y * MI_SIZE;
             uint32_t advance_units;
             TxSize tx_size;
-            AV1_DEBLOCKING_PARAMETERS params;
-            memset(&params, 0, sizeof(params));
-
+            AV1_DEBLOCKING_PARAMETERS *const curr_params = &params[y][x];
+            memset(curr_params, 0, sizeof(*curr_params));
 
             tx_size =
                 set_lpf_parameters(
-                    &params,
+                    curr_params,
                     //(pcsPtr->parent_pcs_ptr->av1_cm->mi_stride << scale_vert),
                     (mi_stride << scale_vert),
                     pcsPtr,
@@ -1288,97 +1609,42 @@ void av1_filter_block_plane_horz(
                     plane,
                     plane_ptr);
             if (tx_size == TX_INVALID) {
-                params.filter_length = 0;
+                curr_params->filter_length = 0;
                 tx_size = TX_4X4;
             }
+            assert(curr_params->filter_length != 6 || plane != 0);
 
-            switch (params.filter_length) {
-                // apply 4-tap filtering
-            case 4:
-                if (is16bit)
-                    aom_highbd_lpf_horizontal_4(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_horizontal_4(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // apply 6-tap filtering
-            case 6:
-                assert(plane != 0);
-                if (is16bit)
-                    aom_highbd_lpf_horizontal_6(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_horizontal_6(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // apply 8-tap filtering
-            case 8:
-                if (is16bit)
-                    aom_highbd_lpf_horizontal_8(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_horizontal_8(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // apply 14-tap filtering
-            case 14:
-                if (is16bit)
-                    aom_highbd_lpf_horizontal_14(
-                    (uint16_t*)(p),//CONVERT_TO_SHORTPTR(p),
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr,
-                        scsPtr->static_config.encoder_bit_depth);
-                else
-                    aom_lpf_horizontal_14(
-                        p,
-                        dst_stride,
-                        params.mblim,
-                        params.lim,
-                        params.hev_thr);
-                break;
-                // no filtering
-            default: break;
-            }
-
-            // advance the destination pointer
+            // advance to the next edge, the units inside the transform block
+            // have no horizontal edge
             ASSERT(tx_size < TX_SIZES_ALL);
             advance_units = tx_size_high_unit[tx_size];
-            y += advance_units;
-            p += ((advance_units * dst_stride * MI_SIZE) << plane_ptr->is16Bit);
+            for (y++; --advance_units && y < y_range; y++)
+                params[y][x].filter_length = 0;
         }
     }
-}
 
+    // then filter the edges row by row, so each column still sees its edges
+    // from top to bottom, with the segments side by side along x batched
+    for (int32_t y = 0; y < y_range; y++) {
+        for (int32_t x = 0; x < x_range;) {
+            int32_t count;
+            if (!params[y][x].filter_length) {
+                x += col_step;
+                continue;
+            }
+            count = count_edge_segments(&params[y][x], 1, x_range - x);
+            filter_edge_segments(
+                HORZ_EDGE,
+                dst_ptr + ((y * MI_SIZE * dst_stride + x * MI_SIZE) << plane_ptr->is16Bit),
+                dst_stride,
+                &params[y][x],
+                count,
+                is16bit,
+                scsPtr->static_config.encoder_bit_depth);
+            x += count;
+        }
+    }
+}
 
 // New function to filter each sb (64x64)
 void loop_filter_sb(
@@ -1499,6 +1765,65 @@ void av1_loop_filter_frame(
     }
 
 }
+
+// Filter the vertical or the horizontal edges of one plane of one SB.
+static void loop_filter_sb_plane(
+    EbPictureBufferDesc_t *frame_buffer,
+    PictureControlSet_t *picture_control_set_ptr,
+    int32_t plane,
+    uint32_t xLcuIndex,
+    uint32_t yLcuIndex,
+    EDGE_DIR edge_dir) {
+
+    SequenceControlSet_t *scsPtr = (SequenceControlSet_t*)picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+    uint8_t                                   sb_size_Log2 = (uint8_t)Log2f(scsPtr->sb_size_pix);
+    int32_t                                    mi_row = (yLcuIndex << sb_size_Log2) >> MI_SIZE_LOG2;
+    int32_t                                    mi_col = (xLcuIndex << sb_size_Log2) >> MI_SIZE_LOG2;
+    struct MacroblockdPlane                    pd[3];
+
+    pd[plane].subsampling_x = plane ? 1 : 0;
+    pd[plane].subsampling_y = plane ? 1 : 0;
+    pd[plane].plane_type = plane ? PLANE_TYPE_UV : PLANE_TYPE_Y;
+    pd[plane].is16Bit = frame_buffer->bit_depth > 8;
+
+    av1_setup_dst_planes(pd, scsPtr->sb_size, frame_buffer, mi_row,
+        mi_col, plane, plane + 1);
+    if (edge_dir == VERT_EDGE)
+        av1_filter_block_plane_vert(picture_control_set_ptr, NULL, plane, &pd[plane], mi_row, mi_col);
+    else
+        av1_filter_block_plane_horz(picture_control_set_ptr, NULL, plane, &pd[plane], mi_row, mi_col);
+}
+
+// Filter the vertical or the horizontal edges of one SB row. The vertical edges
+// of a row only touch the row itself, while its horizontal edges also touch the
+// bottom lines of the row above. av1_loop_filter_frame_init() must have been called.
+void av1_loop_filter_sb_row(
+    EbPictureBufferDesc_t *frame_buffer,
+    PictureControlSet_t *picture_control_set_ptr,
+    uint32_t sb_row,
+    int32_t plane_start, int32_t plane_end,
+    EDGE_DIR edge_dir) {
+
+    SequenceControlSet_t *scsPtr = (SequenceControlSet_t*)picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+    struct loopfilter *const lf = &picture_control_set_ptr->parent_pcs_ptr->lf;
+    uint32_t                                   xLcuIndex;
+    int32_t                                    plane;
+
+    uint32_t picture_width_in_sb = (scsPtr->luma_width + scsPtr->sb_size_pix - 1) / scsPtr->sb_size_pix;
+
+    for (plane = plane_start; plane < plane_end; plane++) {
+        if (plane == 0 && !lf->filter_level[0] && !lf->filter_level[1])
+            break;
+        else if (plane == 1 && !lf->filter_level_u)
+            continue;
+        else if (plane == 2 && !lf->filter_level_v)
+            continue;
+
+        for (xLcuIndex = 0; xLcuIndex < picture_width_in_sb; ++xLcuIndex)
+            loop_filter_sb_plane(frame_buffer, picture_control_set_ptr, plane, xLcuIndex, sb_row, edge_dir);
+    }
+}
+
 extern int16_t av1_ac_quant_Q3(int32_t qindex, int32_t delta, aom_bit_depth_t bit_depth);
 
 void EbCopyBuffer(
@@ -1770,6 +2095,223 @@ uint64_t PictureSseCalculations(
     }
 }
 
+// Distance between two SBs picked by LPF_PICK_FROM_SB_SAMPLES along a row or a column
+#define LPF_SB_SAMPLING_STEP 4
+
+// The band of SB rows across the middle of the picture LPF_PICK_FROM_SUBIMAGE takes
+static void lpf_subimage_band(
+    uint32_t picture_height_in_sb,
+    uint32_t *band_start,
+    uint32_t *band_height) {
+
+    *band_height = MAX(picture_height_in_sb / 8, 1);
+    *band_start = (picture_height_in_sb - *band_height) / 2;
+}
+
+// Whether the SB takes part in the filter level trials of the search method.
+// LPF_PICK_FROM_SUBIMAGE takes a band of SB rows across the middle of the picture,
+// LPF_PICK_FROM_SB_SAMPLES takes one SB out of LPF_SB_SAMPLING_STEP along diagonals
+// so that every SB row and column of the picture is sampled.
+static EbBool lpf_trial_sb(
+    LPF_PICK_METHOD method,
+    uint32_t xLcuIndex,
+    uint32_t yLcuIndex,
+    uint32_t picture_height_in_sb) {
+
+    if (method == LPF_PICK_FROM_SUBIMAGE) {
+        uint32_t band_start;
+        uint32_t band_height;
+        lpf_subimage_band(picture_height_in_sb, &band_start, &band_height);
+        return (EbBool)(yLcuIndex >= band_start && yLcuIndex < band_start + band_height);
+    }
+    if (method == LPF_PICK_FROM_SB_SAMPLES)
+        return (EbBool)((xLcuIndex + yLcuIndex) % LPF_SB_SAMPLING_STEP == 0);
+    return EB_TRUE;
+}
+
+// Number of SB rows, from the top, EncDec must have reconstructed before the filter
+// level search can run. The trials filter the band of LPF_PICK_FROM_SUBIMAGE in place,
+// so the row below the band, which predicts from the unfiltered band, must be done too.
+uint32_t av1_lpf_pick_sb_row_count(
+    LPF_PICK_METHOD method,
+    uint32_t picture_height_in_sb) {
+
+    uint32_t band_start;
+    uint32_t band_height;
+
+    if (method != LPF_PICK_FROM_SUBIMAGE)
+        return picture_height_in_sb;
+
+    lpf_subimage_band(picture_height_in_sb, &band_start, &band_height);
+    return MIN(band_start + band_height + 1, picture_height_in_sb);
+}
+
+// Returns the sample pointer and the stride of a plane of the picture at (x, y)
+static EbByte lpf_plane_sample(
+    EbPictureBufferDesc_t *picturePtr,
+    int32_t plane,
+    uint32_t x,
+    uint32_t y,
+    EbBool is16bit,
+    uint32_t *stride) {
+
+    EbByte   buffer = plane == 0 ? picturePtr->bufferY : plane == 1 ? picturePtr->bufferCb : picturePtr->bufferCr;
+    uint32_t ss = plane ? 1 : 0;
+
+    *stride = plane == 0 ? picturePtr->strideY : plane == 1 ? picturePtr->strideCb : picturePtr->strideCr;
+
+    return buffer + (((picturePtr->origin_x >> ss) + x + ((picturePtr->origin_y >> ss) + y) * *stride) << is16bit);
+}
+
+// Sum of squared errors between the source and the recon over an area of a plane
+static uint64_t RegionSseCalculations(
+    PictureControlSet_t    *picture_control_set_ptr,
+    EbPictureBufferDesc_t  *reconPtr,
+    int32_t plane,
+    uint32_t x,
+    uint32_t y,
+    uint32_t width,
+    uint32_t height) {
+
+    SequenceControlSet_t   *sequence_control_set_ptr = picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_ptr;
+    EbBool is16bit = (sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    EbPictureBufferDesc_t *inputPicturePtr = is16bit ?
+        picture_control_set_ptr->input_frame16bit :
+        (EbPictureBufferDesc_t*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
+    uint32_t   inputStride;
+    uint32_t   reconStride;
+    EbByte     inputBuffer = lpf_plane_sample(inputPicturePtr, plane, x, y, is16bit, &inputStride);
+    EbByte     reconBuffer = lpf_plane_sample(reconPtr, plane, x, y, is16bit, &reconStride);
+    uint64_t   residualDistortion = 0;
+    uint32_t   rowIndex;
+    uint32_t   columnIndex;
+
+    for (rowIndex = 0; rowIndex < height; ++rowIndex) {
+        if (is16bit) {
+            for (columnIndex = 0; columnIndex < width; ++columnIndex)
+                residualDistortion += (int64_t)SQR((int64_t)((uint16_t*)inputBuffer)[columnIndex] - (int64_t)((uint16_t*)reconBuffer)[columnIndex]);
+        }
+        else {
+            for (columnIndex = 0; columnIndex < width; ++columnIndex)
+                residualDistortion += (int64_t)SQR((int64_t)inputBuffer[columnIndex] - (int64_t)reconBuffer[columnIndex]);
+        }
+        inputBuffer += inputStride << is16bit;
+        reconBuffer += reconStride << is16bit;
+    }
+
+    return residualDistortion;
+}
+
+// Copies an area of a plane between two pictures of the same layout
+static void EbCopyBufferRegion(
+    EbPictureBufferDesc_t  *srcBuffer,
+    EbPictureBufferDesc_t  *dstBuffer,
+    int32_t plane,
+    uint32_t x,
+    uint32_t y,
+    uint32_t width,
+    uint32_t height,
+    EbBool is16bit) {
+
+    uint32_t   srcStride;
+    uint32_t   dstStride;
+    EbByte     src = lpf_plane_sample(srcBuffer, plane, x, y, is16bit, &srcStride);
+    EbByte     dst = lpf_plane_sample(dstBuffer, plane, x, y, is16bit, &dstStride);
+    uint32_t   rowIndex;
+
+    for (rowIndex = 0; rowIndex < height; ++rowIndex) {
+        EB_MEMCPY(dst, src, width << is16bit);
+        src += srcStride << is16bit;
+        dst += dstStride << is16bit;
+    }
+}
+
+// Copies the SBs sampled by the search method, with the area of the SBs on the left and
+// above whose pixels the edges of the SB modify.
+static void copy_sb_samples(
+    EbPictureBufferDesc_t  *srcBuffer,
+    EbPictureBufferDesc_t  *dstBuffer,
+    PictureControlSet_t *pcsPtr,
+    LPF_PICK_METHOD method,
+    int32_t plane) {
+
+    SequenceControlSet_t *scsPtr = (SequenceControlSet_t*)pcsPtr->parent_pcs_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+    EbBool is16bit = (EbBool)(scsPtr->static_config.encoder_bit_depth > EB_8BIT);
+    uint32_t picture_width_in_sb = (scsPtr->luma_width + scsPtr->sb_size_pix - 1) / scsPtr->sb_size_pix;
+    uint32_t picture_height_in_sb = (scsPtr->luma_height + scsPtr->sb_size_pix - 1) / scsPtr->sb_size_pix;
+    uint32_t ss = plane ? 1 : 0;
+    uint32_t sb_size = scsPtr->sb_size_pix >> ss;
+    uint32_t plane_width = plane ? scsPtr->chroma_width : scsPtr->luma_width;
+    uint32_t plane_height = plane ? scsPtr->chroma_height : scsPtr->luma_height;
+    uint32_t xLcuIndex;
+    uint32_t yLcuIndex;
+
+    for (yLcuIndex = 0; yLcuIndex < picture_height_in_sb; ++yLcuIndex) {
+        for (xLcuIndex = 0; xLcuIndex < picture_width_in_sb; ++xLcuIndex) {
+            if (lpf_trial_sb(method, xLcuIndex, yLcuIndex, picture_height_in_sb)) {
+                uint32_t x = xLcuIndex ? xLcuIndex * sb_size - 8 : 0;
+                uint32_t y = yLcuIndex ? yLcuIndex * sb_size - 8 : 0;
+                EbCopyBufferRegion(srcBuffer, dstBuffer, plane, x, y,
+                    MIN((xLcuIndex + 1) * sb_size, plane_width) - x, MIN((yLcuIndex + 1) * sb_size, plane_height) - y, is16bit);
+            }
+        }
+    }
+}
+
+// Filters the SBs sampled by the search method, measures their error then restores them
+// from the copy made by copy_sb_samples().
+static int64_t try_filter_sb_samples(
+    EbPictureBufferDesc_t  *reconBuffer,
+    EbPictureBufferDesc_t  *tempLfReconBuffer,
+    PictureControlSet_t *pcsPtr,
+    LPF_PICK_METHOD method,
+    int32_t plane) {
+
+    SequenceControlSet_t *scsPtr = (SequenceControlSet_t*)pcsPtr->parent_pcs_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+    struct loopfilter *const lf = &pcsPtr->parent_pcs_ptr->lf;
+    uint32_t picture_width_in_sb = (scsPtr->luma_width + scsPtr->sb_size_pix - 1) / scsPtr->sb_size_pix;
+    uint32_t picture_height_in_sb = (scsPtr->luma_height + scsPtr->sb_size_pix - 1) / scsPtr->sb_size_pix;
+    uint32_t ss = plane ? 1 : 0;
+    uint32_t sb_size = scsPtr->sb_size_pix >> ss;
+    uint32_t plane_width = plane ? scsPtr->chroma_width : scsPtr->luma_width;
+    uint32_t plane_height = plane ? scsPtr->chroma_height : scsPtr->luma_height;
+    const EbBool filterFlag = (EbBool)(plane == 0 ? (lf->filter_level[0] || lf->filter_level[1]) :
+        plane == 1 ? lf->filter_level_u : lf->filter_level_v);
+    uint32_t xLcuIndex;
+    uint32_t yLcuIndex;
+    int64_t filt_err = 0;
+
+    av1_loop_filter_frame_init(pcsPtr, plane, plane + 1);
+
+    for (yLcuIndex = 0; yLcuIndex < picture_height_in_sb && filterFlag; ++yLcuIndex) {
+        for (xLcuIndex = 0; xLcuIndex < picture_width_in_sb; ++xLcuIndex) {
+            if (lpf_trial_sb(method, xLcuIndex, yLcuIndex, picture_height_in_sb))
+                loop_filter_sb_plane(reconBuffer, pcsPtr, plane, xLcuIndex, yLcuIndex, VERT_EDGE);
+        }
+        for (xLcuIndex = 0; xLcuIndex < picture_width_in_sb; ++xLcuIndex) {
+            if (lpf_trial_sb(method, xLcuIndex, yLcuIndex, picture_height_in_sb))
+                loop_filter_sb_plane(reconBuffer, pcsPtr, plane, xLcuIndex, yLcuIndex, HORZ_EDGE);
+        }
+    }
+
+    for (yLcuIndex = 0; yLcuIndex < picture_height_in_sb; ++yLcuIndex) {
+        for (xLcuIndex = 0; xLcuIndex < picture_width_in_sb; ++xLcuIndex) {
+            if (lpf_trial_sb(method, xLcuIndex, yLcuIndex, picture_height_in_sb)) {
+                uint32_t x = xLcuIndex * sb_size;
+                uint32_t y = yLcuIndex * sb_size;
+                filt_err += RegionSseCalculations(pcsPtr, reconBuffer, plane, x, y,
+                    MIN(sb_size, plane_width - x), MIN(sb_size, plane_height - y));
+            }
+        }
+    }
+
+    // Re-instate the unfiltered SBs
+    if (filterFlag)
+        copy_sb_samples(tempLfReconBuffer, reconBuffer, pcsPtr, method, plane);
+
+    return filt_err;
+}
+
 static int64_t try_filter_frame(
     //const Yv12BufferConfig *sd,
     //AV1_COMP *const cpi,
@@ -1777,9 +2319,7 @@ static int64_t try_filter_frame(
     EbPictureBufferDesc_t  *tempLfReconBuffer,
     PictureControlSet_t *pcsPtr,
     int32_t filt_level,
-    int32_t partial_frame, int32_t plane, int32_t dir) {
-    (void)sd;
-    (void)partial_frame;
+    LPF_PICK_METHOD method, int32_t plane, int32_t dir) {
     (void)sd;
     int64_t filt_err;
 
@@ -1814,6 +2354,9 @@ static int64_t try_filter_frame(
     case 2: pcsPtr->parent_pcs_ptr->lf.filter_level_v = filter_level[0]; break;
     }
 
+    if (method != LPF_PICK_FROM_FULL_IMAGE)
+        return try_filter_sb_samples(reconBuffer, tempLfReconBuffer, pcsPtr, method, plane);
+
     av1_loop_filter_frame(reconBuffer, pcsPtr, plane, plane + 1);
 
     filt_err = PictureSseCalculations(pcsPtr, reconBuffer, plane);
@@ -1830,7 +2373,7 @@ static int32_t search_filter_level(
     EbPictureBufferDesc_t *sd, // source
     EbPictureBufferDesc_t  *tempLfReconBuffer,
     PictureControlSet_t *pcsPtr,
-    int32_t partial_frame,
+    LPF_PICK_METHOD method,
     const int32_t *last_frame_filter_level,
     double *best_cost_ret, int32_t plane, int32_t dir) {
     const int32_t min_filter_level = 0;
@@ -1873,10 +2416,13 @@ static int32_t search_filter_level(
 
     // Set each entry to -1
     memset(ss_err, 0xFF, sizeof(ss_err));
-    // make a copy of reconBuffer
-    EbCopyBuffer(reconBuffer/*cm->frame_to_show*/, tempLfReconBuffer/*&cpi->last_frame_uf*/, pcsPtr, (uint8_t)plane);
+    // make a copy of reconBuffer, of the sampled SBs only when the trials filter those
+    if (method == LPF_PICK_FROM_FULL_IMAGE)
+        EbCopyBuffer(reconBuffer/*cm->frame_to_show*/, tempLfReconBuffer/*&cpi->last_frame_uf*/, pcsPtr, (uint8_t)plane);
+    else
+        copy_sb_samples(reconBuffer, tempLfReconBuffer, pcsPtr, method, plane);
 
-    best_err = try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_mid, partial_frame, plane, dir);
+    best_err = try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_mid, method, plane, dir);
     filt_best = filt_mid;
     ss_err[filt_mid] = best_err;
 
@@ -1898,7 +2444,7 @@ static int32_t search_filter_level(
         // Get Low filter error score
         if (ss_err[filt_low] < 0) {
             ss_err[filt_low] =
-                try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_low, partial_frame, plane, dir);
+                try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_low, method, plane, dir);
         }
         // If value is close to the best so far then bias towards a lower loop
         // filter value.
@@ -1915,7 +2461,7 @@ static int32_t search_filter_level(
     if (filt_direction >= 0 && filt_high != filt_mid) {
         if (ss_err[filt_high] < 0) {
             ss_err[filt_high] =
-                try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_high, partial_frame, plane, dir);
+                try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_high, method, plane, dir);
         }
         // If value is significantly better than previous best, bias added against
         // raising filter value
@@ -1943,7 +2489,7 @@ static int32_t search_filter_level(
             // Get Low filter error score
             if (ss_err[filt_low] < 0) {
                 ss_err[filt_low] =
-                    try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_low, partial_frame, plane, dir);
+                    try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_low, method, plane, dir);
             }
             // If value is close to the best so far then bias towards a lower loop
             // filter value.
@@ -1960,7 +2506,7 @@ static int32_t search_filter_level(
         if (filt_direction >= 0 && filt_high != filt_mid) {
             if (ss_err[filt_high] < 0) {
                 ss_err[filt_high] =
-                    try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_high, partial_frame, plane, dir);
+                    try_filter_frame(sd, tempLfReconBuffer, pcsPtr, filt_high, method, plane, dir);
             }
             // If value is significantly better than previous best, bias added against
             // raising filter value
@@ -2070,22 +2616,22 @@ void av1_pick_filter_level(
         EbPictureBufferDesc_t  *tempLfReconBuffer = (scsPtr->static_config.encoder_bit_depth != EB_8BIT) ? context_ptr->temp_lf_recon_picture16bit_ptr : context_ptr->temp_lf_recon_picture_ptr;
 
         lf->filter_level[0] = lf->filter_level[1] =
-            search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method == LPF_PICK_FROM_SUBIMAGE,
+            search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method,
                 last_frame_filter_level, NULL, 0, 2);
 #if !DLF_TEST3 && !DLF_TEST4
         lf->filter_level[0] =
-            search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method == LPF_PICK_FROM_SUBIMAGE,
+            search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method,
                 last_frame_filter_level, NULL, 0, 0);
         lf->filter_level[1] =
-            search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method == LPF_PICK_FROM_SUBIMAGE,
+            search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method,
                 last_frame_filter_level, NULL, 0, 1);
 #endif
         if (num_planes > 1) {
             lf->filter_level_u =
-                search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method == LPF_PICK_FROM_SUBIMAGE,
+                search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method,
                     last_frame_filter_level, NULL, 1, 0);
             lf->filter_level_v =
-                search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method == LPF_PICK_FROM_SUBIMAGE,
+                search_filter_level(srcBuffer, tempLfReconBuffer, pcsPtr, method,
                     last_frame_filter_level, NULL, 2, 0);
         }
     }
@@ -140,6 +140,9 @@ extern "C" {
 #define CDEF_REF_ONLY                                   0 //CDEF for ref frame only
 #define REST_REF_ONLY                                   0 //REST for ref frame only
 #define REDUCE_COPY_CDEF                                1
+#ifndef LOCK_FREE_FIFO
+#define LOCK_FREE_FIFO                                  1 // Lock-free MPMC object queues in the system resource manager (0: mutex + semaphore queues)
+#endif
 
 
 /********************************************************/
@@ -208,8 +211,8 @@ extern "C" {
 #define MAX_MIB_MASK (MAX_MIB_SIZE - 1)
 
 // Maximum number of tile rows and tile columns
-#define MAX_TILE_ROWS 1024
-#define MAX_TILE_COLS 1024
+#define MAX_TILE_ROWS 64
+#define MAX_TILE_COLS 64
 #define MAX_VARTX_DEPTH 2
 #define MI_SIZE_64X64 (64 >> MI_SIZE_LOG2)
 #define MI_SIZE_128X128 (128 >> MI_SIZE_LOG2)
@@ -285,6 +288,19 @@ one more than the minimum. */
 #define LF_SHARPNESS 0
 #endif
 
+typedef enum {
+    // Try the full image with different values.
+    LPF_PICK_FROM_FULL_IMAGE,
+    // Try a small portion of the image with different values.
+    LPF_PICK_FROM_SUBIMAGE,
+    // Try a sample of the superblocks spread over the image with different values.
+    LPF_PICK_FROM_SB_SAMPLES,
+    // Estimate the level based on quantizer and frame type
+    LPF_PICK_FROM_Q,
+    // Pick 0 to disable LPF if LPF was enabled last frame
+    LPF_PICK_MINIMAL_LPF
+} LPF_PICK_METHOD;
+
 #define FILTER_BITS 7
 #define SUBPEL_BITS 4
 #define SUBPEL_MASK ((1 << SUBPEL_BITS) - 1)
@@ -2129,7 +2145,8 @@ typedef enum EbPtrType {
     EB_A_PTR = 1,                                   // malloc'd pointer aligned
     EB_MUTEX = 2,                                   // mutex
     EB_SEMAPHORE = 3,                                   // semaphore
-    EB_THREAD = 4                                    // thread handle
+    EB_THREAD = 4,                                   // thread handle
+    EB_FIBER = 5                                     // fiber handle
 } EbPtrType;
 
 typedef struct EbMemoryMapEntry
@@ -2138,6 +2155,91 @@ typedef struct EbMemoryMapEntry
     EbPtrType                ptrType;                   // pointer type
 } EbMemoryMapEntry;
 
+/**************************************
+ * Memory Context
+ *   Allocation bookkeeping of one encoder instance. The calling thread of
+ *   the API functions and the threads of the encoder are bound to the
+ *   memory context of their instance, the allocation macros below record
+ *   into it.
+ *
+ *   Memory lives as long as the encoder instance, blocks of
+ *   EbAllocMemoryEntry excepted. Allocations up to
+ *   EB_ArenaMaxCarveSize are carved back to back from EB_ArenaSlabSize
+ *   slabs, so the objects of a pool end up contiguous, larger ones get
+ *   a block of their own. The table only holds the slabs, the blocks and
+ *   the OS objects; it grows by chunks of EB_MemoryMapChunkSize entries.
+ **************************************/
+#define EB_MemoryMapChunkSize       1024
+#define EB_ArenaSlabSize            (1 << 20)
+#define EB_ArenaMaxCarveSize        (EB_ArenaSlabSize >> 4)
+#define EB_ArenaAlignment           16
+
+typedef struct EbMemoryMapChunk_s
+{
+    struct EbMemoryMapChunk_s *nextPtr;                 // chunk holding the older entries
+    uint32_t                 entryCount;
+    EbMemoryMapEntry         entryArray[EB_MemoryMapChunkSize];
+} EbMemoryMapChunk_t;
+
+typedef struct EbMemoryContext_s
+{
+    EbMemoryMapChunk_t      *memoryMapPtr;              // library Memory table, newest chunk first
+    volatile uint32_t        lock;                      // guards the table and the slab
+
+    uint8_t                 *slabPtr;                   // slab being carved
+    uint64_t                 slabOffset;
+
+    volatile uint64_t        totalLibMemory;            // library Memory malloc'd
+    volatile uint64_t        requestedLibMemory;        // library Memory asked for, slabs counted by what was carved
+
+    volatile uint32_t        libMallocCount;
+    volatile uint32_t        libThreadCount;
+    volatile uint32_t        libSemaphoreCount;
+    volatile uint32_t        libMutexCount;
+} EbMemoryContext_t;
+
+extern EbMemoryContext_t* EbGetMemoryContext(void);
+
+// Binds the calling thread to contextPtr, returns the previous binding
+extern EbMemoryContext_t* EbSetMemoryContext(
+    EbMemoryContext_t  *contextPtr);
+
+// Records ptr in the memory context of the calling thread, thread safe
+extern EbErrorType EbAddMemoryEntry(
+    EbPtr               ptr,
+    EbPtrType           ptrType,
+    uint64_t            size);
+
+// Allocates size bytes from the memory context of the calling thread,
+//   EB_A_PTR memory is ALVALUE aligned. Thread safe, never freed on its own
+extern EbPtr EbArenaAlloc(
+    uint64_t            size,
+    EbPtrType           ptrType,
+    EbBool              zero);
+
+// Allocates size bytes in a block of its own of contextPtr, which
+//   EbFreeMemoryEntry can free before contextPtr is released. Thread safe
+extern EbPtr EbAllocMemoryEntry(
+    EbMemoryContext_t  *contextPtr,
+    uint64_t            size,
+    EbPtrType           ptrType);
+
+// Frees ptr, size bytes returned by EbAllocMemoryEntry. Thread safe
+extern void EbFreeMemoryEntry(
+    EbMemoryContext_t  *contextPtr,
+    EbPtr               ptr,
+    uint64_t            size);
+
+// Destroys the threads of contextPtr, the other objects are left in place
+extern void EbStopMemoryContextThreads(
+    EbMemoryContext_t  *contextPtr);
+
+// Destroys the threads, then every other object and allocation of
+//   contextPtr, newest first. The object counts of contextPtr are back
+//   to 0 afterwards unless something was leaked
+extern EbErrorType EbReleaseMemoryContext(
+    EbMemoryContext_t  *contextPtr);
+
 // Rate Control
 #define THRESHOLD1QPINCREASE     0
 #define THRESHOLD2QPINCREASE     1
@@ -2149,7 +2251,6 @@ typedef struct EbMemoryMapEntry
 #define OIS_COMPLEX_MODE         3
 #define OIS_VERY_COMPLEX_MODE    4
 
-#define MAX_NUM_PTR                                 (0x1312D00 << 2) //0x4C4B4000            // Maximum number of pointers to be allocated for the library
 // Display Total Memory at the end of the memory allocations
 #define DISPLAY_MEMORY                                  0
 
@@ -2157,15 +2258,6 @@ extern    EbMemoryMapEntry        *appMemoryMap;            // App Memory table
 extern    uint32_t                  *appMemoryMapIndex;       // App Memory index
 extern    uint64_t                  *totalAppMemory;          // App Memory malloc'd
 
-extern    EbMemoryMapEntry        *memoryMap;               // library Memory table
-extern    uint32_t                  *memoryMapIndex;          // library memory index
-extern    uint64_t                  *totalLibMemory;          // library Memory malloc'd
-
-extern    uint32_t                   libMallocCount;
-extern    uint32_t                   libThreadCount;
-extern    uint32_t                   libSemaphoreCount;
-extern    uint32_t                   libMutexCount;
-
 extern    uint32_t                   appMallocCount;
 
 #define EB_APP_MALLOC(type, pointer, nElements, pointerClass, returnType) \
@@ -2215,136 +2307,48 @@ appMallocCount++;
 
 #define ALVALUE 32
 
-#ifdef _MSC_VER
 #define EB_ALLIGN_MALLOC(type, pointer, nElements, pointerClass) \
-pointer = (type) _aligned_malloc(nElements,ALVALUE); \
+pointer = (type) EbArenaAlloc(nElements, pointerClass, EB_FALSE); \
 if (pointer == (type)EB_NULL) { \
     return EB_ErrorInsufficientResources; \
-    } \
-    else { \
-    memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-    memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-    if (nElements % 8 == 0) { \
-        *totalLibMemory += (nElements); \
-    } \
-    else { \
-        *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-    } \
-} \
-if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
-    return EB_ErrorInsufficientResources; \
-} \
-libMallocCount++;
-
-#else
-#define EB_ALLIGN_MALLOC(type, pointer, nElements, pointerClass) \
-if (posix_memalign((void**)(&(pointer)), ALVALUE, nElements) != 0) { \
-    return EB_ErrorInsufficientResources; \
-        } \
-            else { \
-    pointer = (type) pointer;  \
-    memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-    memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-    if (nElements % 8 == 0) { \
-        *totalLibMemory += (nElements); \
-            } \
-            else { \
-        *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-    } \
-} \
-if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
-    return EB_ErrorInsufficientResources; \
-    } \
-libMallocCount++;
-#endif
-
+}
 
 #define EB_MALLOC(type, pointer, nElements, pointerClass) \
-pointer = (type) malloc(nElements); \
+pointer = (type) EbArenaAlloc(nElements, pointerClass, EB_FALSE); \
 if (pointer == (type)EB_NULL) { \
     return EB_ErrorInsufficientResources; \
-    } \
-    else { \
-    memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-    memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-    if (nElements % 8 == 0) { \
-        *totalLibMemory += (nElements); \
-    } \
-    else { \
-        *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-    } \
-} \
-if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
-    return EB_ErrorInsufficientResources; \
-} \
-libMallocCount++;
+}
 
 #define EB_CALLOC(type, pointer, count, size, pointerClass) \
-pointer = (type) calloc(count, size); \
+pointer = (type) EbArenaAlloc((uint64_t)(count) * (size), pointerClass, EB_TRUE); \
 if (pointer == (type)EB_NULL) { \
     return EB_ErrorInsufficientResources; \
-} \
-else { \
-    memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-    memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-    if (count % 8 == 0) { \
-        *totalLibMemory += (count); \
-    } \
-    else { \
-        *totalLibMemory += ((count) + (8 - ((count) % 8))); \
-    } \
-} \
-if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
-    return EB_ErrorInsufficientResources; \
-} \
-libMallocCount++;
+}
 
 #define EB_CREATESEMAPHORE(type, pointer, nElements, pointerClass, initialCount, maxCount) \
 pointer = EbCreateSemaphore(initialCount, maxCount); \
 if (pointer == (type)EB_NULL) { \
     return EB_ErrorInsufficientResources; \
 } \
-else { \
-    memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-    memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-    if (nElements % 8 == 0) { \
-        *totalLibMemory += (nElements); \
-    } \
-    else { \
-        *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-    } \
-} \
-if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
+if (EbAddMemoryEntry(pointer, pointerClass, nElements) != EB_ErrorNone) { \
     return EB_ErrorInsufficientResources; \
-} \
-libSemaphoreCount++;
+}
 
 #define EB_CREATEMUTEX(type, pointer, nElements, pointerClass) \
 pointer = EbCreateMutex(); \
 if (pointer == (type)EB_NULL){ \
     return EB_ErrorInsufficientResources; \
 } \
-else { \
-    memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-    memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-    if (nElements % 8 == 0) { \
-        *totalLibMemory += (nElements); \
-    } \
-    else { \
-        *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-    } \
-} \
-if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
+if (EbAddMemoryEntry(pointer, pointerClass, nElements) != EB_ErrorNone) { \
     return EB_ErrorInsufficientResources; \
-} \
-libMutexCount++;
+}
 
 #define EB_MEMORY() \
-printf("Total Number of Mallocs in Library: %d\n", libMallocCount); \
-printf("Total Number of Threads in Library: %d\n", libThreadCount); \
-printf("Total Number of Semaphore in Library: %d\n", libSemaphoreCount); \
-printf("Total Number of Mutex in Library: %d\n", libMutexCount); \
-printf("Total Library Memory: %.2lf KB\n\n",*totalLibMemory/(double)1024);
+printf("Total Number of Mallocs in Library: %d\n", EbGetMemoryContext()->libMallocCount); \
+printf("Total Number of Threads in Library: %d\n", EbGetMemoryContext()->libThreadCount); \
+printf("Total Number of Semaphore in Library: %d\n", EbGetMemoryContext()->libSemaphoreCount); \
+printf("Total Number of Mutex in Library: %d\n", EbGetMemoryContext()->libMutexCount); \
+printf("Total Library Memory: %.2lf KB\n\n",EbGetMemoryContext()->totalLibMemory/(double)1024);
 
 
 #define EB_APP_MEMORY() \
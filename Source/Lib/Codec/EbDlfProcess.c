@@ -34,6 +34,7 @@ EbErrorType dlf_context_ctor(
     DlfContext_t **context_dbl_ptr,
     EbFifo_t                *dlf_input_fifo_ptr,
     EbFifo_t                *dlf_output_fifo_ptr ,
+    EbFifo_t                *dlf_feedback_fifo_ptr,
     EbBool                  is16bit,
     uint32_t                max_input_luma_width,
     uint32_t                max_input_luma_height
@@ -47,6 +48,7 @@ EbErrorType dlf_context_ctor(
     // Input/Output System Resource Manager FIFOs
     context_ptr->dlf_input_fifo_ptr = dlf_input_fifo_ptr;
     context_ptr->dlf_output_fifo_ptr = dlf_output_fifo_ptr;
+    context_ptr->dlf_feedback_fifo_ptr = dlf_feedback_fifo_ptr;
 
 
 
@@ -81,8 +83,276 @@ EbErrorType dlf_context_ctor(
     return return_error;
 }
 
+
+#define DLF_JOB_NONE                0
+#define DLF_JOB_PICK_LEVEL          1
+#define DLF_JOB_VERT_EDGES          2
+#define DLF_JOB_HORZ_EDGES          3
+#define DLF_JOB_PICTURE_DONE        4
+
+#define DLF_ROW_ENCODED             0x1
+#define DLF_ROW_VERT_EDGES_DONE     0x2
+
+/******************************************************
+ * Select Dlf Job
+ *   The filter level is picked once EncDec has
+ *   reconstructed the SB rows the search needs, the whole
+ *   picture but for LPF_PICK_FROM_SUBIMAGE, whose band is
+ *   in the middle. The vertical edges
+ *   of a SB row can be filtered once EncDec is also done
+ *   with the row below, which predicts from the unfiltered
+ *   row. The horizontal edges of a SB row touch the row
+ *   above, so they wait for the vertical edges of the row
+ *   and for the horizontal edges of the row above.
+ *   The dlf_mutex must be held.
+ ******************************************************/
+static uint32_t SelectDlfJob(
+    PictureControlSet_t *picture_control_set_ptr,
+    EbBool               filterFlag,
+    EbBool               claimFlag,
+    uint32_t            *rowIndex)
+{
+    const EbBool encodedFlag = (EbBool)(picture_control_set_ptr->dlf_encoded_row_count == picture_control_set_ptr->dlf_row_count);
+    const uint32_t horzRowIndex = picture_control_set_ptr->dlf_horz_row_index;
+    const uint32_t vertRowIndex = picture_control_set_ptr->dlf_vert_row_index;
+
+    if (filterFlag && !picture_control_set_ptr->dlf_level_ready) {
+        if (picture_control_set_ptr->dlf_encoded_row_count >= av1_lpf_pick_sb_row_count(picture_control_set_ptr->parent_pcs_ptr->lpf_pick_method, picture_control_set_ptr->dlf_row_count) &&
+            !picture_control_set_ptr->dlf_level_in_progress) {
+            if (claimFlag)
+                picture_control_set_ptr->dlf_level_in_progress = EB_TRUE;
+            return DLF_JOB_PICK_LEVEL;
+        }
+        return DLF_JOB_NONE;
+    }
+
+    // The picture is done once no job is left in flight
+    if (!filterFlag || horzRowIndex == picture_control_set_ptr->dlf_row_count) {
+        if (encodedFlag && picture_control_set_ptr->dlf_feedback_count == 0 && !picture_control_set_ptr->dlf_pic_done) {
+            if (claimFlag)
+                picture_control_set_ptr->dlf_pic_done = EB_TRUE;
+            return DLF_JOB_PICTURE_DONE;
+        }
+        return DLF_JOB_NONE;
+    }
+
+    // The horizontal edges are on the critical path
+    if (!picture_control_set_ptr->dlf_horz_in_progress && (picture_control_set_ptr->dlf_row_state[horzRowIndex] & DLF_ROW_VERT_EDGES_DONE)) {
+        if (claimFlag) {
+            picture_control_set_ptr->dlf_horz_in_progress = EB_TRUE;
+            *rowIndex = horzRowIndex;
+        }
+        return DLF_JOB_HORZ_EDGES;
+    }
+
+    if (vertRowIndex < picture_control_set_ptr->dlf_row_count && (encodedFlag || vertRowIndex + 1 < picture_control_set_ptr->dlf_encoded_row_count)) {
+        if (claimFlag) {
+            ++picture_control_set_ptr->dlf_vert_row_index;
+            *rowIndex = vertRowIndex;
+        }
+        return DLF_JOB_VERT_EDGES;
+    }
+
+    return DLF_JOB_NONE;
+}
+
+/******************************************************
+ * Update Dlf Rows
+ *   Records the SB rows reconstructed by EncDec, the
+ *   feedback received and the job just completed, then
+ *   hands out the next job of the picture. moreJobsFlag
+ *   is set when another job is ready as well, in which
+ *   case the caller must post a feedback so that the
+ *   job is taken by another DLF process.
+ ******************************************************/
+static uint32_t UpdateDlfRows(
+    PictureControlSet_t *picture_control_set_ptr,
+    EbBool               filterFlag,
+    uint32_t             encodedRowIndexStart,
+    uint32_t             encodedRowCount,
+    EbBool               feedbackFlag,
+    uint32_t             completedJob,
+    uint32_t            *rowIndex,
+    EbBool              *moreJobsFlag)
+{
+    uint32_t job;
+    uint32_t nextRowIndex;
+
+    EbBlockOnMutex(picture_control_set_ptr->dlf_mutex);
+
+    switch (completedJob) {
+    case DLF_JOB_PICK_LEVEL:
+        picture_control_set_ptr->dlf_level_in_progress = EB_FALSE;
+        picture_control_set_ptr->dlf_level_ready = EB_TRUE;
+        break;
+    case DLF_JOB_VERT_EDGES:
+        picture_control_set_ptr->dlf_row_state[*rowIndex] |= DLF_ROW_VERT_EDGES_DONE;
+        break;
+    case DLF_JOB_HORZ_EDGES:
+        picture_control_set_ptr->dlf_horz_in_progress = EB_FALSE;
+        ++picture_control_set_ptr->dlf_horz_row_index;
+        break;
+    default:
+        break;
+    }
+
+    if (feedbackFlag) {
+        --picture_control_set_ptr->dlf_feedback_count;
+    }
+
+    for (nextRowIndex = encodedRowIndexStart; nextRowIndex < encodedRowIndexStart + encodedRowCount; ++nextRowIndex) {
+        picture_control_set_ptr->dlf_row_state[nextRowIndex] |= DLF_ROW_ENCODED;
+    }
+    while (picture_control_set_ptr->dlf_encoded_row_count < picture_control_set_ptr->dlf_row_count &&
+        (picture_control_set_ptr->dlf_row_state[picture_control_set_ptr->dlf_encoded_row_count] & DLF_ROW_ENCODED)) {
+        ++picture_control_set_ptr->dlf_encoded_row_count;
+    }
+
+    job = SelectDlfJob(picture_control_set_ptr, filterFlag, EB_TRUE, rowIndex);
+    *moreJobsFlag = (EbBool)(job != DLF_JOB_NONE && SelectDlfJob(picture_control_set_ptr, filterFlag, EB_FALSE, &nextRowIndex) != DLF_JOB_NONE);
+    if (*moreJobsFlag) {
+        ++picture_control_set_ptr->dlf_feedback_count;
+    }
+
+    EbReleaseMutex(picture_control_set_ptr->dlf_mutex);
+
+    return job;
+}
+
+/******************************************************
+ * Dlf Picture Done
+ *   Prepares the deblocked picture for CDEF and sends
+ *   its CDEF segments
+ ******************************************************/
+static void DlfPictureDone(
+    DlfContext_t         *context_ptr,
+    SequenceControlSet_t *sequence_control_set_ptr,
+    PictureControlSet_t  *picture_control_set_ptr,
+    EbObjectWrapper_t    *picture_control_set_wrapper_ptr)
+{
+    EbObjectWrapper_t                       *dlf_results_wrapper_ptr;
+    struct DlfResults_s*                     dlf_results_ptr;
+    EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+
+#if CDEF_M
+
+    //pre-cdef prep
+    {
+        Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+        EbPictureBufferDesc_t  * recon_picture_ptr;
+        if (is16bit) {
+            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
+                recon_picture_ptr = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture16bit;
+            else
+                recon_picture_ptr = picture_control_set_ptr->recon_picture16bit_ptr;
+        }
+        else {
+            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
+                recon_picture_ptr = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture;
+            else
+                recon_picture_ptr = picture_control_set_ptr->recon_picture_ptr;
+        }
+
+        LinkEbToAomBufferDesc(
+            recon_picture_ptr,
+            cm->frame_to_show);
+
+        if (sequence_control_set_ptr->enable_restoration) {
+            av1_loop_restoration_save_boundary_lines(cm->frame_to_show, cm, 0);
+        }
+
+#if CDEF_M
+        if (sequence_control_set_ptr->enable_cdef)
+        {
+#endif
+            if (is16bit)
+            {
+                picture_control_set_ptr->src[0] = (uint16_t*)recon_picture_ptr->bufferY + (recon_picture_ptr->origin_x + recon_picture_ptr->origin_y     * recon_picture_ptr->strideY);
+                picture_control_set_ptr->src[1] = (uint16_t*)recon_picture_ptr->bufferCb + (recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCb);
+                picture_control_set_ptr->src[2] = (uint16_t*)recon_picture_ptr->bufferCr + (recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCr);
+
+                EbPictureBufferDesc_t *inputPicturePtr = picture_control_set_ptr->input_frame16bit;
+                picture_control_set_ptr->ref_coeff[0] = (uint16_t*)inputPicturePtr->bufferY + (inputPicturePtr->origin_x + inputPicturePtr->origin_y * inputPicturePtr->strideY);
+                picture_control_set_ptr->ref_coeff[1] = (uint16_t*)inputPicturePtr->bufferCb + (inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCb);
+                picture_control_set_ptr->ref_coeff[2] = (uint16_t*)inputPicturePtr->bufferCr + (inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCr);
+
+            }
+            else
+            {
+                //these copies should go!
+            EbByte  rec_ptr = &((recon_picture_ptr->bufferY)[recon_picture_ptr->origin_x + recon_picture_ptr->origin_y * recon_picture_ptr->strideY]);
+                EbByte  rec_ptr_cb = &((recon_picture_ptr->bufferCb)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCb]);
+                EbByte  rec_ptr_cr = &((recon_picture_ptr->bufferCr)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCr]);
+
+                EbPictureBufferDesc_t *inputPicturePtr = (EbPictureBufferDesc_t*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
+                EbByte  enh_ptr = &((inputPicturePtr->bufferY)[inputPicturePtr->origin_x + inputPicturePtr->origin_y * inputPicturePtr->strideY]);
+                EbByte  enh_ptr_cb = &((inputPicturePtr->bufferCb)[inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCb]);
+                EbByte  enh_ptr_cr = &((inputPicturePtr->bufferCr)[inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCr]);
+
+                for (int r = 0; r < sequence_control_set_ptr->luma_height; ++r) {
+                    for (int c = 0; c < sequence_control_set_ptr->luma_width; ++c) {
+                    picture_control_set_ptr->src[0]      [r * sequence_control_set_ptr->luma_width + c] = rec_ptr[r * recon_picture_ptr->strideY + c];
+                    picture_control_set_ptr->ref_coeff[0][r * sequence_control_set_ptr->luma_width + c] = enh_ptr[r * inputPicturePtr->strideY + c];
+                    }
+                }
+
+            for (int r = 0; r < sequence_control_set_ptr->luma_height/2; ++r) {
+                for (int c = 0; c < sequence_control_set_ptr->luma_width/2; ++c) {
+                    picture_control_set_ptr->src[1][r * sequence_control_set_ptr->luma_width/2 + c] = rec_ptr_cb[r * recon_picture_ptr->strideCb + c];
+                    picture_control_set_ptr->ref_coeff[1][r * sequence_control_set_ptr->luma_width/2 + c] = enh_ptr_cb[r * inputPicturePtr->strideCb + c];
+                        picture_control_set_ptr->src[2][r * sequence_control_set_ptr->luma_width / 2 + c] = rec_ptr_cr[r * recon_picture_ptr->strideCr + c];
+                        picture_control_set_ptr->ref_coeff[2][r * sequence_control_set_ptr->luma_width / 2 + c] = enh_ptr_cr[r * inputPicturePtr->strideCr + c];
+                    }
+                }
+
+            }
+#if CDEF_M
+        }
+#endif
+
+    }
+
+    picture_control_set_ptr->cdef_segments_column_count =  sequence_control_set_ptr->cdef_segment_column_count;
+    picture_control_set_ptr->cdef_segments_row_count = sequence_control_set_ptr->cdef_segment_row_count;
+    picture_control_set_ptr->cdef_segments_total_count  = (uint16_t)(picture_control_set_ptr->cdef_segments_column_count  * picture_control_set_ptr->cdef_segments_row_count);
+    picture_control_set_ptr->tot_seg_searched_cdef = 0;
+    uint32_t segment_index;
+
+    for (segment_index = 0; segment_index < picture_control_set_ptr->cdef_segments_total_count; ++segment_index)
+    {
+        // Get Empty DLF Results to Cdef
+        EbGetEmptyObject(
+            context_ptr->dlf_output_fifo_ptr,
+            &dlf_results_wrapper_ptr);
+        dlf_results_ptr = (struct DlfResults_s*)dlf_results_wrapper_ptr->objectPtr;
+        dlf_results_ptr->picture_control_set_wrapper_ptr = picture_control_set_wrapper_ptr;
+
+        dlf_results_ptr->segment_index = segment_index;
+        // Post DLF Results
+        EbPostFullObject(dlf_results_wrapper_ptr);
+    }
+#else
+
+        // Get Empty DLF Results to Cdef
+        EbGetEmptyObject(
+            context_ptr->dlf_output_fifo_ptr,
+            &dlf_results_wrapper_ptr);
+        dlf_results_ptr = (struct DlfResults_s*)dlf_results_wrapper_ptr->objectPtr;
+        dlf_results_ptr->pictureControlSetWrapperPtr = picture_control_set_wrapper_ptr;
+        dlf_results_ptr->completedLcuRowIndexStart = 0;
+        dlf_results_ptr->completedLcuRowCount = ((sequence_control_set_ptr->luma_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+        // Post DLF Results
+        EbPostFullObject(dlf_results_wrapper_ptr);
+#endif
+}
+
 /******************************************************
  * Dlf Kernel
+ *   Deblocks the pictures SB row by SB row. Each input
+ *   either carries SB rows reconstructed by EncDec or is
+ *   a job posted back by another DLF process, and the
+ *   process keeps taking the ready jobs of the picture
+ *   until there are none left.
  ******************************************************/
 void* dlf_kernel(void *input_ptr)
 {
@@ -95,12 +365,17 @@ void* dlf_kernel(void *input_ptr)
     EbObjectWrapper_t                       *enc_dec_results_wrapper_ptr;
     EncDecResults_t                         *enc_dec_results_ptr;
 
-    //// Output
-    EbObjectWrapper_t                       *dlf_results_wrapper_ptr;
-    struct DlfResults_s*                     dlf_results_ptr;
-
-    // SB Loop variables
+    //// Feedback
+    EbObjectWrapper_t                       *feedback_wrapper_ptr;
+    EncDecResults_t                         *feedback_ptr;
 
+    // Job Loop variables
+    uint32_t                                 job;
+    uint32_t                                 row_index;
+    uint32_t                                 encoded_row_index_start;
+    uint32_t                                 encoded_row_count;
+    EbBool                                   feedback_flag;
+    EbBool                                   more_jobs_flag;
 
     for (;;) {
 
@@ -112,169 +387,110 @@ void* dlf_kernel(void *input_ptr)
         enc_dec_results_ptr = (EncDecResults_t*)enc_dec_results_wrapper_ptr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)enc_dec_results_ptr->pictureControlSetWrapperPtr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
 
         EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
         EbBool dlfEnableFlag = (EbBool)(picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode &&
             (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag ||
                 sequence_control_set_ptr->static_config.recon_enabled ||
                 sequence_control_set_ptr->static_config.stat_report));
+        EbBool filterFlag = (EbBool)(dlfEnableFlag && picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode == 2);
 
-        if (dlfEnableFlag && picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode == 2) {
-
-            EbPictureBufferDesc_t  *recon_buffer = is16bit ? picture_control_set_ptr->recon_picture16bit_ptr : picture_control_set_ptr->recon_picture_ptr;
-            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE) {
-
-                //get the 16bit form of the input LCU
-                if (is16bit) {
-                    recon_buffer = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture16bit;
-                }
-                else {
-                    recon_buffer = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture;
-                }
-            }
-            else { // non ref pictures
-                recon_buffer = is16bit ? picture_control_set_ptr->recon_picture16bit_ptr : picture_control_set_ptr->recon_picture_ptr;
-            }
-
-            av1_loop_filter_init(picture_control_set_ptr);
-
-            av1_pick_filter_level(
-                context_ptr,
-                (EbPictureBufferDesc_t*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
-                picture_control_set_ptr,
-                LPF_PICK_FROM_FULL_IMAGE);
-
-#if NO_ENCDEC
-            //NO DLF
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[0] = 0;
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[1] = 0;
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_u = 0;
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_v = 0;
-#endif
-                av1_loop_filter_frame(
-                    recon_buffer,
-                    picture_control_set_ptr,
-                    0,
-                    3);
-            }
-
-
-#if CDEF_M
+        EbPictureBufferDesc_t  *recon_buffer = is16bit ? picture_control_set_ptr->recon_picture16bit_ptr : picture_control_set_ptr->recon_picture_ptr;
+        if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE) {
 
-        //pre-cdef prep
-        {
-            Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
-            EbPictureBufferDesc_t  * recon_picture_ptr;
+            //get the 16bit form of the input LCU
             if (is16bit) {
-                if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-                    recon_picture_ptr = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture16bit;
-                else
-                    recon_picture_ptr = picture_control_set_ptr->recon_picture16bit_ptr;
+                recon_buffer = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture16bit;
             }
             else {
-                if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-                    recon_picture_ptr = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture;
-                else
-                    recon_picture_ptr = picture_control_set_ptr->recon_picture_ptr;
+                recon_buffer = ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->referencePicture;
             }
+        }
 
-            LinkEbToAomBufferDesc(
-                recon_picture_ptr,
-                cm->frame_to_show);
+        // The feedback posted by the DLF processes carries no row
+        encoded_row_index_start = enc_dec_results_ptr->completedLcuRowIndexStart;
+        encoded_row_count = enc_dec_results_ptr->completedLcuRowCount;
+        feedback_flag = (EbBool)(encoded_row_count == 0);
 
-            if (sequence_control_set_ptr->enable_restoration) {
-                av1_loop_restoration_save_boundary_lines(cm->frame_to_show, cm, 0);
+        job = DLF_JOB_NONE;
+        row_index = 0;
+        do {
+            job = UpdateDlfRows(
+                picture_control_set_ptr,
+                filterFlag,
+                encoded_row_index_start,
+                encoded_row_count,
+                feedback_flag,
+                job,
+                &row_index,
+                &more_jobs_flag);
+
+            // The input is only recorded once
+            encoded_row_count = 0;
+            feedback_flag = EB_FALSE;
+
+            // Hand the next ready job to another DLF process
+            if (more_jobs_flag) {
+                EbGetEmptyObject(
+                    context_ptr->dlf_feedback_fifo_ptr,
+                    &feedback_wrapper_ptr);
+                feedback_ptr = (EncDecResults_t*)feedback_wrapper_ptr->objectPtr;
+                feedback_ptr->pictureControlSetWrapperPtr = enc_dec_results_ptr->pictureControlSetWrapperPtr;
+                feedback_ptr->completedLcuRowIndexStart = 0;
+                feedback_ptr->completedLcuRowCount = 0;
+                EbPostFullObject(feedback_wrapper_ptr);
             }
 
-#if CDEF_M
-            if (sequence_control_set_ptr->enable_cdef)
-            {
-#endif
-                if (is16bit)
-                {
-                    picture_control_set_ptr->src[0] = (uint16_t*)recon_picture_ptr->bufferY + (recon_picture_ptr->origin_x + recon_picture_ptr->origin_y     * recon_picture_ptr->strideY);
-                    picture_control_set_ptr->src[1] = (uint16_t*)recon_picture_ptr->bufferCb + (recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCb);
-                    picture_control_set_ptr->src[2] = (uint16_t*)recon_picture_ptr->bufferCr + (recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCr);
-
-                    EbPictureBufferDesc_t *inputPicturePtr = picture_control_set_ptr->input_frame16bit;
-                    picture_control_set_ptr->ref_coeff[0] = (uint16_t*)inputPicturePtr->bufferY + (inputPicturePtr->origin_x + inputPicturePtr->origin_y * inputPicturePtr->strideY);
-                    picture_control_set_ptr->ref_coeff[1] = (uint16_t*)inputPicturePtr->bufferCb + (inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCb);
-                    picture_control_set_ptr->ref_coeff[2] = (uint16_t*)inputPicturePtr->bufferCr + (inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCr);
+            switch (job) {
+            case DLF_JOB_PICK_LEVEL:
 
-                }
-                else
-                {
-                    //these copies should go!
-                EbByte  rec_ptr = &((recon_picture_ptr->bufferY)[recon_picture_ptr->origin_x + recon_picture_ptr->origin_y * recon_picture_ptr->strideY]);
-                    EbByte  rec_ptr_cb = &((recon_picture_ptr->bufferCb)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCb]);
-                    EbByte  rec_ptr_cr = &((recon_picture_ptr->bufferCr)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->strideCr]);
-
-                    EbPictureBufferDesc_t *inputPicturePtr = (EbPictureBufferDesc_t*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
-                    EbByte  enh_ptr = &((inputPicturePtr->bufferY)[inputPicturePtr->origin_x + inputPicturePtr->origin_y * inputPicturePtr->strideY]);
-                    EbByte  enh_ptr_cb = &((inputPicturePtr->bufferCb)[inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCb]);
-                    EbByte  enh_ptr_cr = &((inputPicturePtr->bufferCr)[inputPicturePtr->origin_x / 2 + inputPicturePtr->origin_y / 2 * inputPicturePtr->strideCr]);
-
-                    for (int r = 0; r < sequence_control_set_ptr->luma_height; ++r) {
-                        for (int c = 0; c < sequence_control_set_ptr->luma_width; ++c) {
-                        picture_control_set_ptr->src[0]      [r * sequence_control_set_ptr->luma_width + c] = rec_ptr[r * recon_picture_ptr->strideY + c];
-                        picture_control_set_ptr->ref_coeff[0][r * sequence_control_set_ptr->luma_width + c] = enh_ptr[r * inputPicturePtr->strideY + c];
-                        }
-                    }
+                av1_loop_filter_init(picture_control_set_ptr);
 
-                for (int r = 0; r < sequence_control_set_ptr->luma_height/2; ++r) {
-                    for (int c = 0; c < sequence_control_set_ptr->luma_width/2; ++c) {
-                        picture_control_set_ptr->src[1][r * sequence_control_set_ptr->luma_width/2 + c] = rec_ptr_cb[r * recon_picture_ptr->strideCb + c];
-                        picture_control_set_ptr->ref_coeff[1][r * sequence_control_set_ptr->luma_width/2 + c] = enh_ptr_cb[r * inputPicturePtr->strideCb + c];
-                            picture_control_set_ptr->src[2][r * sequence_control_set_ptr->luma_width / 2 + c] = rec_ptr_cr[r * recon_picture_ptr->strideCr + c];
-                            picture_control_set_ptr->ref_coeff[2][r * sequence_control_set_ptr->luma_width / 2 + c] = enh_ptr_cr[r * inputPicturePtr->strideCr + c];
-                        }
-                    }
+                av1_pick_filter_level(
+                    context_ptr,
+                    (EbPictureBufferDesc_t*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+                    picture_control_set_ptr,
+                    picture_control_set_ptr->parent_pcs_ptr->lpf_pick_method);
 
-                }
-#if CDEF_M
-            }
+#if NO_ENCDEC
+                //NO DLF
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[0] = 0;
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[1] = 0;
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_u = 0;
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_v = 0;
 #endif
+                av1_loop_filter_frame_init(picture_control_set_ptr, 0, 3);
+                break;
 
-        }
-
-        picture_control_set_ptr->cdef_segments_column_count =  sequence_control_set_ptr->cdef_segment_column_count;
-        picture_control_set_ptr->cdef_segments_row_count = sequence_control_set_ptr->cdef_segment_row_count;
-        picture_control_set_ptr->cdef_segments_total_count  = (uint16_t)(picture_control_set_ptr->cdef_segments_column_count  * picture_control_set_ptr->cdef_segments_row_count);
-        picture_control_set_ptr->tot_seg_searched_cdef = 0;
-        uint32_t segment_index;
-
-        for (segment_index = 0; segment_index < picture_control_set_ptr->cdef_segments_total_count; ++segment_index)
-        {
-            // Get Empty DLF Results to Cdef
-            EbGetEmptyObject(
-                context_ptr->dlf_output_fifo_ptr,
-                &dlf_results_wrapper_ptr);
-            dlf_results_ptr = (struct DlfResults_s*)dlf_results_wrapper_ptr->objectPtr;
-            dlf_results_ptr->picture_control_set_wrapper_ptr = enc_dec_results_ptr->pictureControlSetWrapperPtr;
-
-            dlf_results_ptr->segment_index = segment_index;
-            // Post DLF Results
-            EbPostFullObject(dlf_results_wrapper_ptr);
-        }
-#else
-
-            // Get Empty DLF Results to Cdef
-            EbGetEmptyObject(
-                context_ptr->dlf_output_fifo_ptr,
-                &dlf_results_wrapper_ptr);
-            dlf_results_ptr = (struct DlfResults_s*)dlf_results_wrapper_ptr->objectPtr;
-            dlf_results_ptr->pictureControlSetWrapperPtr = enc_dec_results_ptr->pictureControlSetWrapperPtr;
-            dlf_results_ptr->completedLcuRowIndexStart = 0;
-            dlf_results_ptr->completedLcuRowCount = ((sequence_control_set_ptr->luma_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
-            // Post DLF Results
-            EbPostFullObject(dlf_results_wrapper_ptr);
-#endif
+            case DLF_JOB_VERT_EDGES:
+            case DLF_JOB_HORZ_EDGES:
+                av1_loop_filter_sb_row(
+                    recon_buffer,
+                    picture_control_set_ptr,
+                    row_index,
+                    0,
+                    3,
+                    job == DLF_JOB_VERT_EDGES ? VERT_EDGE : HORZ_EDGE);
+                break;
+
+            case DLF_JOB_PICTURE_DONE:
+                DlfPictureDone(
+                    context_ptr,
+                    sequence_control_set_ptr,
+                    picture_control_set_ptr,
+                    enc_dec_results_ptr->pictureControlSetWrapperPtr);
+                break;
 
-            // Release EncDec Results
-            EbReleaseObject(enc_dec_results_wrapper_ptr);
+            default:
+                break;
+            }
+        } while (job != DLF_JOB_NONE && job != DLF_JOB_PICTURE_DONE);
 
-        }
+        // Release EncDec Results
+        EbReleaseObject(enc_dec_results_wrapper_ptr);
+    }
 
     return EB_NULL;
 }
-#endif
\ No newline at end of file
+#endif
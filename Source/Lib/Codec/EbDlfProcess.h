@@ -22,6 +22,7 @@ typedef struct DlfContext_s
 {
     EbFifo_t                       *dlf_input_fifo_ptr;
     EbFifo_t                       *dlf_output_fifo_ptr;
+    EbFifo_t                       *dlf_feedback_fifo_ptr;
 
 
     EbPictureBufferDesc_t                 *temp_lf_recon_picture_ptr;
@@ -37,6 +38,7 @@ extern EbErrorType dlf_context_ctor(
     DlfContext_t **context_dbl_ptr,
     EbFifo_t                       *dlf_input_fifo_ptr,
     EbFifo_t                       *dlf_output_fifo_ptr,
+    EbFifo_t                       *dlf_feedback_fifo_ptr,
     EbBool                  is16bit,
     uint32_t                max_input_luma_width,
     uint32_t                max_input_luma_height
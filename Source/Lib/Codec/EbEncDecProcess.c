@@ -303,6 +303,45 @@ static void ResetEncodePassNeighborArrays(PictureControlSet_t *picture_control_s
     return;
 }
 
+/**************************************************
+ * Reset Encode Pass Tile Neighbor Arrays
+ *   Resets the mode arrays along the SB edges that
+ *   lie on an inner tile boundary, see
+ *   reset_mode_decision_tile_neighbor_arrays
+ **************************************************/
+static void ResetEncodePassTileNeighborArrays(
+    PictureControlSet_t *picture_control_set_ptr,
+    const TileInfo      *tile,
+    uint32_t             sb_origin_x,
+    uint32_t             sb_origin_y,
+    uint32_t             sb_sz)
+{
+    NeighborArrayUnit_t *modeNeighborArrays[] = {
+        picture_control_set_ptr->ep_intra_luma_mode_neighbor_array,
+        picture_control_set_ptr->ep_mv_neighbor_array,
+        picture_control_set_ptr->ep_skip_flag_neighbor_array,
+        picture_control_set_ptr->ep_mode_type_neighbor_array,
+        picture_control_set_ptr->ep_leaf_depth_neighbor_array,
+        picture_control_set_ptr->amvp_mv_merge_mv_neighbor_array,
+        picture_control_set_ptr->amvp_mv_merge_mode_type_neighbor_array };
+    const EbBool resetLeft = (tile->mi_col_start && sb_origin_x == (uint32_t)tile->mi_col_start << MI_SIZE_LOG2) ? EB_TRUE : EB_FALSE;
+    const EbBool resetTop = (tile->mi_row_start && sb_origin_y == (uint32_t)tile->mi_row_start << MI_SIZE_LOG2) ? EB_TRUE : EB_FALSE;
+    uint32_t arrayIndex;
+
+    for (arrayIndex = 0; arrayIndex < sizeof(modeNeighborArrays) / sizeof(modeNeighborArrays[0]); ++arrayIndex) {
+        if (resetLeft)
+            NeighborArrayUnitResetRegion(modeNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_LEFT, sb_origin_y, sb_sz, (uint8_t)~0);
+        if (resetTop)
+            NeighborArrayUnitResetRegion(modeNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_TOP, sb_origin_x, sb_sz, (uint8_t)~0);
+    }
+    if (resetLeft)
+        NeighborArrayUnitResetRegion(picture_control_set_ptr->ep_intra_chroma_mode_neighbor_array, NEIGHBOR_ARRAY_LEFT, sb_origin_y >> 1, sb_sz >> 1, (uint8_t)~0);
+    if (resetTop)
+        NeighborArrayUnitResetRegion(picture_control_set_ptr->ep_intra_chroma_mode_neighbor_array, NEIGHBOR_ARRAY_TOP, sb_origin_x >> 1, sb_sz >> 1, (uint8_t)~0);
+
+    return;
+}
+
 /**************************************************
  * Reset Coding Loop
  **************************************************/
@@ -1392,6 +1431,10 @@ void* EncDecKernel(void *input_ptr)
     uint32_t                                 lcuRowIndexCount;
     uint32_t                                 picture_width_in_sb;
     MdcLcuData_t                            *mdcPtr;
+#if FILT_PROC
+    uint32_t                                 picture_height_in_sb;
+    EbBool                                   dlfRowFlag;
+#endif
 
     // Variables
     EbBool                                   is16bit;
@@ -1421,6 +1464,7 @@ void* EncDecKernel(void *input_ptr)
         encDecTasksPtr = (EncDecTasks_t*)encDecTasksWrapperPtr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)encDecTasksPtr->pictureControlSetWrapperPtr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
         segmentsPtr = picture_control_set_ptr->enc_dec_segment_ctrl;
         lastLcuFlag = EB_FALSE;
         is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
@@ -1439,6 +1483,18 @@ void* EncDecKernel(void *input_ptr)
         lcuSizeLog2 = (uint8_t)Log2f(sb_sz);
         context_ptr->sb_sz = sb_sz;
         picture_width_in_sb = (sequence_control_set_ptr->luma_width + sb_sz - 1) >> lcuSizeLog2;
+#if FILT_PROC
+        picture_height_in_sb = (sequence_control_set_ptr->luma_height + sb_sz - 1) >> lcuSizeLog2;
+
+        // DLF only deblocks SB rows before the whole picture is reconstructed when
+        //   its filter level search needs part of the picture, the rows are then
+        //   sent one by one
+        dlfRowFlag = (EbBool)(picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode == 2 &&
+            (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag ||
+                sequence_control_set_ptr->static_config.recon_enabled ||
+                sequence_control_set_ptr->static_config.stat_report) &&
+            av1_lpf_pick_sb_row_count(picture_control_set_ptr->parent_pcs_ptr->lpf_pick_method, picture_height_in_sb) < picture_height_in_sb);
+#endif
         endOfRowFlag = EB_FALSE;
         lcuRowIndexStart = lcuRowIndexCount = 0;
         context_ptr->tot_intra_coded_area = 0;
@@ -1446,6 +1502,8 @@ void* EncDecKernel(void *input_ptr)
         // Segment-loop
         while (AssignEncDecSegments(segmentsPtr, &segment_index, encDecTasksPtr, context_ptr->enc_dec_feedback_fifo_ptr) == EB_TRUE)
         {
+            EbTraceBegin("EncDecSegment", picture_control_set_ptr->picture_number, segment_index);
+
             xLcuStartIndex = segmentsPtr->xStartArray[segment_index];
             yLcuStartIndex = segmentsPtr->yStartArray[segment_index];
             lcuStartIndex = yLcuStartIndex * picture_width_in_sb + xLcuStartIndex;
@@ -1489,6 +1547,20 @@ void* EncDecKernel(void *input_ptr)
                     context_ptr->sb_index = sb_index;
                     context_ptr->md_context->cu_use_ref_src_flag = (picture_control_set_ptr->parent_pcs_ptr->use_src_ref) && (picture_control_set_ptr->parent_pcs_ptr->edge_results_ptr[sb_index].edge_block_num == EB_FALSE || picture_control_set_ptr->parent_pcs_ptr->sb_flat_noise_array[sb_index]) ? EB_TRUE : EB_FALSE;
 
+                    // Start each tile without the contexts of its neighbors
+                    reset_mode_decision_tile_neighbor_arrays(
+                        picture_control_set_ptr,
+                        &sb_ptr->tile_info,
+                        sb_origin_x,
+                        sb_origin_y,
+                        sequence_control_set_ptr->sb_sz);
+                    ResetEncodePassTileNeighborArrays(
+                        picture_control_set_ptr,
+                        &sb_ptr->tile_info,
+                        sb_origin_x,
+                        sb_origin_y,
+                        sequence_control_set_ptr->sb_sz);
+
                     // Configure the LCU
                     ModeDecisionConfigureLcu(
                         context_ptr->md_context,
@@ -1626,10 +1698,29 @@ void* EncDecKernel(void *input_ptr)
                     if (picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr != NULL) {
                         ((EbReferenceObject_t*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->objectPtr)->intra_coded_area_sb[sb_index] = (uint8_t)((100 * context_ptr->intra_coded_area_sb[sb_index]) / (64 * 64));
                     }
+#if FILT_PROC
+                    // Send each SB row to DLF as soon as it is reconstructed, the
+                    //   last row is sent once the picture level updates are done
+                    if (dlfRowFlag && endOfRowFlag && !lastLcuFlag) {
+
+                        // Get Empty EncDec Results
+                        EbGetEmptyObject(
+                            context_ptr->enc_dec_output_fifo_ptr,
+                            &encDecResultsWrapperPtr);
+                        encDecResultsPtr = (EncDecResults_t*)encDecResultsWrapperPtr->objectPtr;
+                        encDecResultsPtr->pictureControlSetWrapperPtr = encDecTasksPtr->pictureControlSetWrapperPtr;
+                        encDecResultsPtr->completedLcuRowIndexStart = yLcuIndex;
+                        encDecResultsPtr->completedLcuRowCount = 1;
+                        // Post EncDec Results
+                        EbPostFullObject(encDecResultsWrapperPtr);
+                    }
+#endif
 
                 }
                 xLcuStartIndex = (xLcuStartIndex > 0) ? xLcuStartIndex - 1 : 0;
             }
+
+            EbTraceEnd("EncDecSegment");
         }
 
         EbBlockOnMutex(picture_control_set_ptr->intra_mutex);
@@ -1949,9 +2040,8 @@ void* EncDecKernel(void *input_ptr)
                 &encDecResultsWrapperPtr);
             encDecResultsPtr = (EncDecResults_t*)encDecResultsWrapperPtr->objectPtr;
             encDecResultsPtr->pictureControlSetWrapperPtr = encDecTasksPtr->pictureControlSetWrapperPtr;
-            //CHKN these are not needed for DLF
-            encDecResultsPtr->completedLcuRowIndexStart = 0;
-            encDecResultsPtr->completedLcuRowCount = ((sequence_control_set_ptr->luma_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+            encDecResultsPtr->completedLcuRowIndexStart = dlfRowFlag ? picture_height_in_sb - 1 : 0;
+            encDecResultsPtr->completedLcuRowCount = dlfRowFlag ? 1 : picture_height_in_sb;
             // Post EncDec Results
             EbPostFullObject(encDecResultsWrapperPtr);
 
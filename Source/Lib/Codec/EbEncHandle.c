@@ -55,6 +55,9 @@
 /**************************************
  * Includes
  **************************************/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -112,6 +115,9 @@
 #include <pthread.h>
 #include <errno.h>
 #endif
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 
 #define RTCD_C
@@ -139,6 +145,11 @@
 #define EB_OUTPUTRECONBUFFERSIZE                                        (MAX_PICTURE_WIDTH_SIZE*MAX_PICTURE_HEIGHT_SIZE*2)   // Recon Slice Size
 #define EB_OUTPUTSTATISTICSBUFFERSIZE                                   0x30            // 6X8 (8 Bytes for Y, U, V, number of bits, picture number, QP)
 #define EOS_NAL_BUFFER_SIZE                                             0x0010 // Bitstream used to code EOS NAL
+#define EB_MinPacketRingSize                                            0x10000 // Smallest packet_ring_size, the ring grows beyond it
+#define EB_MaxInputCopyThreads                                          16
+#define EB_MaxReconBufferCount                                          256
+#define EB_MaxLog2TileCount                                             6       // Log2 of MAX_TILE_COLS and MAX_TILE_ROWS
+#define EB_InputCopyMinBandHeight                                       64      // Luma rows, smaller pictures are split in fewer bands
 #define EB_OUTPUTSTREAMBUFFERSIZE_MACRO(ResolutionSize)                ((ResolutionSize) < (INPUT_SIZE_1080i_TH) ? 0x1E8480 : (ResolutionSize) < (INPUT_SIZE_1080p_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_4K_TH) ? 0x2DC6C0 : 0x2DC6C0  )   
 
 #define ENCDEC_INPUT_PORT_MDC                                0
@@ -151,14 +162,6 @@
  * Globals
  **************************************/
 
-EbMemoryMapEntry                 *memoryMap;
-uint32_t                         *memoryMapIndex;
-uint64_t                         *totalLibMemory;
-
-uint32_t                         libMallocCount = 0;
-uint32_t                         libThreadCount = 0;
-uint32_t                         libSemaphoreCount = 0;
-uint32_t                         libMutexCount = 0;
 #ifdef _MSC_VER
 GROUP_AFFINITY                   groupAffinity;
 #endif
@@ -235,16 +238,122 @@ static int32_t CanUseIntelCore4thGenFeatures()
         the_4th_gen_features_available = Check4thGenIntelCoreFeatures();
     return the_4th_gen_features_available;
 }
-EbAsm GetCpuAsmType()
+/**************************************
+ * GetCpuFlags
+ *   HAS_* instruction sets of the CPU. AVX also needs the OS to save the
+ *   YMM state, AVX2 the whole 4th generation Intel Core feature set.
+ **************************************/
+static int32_t GetCpuFlags()
 {
-    EbAsm asm_type = ASM_NON_AVX2;
+    int32_t abcd[4];
+    int32_t flags = 0;
+    int32_t maxLeaf;
+    int32_t avxMask = (1 << 27) | (1 << 28);
 
-    if (CanUseIntelCore4thGenFeatures() == 1)
-        asm_type = ASM_AVX2;
-    else
-        // Need to change to support lower CPU Technologies
-        asm_type = ASM_NON_AVX2;
-    return asm_type;
+    RunCpuid(0, 0, abcd);
+    maxLeaf = abcd[0];
+    if (maxLeaf < 1)
+        return flags;
+
+    /* CPUID.(EAX=01H, ECX=0H):EDX.MMX[bit 23], SSE[bit 25], SSE2[bit 26]
+       CPUID.(EAX=01H, ECX=0H):ECX.SSE3[bit 0], SSSE3[bit 9], SSE4_1[bit 19], SSE4_2[bit 20] */
+    RunCpuid(1, 0, abcd);
+    if (abcd[3] & (1 << 23))
+        flags |= HAS_MMX;
+    if (abcd[3] & (1 << 25))
+        flags |= HAS_SSE;
+    if (abcd[3] & (1 << 26))
+        flags |= HAS_SSE2;
+    if (abcd[2] & (1 << 0))
+        flags |= HAS_SSE3;
+    if (abcd[2] & (1 << 9))
+        flags |= HAS_SSSE3;
+    if (abcd[2] & (1 << 19))
+        flags |= HAS_SSE4_1;
+    if (abcd[2] & (1 << 20))
+        flags |= HAS_SSE4_2;
+
+    /* CPUID.(EAX=01H, ECX=0H):ECX.OSXSAVE[bit 27]==1 &&
+       CPUID.(EAX=01H, ECX=0H):ECX.AVX[bit 28]==1 */
+    if ((abcd[2] & avxMask) == avxMask && CheckXcr0Ymm())
+        flags |= HAS_AVX;
+
+    if (maxLeaf >= 7) {
+        /* CPUID.(EAX=07H, ECX=0H):EBX.BMI2[bit 8]==1 */
+        RunCpuid(7, 0, abcd);
+        if (abcd[1] & (1 << 8))
+            flags |= HAS_BMI2;
+
+        if ((flags & HAS_AVX) && CanUseIntelCore4thGenFeatures() == 1)
+            flags |= HAS_AVX2;
+    }
+
+    return flags;
+}
+
+/**************************************
+ * GetAsmTypeFlags
+ *   HAS_* instruction sets asm_type lets the kernels use. The
+ *   [ASM_TYPE_TOTAL] kernel arrays only have a NON_AVX2 row, built on
+ *   SSE4_1, and an AVX2 row, so these are the two levels asm_type picks
+ **************************************/
+static int32_t GetAsmTypeFlags(
+    uint32_t asmType)
+{
+    if (asmType == 1)
+        return ~0;
+
+    return HAS_MMX | HAS_SSE | HAS_SSE2 | HAS_SSE3 | HAS_SSSE3 | HAS_SSE4_1 | HAS_SSE4_2;
+}
+
+// HAS_* instruction sets and their names, lowest first
+static const int32_t cpuFlagArray[] = { HAS_MMX, HAS_SSE, HAS_SSE2, HAS_SSE3, HAS_SSSE3, HAS_SSE4_1, HAS_SSE4_2, HAS_AVX, HAS_AVX2, HAS_BMI2 };
+static const char   *cpuFlagNameArray[] = { "MMX", "SSE", "SSE2", "SSE3", "SSSE3", "SSE4_1", "SSE4_2", "AVX", "AVX2", "BMI2" };
+
+/**************************************
+ * EbDispatchTableCtor
+ *   Picks the kernels of the encoder instance for the instruction sets
+ *   of the CPU asm_type allows
+ **************************************/
+static EbErrorType EbDispatchTableCtor(
+    EbDispatchTable_t  **tableDblPtr,
+    uint32_t             asmType)
+{
+    EbDispatchTable_t *tablePtr;
+    int32_t            cpuFlags = GetCpuFlags();
+    int32_t            flags = cpuFlags & GetAsmTypeFlags(asmType);
+    const char        *kernelName = "C";
+    uint32_t           flagIndex;
+
+    // The [ASM_TYPE_TOTAL] kernel arrays have no C row, ASM_NON_AVX2 needs SSE4_1
+    if ((cpuFlags & HAS_SSE4_1) == 0) {
+        SVT_LOG("SVT [ERROR]: The CPU does not support SSE4_1\n");
+        return EB_ErrorUndefined;
+    }
+
+    EB_MALLOC(EbDispatchTable_t*, tablePtr, sizeof(EbDispatchTable_t), EB_N_PTR);
+    *tableDblPtr = tablePtr;
+
+    tablePtr->flags = flags;
+    tablePtr->asmType = (flags & HAS_AVX2) ? ASM_AVX2 : ASM_NON_AVX2;
+    setup_rtcd_internal(tablePtr, flags);
+
+    // Highest level the RTCD kernels come in
+    for (flagIndex = 0; flagIndex < sizeof(cpuFlagArray) / sizeof(cpuFlagArray[0]); ++flagIndex) {
+        if (flags & cpuFlagArray[flagIndex] & (HAS_SSE2 | HAS_SSSE3 | HAS_SSE4_1 | HAS_AVX2))
+            kernelName = cpuFlagNameArray[flagIndex];
+    }
+
+    SVT_LOG("SVT [config]: Kernels / Kernel Arrays / CPU \t\t\t\t\t: %s / %s /",
+        kernelName,
+        tablePtr->asmType == ASM_AVX2 ? "AVX2" : "NON_AVX2");
+    for (flagIndex = 0; flagIndex < sizeof(cpuFlagArray) / sizeof(cpuFlagArray[0]); ++flagIndex) {
+        if (cpuFlags & cpuFlagArray[flagIndex])
+            SVT_LOG(" %s", cpuFlagNameArray[flagIndex]);
+    }
+    SVT_LOG("\n");
+
+    return EB_ErrorNone;
 }
 //Get Number of processes
 uint32_t GetNumCores() {
@@ -292,6 +401,11 @@ void EbSetThreadManagementParameters(EbSvtAv1EncConfiguration   *config_ptr) {
             numGroups = 1;
         }
     }
+    else if (numGroups == 2 && config_ptr->target_socket != -1) {
+        // Keep every encoder thread on the requested socket
+        alternateGroups = 0;
+        groupAffinity.Group = (WORD)config_ptr->target_socket;
+    }
     else {
         alternateGroups = 0;
         numGroups = 1;
@@ -302,6 +416,122 @@ void EbSetThreadManagementParameters(EbSvtAv1EncConfiguration   *config_ptr) {
     (void)config_ptr;
 #endif
 }
+#ifdef __linux__
+/**************************************
+ * Linux Thread Affinity
+ **************************************/
+// Parses a list of processor ranges such as "0-7,16-23"
+static EbBool ParseProcessorList(
+    const char  *list,
+    cpu_set_t   *processorSet)
+{
+    CPU_ZERO(processorSet);
+
+    while (*list) {
+        char          *end;
+        unsigned long  first = strtoul(list, &end, 10);
+        unsigned long  last = first;
+
+        if (end == list)
+            return EB_FALSE;
+        if (*end == '-') {
+            list = end + 1;
+            last = strtoul(list, &end, 10);
+            if (end == list || last < first)
+                return EB_FALSE;
+        }
+        for (; first <= last && first < CPU_SETSIZE; ++first)
+            CPU_SET(first, processorSet);
+
+        list = end;
+        if (*list == ',')
+            ++list;
+        else if (*list != '\0' && *list != '\n')
+            return EB_FALSE;
+        else
+            break;
+    }
+
+    return CPU_COUNT(processorSet) ? EB_TRUE : EB_FALSE;
+}
+// Processors of a socket, taken from the NUMA node of the same index
+static EbBool GetSocketProcessorSet(
+    uint32_t     socket,
+    cpu_set_t   *processorSet)
+{
+    char   path[64];
+    char   list[1024];
+    FILE  *file;
+    EbBool found = EB_FALSE;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", socket);
+    file = fopen(path, "r");
+    if (file == NULL)
+        return EB_FALSE;
+    if (fgets(list, sizeof(list), file))
+        found = ParseProcessorList(list, processorSet);
+    fclose(file);
+
+    return found;
+}
+/***********************************************
+ * EbAssignEncoderAffinity
+ *   Restricts the calling thread to the processors of the encoder while
+ *   it constructs the encoder. The buffers it first touches are placed on
+ *   the memory of their node and the encoder threads it creates inherit
+ *   the restriction. Returns EB_TRUE when callerAffinity holds the
+ *   affinity to restore afterwards.
+ ***********************************************/
+static EbBool EbAssignEncoderAffinity(
+    EbSvtAv1EncConfiguration   *config_ptr,
+    cpu_set_t                  *callerAffinity)
+{
+    cpu_set_t processorSet;
+
+    if (config_ptr->processor_list) {
+        if (ParseProcessorList(config_ptr->processor_list, &processorSet) == EB_FALSE)
+            return EB_FALSE;
+    }
+    else if (config_ptr->target_socket != -1 && config_ptr->use_round_robin_thread_assignment == EB_FALSE) {
+        // Single node systems have nothing to restrict
+        if (GetSocketProcessorSet((uint32_t)config_ptr->target_socket, &processorSet) == EB_FALSE)
+            return EB_FALSE;
+    }
+    else
+        return EB_FALSE;
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), callerAffinity) != 0)
+        return EB_FALSE;
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &processorSet) != 0) {
+        SVT_LOG("SVT [Warning]: Failed to restrict the encoder threads to the requested processors\n");
+        return EB_FALSE;
+    }
+
+    return EB_TRUE;
+}
+#endif
+/**********************************
+* Application Thread Affinity
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_assign_thread_affinity(const char *processor_list)
+{
+#ifdef __linux__
+    cpu_set_t processorSet;
+
+    if (processor_list == NULL || ParseProcessorList(processor_list, &processorSet) == EB_FALSE)
+        return EB_ErrorBadParameter;
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &processorSet) != 0)
+        return EB_ErrorUndefined;
+#else
+    (void)processor_list;
+#endif
+
+    return EB_ErrorNone;
+}
 void asmSetConvolveAsmTable(void);
 void asmSetConvolveHbdAsmTable(void);
 void init_intra_dc_predictors_c_internal(void);
@@ -336,6 +566,100 @@ uint32_t SetParentPcs(EbSvtAv1EncConfiguration*   config) {
 
     return inputPic;
 }
+/*********************************************************************
+ * PoolInitCount
+ *   Number of objects a picture buffer pool is constructed with, the
+ *   pool holds poolCount objects once the memory budget is shared out
+ *********************************************************************/
+static uint32_t PoolInitCount(
+    SequenceControlSet_t       *sequence_control_set_ptr,
+    uint32_t                    poolCount,
+    uint32_t                    minOffset)
+{
+    return MIN(poolCount, sequence_control_set_ptr->picture_pool_min_count + minOffset);
+}
+
+/*********************************************************************
+ * ReleaseInputPicture
+ *   Release callback of the picture control set pools with zero copy
+ *   input. The application planes are read until the picture control
+ *   set is released: its PA reference, the motion estimation
+ *   reference of the later pictures, shares the luma plane and holds
+ *   the picture control set.
+ *********************************************************************/
+static void ReleaseInputPicture(
+    EbPtr                       objectPtr)
+{
+    PictureParentControlSet_t  *picture_control_set_ptr = (PictureParentControlSet_t*)objectPtr;
+    EbSvtAv1EncConfiguration   *config;
+
+    if (picture_control_set_ptr->input_release_pending == EB_FALSE)
+        return;
+
+    picture_control_set_ptr->input_release_pending = EB_FALSE;
+    config = &picture_control_set_ptr->sequence_control_set_ptr->static_config;
+    config->input_release_callback(
+        config->input_release_context,
+        picture_control_set_ptr->input_app_private,
+        picture_control_set_ptr->input_pts);
+}
+
+/*********************************************************************
+ * ReleasePendingInputPictures
+ *   Hands the application planes of the pictures left in the pipeline
+ *   back, the encoder threads have to be stopped.
+ *********************************************************************/
+static void ReleasePendingInputPictures(
+    EbEncHandle_t              *encHandlePtr)
+{
+    EbSystemResource_t *resourcePtr;
+    uint32_t            instanceIndex;
+    uint32_t            wrapperIndex;
+
+    if (encHandlePtr->pictureParentControlSetPoolPtrArray == (EbSystemResource_t**)EB_NULL)
+        return;
+
+    for (instanceIndex = 0; instanceIndex < encHandlePtr->encodeInstanceTotalCount; ++instanceIndex) {
+        resourcePtr = encHandlePtr->pictureParentControlSetPoolPtrArray[instanceIndex];
+        if (resourcePtr == (EbSystemResource_t*)EB_NULL || resourcePtr->ReleaseCallback == EB_NULL)
+            continue;
+
+        for (wrapperIndex = 0; wrapperIndex < resourcePtr->objectTotalCount; ++wrapperIndex)
+            resourcePtr->ReleaseCallback(resourcePtr->wrapperPtrPool[wrapperIndex]->objectPtr);
+    }
+}
+
+/*********************************************************************
+ * ReleaseOutputPacket
+ *   Release callback of the output stream buffer pools, returns the
+ *   payload of the packet to the packet ring.
+ *********************************************************************/
+static void ReleaseOutputPacket(
+    EbPtr                       objectPtr)
+{
+    EbBufferHeaderType *outBufPtr = (EbBufferHeaderType*)objectPtr;
+
+    if (outBufPtr->p_buffer) {
+        EbPacketRingFree(outBufPtr->p_buffer);
+        outBufPtr->p_buffer = (uint8_t*)EB_NULL;
+        outBufPtr->n_alloc_len = 0;
+    }
+}
+
+/*********************************************************************
+ * FifoInitCount
+ *   Number of objects an inter-process fifo is constructed with, only
+ *   elastic pools start below fifoCount
+ *********************************************************************/
+static uint32_t FifoInitCount(
+    SequenceControlSet_t       *sequence_control_set_ptr,
+    uint32_t                    fifoCount)
+{
+    return sequence_control_set_ptr->static_config.elastic_pools ?
+        MIN(fifoCount, sequence_control_set_ptr->picture_pool_min_count) :
+        fifoCount;
+}
+
 void LoadDefaultBufferConfigurationSettings(
     SequenceControlSet_t       *sequence_control_set_ptr){
     uint32_t encDecSegH = (sequence_control_set_ptr->static_config.super_block_size == 128) ?
@@ -350,8 +674,25 @@ void LoadDefaultBufferConfigurationSettings(
 
     uint32_t inputPic = SetParentPcs(&sequence_control_set_ptr->static_config);
 
+    EbSvtAv1EncConfiguration *config = &sequence_control_set_ptr->static_config;
     unsigned int coreCount = GetNumCores();
 
+    // Logical processor budget, the whole layout below is scaled from it
+    if (config->logical_processors) {
+        if (config->logical_processors > coreCount)
+            SVT_LOG("SVT [Warning]: LogicalProcessors %u clamped to the %u available\n", config->logical_processors, coreCount);
+        else
+            coreCount = config->logical_processors;
+    }
+
+    sequence_control_set_ptr->scheduler_worker_count = coreCount;
+
+    // A single thread gains nothing from splitting pictures into segments
+    if (coreCount == 1) {
+        encDecSegH = encDecSegW = 1;
+        meSegH = meSegW = 1;
+    }
+
     sequence_control_set_ptr->output_stream_buffer_fifo_init_count = sequence_control_set_ptr->input_buffer_fifo_init_count = inputPic + SCD_LAD;
     sequence_control_set_ptr->output_stream_buffer_fifo_init_count = sequence_control_set_ptr->input_buffer_fifo_init_count + 4;
     // ME segments
@@ -394,15 +735,23 @@ void LoadDefaultBufferConfigurationSettings(
     uint32_t unit_size = 256;
     uint32_t rest_seg_w = MAX((sequence_control_set_ptr->max_input_luma_width /2 + (unit_size >> 1)) / unit_size, 1);
     uint32_t rest_seg_h = MAX((sequence_control_set_ptr->max_input_luma_height/2 + (unit_size >> 1)) / unit_size, 1);
-    sequence_control_set_ptr->rest_segment_column_count = MIN(rest_seg_w,6);
-    sequence_control_set_ptr->rest_segment_row_count = MIN(rest_seg_h,4);
+    sequence_control_set_ptr->rest_segment_column_count = (coreCount == 1) ? 1 : MIN(rest_seg_w,6);
+    sequence_control_set_ptr->rest_segment_row_count = (coreCount == 1) ? 1 : MIN(rest_seg_h,4);
 #endif
     //#====================== Data Structures and Picture Buffers ======================
     sequence_control_set_ptr->picture_control_set_pool_init_count = inputPic;
     sequence_control_set_ptr->picture_control_set_pool_init_count_child = MAX(4, coreCount / 6);
     sequence_control_set_ptr->reference_picture_buffer_init_count = inputPic;//MAX((uint32_t)(sequence_control_set_ptr->inputOutputBufferFifoInitCount >> 1), (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchicalLevels) + 2));
     sequence_control_set_ptr->pa_reference_picture_buffer_init_count = inputPic;//MAX((uint32_t)(sequence_control_set_ptr->inputOutputBufferFifoInitCount >> 1), (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchicalLevels) + 2));
-    sequence_control_set_ptr->output_recon_buffer_fifo_init_count = sequence_control_set_ptr->reference_picture_buffer_init_count;
+    sequence_control_set_ptr->output_recon_buffer_fifo_init_count = config->recon_buffer_count ? config->recon_buffer_count : sequence_control_set_ptr->reference_picture_buffer_init_count;
+
+    // Under a memory budget the pools start with the pictures of a mini GOP,
+    //   the scene change look ahead and the rate control look ahead
+    sequence_control_set_ptr->picture_pool_min_count = inputPic;
+    if (config->memory_budget || config->elastic_pools) {
+        uint32_t lookAheadDistance = (config->rate_control_mode == 0 && config->improve_sharpness == 0) ? 0 : config->look_ahead_distance;
+        sequence_control_set_ptr->picture_pool_min_count = MIN(inputPic, (uint32_t)(1 << config->hierarchical_levels) + SCD_LAD + lookAheadDistance + 2);
+    }
 
     //#====================== Inter process Fifos ======================
     sequence_control_set_ptr->resource_coordination_fifo_init_count = 300;
@@ -417,6 +766,16 @@ void LoadDefaultBufferConfigurationSettings(
     sequence_control_set_ptr->entropy_coding_fifo_init_count = 300;
     sequence_control_set_ptr->enc_dec_fifo_init_count = 300;
 #if FILT_PROC    
+    // The EncDec results pool also carries the DLF feedback, which a DLF process
+    //   gets while it holds its input, so the pool must never run dry: per picture
+    //   in EncDec / DLF one object per SB row from EncDec, and at most one feedback
+    //   per DLF job (pick level, done, vertical and horizontal edges of each row)
+    {
+        const uint32_t sbSize = (config->super_block_size == 128) ? 128 : 64;
+        const uint32_t sbRowCount = (sequence_control_set_ptr->max_input_luma_height + sbSize - 1) / sbSize;
+        sequence_control_set_ptr->enc_dec_fifo_init_count = MAX(sequence_control_set_ptr->enc_dec_fifo_init_count,
+            sequence_control_set_ptr->picture_control_set_pool_init_count_child * (3 * sbRowCount + 2));
+    }
     sequence_control_set_ptr->dlf_fifo_init_count = 300;
     sequence_control_set_ptr->cdef_fifo_init_count = 300;
     sequence_control_set_ptr->rest_fifo_init_count = 300;
@@ -432,22 +791,72 @@ void LoadDefaultBufferConfigurationSettings(
     sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->enc_dec_process_init_count = 1;//MAX(40, coreCount);
     sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->entropy_coding_process_init_count = 1;//MAX(3, coreCount / 12);
 #else
-    sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count             = MAX(15, coreCount / 6));
-    sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count            = MAX(20, coreCount / 3));
-    sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count      = MAX(3, coreCount / 12));
-    sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count  = MAX(3, coreCount / 12));
-    sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                      = MAX(40, coreCount)    );
-    sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count               = MAX(3, coreCount / 12));
+    if (config->logical_processors == 0) {
+        sequence_control_set_ptr->picture_analysis_process_init_count             = MAX(15, coreCount / 6);
+        sequence_control_set_ptr->motion_estimation_process_init_count            = MAX(20, coreCount / 3);
+        sequence_control_set_ptr->source_based_operations_process_init_count      = MAX(3, coreCount / 12);
+        sequence_control_set_ptr->mode_decision_configuration_process_init_count  = MAX(3, coreCount / 12);
+        sequence_control_set_ptr->enc_dec_process_init_count                      = MAX(40, coreCount);
+        sequence_control_set_ptr->entropy_coding_process_init_count               = MAX(3, coreCount / 12);
+    }
+    else {
+        // The fixed minimums above oversubscribe a budgeted encoder, keep
+        //   the same proportions down to one thread per process
+        sequence_control_set_ptr->picture_analysis_process_init_count             = MAX(1, coreCount / 6);
+        sequence_control_set_ptr->motion_estimation_process_init_count            = MAX(1, coreCount / 3);
+        sequence_control_set_ptr->source_based_operations_process_init_count      = MAX(1, coreCount / 12);
+        sequence_control_set_ptr->mode_decision_configuration_process_init_count  = MAX(1, coreCount / 12);
+        sequence_control_set_ptr->enc_dec_process_init_count                      = coreCount;
+        sequence_control_set_ptr->entropy_coding_process_init_count               = MAX(1, coreCount / 12);
+    }
+
+    // Per process overrides
+    sequence_control_set_ptr->picture_analysis_process_init_count            = config->picture_analysis_threads            ? config->picture_analysis_threads            : sequence_control_set_ptr->picture_analysis_process_init_count;
+    sequence_control_set_ptr->motion_estimation_process_init_count           = config->motion_estimation_threads           ? config->motion_estimation_threads           : sequence_control_set_ptr->motion_estimation_process_init_count;
+    sequence_control_set_ptr->source_based_operations_process_init_count     = config->source_based_operations_threads     ? config->source_based_operations_threads     : sequence_control_set_ptr->source_based_operations_process_init_count;
+    sequence_control_set_ptr->mode_decision_configuration_process_init_count = config->mode_decision_configuration_threads ? config->mode_decision_configuration_threads : sequence_control_set_ptr->mode_decision_configuration_process_init_count;
+    sequence_control_set_ptr->enc_dec_process_init_count                     = config->enc_dec_threads                     ? config->enc_dec_threads                     : sequence_control_set_ptr->enc_dec_process_init_count;
+    sequence_control_set_ptr->entropy_coding_process_init_count              = config->entropy_coding_threads              ? config->entropy_coding_threads              : sequence_control_set_ptr->entropy_coding_process_init_count;
+
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->picture_analysis_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->motion_estimation_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->source_based_operations_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->mode_decision_configuration_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->enc_dec_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->entropy_coding_process_init_count;
+#endif
+
+#if FILT_PROC
+    sequence_control_set_ptr->dlf_process_init_count  = config->dlf_threads  ? config->dlf_threads  : (config->logical_processors == 0) ? MAX(40, coreCount) : coreCount;
+    sequence_control_set_ptr->cdef_process_init_count = config->cdef_threads ? config->cdef_threads : (config->logical_processors == 0) ? MAX(40, coreCount) : coreCount;
+    sequence_control_set_ptr->rest_process_init_count = config->rest_threads ? config->rest_threads : (config->logical_processors == 0) ? MAX(40, coreCount) : coreCount;
+
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->dlf_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->cdef_process_init_count;
+    sequence_control_set_ptr->total_process_init_count += sequence_control_set_ptr->rest_process_init_count;
 #endif
 
+    // Task scheduler, at most scheduler_worker_count tasks run at once so
+    //   further process instances would only add contexts
+    if (sequence_control_set_ptr->static_config.task_scheduler) {
+        uint32_t workerCount = sequence_control_set_ptr->scheduler_worker_count;
+
+        sequence_control_set_ptr->total_process_init_count = 0;
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->picture_analysis_process_init_count            = MIN(sequence_control_set_ptr->picture_analysis_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->motion_estimation_process_init_count           = MIN(sequence_control_set_ptr->motion_estimation_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->source_based_operations_process_init_count     = MIN(sequence_control_set_ptr->source_based_operations_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->mode_decision_configuration_process_init_count = MIN(sequence_control_set_ptr->mode_decision_configuration_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->enc_dec_process_init_count                     = MIN(sequence_control_set_ptr->enc_dec_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->entropy_coding_process_init_count              = MIN(sequence_control_set_ptr->entropy_coding_process_init_count, workerCount));
 #if FILT_PROC
-    sequence_control_set_ptr->total_process_init_count +=(sequence_control_set_ptr->dlf_process_init_count  = MAX(40, coreCount));
-    sequence_control_set_ptr->total_process_init_count +=(sequence_control_set_ptr->cdef_process_init_count = MAX(40, coreCount));
-    sequence_control_set_ptr->total_process_init_count +=(sequence_control_set_ptr->rest_process_init_count = MAX(40, coreCount));   
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->dlf_process_init_count                         = MIN(sequence_control_set_ptr->dlf_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = MIN(sequence_control_set_ptr->cdef_process_init_count, workerCount));
+        sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = MIN(sequence_control_set_ptr->rest_process_init_count, workerCount));
 #endif
+    }
 
     sequence_control_set_ptr->total_process_init_count += 6; // single processes count
-    printf("Number of logical cores available: %u\nNumber of PPCS %u\n", coreCount, inputPic);
+    printf("Number of logical cores available: %u\nNumber of PPCS %u\n", GetNumCores(), inputPic);
 
     return;
 
@@ -546,22 +955,24 @@ static EbErrorType eb_enc_handle_ctor(
     if (encHandlePtr == (EbEncHandle_t*)EB_NULL) {
         return EB_ErrorInsufficientResources;
     }
-    encHandlePtr->memoryMap = (EbMemoryMapEntry*)malloc(sizeof(EbMemoryMapEntry) * MAX_NUM_PTR);
-    encHandlePtr->memoryMapIndex = 0;
-    encHandlePtr->totalLibMemory = sizeof(EbEncHandle_t) + sizeof(EbMemoryMapEntry) * MAX_NUM_PTR;
-
-    // Save Memory Map Pointers 
-    totalLibMemory = &encHandlePtr->totalLibMemory;
-    memoryMap = encHandlePtr->memoryMap;
-    memoryMapIndex = &encHandlePtr->memoryMapIndex;
-    libMallocCount = 0;
-    libThreadCount = 0;
-    libMutexCount = 0;
-    libSemaphoreCount = 0;
-
-    if (memoryMap == (EbMemoryMapEntry*)EB_NULL) {
-        return EB_ErrorInsufficientResources;
-    }
+    encHandlePtr->memoryContext.memoryMapPtr = (EbMemoryMapChunk_t*)EB_NULL;
+    encHandlePtr->memoryContext.lock = 0;
+    encHandlePtr->memoryContext.slabPtr = (uint8_t*)EB_NULL;
+    encHandlePtr->memoryContext.slabOffset = 0;
+    encHandlePtr->memoryContext.totalLibMemory = sizeof(EbEncHandle_t);
+    encHandlePtr->memoryContext.requestedLibMemory = sizeof(EbEncHandle_t);
+    encHandlePtr->memoryContext.libMallocCount = 0;
+    encHandlePtr->memoryContext.libThreadCount = 0;
+    encHandlePtr->memoryContext.libMutexCount = 0;
+    encHandlePtr->memoryContext.libSemaphoreCount = 0;
+    encHandlePtr->tracePtr = (EbTrace_t*)EB_NULL;
+    encHandlePtr->dispatchTablePtr = (EbDispatchTable_t*)EB_NULL;
+    encHandlePtr->inputCopyBandCount = 0;
+    encHandlePtr->pictureParentControlSetPoolPtrArray = (EbSystemResource_t**)EB_NULL;
+    encHandlePtr->sequenceControlSetInstanceArray = (EbSequenceControlSetInstance_t**)EB_NULL;
+
+    // Bind the calling thread, the allocations below record into the handle
+    EbSetMemoryContext(&encHandlePtr->memoryContext);
 
     InitThreadManagmentParams();
 
@@ -681,7 +1092,7 @@ static EbErrorType eb_enc_handle_ctor(
     }
 
     // Initialize Sequence Control Set Instance Array
-    EB_MALLOC(EbSequenceControlSetInstance_t**, encHandlePtr->sequenceControlSetInstanceArray, sizeof(EbSequenceControlSetInstance_t*) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
+    EB_CALLOC(EbSequenceControlSetInstance_t**, encHandlePtr->sequenceControlSetInstanceArray, encHandlePtr->encodeInstanceTotalCount, sizeof(EbSequenceControlSetInstance_t*), EB_N_PTR);
 
     for (instanceIndex = 0; instanceIndex < encHandlePtr->encodeInstanceTotalCount; ++instanceIndex) {
         return_error = eb_sequence_control_set_instance_ctor(&encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]);
@@ -756,15 +1167,340 @@ EbErrorType RestResultsCtor(
     return EB_ErrorNone;
 }
 #endif
+#if LOCK_FREE_FIFO
 /**********************************
-* Initialize Encoder Library
+* Task Scheduler
+*   Every process instance runs as a task bound to its input Fifo, the
+*   workers are the only threads of the pipeline.
 **********************************/
-#if defined(__linux__) || defined(__APPLE__)
-__attribute__((visibility("default")))
+static EbErrorType eb_enc_handle_scheduler_ctor(
+    EbEncHandle_t *encHandlePtr)
+{
+    SequenceControlSet_t *sequence_control_set_ptr = encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
+    EbErrorType return_error = EB_ErrorNone;
+    uint32_t processIndex;
+    uint32_t taskTotalCount;
+
+    taskTotalCount = 6 + // single processes count
+        sequence_control_set_ptr->picture_analysis_process_init_count +
+        sequence_control_set_ptr->motion_estimation_process_init_count +
+        sequence_control_set_ptr->source_based_operations_process_init_count +
+        sequence_control_set_ptr->mode_decision_configuration_process_init_count +
+        sequence_control_set_ptr->enc_dec_process_init_count +
+#if FILT_PROC
+        sequence_control_set_ptr->dlf_process_init_count +
+        sequence_control_set_ptr->cdef_process_init_count +
+        sequence_control_set_ptr->rest_process_init_count +
 #endif
-EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
+        sequence_control_set_ptr->entropy_coding_process_init_count;
+
+    return_error = EbSchedulerCtor(
+        &encHandlePtr->schedulerPtr,
+        sequence_control_set_ptr->scheduler_worker_count,
+        taskTotalCount);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Resource Coordination
+    return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->input_buffer_consumer_fifo_ptr_array[0], ResourceCoordinationKernel, encHandlePtr->resourceCoordinationContextPtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Picture Decision
+    return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->pictureAnalysisResultsConsumerFifoPtrArray[0], PictureDecisionKernel, encHandlePtr->pictureDecisionContextPtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Initial Rate Control
+    return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->motionEstimationResultsConsumerFifoPtrArray[0], InitialRateControlKernel, encHandlePtr->initialRateControlContextPtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Picture Manager
+    return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->pictureDemuxResultsConsumerFifoPtrArray[0], PictureManagerKernel, encHandlePtr->pictureManagerContextPtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Rate Control
+    return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->rateControlTasksConsumerFifoPtrArray[0], RateControlKernel, encHandlePtr->rateControlContextPtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Packetization
+    return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->entropyCodingResultsConsumerFifoPtrArray[0], PacketizationKernel, encHandlePtr->packetizationContextPtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Picture Analysis
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->picture_analysis_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->resourceCoordinationResultsConsumerFifoPtrArray[processIndex], PictureAnalysisKernel, encHandlePtr->pictureAnalysisContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // Motion Estimation
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->motion_estimation_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->pictureDecisionResultsConsumerFifoPtrArray[processIndex], MotionEstimationKernel, encHandlePtr->motionEstimationContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // Source Based Oprations
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->source_based_operations_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->initialRateControlResultsConsumerFifoPtrArray[processIndex], source_based_operations_kernel, encHandlePtr->sourceBasedOperationsContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // Mode Decision Configuration Process
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->mode_decision_configuration_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->rateControlResultsConsumerFifoPtrArray[processIndex], ModeDecisionConfigurationKernel, encHandlePtr->modeDecisionConfigurationContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // EncDec Process
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->enc_dec_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->encDecTasksConsumerFifoPtrArray[processIndex], EncDecKernel, encHandlePtr->encDecContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+#if FILT_PROC
+    // Dlf Process
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->dlf_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->encDecResultsConsumerFifoPtrArray[processIndex], dlf_kernel, encHandlePtr->dlfContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // Cdef Process
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->cdef_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->dlfResultsConsumerFifoPtrArray[processIndex], cdef_kernel, encHandlePtr->cdefContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // Rest Process
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->rest_process_init_count; ++processIndex) {
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->cdefResultsConsumerFifoPtrArray[processIndex], rest_kernel, encHandlePtr->restContextPtrArray[processIndex]);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+#endif
+
+    // Entropy Coding Process
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->entropy_coding_process_init_count; ++processIndex) {
+#if FILT_PROC
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->restResultsConsumerFifoPtrArray[processIndex], EntropyCodingKernel, encHandlePtr->entropyCodingContextPtrArray[processIndex]);
+#else
+        return_error = EbSchedulerTaskCtor(encHandlePtr->schedulerPtr, encHandlePtr->encDecResultsConsumerFifoPtrArray[processIndex], EntropyCodingKernel, encHandlePtr->entropyCodingContextPtrArray[processIndex]);
+#endif
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    // Workers
+    EB_MALLOC(EbHandle*, encHandlePtr->schedulerWorkerThreadHandleArray, sizeof(EbHandle) * sequence_control_set_ptr->scheduler_worker_count, EB_N_PTR);
+
+    for (processIndex = 0; processIndex < sequence_control_set_ptr->scheduler_worker_count; ++processIndex) {
+        EB_CREATETHREAD(EbHandle, encHandlePtr->schedulerWorkerThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, EbSchedulerWorkerKernel, &encHandlePtr->schedulerPtr->workerArray[processIndex]);
+    }
+
+    return return_error;
+}
+#endif
+
+/**********************************
+* Input Copy
+*   input_copy_threads - 1 threads copy the bands of the input pictures
+*   below the band of the sending thread.
+**********************************/
+static void* InputCopyKernel(void *input_ptr);
+
+static EbErrorType eb_enc_handle_input_copy_ctor(
+    EbEncHandle_t *encHandlePtr)
+{
+    SequenceControlSet_t *sequence_control_set_ptr = encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
+    uint32_t bandIndex;
+
+    encHandlePtr->inputCopyBandCount = sequence_control_set_ptr->static_config.input_copy_threads;
+
+    EB_CREATEMUTEX(EbHandle, encHandlePtr->inputCopyMutex, sizeof(EbHandle), EB_MUTEX);
+    EB_CREATESEMAPHORE(EbHandle, encHandlePtr->inputCopyDoneSemaphore, sizeof(EbHandle), EB_SEMAPHORE, 0, encHandlePtr->inputCopyBandCount);
+
+    EB_MALLOC(EbInputCopyBand_t*, encHandlePtr->inputCopyBandArray, sizeof(EbInputCopyBand_t) * encHandlePtr->inputCopyBandCount, EB_N_PTR);
+    EB_MALLOC(EbHandle*, encHandlePtr->inputCopyThreadHandleArray, sizeof(EbHandle) * encHandlePtr->inputCopyBandCount, EB_N_PTR);
+
+    for (bandIndex = 1; bandIndex < encHandlePtr->inputCopyBandCount; ++bandIndex) {
+        EbInputCopyBand_t *bandPtr = &encHandlePtr->inputCopyBandArray[bandIndex];
+
+        bandPtr->doneSemaphore = encHandlePtr->inputCopyDoneSemaphore;
+        EB_CREATESEMAPHORE(EbHandle, bandPtr->startSemaphore, sizeof(EbHandle), EB_SEMAPHORE, 0, 1);
+        EB_CREATETHREAD(EbHandle, encHandlePtr->inputCopyThreadHandleArray[bandIndex], sizeof(EbHandle), EB_THREAD, InputCopyKernel, bandPtr);
+    }
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Memory Budget
+*   The picture buffer pools are constructed with their smallest count,
+*   the memory budget left is shared out one picture (an object of each
+*   pool) at a time, up to the default pool sizes.
+**********************************/
+#define EB_BudgetPoolCount 6
+static EbErrorType eb_enc_handle_memory_budget_ctor(
+    EbEncHandle_t *encHandlePtr)
+{
+    SequenceControlSet_t *sequence_control_set_ptr = encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
+    EbSystemResource_t   *poolArray[EB_BudgetPoolCount];
+    uint32_t             *poolCountArray[EB_BudgetPoolCount];
+    uint32_t              poolTotalCount = 0;
+    uint32_t              poolIndex;
+    uint64_t              budgetSize = (uint64_t)sequence_control_set_ptr->static_config.memory_budget << 20;
+    uint64_t              usedSize = 0;
+    uint64_t              pictureSize = 0;
+    uint32_t              extraPictureCount = 0;
+    EbErrorType           return_error = EB_ErrorNone;
+
+    poolArray[poolTotalCount] = encHandlePtr->pictureParentControlSetPoolPtrArray[0];
+    poolCountArray[poolTotalCount++] = &sequence_control_set_ptr->picture_control_set_pool_init_count;
+    poolArray[poolTotalCount] = encHandlePtr->referencePicturePoolPtrArray[0];
+    poolCountArray[poolTotalCount++] = &sequence_control_set_ptr->reference_picture_buffer_init_count;
+    poolArray[poolTotalCount] = encHandlePtr->paReferencePicturePoolPtrArray[0];
+    poolCountArray[poolTotalCount++] = &sequence_control_set_ptr->pa_reference_picture_buffer_init_count;
+    poolArray[poolTotalCount] = encHandlePtr->input_buffer_resource_ptr;
+    poolCountArray[poolTotalCount++] = &sequence_control_set_ptr->input_buffer_fifo_init_count;
+    poolArray[poolTotalCount] = encHandlePtr->output_stream_buffer_resource_ptr_array[0];
+    poolCountArray[poolTotalCount++] = &sequence_control_set_ptr->output_stream_buffer_fifo_init_count;
+    if (sequence_control_set_ptr->static_config.recon_enabled) {
+        poolArray[poolTotalCount] = encHandlePtr->output_recon_buffer_resource_ptr_array[0];
+        poolCountArray[poolTotalCount++] = &sequence_control_set_ptr->output_recon_buffer_fifo_init_count;
+    }
+
+    for (poolIndex = 0; poolIndex < poolTotalCount; ++poolIndex) {
+        usedSize += poolArray[poolIndex]->objectSize * poolArray[poolIndex]->objectTotalCount;
+        pictureSize += poolArray[poolIndex]->objectSize;
+    }
+
+    if (budgetSize < usedSize)
+        SVT_LOG("SVT [Warning]: MemoryBudget %u MB is below the %u MB the buffer pools need at least\n",
+            sequence_control_set_ptr->static_config.memory_budget, (uint32_t)((usedSize + (1 << 20) - 1) >> 20));
+    else if (pictureSize)
+        extraPictureCount = (uint32_t)MIN((budgetSize - usedSize) / pictureSize, 0xFFFF);
+
+    for (poolIndex = 0; poolIndex < poolTotalCount; ++poolIndex) {
+        return_error = EbSystemResourceSetMaxCount(
+            poolArray[poolIndex],
+            poolArray[poolIndex]->objectTotalCount + extraPictureCount,
+            sequence_control_set_ptr->static_config.elastic_pools);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+        *poolCountArray[poolIndex] = poolArray[poolIndex]->objectMaxCount;
+    }
+
+    SVT_LOG("SVT [config]: PCS / PAREF / REF / INPUT / OUTPUT Buffers \t\t\t\t: %d / %d / %d / %d / %d\n",
+        sequence_control_set_ptr->picture_control_set_pool_init_count,
+        sequence_control_set_ptr->pa_reference_picture_buffer_init_count,
+        sequence_control_set_ptr->reference_picture_buffer_init_count,
+        sequence_control_set_ptr->input_buffer_fifo_init_count,
+        sequence_control_set_ptr->output_stream_buffer_fifo_init_count);
+
+    return return_error;
+}
+
+/**********************************
+* Pipeline Statistics
+*   Each process is accounted on the full queue of the SystemResource
+*   it consumes.
+**********************************/
+static void eb_enc_handle_add_stage(
+    EbEncHandle_t      *encHandlePtr,
+    EbSystemResource_t *resourcePtr,
+    const char         *name,
+    uint32_t            threadCount)
+{
+    EbStageStats_t *statsPtr = &encHandlePtr->stageStatsArray[encHandlePtr->stageTotalCount++];
+
+    statsPtr->name = name;
+    statsPtr->threadCount = threadCount;
+    statsPtr->processedCount = 0;
+    statsPtr->activeTime = 0;
+    statsPtr->inputBlockedTime = 0;
+    statsPtr->outputBlockedTime = 0;
+    statsPtr->queueDepth = 0;
+    statsPtr->maxQueueDepth = 0;
+    statsPtr->tracePtr = encHandlePtr->tracePtr;
+
+    EbSystemResourceSetStageStats(resourcePtr, statsPtr);
+}
+
+static EbErrorType eb_enc_handle_stats_ctor(
+    EbEncHandle_t *encHandlePtr)
+{
+    SequenceControlSet_t *sequence_control_set_ptr = encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
+
+    if (sequence_control_set_ptr->static_config.trace_file) {
+        EbErrorType return_error = EbTraceCtor(
+            &encHandlePtr->tracePtr,
+            sequence_control_set_ptr->static_config.trace_file,
+            sequence_control_set_ptr->static_config.channel_id);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+
+    encHandlePtr->stageTotalCount = 0;
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->input_buffer_resource_ptr, "ResourceCoordination", EB_ResourceCoordinationProcessInitCount);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->resourceCoordinationResultsResourcePtr, "PictureAnalysis", sequence_control_set_ptr->picture_analysis_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->pictureAnalysisResultsResourcePtr, "PictureDecision", EB_PictureDecisionProcessInitCount);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->pictureDecisionResultsResourcePtr, "MotionEstimation", sequence_control_set_ptr->motion_estimation_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->motionEstimationResultsResourcePtr, "InitialRateControl", EB_InitialRateControlProcessInitCount);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->initialRateControlResultsResourcePtr, "SourceBasedOperations", sequence_control_set_ptr->source_based_operations_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->pictureDemuxResultsResourcePtr, "PictureManager", EB_PictureManagerProcessInitCount);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->rateControlTasksResourcePtr, "RateControl", EB_RateControlProcessInitCount);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->rateControlResultsResourcePtr, "ModeDecisionConfiguration", sequence_control_set_ptr->mode_decision_configuration_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->encDecTasksResourcePtr, "EncDec", sequence_control_set_ptr->enc_dec_process_init_count);
+#if FILT_PROC
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->encDecResultsResourcePtr, "Dlf", sequence_control_set_ptr->dlf_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->dlfResultsResourcePtr, "Cdef", sequence_control_set_ptr->cdef_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->cdefResultsResourcePtr, "Rest", sequence_control_set_ptr->rest_process_init_count);
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->restResultsResourcePtr, "EntropyCoding", sequence_control_set_ptr->entropy_coding_process_init_count);
+#else
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->encDecResultsResourcePtr, "EntropyCoding", sequence_control_set_ptr->entropy_coding_process_init_count);
+#endif
+    eb_enc_handle_add_stage(encHandlePtr, encHandlePtr->entropyCodingResultsResourcePtr, "Packetization", EB_PacketizationProcessInitCount);
+
+    encHandlePtr->statsStartTime = EbGetTimeUs();
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Encoder Pipeline
+*   Constructs the buffers, contexts and threads of the encoder, with the
+*   calling thread set up by eb_init_encoder. Returns at the first error.
+**********************************/
+static EbErrorType eb_enc_handle_pipeline_ctor(
+    EbEncHandle_t *encHandlePtr)
 {
-    EbEncHandle_t *encHandlePtr = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
     EbErrorType return_error = EB_ErrorNone;
     uint32_t instanceIndex;
     uint32_t processIndex;
@@ -772,21 +1508,24 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     uint32_t maxLookAheadDistance = 0;
 
     EbBool is16bit = (EbBool)(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    EbSvtAv1EncConfiguration   *config_ptr = &encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config;
 
     /************************************
     * Plateform detection
     ************************************/
-    if (encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.asm_type == 1) {
-        encHandlePtr->sequenceControlSetInstanceArray[0]->encode_context_ptr->asm_type = GetCpuAsmType();
-    }
-    else {
-        encHandlePtr->sequenceControlSetInstanceArray[0]->encode_context_ptr->asm_type = encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.asm_type;
-    }
+    return_error = EbDispatchTableCtor(
+        &encHandlePtr->dispatchTablePtr,
+        config_ptr->asm_type);
+    if (return_error != EB_ErrorNone)
+        return return_error;
+
+    // The encoder threads inherit the binding like the memory context
+    EbSetDispatchTable(encHandlePtr->dispatchTablePtr);
+    encHandlePtr->sequenceControlSetInstanceArray[0]->encode_context_ptr->asm_type = encHandlePtr->dispatchTablePtr->asmType;
 
 #if !INTRA_ASM
     init_intra_predictors_internal();
 #endif
-    setup_rtcd_internal(encHandlePtr->sequenceControlSetInstanceArray[0]->encode_context_ptr->asm_type);
     asmSetConvolveAsmTable();
 
     init_intra_dc_predictors_c_internal();
@@ -823,7 +1562,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     /************************************
     * Picture Control Set: Parent
     ************************************/
-    EB_MALLOC(EbSystemResource_t**, encHandlePtr->pictureParentControlSetPoolPtrArray, sizeof(EbSystemResource_t*)  * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
+    EB_CALLOC(EbSystemResource_t**, encHandlePtr->pictureParentControlSetPoolPtrArray, encHandlePtr->encodeInstanceTotalCount, sizeof(EbSystemResource_t*), EB_N_PTR);
 
 
     EB_MALLOC(EbFifo_t***, encHandlePtr->pictureParentControlSetPoolProducerFifoPtrDblArray, sizeof(EbSystemResource_t**) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
@@ -865,9 +1604,13 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         inputData.ext_block_flag = (uint8_t)encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.ext_block_flag;
 
         inputData.in_loop_me_flag = (uint8_t)encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.in_loop_me_flag;
+        inputData.sb_size_pix = scs_init.sb_size;
+        inputData.tile_columns = encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.tile_columns;
+        inputData.tile_rows = encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.tile_rows;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &(encHandlePtr->pictureParentControlSetPoolPtrArray[instanceIndex]),
+            PoolInitCount(encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->picture_control_set_pool_init_count, maxLookAheadDistance),
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->picture_control_set_pool_init_count,//encHandlePtr->pictureControlSetPoolTotalCount,
             1,
             0,
@@ -875,10 +1618,17 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (EbFifo_t ***)EB_NULL,
             EB_FALSE,
             PictureParentControlSetCtor,
-            &inputData);
+            &inputData,
+            sizeof(inputData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
+
+        if (encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.zero_copy_input) {
+            EbSystemResourceSetReleaseCallback(
+                encHandlePtr->pictureParentControlSetPoolPtrArray[instanceIndex],
+                ReleaseInputPicture);
+        }
     }
 
     /************************************
@@ -916,6 +1666,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         inputData.sb_size_pix = scs_init.sb_size;
         inputData.max_depth = encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->max_sb_depth;
         inputData.is16bit = is16bit;
+        inputData.tile_columns = encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.tile_columns;
+        inputData.tile_rows = encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.tile_rows;
         return_error = EbSystemResourceCtor(
             &(encHandlePtr->pictureControlSetPoolPtrArray[instanceIndex]),
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->picture_control_set_pool_init_count_child, //EB_PictureControlSetPoolInitCountChild,
@@ -980,8 +1732,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbReferenceObjectDescInitDataStructure.referencePictureDescInitData = referencePictureBufferDescInitData;
 
         // Reference Picture Buffers
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->referencePicturePoolPtrArray[instanceIndex],
+            PoolInitCount(encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->reference_picture_buffer_init_count, 0),
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->reference_picture_buffer_init_count,//encHandlePtr->referencePicturePoolTotalCount,
             EB_PictureManagerProcessInitCount,
             0,
@@ -989,7 +1742,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (EbFifo_t ***)EB_NULL,
             EB_FALSE,
             EbReferenceObjectCtor,
-            &(EbReferenceObjectDescInitDataStructure));
+            &(EbReferenceObjectDescInitDataStructure),
+            sizeof(EbReferenceObjectDescInitDataStructure));
 
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
@@ -1034,8 +1788,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbPaReferenceObjectDescInitDataStructure.sixteenthPictureDescInitData = sixteenthDecimPictureBufferDescInitData;
 
         // Reference Picture Buffers
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->paReferencePicturePoolPtrArray[instanceIndex],
+            PoolInitCount(encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->pa_reference_picture_buffer_init_count, 0),
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->pa_reference_picture_buffer_init_count,
             EB_PictureDecisionProcessInitCount,
             0,
@@ -1043,7 +1798,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (EbFifo_t ***)EB_NULL,
             EB_FALSE,
             EbPaReferenceObjectCtor,
-            &(EbPaReferenceObjectDescInitDataStructure));
+            &(EbPaReferenceObjectDescInitDataStructure),
+            sizeof(EbPaReferenceObjectDescInitDataStructure));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1058,8 +1814,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     ************************************/
 
     // EbBufferHeaderType Input
-    return_error = EbSystemResourceCtor(
+    return_error = EbSystemResourceElasticCtor(
         &encHandlePtr->input_buffer_resource_ptr,
+        PoolInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->input_buffer_fifo_init_count, SCD_LAD),
         encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->input_buffer_fifo_init_count,
         1,
         EB_ResourceCoordinationProcessInitCount,
@@ -1067,7 +1824,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         &encHandlePtr->input_buffer_consumer_fifo_ptr_array,
         EB_TRUE,
         EbInputBufferHeaderCtor,
-        encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr);
+        encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr,
+        0);
 
     if (return_error == EB_ErrorInsufficientResources) {
         return EB_ErrorInsufficientResources;
@@ -1078,8 +1836,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     EB_MALLOC(EbFifo_t***, encHandlePtr->output_stream_buffer_consumer_fifo_ptr_dbl_array, sizeof(EbFifo_t**)          * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
 
     for (instanceIndex = 0; instanceIndex < encHandlePtr->encodeInstanceTotalCount; ++instanceIndex) {
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->output_stream_buffer_resource_ptr_array[instanceIndex],
+            PoolInitCount(encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->output_stream_buffer_fifo_init_count, SCD_LAD + 4),
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->output_stream_buffer_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->total_process_init_count,//EB_PacketizationProcessInitCount,
             1,
@@ -1087,10 +1846,25 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->output_stream_buffer_consumer_fifo_ptr_dbl_array[instanceIndex],
             EB_TRUE,
             EbOutputBufferHeaderCtor,
-            &encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config);
+            &encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config,
+            0);
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
+
+        // The packets are written to the packet ring, starting at the size
+        //   of the largest packet
+        return_error = EbPacketRingCtor(
+            &encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encode_context_ptr->packet_ring_ptr,
+            encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.packet_ring_size ?
+            encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.packet_ring_size :
+            (uint32_t)(EB_OUTPUTSTREAMBUFFERSIZE_MACRO(encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.source_width * encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->static_config.source_height)));
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+        EbSystemResourceSetReleaseCallback(
+            encHandlePtr->output_stream_buffer_resource_ptr_array[instanceIndex],
+            ReleaseOutputPacket);
     }
     if (encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.recon_enabled) {
         // EbBufferHeaderType Output Recon
@@ -1099,8 +1873,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EB_MALLOC(EbFifo_t***, encHandlePtr->output_recon_buffer_consumer_fifo_ptr_dbl_array, sizeof(EbFifo_t**)          * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
 
         for (instanceIndex = 0; instanceIndex < encHandlePtr->encodeInstanceTotalCount; ++instanceIndex) {
-            return_error = EbSystemResourceCtor(
+            return_error = EbSystemResourceElasticCtor(
                 &encHandlePtr->output_recon_buffer_resource_ptr_array[instanceIndex],
+                PoolInitCount(encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->output_recon_buffer_fifo_init_count, 0),
                 encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->output_recon_buffer_fifo_init_count,
                 encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequence_control_set_ptr->enc_dec_process_init_count,
                 1,
@@ -1108,19 +1883,29 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
                 &encHandlePtr->output_recon_buffer_consumer_fifo_ptr_dbl_array[instanceIndex],
                 EB_TRUE,
                 EbOutputReconBufferHeaderCtor,
-                encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr);
+                encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr,
+                0);
             if (return_error == EB_ErrorInsufficientResources) {
                 return EB_ErrorInsufficientResources;
             }
         }
     }
 
+    // Share out the memory budget between the picture buffers
+    if (config_ptr->memory_budget) {
+        return_error = eb_enc_handle_memory_budget_ctor(encHandlePtr);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
     // Resource Coordination Results
     {
         ResourceCoordinationResultInitData_t resourceCoordinationResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->resourceCoordinationResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->resource_coordination_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->resource_coordination_fifo_init_count,
             EB_ResourceCoordinationProcessInitCount,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_process_init_count,
@@ -1128,7 +1913,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->resourceCoordinationResultsConsumerFifoPtrArray,
             EB_TRUE,
             ResourceCoordinationResultCtor,
-            &resourceCoordinationResultInitData);
+            &resourceCoordinationResultInitData,
+            sizeof(resourceCoordinationResultInitData));
 
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
@@ -1140,8 +1926,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         PictureAnalysisResultInitData_t pictureAnalysisResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->pictureAnalysisResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_process_init_count,
             EB_PictureDecisionProcessInitCount,
@@ -1149,7 +1936,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->pictureAnalysisResultsConsumerFifoPtrArray,
             EB_TRUE,
             PictureAnalysisResultCtor,
-            &pictureAnalysisResultInitData);
+            &pictureAnalysisResultInitData,
+            sizeof(pictureAnalysisResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1159,8 +1947,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         PictureDecisionResultInitData_t pictureDecisionResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->pictureDecisionResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_decision_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_decision_fifo_init_count,
             EB_PictureDecisionProcessInitCount,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_process_init_count,
@@ -1168,7 +1957,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->pictureDecisionResultsConsumerFifoPtrArray,
             EB_TRUE,
             PictureDecisionResultCtor,
-            &pictureDecisionResultInitData);
+            &pictureDecisionResultInitData,
+            sizeof(pictureDecisionResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1178,8 +1968,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         MotionEstimationResultsInitData_t motionEstimationResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->motionEstimationResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_process_init_count,
             EB_InitialRateControlProcessInitCount,
@@ -1187,7 +1978,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->motionEstimationResultsConsumerFifoPtrArray,
             EB_TRUE,
             MotionEstimationResultsCtor,
-            &motionEstimationResultInitData);
+            &motionEstimationResultInitData,
+            sizeof(motionEstimationResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1197,8 +1989,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         InitialRateControlResultInitData_t initialRateControlResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->initialRateControlResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->initial_rate_control_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->initial_rate_control_fifo_init_count,
             EB_InitialRateControlProcessInitCount,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->source_based_operations_process_init_count,
@@ -1206,7 +1999,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->initialRateControlResultsConsumerFifoPtrArray,
             EB_TRUE,
             InitialRateControlResultsCtor,
-            &initialRateControlResultInitData);
+            &initialRateControlResultInitData,
+            sizeof(initialRateControlResultInitData));
 
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
@@ -1217,8 +2011,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         PictureResultInitData_t pictureResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->pictureDemuxResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_demux_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_demux_fifo_init_count,
 #if FILT_PROC
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->source_based_operations_process_init_count + encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count,
@@ -1230,7 +2025,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->pictureDemuxResultsConsumerFifoPtrArray,
             EB_TRUE,
             PictureResultsCtor,
-            &pictureResultInitData);
+            &pictureResultInitData,
+            sizeof(pictureResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1240,8 +2036,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         RateControlTasksInitData_t rateControlTasksInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->rateControlTasksResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rate_control_tasks_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rate_control_tasks_fifo_init_count,
             RateControlPortTotalCount(),
             EB_RateControlProcessInitCount,
@@ -1249,7 +2046,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->rateControlTasksConsumerFifoPtrArray,
             EB_TRUE,
             RateControlTasksCtor,
-            &rateControlTasksInitData);
+            &rateControlTasksInitData,
+            sizeof(rateControlTasksInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1259,8 +2057,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         RateControlResultsInitData_t rateControlResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->rateControlResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rate_control_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rate_control_fifo_init_count,
             EB_RateControlProcessInitCount,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count,
@@ -1268,7 +2067,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->rateControlResultsConsumerFifoPtrArray,
             EB_TRUE,
             RateControlResultsCtor,
-            &rateControlResultInitData);
+            &rateControlResultInitData,
+            sizeof(rateControlResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1286,8 +2086,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
                 encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_segment_row_count_array[i]);
         }
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->encDecTasksResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_fifo_init_count,
             EncDecPortTotalCount(),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count,
@@ -1295,7 +2096,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->encDecTasksConsumerFifoPtrArray,
             EB_TRUE,
             EncDecTasksCtor,
-            &ModeDecisionResultInitData);
+            &ModeDecisionResultInitData,
+            sizeof(ModeDecisionResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1305,20 +2107,25 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         EncDecResultsInitData_t encDecResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->encDecResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_fifo_init_count,
-            encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count,
 #if FILT_PROC
+            // The DLF processes post their SB row jobs back to the DLF input
+            encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count +
+            encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count,
 #else
+            encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count,
 #endif
             &encHandlePtr->encDecResultsProducerFifoPtrArray,
             &encHandlePtr->encDecResultsConsumerFifoPtrArray,
             EB_TRUE,
             EncDecResultsCtor,
-            &encDecResultInitData);
+            &encDecResultInitData,
+            sizeof(encDecResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1329,8 +2136,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         EntropyCodingResultsInitData_t dlfResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->dlfResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_process_init_count,
@@ -1338,7 +2146,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->dlfResultsConsumerFifoPtrArray,
             EB_TRUE,
             DlfResultsCtor,
-            &dlfResultInitData);
+            &dlfResultInitData,
+            sizeof(dlfResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1347,8 +2156,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         EntropyCodingResultsInitData_t cdefResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->cdefResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_process_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count,
@@ -1356,7 +2166,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->cdefResultsConsumerFifoPtrArray,
             EB_TRUE,
             CdefResultsCtor,
-            &cdefResultInitData);
+            &cdefResultInitData,
+            sizeof(cdefResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1366,8 +2177,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         EntropyCodingResultsInitData_t restResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->restResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count,
@@ -1375,7 +2187,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->restResultsConsumerFifoPtrArray,
             EB_TRUE,
             RestResultsCtor,
-            &restResultInitData);
+            &restResultInitData,
+            sizeof(restResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
@@ -1386,8 +2199,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     {
         EntropyCodingResultsInitData_t entropyCodingResultInitData;
 
-        return_error = EbSystemResourceCtor(
+        return_error = EbSystemResourceElasticCtor(
             &encHandlePtr->entropyCodingResultsResourcePtr,
+            FifoInitCount(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_fifo_init_count),
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_fifo_init_count,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count,
             EB_PacketizationProcessInitCount,
@@ -1395,12 +2209,18 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &encHandlePtr->entropyCodingResultsConsumerFifoPtrArray,
             EB_TRUE,
             EntropyCodingResultsCtor,
-            &entropyCodingResultInitData);
+            &entropyCodingResultInitData,
+            sizeof(entropyCodingResultInitData));
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
     }
 
+    return_error = eb_enc_handle_stats_ctor(encHandlePtr);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+
     /************************************
     * App Callbacks
     ************************************/
@@ -1413,6 +2233,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encode_context_ptr->stream_output_fifo_ptr     = (encHandlePtr->output_stream_buffer_producer_fifo_ptr_dbl_array[instanceIndex])[0];
         if (encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.recon_enabled)
             encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encode_context_ptr->recon_output_fifo_ptr      = (encHandlePtr->output_recon_buffer_producer_fifo_ptr_dbl_array[instanceIndex])[0];
+        if (encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.recon_enabled &&
+            encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.packet_callback)
+            encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encode_context_ptr->recon_callback_fifo_ptr    = (encHandlePtr->output_recon_buffer_consumer_fifo_ptr_dbl_array[instanceIndex])[0];
     }
 
     /************************************
@@ -1598,6 +2421,7 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (DlfContext_t**)&encHandlePtr->dlfContextPtrArray[processIndex],
             encHandlePtr->encDecResultsConsumerFifoPtrArray[processIndex],
             encHandlePtr->dlfResultsProducerFifoPtrArray[processIndex],             //output to EC
+            encHandlePtr->encDecResultsProducerFifoPtrArray[encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count + processIndex],
             is16bit,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->max_input_luma_width,
             encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->max_input_luma_height
@@ -1678,93 +2502,147 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     /************************************
     * Thread Handles
     ************************************/
-    EbSvtAv1EncConfiguration   *config_ptr = &encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config;
-    EbSetThreadManagementParameters(config_ptr);
+    // Input Copy
+    if (config_ptr->input_copy_threads > 1) {
+        return_error = eb_enc_handle_input_copy_ctor(encHandlePtr);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
 
-    // Resource Coordination
-    EB_CREATETHREAD(EbHandle, encHandlePtr->resourceCoordinationThreadHandle, sizeof(EbHandle), EB_THREAD, ResourceCoordinationKernel, encHandlePtr->resourceCoordinationContextPtr);
+#if LOCK_FREE_FIFO
+    if (config_ptr->task_scheduler) {
+        // Task Scheduler
+        return_error = eb_enc_handle_scheduler_ctor(encHandlePtr);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+    else
+#endif
+    {
+        // Resource Coordination
+        EB_CREATETHREAD(EbHandle, encHandlePtr->resourceCoordinationThreadHandle, sizeof(EbHandle), EB_THREAD, ResourceCoordinationKernel, encHandlePtr->resourceCoordinationContextPtr);
 
-    // Picture Analysis
-    EB_MALLOC(EbHandle*, encHandlePtr->pictureAnalysisThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_process_init_count, EB_N_PTR);
+        // Picture Decision
+        EB_CREATETHREAD(EbHandle, encHandlePtr->pictureDecisionThreadHandle, sizeof(EbHandle), EB_THREAD, PictureDecisionKernel, encHandlePtr->pictureDecisionContextPtr);
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->pictureAnalysisThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, PictureAnalysisKernel, encHandlePtr->pictureAnalysisContextPtrArray[processIndex]);
-    }
+        // Initial Rate Control
+        EB_CREATETHREAD(EbHandle, encHandlePtr->initialRateControlThreadHandle, sizeof(EbHandle), EB_THREAD, InitialRateControlKernel, encHandlePtr->initialRateControlContextPtr);
 
-    // Picture Decision
-    EB_CREATETHREAD(EbHandle, encHandlePtr->pictureDecisionThreadHandle, sizeof(EbHandle), EB_THREAD, PictureDecisionKernel, encHandlePtr->pictureDecisionContextPtr);
+        // Picture Manager
+        EB_CREATETHREAD(EbHandle, encHandlePtr->pictureManagerThreadHandle, sizeof(EbHandle), EB_THREAD, PictureManagerKernel, encHandlePtr->pictureManagerContextPtr);
 
-    // Motion Estimation
-    EB_MALLOC(EbHandle*, encHandlePtr->motionEstimationThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_process_init_count, EB_N_PTR);
+        // Rate Control
+        EB_CREATETHREAD(EbHandle, encHandlePtr->rateControlThreadHandle, sizeof(EbHandle), EB_THREAD, RateControlKernel, encHandlePtr->rateControlContextPtr);
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->motionEstimationThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, MotionEstimationKernel, encHandlePtr->motionEstimationContextPtrArray[processIndex]);
-    }
+        // Packetization
+        EB_CREATETHREAD(EbHandle, encHandlePtr->packetizationThreadHandle, sizeof(EbHandle), EB_THREAD, PacketizationKernel, encHandlePtr->packetizationContextPtr);
 
-    // Initial Rate Control
-    EB_CREATETHREAD(EbHandle, encHandlePtr->initialRateControlThreadHandle, sizeof(EbHandle), EB_THREAD, InitialRateControlKernel, encHandlePtr->initialRateControlContextPtr);
+        // Picture Analysis
+        EB_MALLOC(EbHandle*, encHandlePtr->pictureAnalysisThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_process_init_count, EB_N_PTR);
 
-    // Source Based Oprations
-    EB_MALLOC(EbHandle*, encHandlePtr->sourceBasedOperationsThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->source_based_operations_process_init_count, EB_N_PTR);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->picture_analysis_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->pictureAnalysisThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, PictureAnalysisKernel, encHandlePtr->pictureAnalysisContextPtrArray[processIndex]);
+        }
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->source_based_operations_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->sourceBasedOperationsThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, source_based_operations_kernel, encHandlePtr->sourceBasedOperationsContextPtrArray[processIndex]);
-    }
+        // Motion Estimation
+        EB_MALLOC(EbHandle*, encHandlePtr->motionEstimationThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_process_init_count, EB_N_PTR);
 
-    // Picture Manager
-    EB_CREATETHREAD(EbHandle, encHandlePtr->pictureManagerThreadHandle, sizeof(EbHandle), EB_THREAD, PictureManagerKernel, encHandlePtr->pictureManagerContextPtr);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->motion_estimation_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->motionEstimationThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, MotionEstimationKernel, encHandlePtr->motionEstimationContextPtrArray[processIndex]);
+        }
 
-    // Rate Control
-    EB_CREATETHREAD(EbHandle, encHandlePtr->rateControlThreadHandle, sizeof(EbHandle), EB_THREAD, RateControlKernel, encHandlePtr->rateControlContextPtr);
+        // Source Based Oprations
+        EB_MALLOC(EbHandle*, encHandlePtr->sourceBasedOperationsThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->source_based_operations_process_init_count, EB_N_PTR);
 
-    // Mode Decision Configuration Process
-    EB_MALLOC(EbHandle*, encHandlePtr->modeDecisionConfigurationThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count, EB_N_PTR);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->source_based_operations_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->sourceBasedOperationsThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, source_based_operations_kernel, encHandlePtr->sourceBasedOperationsContextPtrArray[processIndex]);
+        }
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->modeDecisionConfigurationThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, ModeDecisionConfigurationKernel, encHandlePtr->modeDecisionConfigurationContextPtrArray[processIndex]);
-    }
+        // Mode Decision Configuration Process
+        EB_MALLOC(EbHandle*, encHandlePtr->modeDecisionConfigurationThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count, EB_N_PTR);
 
-    // EncDec Process
-    EB_MALLOC(EbHandle*, encHandlePtr->encDecThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count, EB_N_PTR);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->modeDecisionConfigurationThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, ModeDecisionConfigurationKernel, encHandlePtr->modeDecisionConfigurationContextPtrArray[processIndex]);
+        }
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->encDecThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, EncDecKernel, encHandlePtr->encDecContextPtrArray[processIndex]);
-    }
+        // EncDec Process
+        EB_MALLOC(EbHandle*, encHandlePtr->encDecThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count, EB_N_PTR);
+
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->enc_dec_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->encDecThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, EncDecKernel, encHandlePtr->encDecContextPtrArray[processIndex]);
+        }
 
 #if FILT_PROC
-    // Dlf Process
-    EB_MALLOC(EbHandle*, encHandlePtr->dlfThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count, EB_N_PTR);
+        // Dlf Process
+        EB_MALLOC(EbHandle*, encHandlePtr->dlfThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count, EB_N_PTR);
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->dlfThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, dlf_kernel, encHandlePtr->dlfContextPtrArray[processIndex]);
-    }
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->dlf_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->dlfThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, dlf_kernel, encHandlePtr->dlfContextPtrArray[processIndex]);
+        }
 
+        // Cdef Process
+        EB_MALLOC(EbHandle*, encHandlePtr->cdefThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_process_init_count, EB_N_PTR);
 
-    // Cdef Process
-    EB_MALLOC(EbHandle*, encHandlePtr->cdefThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_process_init_count, EB_N_PTR);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->cdefThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, cdef_kernel, encHandlePtr->cdefContextPtrArray[processIndex]);
+        }
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->cdef_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->cdefThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, cdef_kernel, encHandlePtr->cdefContextPtrArray[processIndex]);
-    }
+        // Rest Process
+        EB_MALLOC(EbHandle*, encHandlePtr->restThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count, EB_N_PTR);
 
-    // Rest Process
-    EB_MALLOC(EbHandle*, encHandlePtr->restThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count, EB_N_PTR);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->restThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, rest_kernel, encHandlePtr->restContextPtrArray[processIndex]);
+        }
+#endif
+        // Entropy Coding Process
+        EB_MALLOC(EbHandle*, encHandlePtr->entropyCodingThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count, EB_N_PTR);
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->rest_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->restThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, rest_kernel, encHandlePtr->restContextPtrArray[processIndex]);
+        for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count; ++processIndex) {
+            EB_CREATETHREAD(EbHandle, encHandlePtr->entropyCodingThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, EntropyCodingKernel, encHandlePtr->entropyCodingContextPtrArray[processIndex]);
+        }
     }
+
+    return return_error;
+}
+
+/**********************************
+* Initialize Encoder Library
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
 #endif
-    // Entropy Coding Process
-    EB_MALLOC(EbHandle*, encHandlePtr->entropyCodingThreadHandleArray, sizeof(EbHandle) * encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count, EB_N_PTR);
+EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
+{
+    EbEncHandle_t *encHandlePtr = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
+    EbErrorType return_error = EB_ErrorNone;
 
-    for (processIndex = 0; processIndex < encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->entropy_coding_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, encHandlePtr->entropyCodingThreadHandleArray[processIndex], sizeof(EbHandle), EB_THREAD, EntropyCodingKernel, encHandlePtr->entropyCodingContextPtrArray[processIndex]);
-    }
+    EbSvtAv1EncConfiguration   *config_ptr = &encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config;
 
-    // Packetization
-    EB_CREATETHREAD(EbHandle, encHandlePtr->packetizationThreadHandle, sizeof(EbHandle), EB_THREAD, PacketizationKernel, encHandlePtr->packetizationContextPtr);
+    // Bind the calling thread to the memory context of the handle, the
+    //   encoder threads inherit the binding when they are created
+    EbSetMemoryContext(&encHandlePtr->memoryContext);
+
+    /************************************
+    * Thread Affinity
+    ************************************/
+    EbSetThreadManagementParameters(config_ptr);
+#ifdef __linux__
+    cpu_set_t callerAffinity;
+    EbBool    callerAffinitySet = EbAssignEncoderAffinity(config_ptr, &callerAffinity);
+#endif
+
+    // The constructors return from the middle on errors (i.e. EB_MALLOC),
+    //   the affinity is restored here whatever the outcome
+    return_error = eb_enc_handle_pipeline_ctor(encHandlePtr);
+
+#ifdef __linux__
+    // The encoder threads keep the restriction, give the caller its own back
+    if (callerAffinitySet)
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &callerAffinity);
+#endif
 
-    
 #if DISPLAY_MEMORY
     EB_MEMORY();
 #endif
@@ -1781,43 +2659,26 @@ EB_API EbErrorType eb_deinit_encoder(EbComponentType *svt_enc_component)
 {
     EbEncHandle_t *encHandlePtr = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
     EbErrorType return_error = EB_ErrorNone;
-    int32_t              ptrIndex = 0;
-    EbMemoryMapEntry*   memoryEntry = (EbMemoryMapEntry*)EB_NULL;
     if (encHandlePtr) {
-        if (encHandlePtr->memoryMapIndex) {
-            // Loop through the ptr table and free all malloc'd pointers per channel
-            for (ptrIndex = (encHandlePtr->memoryMapIndex) - 1; ptrIndex >= 0; --ptrIndex) {
-                memoryEntry = &encHandlePtr->memoryMap[ptrIndex];
-                switch (memoryEntry->ptrType) {
-                case EB_N_PTR:
-                    free(memoryEntry->ptr);
-                    break;
-                case EB_A_PTR:
-#ifdef _WIN32
-                    _aligned_free(memoryEntry->ptr);
-#else
-                    free(memoryEntry->ptr);
-#endif
-                    break;
-                case EB_SEMAPHORE:
-                    EbDestroySemaphore(memoryEntry->ptr);
-                    break;
-                case EB_THREAD:
-                    EbDestroyThread(memoryEntry->ptr);
-                    break;
-                case EB_MUTEX:
-                    EbDestroyMutex(memoryEntry->ptr);
-                    break;
-                default:
-                    return_error = EB_ErrorMax;
-                    break;
-                }
-            }
-            if (encHandlePtr->memoryMap != (EbMemoryMapEntry*)NULL) {
-                free(encHandlePtr->memoryMap);
-            }
-
+        EbMemoryContext_t *memoryContextPtr = &encHandlePtr->memoryContext;
+
+        // Unbind the calling thread before the context goes away
+        if (EbGetMemoryContext() == memoryContextPtr)
+            EbSetMemoryContext((EbMemoryContext_t*)EB_NULL);
+        if (currentDispatchTablePtr == encHandlePtr->dispatchTablePtr)
+            EbSetDispatchTable((EbDispatchTable_t*)EB_NULL);
+
+        // The threads record into the trace and release pictures until they
+        //   are stopped
+        EbStopMemoryContextThreads(memoryContextPtr);
+        if (encHandlePtr->tracePtr) {
+            EbTraceDump(encHandlePtr->tracePtr);
+            encHandlePtr->tracePtr = (EbTrace_t*)EB_NULL;
         }
+
+        ReleasePendingInputPictures(encHandlePtr);
+
+        return_error = EbReleaseMemoryContext(memoryContextPtr);
     }
     return return_error;
 }
@@ -2126,6 +2987,10 @@ void CopyApiFromApp(
     // MD Parameters
     sequence_control_set_ptr->static_config.constrained_intra = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->constrained_intra;
 
+    // Tiles
+    sequence_control_set_ptr->static_config.tile_columns = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->tile_columns;
+    sequence_control_set_ptr->static_config.tile_rows = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->tile_rows;
+
     // Adaptive Loop Filter
 
     // Rate Control
@@ -2151,6 +3016,9 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.encoder_bit_depth = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->encoder_bit_depth;
     sequence_control_set_ptr->static_config.ten_bit_format = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->ten_bit_format;
     sequence_control_set_ptr->static_config.compressed_ten_bit_format = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->compressed_ten_bit_format;
+    sequence_control_set_ptr->static_config.semi_planar_input = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->semi_planar_input;
+    sequence_control_set_ptr->static_config.input_sample_shift = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->input_sample_shift;
+    sequence_control_set_ptr->static_config.input_copy_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->input_copy_threads;
 
     // Thresholds
     sequence_control_set_ptr->static_config.improve_sharpness = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->improve_sharpness;
@@ -2178,8 +3046,32 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.channel_id = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->channel_id;
     sequence_control_set_ptr->static_config.active_channel_count = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->active_channel_count;
     sequence_control_set_ptr->static_config.use_round_robin_thread_assignment = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->use_round_robin_thread_assignment;
+    sequence_control_set_ptr->static_config.task_scheduler = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->task_scheduler;
+    sequence_control_set_ptr->static_config.memory_budget = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->memory_budget;
+    sequence_control_set_ptr->static_config.elastic_pools = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->elastic_pools;
+    sequence_control_set_ptr->static_config.zero_copy_input = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->zero_copy_input;
+    sequence_control_set_ptr->static_config.input_release_callback = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->input_release_callback;
+    sequence_control_set_ptr->static_config.input_release_context = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->input_release_context;
+    sequence_control_set_ptr->static_config.packet_ring_size = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->packet_ring_size;
+    sequence_control_set_ptr->static_config.packet_callback = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->packet_callback;
+    sequence_control_set_ptr->static_config.recon_callback = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->recon_callback;
+    sequence_control_set_ptr->static_config.output_callback_context = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->output_callback_context;
+    sequence_control_set_ptr->static_config.logical_processors = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->logical_processors;
+    sequence_control_set_ptr->static_config.target_socket = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->target_socket;
+    sequence_control_set_ptr->static_config.processor_list = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->processor_list;
+    sequence_control_set_ptr->static_config.picture_analysis_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->picture_analysis_threads;
+    sequence_control_set_ptr->static_config.motion_estimation_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->motion_estimation_threads;
+    sequence_control_set_ptr->static_config.source_based_operations_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->source_based_operations_threads;
+    sequence_control_set_ptr->static_config.mode_decision_configuration_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->mode_decision_configuration_threads;
+    sequence_control_set_ptr->static_config.enc_dec_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enc_dec_threads;
+    sequence_control_set_ptr->static_config.dlf_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->dlf_threads;
+    sequence_control_set_ptr->static_config.cdef_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->cdef_threads;
+    sequence_control_set_ptr->static_config.rest_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->rest_threads;
+    sequence_control_set_ptr->static_config.entropy_coding_threads = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->entropy_coding_threads;
     sequence_control_set_ptr->qp = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->qp;
     sequence_control_set_ptr->static_config.recon_enabled = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->recon_enabled;
+    sequence_control_set_ptr->static_config.recon_buffer_count = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->recon_buffer_count;
+    sequence_control_set_ptr->static_config.trace_file = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->trace_file;
 
     // Extract frame rate from Numerator and Denominator if not 0
     if (sequence_control_set_ptr->static_config.frame_rate_numerator != 0 && sequence_control_set_ptr->static_config.frame_rate_denominator != 0) {
@@ -2439,6 +3331,14 @@ static EbErrorType VerifySettings(
         SVT_LOG("Error Instance %u: The constrained intra must be [0 - 1] \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
+    if (config->tile_columns > EB_MaxLog2TileCount) {
+        SVT_LOG("Error Instance %u: The log2 tile columns must be [0 - %u] \n", channelNumber + 1, EB_MaxLog2TileCount);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->tile_rows > EB_MaxLog2TileCount) {
+        SVT_LOG("Error Instance %u: The log2 tile rows must be [0 - %u] \n", channelNumber + 1, EB_MaxLog2TileCount);
+        return_error = EB_ErrorBadParameter;
+    }
     if (config->rate_control_mode > 1) {
         SVT_LOG("Error Instance %u: The rate control mode must be [0 - 1] \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
@@ -2484,57 +3384,155 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->picture_timing_sei > 1) {
-        SVT_LOG("Error instance %u : Invalid PictureTiming. PictureTiming must be [0 - 1]\n", channelNumber + 1);
+    if (config->picture_timing_sei > 1) {
+        SVT_LOG("Error instance %u : Invalid PictureTiming. PictureTiming must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->registered_user_data_sei_flag > 1) {
+        SVT_LOG("Error instance %u : Invalid RegisteredUserData. RegisteredUserData must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->unregistered_user_data_sei_flag > 1) {
+        SVT_LOG("Error instance %u : Invalid UnregisteredUserData. UnregisteredUserData must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->recovery_point_sei_flag > 1) {
+        SVT_LOG("Error instance %u : Invalid RecoveryPoint. RecoveryPoint must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->enable_temporal_id > 1) {
+        SVT_LOG("Error instance %u : Invalid TemporalId. TemporalId must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if ((config->encoder_bit_depth != 8) &&
+        (config->encoder_bit_depth != 10)
+        ) {
+        SVT_LOG("Error instance %u: Encoder Bit Depth shall be only 8 or 10 \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    // Check if the EncoderBitDepth is conformant with the Profile constraint
+    if (config->profile == 1 && config->encoder_bit_depth == 10) {
+        SVT_LOG("Error instance %u: The encoder bit depth shall be equal to 8 for Main Profile\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->compressed_ten_bit_format !=0)
+    {
+        SVT_LOG("Error instance %u: Compressed ten bit format is not supported in this version \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->semi_planar_input > 1) {
+        SVT_LOG("Error Instance %u: Invalid semi planar input flag [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->input_sample_shift > 6) {
+        SVT_LOG("Error Instance %u: Invalid input sample shift [0 - 6]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->input_copy_threads > EB_MaxInputCopyThreads) {
+        SVT_LOG("Error Instance %u: Invalid input copy threads [0 - %u]\n", channelNumber + 1, EB_MaxInputCopyThreads);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->input_sample_shift && config->encoder_bit_depth == 8) {
+        SVT_LOG("Error Instance %u: Input sample shift is only supported for 10 bit input\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->speed_control_flag > 1) {
+        SVT_LOG("Error Instance %u: Invalid Speed Control flag [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->task_scheduler > 1) {
+        SVT_LOG("Error Instance %u: Invalid task scheduler flag [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->elastic_pools > 1) {
+        SVT_LOG("Error Instance %u: Invalid elastic pools flag [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->zero_copy_input > 1) {
+        SVT_LOG("Error Instance %u: Invalid zero copy input flag [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->zero_copy_input && config->encoder_bit_depth > 8) {
+        SVT_LOG("Error Instance %u: Zero copy input is only supported for 8 bit input\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->zero_copy_input && config->semi_planar_input) {
+        SVT_LOG("Error Instance %u: Zero copy input is not supported for semi planar input\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->registered_user_data_sei_flag > 1) {
-        SVT_LOG("Error instance %u : Invalid RegisteredUserData. RegisteredUserData must be [0 - 1]\n", channelNumber + 1);
+    if (config->zero_copy_input && config->input_release_callback == NULL) {
+        SVT_LOG("Error Instance %u: Zero copy input requires an input release callback\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->unregistered_user_data_sei_flag > 1) {
-        SVT_LOG("Error instance %u : Invalid UnregisteredUserData. UnregisteredUserData must be [0 - 1]\n", channelNumber + 1);
+    if (config->packet_ring_size && config->packet_ring_size < EB_MinPacketRingSize) {
+        SVT_LOG("Error Instance %u: Invalid packet ring size, 0 or at least %u bytes\n", channelNumber + 1, EB_MinPacketRingSize);
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->recovery_point_sei_flag > 1) {
-        SVT_LOG("Error instance %u : Invalid RecoveryPoint. RecoveryPoint must be [0 - 1]\n", channelNumber + 1);
+    if (config->packet_callback && config->recon_enabled && config->recon_callback == NULL) {
+        SVT_LOG("Error Instance %u: The output callbacks require a recon callback with recon enabled\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->enable_temporal_id > 1) {
-        SVT_LOG("Error instance %u : Invalid TemporalId. TemporalId must be [0 - 1]\n", channelNumber + 1);
+    if (config->recon_buffer_count > EB_MaxReconBufferCount) {
+        SVT_LOG("Error Instance %u: Invalid recon buffer count [0 - %u]\n", channelNumber + 1, EB_MaxReconBufferCount);
         return_error = EB_ErrorBadParameter;
     }
 
-    if ((config->encoder_bit_depth != 8) &&
-        (config->encoder_bit_depth != 10)
-        ) {
-        SVT_LOG("Error instance %u: Encoder Bit Depth shall be only 8 or 10 \n", channelNumber + 1);
+    if (config->target_socket != -1 && config->target_socket != 0 && config->target_socket != 1) {
+        SVT_LOG("Error Instance %u: Invalid target socket [-1 - 1]\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
-    // Check if the EncoderBitDepth is conformant with the Profile constraint
-    if (config->profile == 1 && config->encoder_bit_depth == 10) {
-        SVT_LOG("Error instance %u: The encoder bit depth shall be equal to 8 for Main Profile\n", channelNumber + 1);
-        return_error = EB_ErrorBadParameter;
+
+#ifdef __linux__
+    if (config->processor_list) {
+        cpu_set_t processorSet;
+        if (ParseProcessorList(config->processor_list, &processorSet) == EB_FALSE) {
+            SVT_LOG("Error Instance %u: Invalid processor list %s\n", channelNumber + 1, config->processor_list);
+            return_error = EB_ErrorBadParameter;
+        }
     }
+#endif
 
-    if (config->compressed_ten_bit_format !=0)
-    {
-        SVT_LOG("Error instance %u: Compressed ten bit format is not supported in this version \n", channelNumber + 1);
+    if (config->picture_analysis_threads > 1024 || config->motion_estimation_threads > 1024 ||
+        config->source_based_operations_threads > 1024 || config->mode_decision_configuration_threads > 1024 ||
+        config->enc_dec_threads > 1024 || config->dlf_threads > 1024 || config->cdef_threads > 1024 ||
+        config->rest_threads > 1024 || config->entropy_coding_threads > 1024) {
+        SVT_LOG("Error Instance %u: Invalid process thread count [0 - 1024]\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->speed_control_flag > 1) {
-        SVT_LOG("Error Instance %u: Invalid Speed Control flag [0 - 1]\n", channelNumber + 1);
+#if !LOCK_FREE_FIFO
+    if (config->task_scheduler) {
+        SVT_LOG("Error Instance %u: The task scheduler requires a build with LOCK_FREE_FIFO\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->elastic_pools) {
+        SVT_LOG("Error Instance %u: Elastic pools require a build with LOCK_FREE_FIFO\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
+#endif
 
-    if (((int32_t)(config->asm_type) < -1) || ((int32_t)(config->asm_type) != 1)) {
-       // SVT_LOG("Error Instance %u: Invalid asm type value [0: C Only, 1: Auto] .\n", channelNumber + 1);
-        SVT_LOG("Error Instance %u: Asm 0 is not supported in this build .\n", channelNumber + 1);
+    if (config->asm_type > 1) {
+        SVT_LOG("Error Instance %u: Invalid asm type value [0: Up to SSE4_2, 1: Auto] .\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
@@ -2560,6 +3558,9 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->encoder_bit_depth = 8;
     config_ptr->ten_bit_format = 0;
     config_ptr->compressed_ten_bit_format = 0;
+    config_ptr->semi_planar_input = EB_FALSE;
+    config_ptr->input_sample_shift = 0;
+    config_ptr->input_copy_threads = 0;
     config_ptr->source_width = 0;
     config_ptr->source_height = 0;
     config_ptr->framesToBeEncoded = 0; 
@@ -2608,6 +3609,8 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->hme_level2_search_area_in_height_array[1] = 1;
     config_ptr->constrained_intra = EB_FALSE;
     config_ptr->improve_sharpness = EB_FALSE;
+    config_ptr->tile_columns = 0;
+    config_ptr->tile_rows = 0;
 
     // Bitstream options
     //config_ptr->codeVpsSpsPps = 0;
@@ -2645,13 +3648,35 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->asm_type = 1;
 
     // Channel info
-    //config_ptr->logicalProcessors = 0;
-    //config_ptr->target_socket = -1;
+    config_ptr->task_scheduler = EB_FALSE;
+    config_ptr->memory_budget = 0;
+    config_ptr->elastic_pools = EB_FALSE;
+    config_ptr->zero_copy_input = EB_FALSE;
+    config_ptr->input_release_callback = NULL;
+    config_ptr->input_release_context = NULL;
+    config_ptr->packet_ring_size = 0;
+    config_ptr->packet_callback = NULL;
+    config_ptr->recon_callback = NULL;
+    config_ptr->output_callback_context = NULL;
+    config_ptr->logical_processors = 0;
+    config_ptr->target_socket = -1;
+    config_ptr->processor_list = NULL;
+    config_ptr->picture_analysis_threads = 0;
+    config_ptr->motion_estimation_threads = 0;
+    config_ptr->source_based_operations_threads = 0;
+    config_ptr->mode_decision_configuration_threads = 0;
+    config_ptr->enc_dec_threads = 0;
+    config_ptr->dlf_threads = 0;
+    config_ptr->cdef_threads = 0;
+    config_ptr->rest_threads = 0;
+    config_ptr->entropy_coding_threads = 0;
     config_ptr->channel_id = 0;
     config_ptr->active_channel_count = 1;
 
     // Debug info
     config_ptr->recon_enabled = 0;
+    config_ptr->recon_buffer_count = 0;
+    config_ptr->trace_file = NULL;
 
     return return_error;
 }
@@ -2694,6 +3719,46 @@ static void PrintLibParams(
         SVT_LOG("\nSVT [config]: RCMode / TargetBitrate / LookaheadDistance / SceneChange\t\t: VBR / %d / %d / %d ", config->target_bit_rate, config->look_ahead_distance, config->scene_change_detection);
     else
         SVT_LOG("\nSVT [config]: BRC Mode / QP  / LookaheadDistance / SceneChange\t\t\t: CQP / %d / %d / %d ", scs->qp, config->look_ahead_distance, config->scene_change_detection);
+    SVT_LOG("\nSVT [config]: LogicalProcessors / TargetSocket / Threads \t\t\t\t: %d / %d / %d ",
+        scs->scheduler_worker_count,
+        config->target_socket,
+        config->task_scheduler ? scs->scheduler_worker_count : scs->total_process_init_count);
+    if (config->task_scheduler)
+        SVT_LOG("\nSVT [config]: TaskScheduler / Workers \t\t\t\t\t\t: %d / %d ", config->task_scheduler, scs->scheduler_worker_count);
+    if (config->memory_budget || config->elastic_pools)
+        SVT_LOG("\nSVT [config]: MemoryBudget / ElasticPools \t\t\t\t\t\t: %d / %d ", config->memory_budget, config->elastic_pools);
+    if (config->semi_planar_input || config->input_sample_shift)
+        SVT_LOG("\nSVT [config]: SemiPlanarInput / InputSampleShift \t\t\t\t\t: %d / %u ", config->semi_planar_input, config->input_sample_shift);
+    if (config->input_copy_threads > 1)
+        SVT_LOG("\nSVT [config]: InputCopyThreads \t\t\t\t\t\t\t: %u ", config->input_copy_threads);
+    if (config->zero_copy_input)
+        SVT_LOG("\nSVT [config]: ZeroCopyInput \t\t\t\t\t\t\t: %d ", config->zero_copy_input);
+    if (config->packet_ring_size)
+        SVT_LOG("\nSVT [config]: PacketRingSize \t\t\t\t\t\t\t: %u ", config->packet_ring_size);
+    if (config->packet_callback)
+        SVT_LOG("\nSVT [config]: OutputCallbacks \t\t\t\t\t\t\t: 1 ");
+#if FILT_PROC
+    SVT_LOG("\nSVT [config]: PA / ME / SBO / MDC / ED / DLF / CDEF / REST / EC Threads \t\t: %d / %d / %d / %d / %d / %d / %d / %d / %d ",
+#else
+    SVT_LOG("\nSVT [config]: PA / ME / SBO / MDC / ED / EC Threads \t\t\t\t: %d / %d / %d / %d / %d / %d ",
+#endif
+        scs->picture_analysis_process_init_count,
+        scs->motion_estimation_process_init_count,
+        scs->source_based_operations_process_init_count,
+        scs->mode_decision_configuration_process_init_count,
+        scs->enc_dec_process_init_count,
+#if FILT_PROC
+        scs->dlf_process_init_count,
+        scs->cdef_process_init_count,
+        scs->rest_process_init_count,
+#endif
+        scs->entropy_coding_process_init_count);
+    SVT_LOG("\nSVT [config]: ME_SEG W x H / ED_SEG W x H / CPCS \t\t\t\t: %d x %d / %d x %d / %d ",
+        scs->me_segment_column_count_array[0],
+        scs->me_segment_row_count_array[0],
+        scs->enc_dec_segment_col_count_array[0],
+        scs->enc_dec_segment_row_count_array[0],
+        scs->picture_control_set_pool_init_count_child);
 #ifdef DEBUG_BUFFERS
     SVT_LOG("\nSVT [config]: INPUT / OUTPUT \t\t\t\t\t\t\t: %d / %d", scs->input_buffer_fifo_init_count, scs->output_stream_buffer_fifo_init_count);
     SVT_LOG("\nSVT [config]: CPCS / PAREF / REF \t\t\t\t\t\t: %d / %d / %d", scs->picture_control_set_pool_init_count_child, scs->pa_reference_picture_buffer_init_count, scs->reference_picture_buffer_init_count);
@@ -2745,6 +3810,8 @@ EB_API EbErrorType eb_svt_enc_set_parameter(
     EbEncHandle_t        *pEncCompData  = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
     uint32_t              instanceIndex = 0;
 
+    EbSetMemoryContext(&pEncCompData->memoryContext);
+
     // Acquire Config Mutex
     EbBlockOnMutex(pEncCompData->sequenceControlSetInstanceArray[instanceIndex]->config_mutex);
 
@@ -2820,63 +3887,225 @@ EB_API EbErrorType eb_svt_enc_eos_nal(
 }
 
 /***********************************************
-**** Copy the input buffer from the
-**** sample application to the library buffers
+**** Copy the rows lumaRowStart to lumaRowEnd
+**** (even) of an 8 bit or 16 bit input picture
 ************************************************/
-static EbErrorType CopyFrameBuffer(
+static void CopyFrameBufferRows(
     SequenceControlSet_t            *sequence_control_set_ptr,
-    uint8_t                          *dst,
-    uint8_t                          *src)
+    EbPictureBufferDesc_t           *inputPicturePtr,
+    EbSvtEncInput                   *inputPtr,
+    uint32_t                         lumaRowStart,
+    uint32_t                         lumaRowEnd)
 {
     EbSvtAv1EncConfiguration          *config = &sequence_control_set_ptr->static_config;
-    EbErrorType                      return_error = EB_ErrorNone;
-
-    EbPictureBufferDesc_t           *inputPicturePtr = (EbPictureBufferDesc_t*)dst;
-    EbSvtEncInput               *inputPtr = (EbSvtEncInput*)src;
-    uint16_t                         inputRowIndex;
+    uint32_t                         inputRowIndex;
     EbBool                           is16BitInput = (EbBool)(config->encoder_bit_depth > EB_8BIT);
-
-    // Need to include for Interlacing on the fly with pictureScanType = 1
+    EbAsm                            asm_type = sequence_control_set_ptr->encode_context_ptr->asm_type;
+    uint32_t                         chromaRowStart = lumaRowStart >> 1;
+    uint16_t                         lumaHeight = (uint16_t)(lumaRowEnd - lumaRowStart);
 
     if (!is16BitInput) {
 
-        uint32_t     lumaBufferOffset = (inputPicturePtr->strideY*sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding) << is16BitInput;
-        uint32_t     chromaBufferOffset = (inputPicturePtr->strideCr*(sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1)) << is16BitInput;
-        uint16_t     lumaStride = inputPicturePtr->strideY << is16BitInput;
-        uint16_t     chromaStride = inputPicturePtr->strideCb << is16BitInput;
-        uint16_t     lumaWidth = (uint16_t)(inputPicturePtr->width - sequence_control_set_ptr->max_input_pad_right) << is16BitInput;
-        uint16_t     chromaWidth = (lumaWidth >> 1) << is16BitInput;
-        uint16_t     lumaHeight = (uint16_t)(inputPicturePtr->height - sequence_control_set_ptr->max_input_pad_bottom);
+        uint32_t     lumaBufferOffset = inputPicturePtr->strideY*(sequence_control_set_ptr->top_padding + lumaRowStart) + sequence_control_set_ptr->left_padding;
+        uint32_t     chromaBufferOffset = inputPicturePtr->strideCr*((sequence_control_set_ptr->top_padding >> 1) + chromaRowStart) + (sequence_control_set_ptr->left_padding >> 1);
+        uint16_t     lumaStride = inputPicturePtr->strideY;
+        uint16_t     chromaStride = inputPicturePtr->strideCb;
+        uint16_t     lumaWidth = (uint16_t)(inputPicturePtr->width - sequence_control_set_ptr->max_input_pad_right);
+        uint16_t     chromaWidth = (lumaWidth >> 1);
 
-        uint16_t     sourceLumaStride = (uint16_t)(inputPtr->yStride);
-        uint16_t     sourceCrStride = (uint16_t)(inputPtr->crStride);
-        uint16_t     sourceCbStride = (uint16_t)(inputPtr->cbStride);
+        uint32_t     sourceLumaStride = inputPtr->yStride;
+        uint32_t     sourceCrStride = inputPtr->crStride;
+        uint32_t     sourceCbStride = inputPtr->cbStride;
 
-        //uint16_t     lumaHeight  = inputPicturePtr->maxHeight;
         // Y
         for (inputRowIndex = 0; inputRowIndex < lumaHeight; inputRowIndex++) {
 
             EB_MEMCPY((inputPicturePtr->bufferY + lumaBufferOffset + lumaStride * inputRowIndex),
-                (inputPtr->luma + sourceLumaStride * inputRowIndex),
+                (inputPtr->luma + sourceLumaStride * (lumaRowStart + inputRowIndex)),
                 lumaWidth);
         }
 
-        // U
-        for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
-            EB_MEMCPY((inputPicturePtr->bufferCb + chromaBufferOffset + chromaStride * inputRowIndex),
-                (inputPtr->cb + (sourceCbStride*inputRowIndex)),
-                chromaWidth);
+        if (config->semi_planar_input) {
+            // U V
+            Deinterleave2D(
+                inputPtr->cb + sourceCbStride * chromaRowStart,
+                sourceCbStride,
+                inputPicturePtr->bufferCb + chromaBufferOffset,
+                inputPicturePtr->bufferCr + chromaBufferOffset,
+                chromaStride,
+                chromaWidth,
+                lumaHeight >> 1,
+                asm_type);
+        }
+        else {
+            // U
+            for (inputRowIndex = 0; inputRowIndex < (uint32_t)(lumaHeight >> 1); inputRowIndex++) {
+                EB_MEMCPY((inputPicturePtr->bufferCb + chromaBufferOffset + chromaStride * inputRowIndex),
+                    (inputPtr->cb + sourceCbStride * (chromaRowStart + inputRowIndex)),
+                    chromaWidth);
+            }
+
+            // V
+            for (inputRowIndex = 0; inputRowIndex < (uint32_t)(lumaHeight >> 1); inputRowIndex++) {
+                EB_MEMCPY((inputPicturePtr->bufferCr + chromaBufferOffset + chromaStride * inputRowIndex),
+                    (inputPtr->cr + sourceCrStride * (chromaRowStart + inputRowIndex)),
+                    chromaWidth);
+            }
         }
 
-        // V
-        for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
-            EB_MEMCPY((inputPicturePtr->bufferCr + chromaBufferOffset + chromaStride * inputRowIndex),
-                (inputPtr->cr + (sourceCrStride*inputRowIndex)),
-                chromaWidth);
+    }
+    else { // 10bit packed
+
+        uint32_t lumaBufferOffset = inputPicturePtr->strideY*(sequence_control_set_ptr->top_padding + lumaRowStart) + sequence_control_set_ptr->left_padding;
+        uint32_t chromaBufferOffset = inputPicturePtr->strideCr*((sequence_control_set_ptr->top_padding >> 1) + chromaRowStart) + (sequence_control_set_ptr->left_padding >> 1);
+        uint16_t lumaWidth = (uint16_t)(inputPicturePtr->width - sequence_control_set_ptr->max_input_pad_right);
+        uint16_t chromaWidth = (lumaWidth >> 1);
+
+        uint16_t sourceLumaStride = (uint16_t)(inputPtr->yStride);
+        uint16_t sourceCrStride = (uint16_t)(inputPtr->crStride);
+        uint16_t sourceCbStride = (uint16_t)(inputPtr->cbStride);
+        uint16_t *sourceLuma = (uint16_t*)inputPtr->luma + sourceLumaStride * lumaRowStart;
+        uint16_t *sourceCb = (uint16_t*)inputPtr->cb + sourceCbStride * chromaRowStart;
+        uint32_t shift = config->input_sample_shift;
+
+        if (shift)
+            UnPackShift2D(
+                sourceLuma,
+                sourceLumaStride,
+                inputPicturePtr->bufferY + lumaBufferOffset,
+                inputPicturePtr->strideY,
+                inputPicturePtr->bufferBitIncY + lumaBufferOffset,
+                inputPicturePtr->strideBitIncY,
+                shift,
+                lumaWidth,
+                lumaHeight,
+                asm_type);
+        else
+            UnPack2D(
+                sourceLuma,
+                sourceLumaStride,
+                inputPicturePtr->bufferY + lumaBufferOffset,
+                inputPicturePtr->strideY,
+                inputPicturePtr->bufferBitIncY + lumaBufferOffset,
+                inputPicturePtr->strideBitIncY,
+                lumaWidth,
+                lumaHeight,
+                asm_type);
+
+        if (config->semi_planar_input) {
+            UnPackDeinterleave2D(
+                sourceCb,
+                sourceCbStride,
+                inputPicturePtr->bufferCb + chromaBufferOffset,
+                inputPicturePtr->bufferCr + chromaBufferOffset,
+                inputPicturePtr->strideCb,
+                inputPicturePtr->bufferBitIncCb + chromaBufferOffset,
+                inputPicturePtr->bufferBitIncCr + chromaBufferOffset,
+                inputPicturePtr->strideBitIncCb,
+                shift,
+                chromaWidth,
+                (lumaHeight >> 1),
+                asm_type);
+        }
+        else {
+            uint16_t *sourceCr = (uint16_t*)inputPtr->cr + sourceCrStride * chromaRowStart;
+
+            if (shift) {
+                UnPackShift2D(
+                    sourceCb,
+                    sourceCbStride,
+                    inputPicturePtr->bufferCb + chromaBufferOffset,
+                    inputPicturePtr->strideCb,
+                    inputPicturePtr->bufferBitIncCb + chromaBufferOffset,
+                    inputPicturePtr->strideBitIncCb,
+                    shift,
+                    chromaWidth,
+                    (lumaHeight >> 1),
+                    asm_type);
+
+                UnPackShift2D(
+                    sourceCr,
+                    sourceCrStride,
+                    inputPicturePtr->bufferCr + chromaBufferOffset,
+                    inputPicturePtr->strideCr,
+                    inputPicturePtr->bufferBitIncCr + chromaBufferOffset,
+                    inputPicturePtr->strideBitIncCr,
+                    shift,
+                    chromaWidth,
+                    (lumaHeight >> 1),
+                    asm_type);
+            }
+            else {
+                UnPack2D(
+                    sourceCb,
+                    sourceCbStride,
+                    inputPicturePtr->bufferCb + chromaBufferOffset,
+                    inputPicturePtr->strideCb,
+                    inputPicturePtr->bufferBitIncCb + chromaBufferOffset,
+                    inputPicturePtr->strideBitIncCb,
+                    chromaWidth,
+                    (lumaHeight >> 1),
+                    asm_type);
+
+                UnPack2D(
+                    sourceCr,
+                    sourceCrStride,
+                    inputPicturePtr->bufferCr + chromaBufferOffset,
+                    inputPicturePtr->strideCr,
+                    inputPicturePtr->bufferBitIncCr + chromaBufferOffset,
+                    inputPicturePtr->strideBitIncCr,
+                    chromaWidth,
+                    (lumaHeight >> 1),
+                    asm_type);
+            }
         }
+    }
+}
+
+/***********************************************
+**** Input copy thread, copies its band of the
+**** pictures split by CopyFrameBuffer
+************************************************/
+static void* InputCopyKernel(void *input_ptr)
+{
+    EbInputCopyBand_t *bandPtr = (EbInputCopyBand_t*)input_ptr;
+
+    for (;;) {
+        EbBlockOnSemaphore(bandPtr->startSemaphore);
 
+        CopyFrameBufferRows(
+            bandPtr->sequence_control_set_ptr,
+            bandPtr->inputPicturePtr,
+            bandPtr->inputPtr,
+            bandPtr->lumaRowStart,
+            bandPtr->lumaRowEnd);
+
+        EbPostSemaphore(bandPtr->doneSemaphore);
     }
-    else if (is16BitInput && config->compressed_ten_bit_format == 1)
+    return EB_NULL;
+}
+
+/***********************************************
+**** Copy the input buffer from the
+**** sample application to the library buffers
+************************************************/
+static EbErrorType CopyFrameBuffer(
+    EbEncHandle_t                   *encHandlePtr,
+    SequenceControlSet_t            *sequence_control_set_ptr,
+    uint8_t                          *dst,
+    uint8_t                          *src)
+{
+    EbSvtAv1EncConfiguration          *config = &sequence_control_set_ptr->static_config;
+    EbErrorType                      return_error = EB_ErrorNone;
+
+    EbPictureBufferDesc_t           *inputPicturePtr = (EbPictureBufferDesc_t*)dst;
+    EbSvtEncInput               *inputPtr = (EbSvtEncInput*)src;
+    uint16_t                         inputRowIndex;
+    EbBool                           is16BitInput = (EbBool)(config->encoder_bit_depth > EB_8BIT);
+
+    // Need to include for Interlacing on the fly with pictureScanType = 1
+
+    if (is16BitInput && config->compressed_ten_bit_format == 1)
     {
         {
             uint32_t  lumaBufferOffset = (inputPicturePtr->strideY*sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding);
@@ -2938,55 +4167,118 @@ static EbErrorType CopyFrameBuffer(
         }
 
     }
-    else { // 10bit packed 
+    else {
+        uint32_t lumaHeight = inputPicturePtr->height - sequence_control_set_ptr->max_input_pad_bottom;
+        uint32_t bandCount = MIN(encHandlePtr->inputCopyBandCount, lumaHeight / EB_InputCopyMinBandHeight);
+        uint32_t bandHeight;
+        uint32_t bandIndex;
+
+        if (bandCount <= 1) {
+            CopyFrameBufferRows(sequence_control_set_ptr, inputPicturePtr, inputPtr, 0, lumaHeight);
+            return return_error;
+        }
 
-        uint32_t lumaOffset = 0, chromaOffset = 0;
-        uint32_t lumaBufferOffset = (inputPicturePtr->strideY*sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding);
-        uint32_t chromaBufferOffset = (inputPicturePtr->strideCr*(sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1));
-        uint16_t lumaWidth = (uint16_t)(inputPicturePtr->width - sequence_control_set_ptr->max_input_pad_right);
-        uint16_t chromaWidth = (lumaWidth >> 1);
-        uint16_t lumaHeight = (uint16_t)(inputPicturePtr->height - sequence_control_set_ptr->max_input_pad_bottom);
+        // Even heights keep the chroma rows of a band together
+        bandHeight = ((lumaHeight + bandCount - 1) / bandCount + 1) & ~1;
 
-        uint16_t sourceLumaStride = (uint16_t)(inputPtr->yStride);
-        uint16_t sourceCrStride = (uint16_t)(inputPtr->crStride);
-        uint16_t sourceCbStride = (uint16_t)(inputPtr->cbStride);
+        EbBlockOnMutex(encHandlePtr->inputCopyMutex);
+
+        for (bandIndex = 1; bandIndex < bandCount; ++bandIndex) {
+            EbInputCopyBand_t *bandPtr = &encHandlePtr->inputCopyBandArray[bandIndex];
+
+            bandPtr->sequence_control_set_ptr = sequence_control_set_ptr;
+            bandPtr->inputPicturePtr = inputPicturePtr;
+            bandPtr->inputPtr = inputPtr;
+            bandPtr->lumaRowStart = MIN(bandIndex * bandHeight, lumaHeight);
+            bandPtr->lumaRowEnd = MIN(bandPtr->lumaRowStart + bandHeight, lumaHeight);
+            EbPostSemaphore(bandPtr->startSemaphore);
+        }
 
-        UnPack2D(
-            (uint16_t*)(inputPtr->luma + lumaOffset),
-            sourceLumaStride,
-            inputPicturePtr->bufferY + lumaBufferOffset,
-            inputPicturePtr->strideY,
-            inputPicturePtr->bufferBitIncY + lumaBufferOffset,
-            inputPicturePtr->strideBitIncY,
-            lumaWidth,
-            lumaHeight,
-            config->asm_type);
-
-        UnPack2D(
-            (uint16_t*)(inputPtr->cb + chromaOffset),
-            sourceCbStride,
-            inputPicturePtr->bufferCb + chromaBufferOffset,
-            inputPicturePtr->strideCb,
-            inputPicturePtr->bufferBitIncCb + chromaBufferOffset,
-            inputPicturePtr->strideBitIncCb,
-            chromaWidth,
-            (lumaHeight >> 1),
-            config->asm_type);
-
-        UnPack2D(
-            (uint16_t*)(inputPtr->cr + chromaOffset),
-            sourceCrStride,
-            inputPicturePtr->bufferCr + chromaBufferOffset,
-            inputPicturePtr->strideCr,
-            inputPicturePtr->bufferBitIncCr + chromaBufferOffset,
-            inputPicturePtr->strideBitIncCr,
-            chromaWidth,
-            (lumaHeight >> 1),
-            config->asm_type);
+        CopyFrameBufferRows(sequence_control_set_ptr, inputPicturePtr, inputPtr, 0, bandHeight);
+
+        for (bandIndex = 1; bandIndex < bandCount; ++bandIndex)
+            EbBlockOnSemaphore(encHandlePtr->inputCopyDoneSemaphore);
+
+        EbReleaseMutex(encHandlePtr->inputCopyMutex);
     }
     return return_error;
 }
+
+/***********************************************
+**** Layout of the input planes, the one of
+**** the library buffers
+************************************************/
+static void GetInputLayout(
+    SequenceControlSet_t            *sequence_control_set_ptr,
+    EbSvtInputLayout                *layout)
+{
+    layout->width = sequence_control_set_ptr->max_input_luma_width;
+    layout->height = sequence_control_set_ptr->max_input_luma_height;
+    layout->left_padding = sequence_control_set_ptr->left_padding;
+    layout->right_padding = sequence_control_set_ptr->right_padding;
+    layout->top_padding = sequence_control_set_ptr->top_padding;
+    layout->bot_padding = sequence_control_set_ptr->bot_padding;
+    layout->y_stride = layout->width + layout->left_padding + layout->right_padding;
+    layout->cb_stride = layout->y_stride >> 1;
+    layout->cr_stride = layout->y_stride >> 1;
+    layout->alignment = ALVALUE;
+}
+
+/***********************************************
+**** Check the planes of the application
+**** follow the layout (zero copy input)
+************************************************/
+static EbErrorType CheckInputLayout(
+    SequenceControlSet_t            *sequence_control_set_ptr,
+    EbSvtEncInput                   *inputPtr)
+{
+    EbSvtInputLayout                 layout;
+    uint32_t                         lumaBufferOffset;
+    uint32_t                         chromaBufferOffset;
+
+    GetInputLayout(sequence_control_set_ptr, &layout);
+    lumaBufferOffset = layout.y_stride * layout.top_padding + layout.left_padding;
+    chromaBufferOffset = layout.cb_stride * (layout.top_padding >> 1) + (layout.left_padding >> 1);
+
+    if (inputPtr->luma == NULL || inputPtr->cb == NULL || inputPtr->cr == NULL ||
+        inputPtr->yStride != layout.y_stride || inputPtr->cbStride != layout.cb_stride || inputPtr->crStride != layout.cr_stride)
+        return EB_ErrorBadParameter;
+
+    if (((size_t)(inputPtr->luma - lumaBufferOffset) | (size_t)(inputPtr->cb - chromaBufferOffset) | (size_t)(inputPtr->cr - chromaBufferOffset)) & (layout.alignment - 1))
+        return EB_ErrorBadParameter;
+
+    return EB_ErrorNone;
+}
+
+/***********************************************
+**** Point the library buffers to the planes
+**** of the application (zero copy input)
+************************************************/
+static void ReferenceFrameBuffer(
+    SequenceControlSet_t            *sequence_control_set_ptr,
+    uint8_t                          *dst,
+    uint8_t                          *src)
+{
+    EbPictureBufferDesc_t           *inputPicturePtr = (EbPictureBufferDesc_t*)dst;
+    EbSvtEncInput                   *inputPtr = (EbSvtEncInput*)src;
+    uint32_t                         lumaBufferOffset = inputPicturePtr->strideY*sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding;
+    uint32_t                         chromaBufferOffset = inputPicturePtr->strideCr*(sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1);
+
+    // End of sequence without picture
+    if (inputPtr == NULL) {
+        inputPicturePtr->bufferY = (EbByte)EB_NULL;
+        inputPicturePtr->bufferCb = (EbByte)EB_NULL;
+        inputPicturePtr->bufferCr = (EbByte)EB_NULL;
+        return;
+    }
+
+    inputPicturePtr->bufferY = inputPtr->luma - lumaBufferOffset;
+    inputPicturePtr->bufferCb = inputPtr->cb - chromaBufferOffset;
+    inputPicturePtr->bufferCr = inputPtr->cr - chromaBufferOffset;
+}
+
 static void CopyInputBuffer(
+    EbEncHandle_t*          encHandlePtr,
     SequenceControlSet_t*    sequenceControlSet,
     EbBufferHeaderType*     dst,
     EbBufferHeaderType*     src
@@ -3003,8 +4295,39 @@ static void CopyInputBuffer(
     dst->pic_type = src->pic_type;
 
     // Copy the picture buffer
-    if (src->p_buffer != NULL)
-        CopyFrameBuffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
+    if (sequenceControlSet->static_config.zero_copy_input) {
+        dst->p_app_private = src->p_app_private;
+        ReferenceFrameBuffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
+    }
+    else if (src->p_buffer != NULL)
+        CopyFrameBuffer(encHandlePtr, sequenceControlSet, dst->p_buffer, src->p_buffer);
+}
+
+/**********************************
+* eb_svt_enc_get_input_layout
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_get_input_layout(
+    EbComponentType      *svt_enc_component,
+    EbSvtInputLayout     *layout)
+{
+    EbEncHandle_t *encHandlePtr;
+
+    if (svt_enc_component == NULL || layout == NULL)
+        return EB_ErrorBadParameter;
+
+    encHandlePtr = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
+    if (encHandlePtr->pictureParentControlSetPoolPtrArray == (EbSystemResource_t**)EB_NULL)
+        return EB_ErrorBadParameter;
+
+    GetInputLayout(encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr, layout);
+
+    // The application planes are held as long as the picture control set
+    layout->max_pictures = encHandlePtr->pictureParentControlSetPoolPtrArray[0]->objectMaxCount;
+
+    return EB_ErrorNone;
 }
 
 /**********************************
@@ -3018,8 +4341,16 @@ EB_API EbErrorType eb_svt_enc_send_picture(
     EbBufferHeaderType   *p_buffer)
 {
     EbEncHandle_t          *encHandlePtr = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
+    SequenceControlSet_t   *sequence_control_set_ptr = encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
     EbObjectWrapper_t      *ebWrapperPtr;
 
+    // Referenced planes are checked before the buffer is queued
+    if (sequence_control_set_ptr->static_config.zero_copy_input && p_buffer != NULL && p_buffer->p_buffer != NULL &&
+        CheckInputLayout(sequence_control_set_ptr, (EbSvtEncInput*)p_buffer->p_buffer) != EB_ErrorNone) {
+        SVT_LOG("SVT [Warning]: Input picture planes do not follow the zero copy input layout\n");
+        return EB_ErrorBadParameter;
+    }
+
     // Take the buffer and put it into our internal queue structure
     EbGetEmptyObject(
         encHandlePtr->input_buffer_producer_fifo_ptr_array[0],
@@ -3027,7 +4358,8 @@ EB_API EbErrorType eb_svt_enc_send_picture(
 
     if (p_buffer != NULL) {
         CopyInputBuffer(
-            encHandlePtr->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr,
+            encHandlePtr,
+            sequence_control_set_ptr,
             (EbBufferHeaderType*)ebWrapperPtr->objectPtr,
             p_buffer);
     }
@@ -3072,6 +4404,11 @@ EB_API EbErrorType eb_svt_get_packet(
     EbEncHandle_t          *pEncCompData = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
     EbObjectWrapper_t      *ebWrapperPtr = NULL;
     EbBufferHeaderType    *packet;
+
+    // The packets go to packet_callback
+    if (pEncCompData->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.packet_callback)
+        return EB_NoErrorEmptyQueue;
+
     if (pic_send_done)
         EbGetFullObject(
         (pEncCompData->output_stream_buffer_consumer_fifo_ptr_dbl_array[0])[0],
@@ -3131,7 +4468,11 @@ EB_API EbErrorType eb_svt_get_recon(
     EbEncHandle_t          *pEncCompData = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
     EbObjectWrapper_t      *ebWrapperPtr = NULL;
 
-    if (pEncCompData->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.recon_enabled) {
+    if (pEncCompData->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.packet_callback) {
+        // The recon pictures go to recon_callback
+        return_error = EB_NoErrorEmptyQueue;
+    }
+    else if (pEncCompData->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr->static_config.recon_enabled) {
 
         EbGetFullObjectNonBlocking(
             (pEncCompData->output_recon_buffer_consumer_fifo_ptr_dbl_array[0])[0],
@@ -3160,6 +4501,169 @@ EB_API EbErrorType eb_svt_get_recon(
     return return_error;
 }
 
+/**********************************
+* eb_svt_borrow_recon hands out the recon picture in place
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_borrow_recon(
+    EbComponentType      *svt_enc_component,
+    EbBufferHeaderType  **p_buffer,
+    EbSvtReconPlanes     *planes)
+{
+    EbErrorType             return_error = EB_ErrorNone;
+    EbEncHandle_t          *pEncCompData = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
+    SequenceControlSet_t   *sequence_control_set_ptr = pEncCompData->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
+    EbObjectWrapper_t      *ebWrapperPtr = NULL;
+    EbBufferHeaderType     *reconPtr;
+
+    if (sequence_control_set_ptr->static_config.packet_callback)
+        // The recon pictures go to recon_callback
+        return EB_NoErrorEmptyQueue;
+
+    if (!sequence_control_set_ptr->static_config.recon_enabled)
+        // recon is not enabled
+        return EB_ErrorMax;
+
+    EbGetFullObjectNonBlocking(
+        (pEncCompData->output_recon_buffer_consumer_fifo_ptr_dbl_array[0])[0],
+        &ebWrapperPtr);
+
+    if (ebWrapperPtr == NULL)
+        return EB_NoErrorEmptyQueue;
+
+    reconPtr = (EbBufferHeaderType*)ebWrapperPtr->objectPtr;
+    if (reconPtr->flags != EB_BUFFERFLAG_EOS && reconPtr->flags != 0)
+        return_error = EB_ErrorMax;
+
+    // save the wrapper pointer for the release
+    reconPtr->wrapper_ptr = (void*)ebWrapperPtr;
+    *p_buffer = reconPtr;
+
+    // ReconOutput packs the planes of the source size one after the other
+    if (planes) {
+        const uint32_t is16bit = sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT;
+
+        planes->width = sequence_control_set_ptr->max_input_luma_width - sequence_control_set_ptr->max_input_pad_right;
+        planes->height = sequence_control_set_ptr->max_input_luma_height - sequence_control_set_ptr->max_input_pad_bottom;
+        planes->y_stride = planes->width;
+        planes->cb_stride = planes->width >> 1;
+        planes->cr_stride = planes->width >> 1;
+        planes->luma = reconPtr->p_buffer;
+        planes->cb = planes->luma + ((planes->width * planes->height) << is16bit);
+        planes->cr = planes->cb + (((planes->width * planes->height) >> 2) << is16bit);
+    }
+
+    return return_error;
+}
+
+/**********************************
+* eb_svt_enc_update_rate_control queues the settings for ResourceCoordination
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_update_rate_control(
+    EbComponentType          *svt_enc_component,
+    EbSvtRateControlUpdate   *update)
+{
+    EbEncHandle_t          *pEncCompData;
+    SequenceControlSet_t   *sequence_control_set_ptr;
+    EncodeContext_t        *encode_context_ptr;
+    EbSvtRateControlUpdate  rateControlUpdate;
+    uint32_t                updateIndex;
+
+    if (svt_enc_component == NULL || update == NULL)
+        return EB_ErrorBadParameter;
+
+    pEncCompData = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
+    sequence_control_set_ptr = pEncCompData->sequenceControlSetInstanceArray[0]->sequence_control_set_ptr;
+    encode_context_ptr = pEncCompData->sequenceControlSetInstanceArray[0]->encode_context_ptr;
+    rateControlUpdate = *update;
+
+    // As with eb_svt_enc_set_parameter, the QP range stays [0 - 63] with rate_control_mode 0
+    if (sequence_control_set_ptr->static_config.rate_control_mode == 0)
+        rateControlUpdate.flags &= ~EB_RATE_CONTROL_UPDATE_QP_RANGE;
+
+    if ((rateControlUpdate.flags & EB_RATE_CONTROL_UPDATE_TARGET_BIT_RATE) && rateControlUpdate.target_bit_rate == 0) {
+        SVT_LOG("SVT [Warning]: The target bit rate must be greater than 0\n");
+        return EB_ErrorBadParameter;
+    }
+    if ((rateControlUpdate.flags & EB_RATE_CONTROL_UPDATE_QP) && rateControlUpdate.qp > MAX_QP_VALUE) {
+        SVT_LOG("SVT [Warning]: QP must be [0 - %d]\n", MAX_QP_VALUE);
+        return EB_ErrorBadParameter;
+    }
+    if ((rateControlUpdate.flags & EB_RATE_CONTROL_UPDATE_QP_RANGE) &&
+        (rateControlUpdate.max_qp_allowed > MAX_QP_VALUE || rateControlUpdate.min_qp_allowed > rateControlUpdate.max_qp_allowed)) {
+        SVT_LOG("SVT [Warning]: MinQpAllowed and MaxQpAllowed must be [0 - %d], MinQpAllowed smaller than MaxQpAllowed\n", MAX_QP_VALUE);
+        return EB_ErrorBadParameter;
+    }
+    // The intervals of the rate control follow a finite intra period
+    if ((rateControlUpdate.flags & EB_RATE_CONTROL_UPDATE_INTRA_PERIOD) &&
+        (sequence_control_set_ptr->intra_period_length == -1 || rateControlUpdate.intra_period_length < 0 || rateControlUpdate.intra_period_length > 255)) {
+        SVT_LOG("SVT [Warning]: The intra period must be [0 - 255] and can not change from -1\n");
+        return EB_ErrorBadParameter;
+    }
+
+    EbBlockOnMutex(encode_context_ptr->rate_control_update_mutex);
+
+    if (encode_context_ptr->rate_control_update_count == RATE_CONTROL_UPDATE_QUEUE_MAX_DEPTH) {
+        EbReleaseMutex(encode_context_ptr->rate_control_update_mutex);
+        return EB_ErrorInsufficientResources;
+    }
+
+    // Keep the queue sorted by picture number, updates of the same picture in order
+    updateIndex = encode_context_ptr->rate_control_update_count;
+    while (updateIndex > 0 && encode_context_ptr->rate_control_update_queue[updateIndex - 1].picture_number > rateControlUpdate.picture_number) {
+        encode_context_ptr->rate_control_update_queue[updateIndex] = encode_context_ptr->rate_control_update_queue[updateIndex - 1];
+        updateIndex--;
+    }
+    encode_context_ptr->rate_control_update_queue[updateIndex] = rateControlUpdate;
+    encode_context_ptr->rate_control_update_count++;
+
+    EbReleaseMutex(encode_context_ptr->rate_control_update_mutex);
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* eb_svt_get_stats
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_get_stats(
+    EbComponentType      *svt_enc_component,
+    EbSvtEncStats        *stats)
+{
+    EbEncHandle_t *pEncCompData;
+    uint32_t       stageIndex;
+
+    if (svt_enc_component == NULL || stats == NULL)
+        return EB_ErrorBadParameter;
+
+    pEncCompData = (EbEncHandle_t*)svt_enc_component->pComponentPrivate;
+
+    stats->elapsed_time = EbGetTimeUs() - pEncCompData->statsStartTime;
+    stats->stage_count = pEncCompData->stageTotalCount;
+    for (stageIndex = 0; stageIndex < pEncCompData->stageTotalCount; ++stageIndex) {
+        EbStageStats_t  *statsPtr = &pEncCompData->stageStatsArray[stageIndex];
+        EbSvtStageStats *stagePtr = &stats->stage_array[stageIndex];
+
+        stagePtr->name = statsPtr->name;
+        stagePtr->thread_count = statsPtr->threadCount;
+        stagePtr->processed_count = EbAtomicLoad64(&statsPtr->processedCount);
+        stagePtr->active_time = EbAtomicLoad64(&statsPtr->activeTime);
+        stagePtr->input_blocked_time = EbAtomicLoad64(&statsPtr->inputBlockedTime);
+        stagePtr->output_blocked_time = EbAtomicLoad64(&statsPtr->outputBlockedTime);
+        stagePtr->queue_depth = EbAtomicLoad32(&statsPtr->queueDepth);
+        stagePtr->max_queue_depth = EbAtomicLoad32(&statsPtr->maxQueueDepth);
+    }
+
+    return EB_ErrorNone;
+}
+
 /**********************************
 * Encoder Error Handling
 **********************************/
@@ -3248,6 +4752,10 @@ static EbErrorType allocate_frame_buffer(
 
     inputPictureBufferDescInitData.bufferEnableMask = PICTURE_BUFFER_DESC_FULL_MASK;
 
+    // The descriptor points to the application planes of each picture
+    if (config->zero_copy_input)
+        inputPictureBufferDescInitData.bufferEnableMask = 0;
+
     if (is16bit && config->compressed_ten_bit_format == 1) {
         inputPictureBufferDescInitData.splitMode = EB_FALSE;  //do special allocation for 2bit data down below.        
     }
@@ -3300,8 +4808,6 @@ EbErrorType EbOutputBufferHeaderCtor(
     EbPtr *objectDblPtr,
     EbPtr objectInitDataPtr)
 {
-    EbSvtAv1EncConfiguration   * config = (EbSvtAv1EncConfiguration*)objectInitDataPtr;
-    uint32_t nStride = (uint32_t)(EB_OUTPUTSTREAMBUFFERSIZE_MACRO(config->source_width * config->source_height));  //TBC
     EbBufferHeaderType* outBufPtr;
 
     EB_MALLOC(EbBufferHeaderType*, outBufPtr, sizeof(EbBufferHeaderType), EB_N_PTR);
@@ -3310,9 +4816,9 @@ EbErrorType EbOutputBufferHeaderCtor(
     // Initialize Header
     outBufPtr->size = sizeof(EbBufferHeaderType);
 
-    EB_MALLOC(uint8_t*, outBufPtr->p_buffer, nStride, EB_N_PTR);
-
-    outBufPtr->n_alloc_len = nStride;
+    // The payload is allocated from the packet ring by Packetization
+    outBufPtr->p_buffer = (uint8_t*)EB_NULL;
+    outBufPtr->n_alloc_len = 0;
     outBufPtr->p_app_private = NULL;
 
     (void)objectInitDataPtr;
@@ -10,12 +10,30 @@
 #include "EbApi.h"
 #include "EbPictureBufferDesc.h"
 #include "EbSystemResourceManager.h"
+#include "EbScheduler.h"
 #include "EbSequenceControlSet.h"
 
 #include "EbResourceCoordinationResults.h"
 #include "EbPictureDemuxResults.h"
 #include "EbRateControlResults.h"
 
+/**************************************
+ * Input Copy Band
+ *   Rows of an input picture copied by an
+ *   input copy thread, see input_copy_threads
+ **************************************/
+typedef struct EbInputCopyBand_s
+{
+    SequenceControlSet_t                   *sequence_control_set_ptr;
+    EbPictureBufferDesc_t                  *inputPicturePtr;
+    EbSvtEncInput                          *inputPtr;
+    uint32_t                                lumaRowStart;
+    uint32_t                                lumaRowEnd;
+
+    EbHandle                                startSemaphore;
+    EbHandle                                doneSemaphore;
+} EbInputCopyBand_t;
+
 /**************************************
  * Component Private Data
  **************************************/
@@ -77,6 +95,11 @@ typedef struct EbEncHandle_s
     EbHandle                              *restThreadHandleArray;
 #endif
     EbHandle                               packetizationThreadHandle;
+#if LOCK_FREE_FIFO
+    // Task Scheduler
+    EbScheduler_t                         *schedulerPtr;
+    EbHandle                              *schedulerWorkerThreadHandleArray;
+#endif
 
     // Contexts
     EbPtr                                  resourceCoordinationContextPtr;
@@ -167,10 +190,24 @@ typedef struct EbEncHandle_s
     // Callbacks
     EbCallback_t                          **app_callback_ptr_array;
 
+    // Pipeline Statistics
+    uint32_t                                stageTotalCount;
+    EbStageStats_t                          stageStatsArray[EB_MAX_PIPELINE_STAGES];
+    uint64_t                                statsStartTime;
+    EbTrace_t                              *tracePtr;
+
+    // Kernels, see aom_dsp_rtcd.h
+    struct EbDispatchTable_s               *dispatchTablePtr;
+
+    // Input Copy, the sending thread copies band 0
+    uint32_t                                inputCopyBandCount;
+    EbInputCopyBand_t                      *inputCopyBandArray;
+    EbHandle                               *inputCopyThreadHandleArray;
+    EbHandle                                inputCopyMutex;
+    EbHandle                                inputCopyDoneSemaphore;
+
     // Memory Map
-    EbMemoryMapEntry                       *memoryMap;
-    uint32_t                                memoryMapIndex;
-    uint64_t                                totalLibMemory;
+    EbMemoryContext_t                       memoryContext;
 
 } EbEncHandle_t;
 
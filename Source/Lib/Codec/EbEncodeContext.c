@@ -38,6 +38,8 @@ EbErrorType encode_context_ctor(
     // Output Buffer Fifos
     encode_context_ptr->stream_output_fifo_ptr = (EbFifo_t*)EB_NULL;
     encode_context_ptr->recon_output_fifo_ptr = (EbFifo_t*)EB_NULL;
+    encode_context_ptr->recon_callback_fifo_ptr = (EbFifo_t*)EB_NULL;
+    encode_context_ptr->packet_ring_ptr = (EbPacketRing_t*)EB_NULL;
 
     // Picture Buffer Fifos
     encode_context_ptr->reference_picture_pool_fifo_ptr = (EbFifo_t*)EB_NULL;
@@ -218,14 +220,17 @@ EbErrorType encode_context_ctor(
     encode_context_ptr->max_coded_poc = 0;
     encode_context_ptr->max_coded_poc_selected_ref_qp = 32;
 
+    EB_CREATEMUTEX(EbHandle, encode_context_ptr->rate_control_update_mutex, sizeof(EbHandle), EB_MUTEX);
+    encode_context_ptr->rate_control_update_count = 0;
+    encode_context_ptr->intra_period_start = 0;
+    encode_context_ptr->rate_control_generation = 0;
+
     encode_context_ptr->shared_reference_mutex = EbCreateMutex();
     if (encode_context_ptr->shared_reference_mutex == (EbHandle)EB_NULL) {
         return EB_ErrorInsufficientResources;
     }
-    else {
-        memoryMap[*(memoryMapIndex)].ptrType = EB_MUTEX;
-        memoryMap[(*(memoryMapIndex))++].ptr = encode_context_ptr->shared_reference_mutex;
-        *totalLibMemory += (sizeof(EbHandle));
+    else if (EbAddMemoryEntry(encode_context_ptr->shared_reference_mutex, EB_MUTEX, sizeof(EbHandle)) != EB_ErrorNone) {
+        return EB_ErrorInsufficientResources;
     }
 
 
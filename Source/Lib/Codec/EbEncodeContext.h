@@ -15,6 +15,7 @@
 #include "EbPictureDecisionQueue.h"
 #include "EbPictureManagerQueue.h"
 #include "EbPacketizationReorderQueue.h"
+#include "EbPacketRing.h"
 #include "EbInitialRateControlReorderQueue.h"
 #include "EbPictureManagerReorderQueue.h"
 #include "EbCabacContextModel.h"
@@ -39,6 +40,7 @@
 #define PARALLEL_GOP_MAX_NUMBER                             256
 #define RC_GROUP_IN_GOP_MAX_NUMBER                          512
 #define PICTURE_IN_RC_GROUP_MAX_NUMBER                      64
+#define RATE_CONTROL_UPDATE_QUEUE_MAX_DEPTH                 64
 
 typedef struct EncodeContext_s
 {
@@ -52,6 +54,8 @@ typedef struct EncodeContext_s
     // Output Buffer Fifos
     EbFifo_t                                        *stream_output_fifo_ptr;
     EbFifo_t                                        *recon_output_fifo_ptr;
+    // Recon pictures Packetization delivers with the output callbacks
+    EbFifo_t                                        *recon_callback_fifo_ptr;
     EbFifo_t                                        *statistics_output_fifo_ptr;
 
     // Picture Buffer Fifos
@@ -102,6 +106,9 @@ typedef struct EncodeContext_s
     PacketizationReorderEntry_t                    **packetization_reorder_queue;
     uint32_t                                         packetization_reorder_queue_head_index;
 
+    // Payload memory of the output packets
+    EbPacketRing_t                                  *packet_ring_ptr;
+
     // GOP Counters
     uint32_t                                         intra_period_position;        // Current position in intra period
     uint32_t                                         pred_struct_position;         // Current position within a prediction structure
@@ -137,6 +144,15 @@ typedef struct EncodeContext_s
     uint32_t                                          previous_selected_ref_qp;
     uint64_t                                          max_coded_poc;
     uint32_t                                          max_coded_poc_selected_ref_qp;
+
+    // Rate control updates of eb_svt_enc_update_rate_control sorted by picture
+    // number, and the settings ResourceCoordination gives the pictures
+    EbHandle                                          rate_control_update_mutex;
+    EbSvtRateControlUpdate                            rate_control_update_queue[RATE_CONTROL_UPDATE_QUEUE_MAX_DEPTH];
+    uint32_t                                          rate_control_update_count;
+    EbSvtRateControlUpdate                            rate_control_settings;
+    uint64_t                                          intra_period_start;           // First picture of the current intra period layout
+    uint32_t                                          rate_control_generation;      // Number of updates applied
                                                      
     // Dynamic GOP                                   
     uint32_t                                          previous_mini_gop_hierarchical_levels;
@@ -1390,8 +1390,9 @@ void av1_count_overlappable_neighbors(
     xd->mi_stride = picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_ptr->picture_width_in_sb*(BLOCK_SIZE_64 / 4);
     const int32_t offset = mi_row * xd->mi_stride + mi_col;
     xd->mi = picture_control_set_ptr->mi_grid_base + offset;
-    xd->up_available = (mi_row > 0);
-    xd->left_available = (mi_col > 0);
+    // xd->tile is set by the mvp table generation of the block
+    xd->up_available = (mi_row > xd->tile.mi_row_start);
+    xd->left_available = (mi_col > xd->tile.mi_col_start);
 
     if (!is_motion_variation_allowed_bsize(bsize)) return;
 
@@ -1514,7 +1515,9 @@ EbErrorType EncodeSliceFinish(
 {
     EbErrorType return_error = EB_ErrorNone;
 
-    aom_stop_encode(&entropy_coder_ptr->ecWriter);
+    // The tile did not fit in the buffer of its coder
+    if (aom_stop_encode(&entropy_coder_ptr->ecWriter) < 0)
+        return_error = EB_ErrorInsufficientResources;
 
     return return_error;
 }
@@ -1548,33 +1551,6 @@ EbErrorType ResetEntropyCoder(
     return return_error;
 }
 
-EbErrorType CopyRbspBitstreamToPayload(
-    Bitstream_t *bitstreamPtr,
-    EbByte      outputBuffer,
-    uint32_t      *outputBufferIndex,
-    uint32_t      *outputBufferSize,
-    EncodeContext_t         *encode_context_ptr)
-{
-    EbErrorType return_error = EB_ErrorNone;
-    OutputBitstreamUnit_t *outputBitstreamPtr = (OutputBitstreamUnit_t*)bitstreamPtr->outputBitstreamPtr;
-
-
-    CHECK_REPORT_ERROR(
-        ((outputBitstreamPtr->writtenBitsCount >> 3) + (*outputBufferIndex) < (*outputBufferSize)),
-        encode_context_ptr->app_callback_ptr,
-        EB_ENC_EC_ERROR2);
-
-
-
-    output_bitstream_rbsp_to_payload(
-        outputBitstreamPtr,
-        outputBuffer,
-        outputBufferIndex,
-        outputBufferSize,
-        0);
-
-    return return_error;
-}
 
 
 EbErrorType BitstreamCtor(
@@ -2922,33 +2898,27 @@ static void write_tile_info_max_tile(const PictureParentControlSet_t *const pcsP
     struct aom_write_bit_buffer *wb) {
 
 
-    Av1Common * cm = pcsPtr->av1_cm;
+    const TilesInfo *tiles_info = &pcsPtr->av1_cm->tiles_info;
     aom_wb_write_bit(wb, pcsPtr->uniform_tile_spacing_flag);
 
     if (pcsPtr->uniform_tile_spacing_flag) {
 
-        //CHKN: no tiles
-        cm->log2_tile_cols = cm->min_log2_tile_cols;
-
         // Uniform spaced tiles with power-of-two number of rows and columns
         // tile columns
-        int32_t ones = cm->log2_tile_cols - cm->min_log2_tile_cols;
+        int32_t ones = tiles_info->log2_tile_cols - tiles_info->min_log2_tile_cols;
         while (ones--) {
             aom_wb_write_bit(wb, 1);
         }
-        if (cm->log2_tile_cols < cm->max_log2_tile_cols) {
+        if (tiles_info->log2_tile_cols < tiles_info->max_log2_tile_cols) {
             aom_wb_write_bit(wb, 0);
         }
 
         // rows
-        //CHKN: no tiles
-        cm->log2_tile_rows = cm->min_log2_tile_rows;
-
-        ones = cm->log2_tile_rows - cm->min_log2_tile_rows;
+        ones = tiles_info->log2_tile_rows - tiles_info->min_log2_tile_rows;
         while (ones--) {
             aom_wb_write_bit(wb, 1);
         }
-        if (cm->log2_tile_rows < cm->max_log2_tile_rows) {
+        if (tiles_info->log2_tile_rows < tiles_info->max_log2_tile_rows) {
             aom_wb_write_bit(wb, 0);
         }
 
@@ -2976,43 +2946,11 @@ static void write_tile_info_max_tile(const PictureParentControlSet_t *const pcsP
     }
 }
 
-#define MAX_TILE_WIDTH (4096)        // Max Tile width in pixels
-#define MAX_TILE_AREA (4096 * 2304)  // Maximum tile area in pixels
-// Find smallest k>=0 such that (blk_size << k) >= target
-static int32_t tile_log2(int32_t blk_size, int32_t target) {
-    int32_t k;
-    for (k = 0; (blk_size << k) < target; k++) {
-    }
-    return k;
-}
-void av1_get_tile_limits(PictureParentControlSet_t * pcsPtr) {
-
-    Av1Common * cm = pcsPtr->av1_cm;
-
-    int32_t mi_cols = ALIGN_POWER_OF_TWO(cm->mi_cols, pcsPtr->sequence_control_set_ptr->mib_size_log2);
-    int32_t mi_rows = ALIGN_POWER_OF_TWO(cm->mi_rows, pcsPtr->sequence_control_set_ptr->mib_size_log2);
-    int32_t sb_cols = mi_cols >> pcsPtr->sequence_control_set_ptr->mib_size_log2;
-    int32_t sb_rows = mi_rows >> pcsPtr->sequence_control_set_ptr->mib_size_log2;
-
-    int32_t sb_size_log2 = pcsPtr->sequence_control_set_ptr->mib_size_log2 + MI_SIZE_LOG2;
-    cm->max_tile_width_sb = MAX_TILE_WIDTH >> sb_size_log2;
-    int32_t max_tile_area_sb = MAX_TILE_AREA >> (2 * sb_size_log2);
-
-    cm->min_log2_tile_cols = tile_log2(cm->max_tile_width_sb, sb_cols);
-    cm->max_log2_tile_cols = tile_log2(1, AOMMIN(sb_cols, MAX_TILE_COLS));
-    cm->max_log2_tile_rows = tile_log2(1, AOMMIN(sb_rows, MAX_TILE_ROWS));
-    cm->min_log2_tile_rows = 0; // CHKN Tiles 
-    cm->min_log2_tiles = tile_log2(max_tile_area_sb, sb_cols * sb_rows);
-    cm->min_log2_tiles = AOMMAX(cm->min_log2_tiles, cm->min_log2_tile_cols);
-}
-
-
-
 static void write_tile_info(const PictureParentControlSet_t *const pcsPtr,
     //struct aom_write_bit_buffer *saved_wb,
     struct aom_write_bit_buffer *wb) {
 
-    av1_get_tile_limits((PictureParentControlSet_t *)pcsPtr);
+    const TilesInfo *tiles_info = &pcsPtr->av1_cm->tiles_info;
 #if AV1_UPGRADE
     write_tile_info_max_tile(pcsPtr, wb);
 #else
@@ -3063,10 +3001,12 @@ static void write_tile_info(const PictureParentControlSet_t *const pcsPtr,
 #if !AV1_UPGRADE
     }
 #endif
-    //if (cm->tile_rows * cm->tile_cols > 1) {
-    //    // Number of bytes in tile size - 1
-    //    aom_wb_write_literal(wb, 3, 2);
-    //}
+    if (tiles_info->log2_tile_rows + tiles_info->log2_tile_cols > 0) {
+        // context_update_tile_id: the contexts of the first tile are kept
+        aom_wb_write_literal(wb, 0, tiles_info->log2_tile_rows + tiles_info->log2_tile_cols);
+        // Number of bytes in tile size - 1
+        aom_wb_write_literal(wb, 3, 2);
+    }
 }
 
 static void write_frame_size(PictureParentControlSet_t *pcsPtr,
@@ -4421,13 +4361,35 @@ EbErrorType WriteFrameHeaderAv1(
     //    n_log2_tiles, cm->num_tg > 1);
 
     if (!showExisting) {
-        // Add data from EC stream to Picture Stream.
-        int32_t frameSize = pcsPtr->entropy_coder_ptr->ecWriter.pos;
-        OutputBitstreamUnit_t *ecOutputBitstreamPtr = (OutputBitstreamUnit_t*)pcsPtr->entropy_coder_ptr->ecOutputBitstreamPtr;
-        //****************************************************************//
-        // Copy from EC stream to frame stream
-        memcpy(data + currDataSize, ecOutputBitstreamPtr->bufferBeginAv1, frameSize);
-        currDataSize += (frameSize);
+        const uint32_t tileCount = pcsPtr->tile_column_count * pcsPtr->tile_row_count;
+
+        // Tile group header of the OBU_FRAME: tile_start_and_end_present_flag = 0
+        // and the byte alignment
+        if (tileCount > 1)
+            data[currDataSize++] = 0;
+
+        for (uint32_t tileIdx = 0; tileIdx < tileCount; ++tileIdx) {
+            EntropyCoder_t *entropyCoderPtr = pcsPtr->tile_entropy_coder_ptr_array[tileIdx];
+            // Add data from EC stream to Picture Stream.
+            int32_t tileSize = entropyCoderPtr->ecWriter.pos;
+            OutputBitstreamUnit_t *ecOutputBitstreamPtr = (OutputBitstreamUnit_t*)entropyCoderPtr->ecOutputBitstreamPtr;
+
+            // Room for the tile, its size and the OBU size field moved in below
+            CHECK_REPORT_ERROR(
+                (output_bitstream_written_bytes(outputBitstreamPtr) + (uint32_t)currDataSize + 4 + (uint32_t)tileSize + sizeof(uint64_t) <= outputBitstreamPtr->size),
+                scsPtr->encode_context_ptr->app_callback_ptr,
+                EB_ENC_EC_ERROR18);
+
+            // tile_size_minus_1, on 4 bytes (tile_size_bytes_minus_1 = 3), except for the last tile
+            if (tileIdx < tileCount - 1) {
+                mem_put_le32(data + currDataSize, tileSize - 1);
+                currDataSize += 4;
+            }
+            //****************************************************************//
+            // Copy from EC stream to frame stream
+            memcpy(data + currDataSize, ecOutputBitstreamPtr->bufferBeginAv1, tileSize);
+            currDataSize += (tileSize);
+        }
     }
     const uint32_t obuPayloadSize = currDataSize - obuHeaderSize;
     const size_t lengthFieldSize =
@@ -4537,6 +4499,7 @@ static void Av1writeDeltaQindex(
 static void write_cdef(
     SequenceControlSet_t     *seqCSetPtr,
     PictureControlSet_t     *p_pcs_ptr,
+    int32_t                 *cdef_preset,
     //Av1Common *cm,
     MacroBlockD *const xd,
     aom_writer *w,
@@ -4564,8 +4527,8 @@ static void write_cdef(
 // Initialise when at top left part of the superblock
     if (!(mi_row & (seqCSetPtr->mib_size - 1)) &&
         !(mi_col & (seqCSetPtr->mib_size - 1))) {  // Top left?
-        p_pcs_ptr->cdef_preset[0] = p_pcs_ptr->cdef_preset[1] = p_pcs_ptr->cdef_preset[2] =
-            p_pcs_ptr->cdef_preset[3] = -1;
+        cdef_preset[0] = cdef_preset[1] = cdef_preset[2] =
+            cdef_preset[3] = -1;
     }
 
     // Emit CDEF param at first non-skip coding block
@@ -4574,9 +4537,9 @@ static void write_cdef(
         ? !!(mi_col & mask) + 2 * !!(mi_row & mask)
         : 0;
 
-    if (p_pcs_ptr->cdef_preset[index] == -1 && !skip) {
+    if (cdef_preset[index] == -1 && !skip) {
         aom_write_literal(w, mi->mbmi.cdef_strength, p_pcs_ptr->parent_pcs_ptr->cdef_bits);
-        p_pcs_ptr->cdef_preset[index] = mi->mbmi.cdef_strength;
+        cdef_preset[index] = mi->mbmi.cdef_strength;
 
 
     }
@@ -4584,10 +4547,10 @@ static void write_cdef(
 }
 
 
-void av1_reset_loop_restoration(PictureControlSet_t     *piCSetPtr) {
+void av1_reset_loop_restoration(PictureControlSet_t     *piCSetPtr, uint32_t tile_idx) {
     for (int32_t p = 0; p < 3; ++p) {
-        set_default_wiener(piCSetPtr->wiener_info + p);
-        set_default_sgrproj(piCSetPtr->sgrproj_info + p);
+        set_default_wiener(piCSetPtr->wiener_info + tile_idx * MAX_MB_PLANE + p);
+        set_default_sgrproj(piCSetPtr->sgrproj_info + tile_idx * MAX_MB_PLANE + p);
     }
 }
 static void write_wiener_filter(int32_t wiener_win, const WienerInfo *wiener_info,
@@ -4665,7 +4628,7 @@ static void write_sgrproj_filter(const SgrprojInfo *sgrproj_info,
 
     memcpy(ref_sgrproj_info, sgrproj_info, sizeof(*sgrproj_info));
 }
-static void loop_restoration_write_sb_coeffs(PictureControlSet_t     *piCSetPtr, FRAME_CONTEXT           *frameContext, const Av1Common *const cm,
+static void loop_restoration_write_sb_coeffs(PictureControlSet_t     *piCSetPtr, uint32_t tile_idx, FRAME_CONTEXT           *frameContext, const Av1Common *const cm,
     //MacroBlockD *xd,
     const RestorationUnitInfo *rui,
     aom_writer *const w, int32_t plane/*,
@@ -4679,8 +4642,8 @@ static void loop_restoration_write_sb_coeffs(PictureControlSet_t     *piCSetPtr,
 //    assert(!cm->all_lossless);
 
     const int32_t wiener_win = (plane > 0) ? WIENER_WIN_CHROMA : WIENER_WIN;
-    WienerInfo *wiener_info = piCSetPtr->wiener_info + plane;
-    SgrprojInfo *sgrproj_info = piCSetPtr->sgrproj_info + plane;
+    WienerInfo *wiener_info = piCSetPtr->wiener_info + tile_idx * MAX_MB_PLANE + plane;
+    SgrprojInfo *sgrproj_info = piCSetPtr->sgrproj_info + tile_idx * MAX_MB_PLANE + plane;
     RestorationType unit_rtype = rui->restoration_type;
 
 
@@ -4743,16 +4706,16 @@ EbErrorType ec_update_neighbors(
 {
     UNUSED(coeffPtr);
     EbErrorType return_error = EB_ErrorNone;
-    NeighborArrayUnit_t     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array;
-    NeighborArrayUnit_t     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array;
-    NeighborArrayUnit_t     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array;
-    NeighborArrayUnit_t     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array;
-    NeighborArrayUnit_t     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit_t     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit_t     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit_t     *inter_pred_dir_neighbor_array = picture_control_set_ptr->inter_pred_dir_neighbor_array;
-    NeighborArrayUnit_t     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array;
-    NeighborArrayUnit32_t   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array;
+    NeighborArrayUnit_t     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *inter_pred_dir_neighbor_array = picture_control_set_ptr->inter_pred_dir_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit32_t   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array[context_ptr->tile_idx];
     const BlockGeom         *blk_geom = Get_blk_geom_mds(cu_ptr->mds_idx);
     EbBool                   skipCoeff = EB_FALSE;
     PartitionContext         partition;
@@ -4907,16 +4870,16 @@ EbErrorType write_modes_b(
     aom_writer              *ecWriter = &entropy_coder_ptr->ecWriter;
     SequenceControlSet_t     *sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
 
-    NeighborArrayUnit_t     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array;
-    NeighborArrayUnit_t     *intra_luma_mode_neighbor_array = picture_control_set_ptr->intra_luma_mode_neighbor_array;
-    NeighborArrayUnit_t     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array;
-    NeighborArrayUnit_t     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array;
-    NeighborArrayUnit_t     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit_t     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit_t     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit_t     *inter_pred_dir_neighbor_array = picture_control_set_ptr->inter_pred_dir_neighbor_array;
-    NeighborArrayUnit_t     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array;
-    NeighborArrayUnit32_t   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array;
+    NeighborArrayUnit_t     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *intra_luma_mode_neighbor_array = picture_control_set_ptr->intra_luma_mode_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *inter_pred_dir_neighbor_array = picture_control_set_ptr->inter_pred_dir_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit_t     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array[context_ptr->tile_idx];
+    NeighborArrayUnit32_t   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array[context_ptr->tile_idx];
 
     const BlockGeom          *blk_geom = Get_blk_geom_mds(cu_ptr->mds_idx);
     uint32_t blkOriginX = context_ptr->sb_origin_x + blk_geom->origin_x;
@@ -4938,6 +4901,7 @@ EbErrorType write_modes_b(
         write_cdef(
             sequence_control_set_ptr,
             picture_control_set_ptr,
+            context_ptr->cdef_preset,
             cu_ptr->av1xd,
             ecWriter,
             skipCoeff,
@@ -5058,6 +5022,7 @@ EbErrorType write_modes_b(
         write_cdef(
             sequence_control_set_ptr,
             picture_control_set_ptr, /*cm,*/
+            context_ptr->cdef_preset,
             cu_ptr->av1xd,
             ecWriter,
             cu_ptr->skip_flag ? 1 : skipCoeff,
@@ -5357,7 +5322,7 @@ EB_EXTERN EbErrorType write_sb(
     FRAME_CONTEXT           *frameContext = entropy_coder_ptr->fc;
     aom_writer              *ecWriter = &entropy_coder_ptr->ecWriter;
     SequenceControlSet_t     *sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
-    NeighborArrayUnit_t     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array;
+    NeighborArrayUnit_t     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array[context_ptr->tile_idx];
 
     // CU Varaiables
     const BlockGeom          *blk_geom;
@@ -5375,11 +5340,14 @@ EB_EXTERN EbErrorType write_sb(
     EbBool checkCuOutOfBound = EB_FALSE;
 
     SbGeom_t * sb_geom = &sequence_control_set_ptr->sb_geom[tbPtr->index];// .block_is_inside_md_scan[blk_index])
+    const uint32_t tile_idx = context_ptr->tile_idx;
 
 
-    if (context_ptr->sb_origin_x == 0 && context_ptr->sb_origin_y == 0)
+    // The loop restoration references are reset at the start of each tile
+    if ((int32_t)(context_ptr->sb_origin_x >> MI_SIZE_LOG2) == tbPtr->tile_info.mi_col_start &&
+        (int32_t)(context_ptr->sb_origin_y >> MI_SIZE_LOG2) == tbPtr->tile_info.mi_row_start)
 
-        av1_reset_loop_restoration(picture_control_set_ptr);
+        av1_reset_loop_restoration(picture_control_set_ptr, tile_idx);
     if (!(sb_geom->is_complete_sb)) {
 
         checkCuOutOfBound = EB_TRUE;
@@ -5426,7 +5394,7 @@ EB_EXTERN EbErrorType write_sb(
                                 const int32_t runit_idx = tile_tl_idx + rcol + rrow * rstride;
                                 const RestorationUnitInfo *rui =
                                     &cm->rst_info[plane].unit_info[runit_idx];
-                                loop_restoration_write_sb_coeffs(picture_control_set_ptr, frameContext, cm, /*xd,*/ rui, ecWriter, plane);
+                                loop_restoration_write_sb_coeffs(picture_control_set_ptr, tile_idx, frameContext, cm, /*xd,*/ rui, ecWriter, plane);
                             }
                         }
                     }
@@ -91,12 +91,6 @@ extern "C" {
         COMPONENT_TYPE                          componentType,
         EbAsm                                  asm_type);
 
-    extern EbErrorType CopyRbspBitstreamToPayload(
-        Bitstream_t *bitstreamPtr,
-        EbByte      outputBuffer,
-        uint32_t      *outputBufferIndex,
-        uint32_t      *outputBufferSize,
-        EncodeContext_t         *encode_context_ptr);
 
 
     //**********************************************************************************************************//
@@ -20,6 +20,7 @@
 #include "EbEncDecResults.h"
 #include "EbEntropyCodingResults.h"
 #include "EbRateControlTasks.h"
+#include "EbErrorCodes.h"
 /******************************************************
  * Enc Dec Context Constructor
  ******************************************************/
@@ -47,23 +48,58 @@ EbErrorType entropy_coding_context_ctor(
 /***********************************************
  * Entropy Coding Reset Neighbor Arrays
  ***********************************************/
-static void EntropyCodingResetNeighborArrays(PictureControlSet_t *picture_control_set_ptr)
+static void EntropyCodingResetNeighborArrays(PictureControlSet_t *picture_control_set_ptr, uint32_t tile_idx)
 {
-    NeighborArrayUnitReset(picture_control_set_ptr->mode_type_neighbor_array);
+    NeighborArrayUnitReset(picture_control_set_ptr->mode_type_neighbor_array[tile_idx]);
 
-    NeighborArrayUnitReset(picture_control_set_ptr->partition_context_neighbor_array);
+    NeighborArrayUnitReset(picture_control_set_ptr->partition_context_neighbor_array[tile_idx]);
 
-    NeighborArrayUnitReset(picture_control_set_ptr->skip_flag_neighbor_array);
+    NeighborArrayUnitReset(picture_control_set_ptr->skip_flag_neighbor_array[tile_idx]);
 
-    NeighborArrayUnitReset(picture_control_set_ptr->skip_coeff_neighbor_array);
-    NeighborArrayUnitReset(picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array);
-    NeighborArrayUnitReset(picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array);
-    NeighborArrayUnitReset(picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array);
-    NeighborArrayUnitReset(picture_control_set_ptr->inter_pred_dir_neighbor_array);
-    NeighborArrayUnitReset(picture_control_set_ptr->ref_frame_type_neighbor_array);
+    NeighborArrayUnitReset(picture_control_set_ptr->skip_coeff_neighbor_array[tile_idx]);
+    NeighborArrayUnitReset(picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array[tile_idx]);
+    NeighborArrayUnitReset(picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array[tile_idx]);
+    NeighborArrayUnitReset(picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array[tile_idx]);
+    NeighborArrayUnitReset(picture_control_set_ptr->inter_pred_dir_neighbor_array[tile_idx]);
+    NeighborArrayUnitReset(picture_control_set_ptr->ref_frame_type_neighbor_array[tile_idx]);
+
+    NeighborArrayUnitReset(picture_control_set_ptr->intra_luma_mode_neighbor_array[tile_idx]);
+    NeighborArrayUnitReset32(picture_control_set_ptr->interpolation_type_neighbor_array[tile_idx]);
+    return;
+}
+
+/**************************************************
+ * Reset the dc sign neighbor arrays at the tile
+ *   boundaries, so that no context is inherited
+ *   from the tile on the left or above. Unlike the
+ *   mode arrays, they are read whenever the block
+ *   is not on the picture boundary.
+ **************************************************/
+static void EntropyCodingResetTileNeighborArrays(
+    PictureControlSet_t *picture_control_set_ptr,
+    uint32_t             tile_idx,
+    const TileInfo      *tile,
+    uint32_t             sb_sz)
+{
+    NeighborArrayUnit_t *dcSignNeighborArrays[] = {
+        picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array[tile_idx],
+        picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array[tile_idx],
+        picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array[tile_idx] };
+    const uint32_t tileOriginX = tile->mi_col_start << MI_SIZE_LOG2;
+    const uint32_t tileOriginY = tile->mi_row_start << MI_SIZE_LOG2;
+    const uint32_t tileWidth = (((tile->mi_col_end << MI_SIZE_LOG2) + sb_sz - 1) / sb_sz) * sb_sz - tileOriginX;
+    const uint32_t tileHeight = (((tile->mi_row_end << MI_SIZE_LOG2) + sb_sz - 1) / sb_sz) * sb_sz - tileOriginY;
+    uint32_t arrayIndex;
+
+    for (arrayIndex = 0; arrayIndex < sizeof(dcSignNeighborArrays) / sizeof(dcSignNeighborArrays[0]); ++arrayIndex) {
+        const uint32_t subsamplingShift = arrayIndex ? 1 : 0;
+
+        if (tileOriginX)
+            NeighborArrayUnitResetRegion(dcSignNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_LEFT, tileOriginY >> subsamplingShift, tileHeight >> subsamplingShift, 0);
+        if (tileOriginY)
+            NeighborArrayUnitResetRegion(dcSignNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_TOP, tileOriginX >> subsamplingShift, tileWidth >> subsamplingShift, 0);
+    }
 
-    NeighborArrayUnitReset(picture_control_set_ptr->intra_luma_mode_neighbor_array);
-    NeighborArrayUnitReset32(picture_control_set_ptr->interpolation_type_neighbor_array);
     return;
 }
 
@@ -167,35 +203,8 @@ void av1_build_nmv_cost_table(int32_t *mvjoint, int32_t *mvcost[2],
  * Reset Entropy Coding Picture
  **************************************************/
 static void ResetEntropyCodingPicture(
-    EntropyCodingContext_t  *context_ptr,
-    PictureControlSet_t     *picture_control_set_ptr,
-    SequenceControlSet_t    *sequence_control_set_ptr)
+    PictureControlSet_t     *picture_control_set_ptr)
 {
-    ResetBitstream(EntropyCoderGetBitstreamPtr(picture_control_set_ptr->entropy_coder_ptr));
-
-    uint32_t                       entropyCodingQp;
-
-    context_ptr->is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
-
-    // QP
-#if ADD_DELTA_QP_SUPPORT
-    uint16_t picture_qp = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
-    context_ptr->qp = picture_qp;
-#else
-    context_ptr->qp = picture_control_set_ptr->picture_qp;
-#endif
-    // Asuming cb and cr offset to be the same for chroma QP in both slice and pps for lambda computation
-
-    context_ptr->chroma_qp = context_ptr->qp;
-    if (picture_control_set_ptr->use_delta_qp) {
-        entropyCodingQp = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
-    }
-    else {
-        entropyCodingQp = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
-    }
-
-
-    // Reset CABAC Contexts
     // Reset QP Assignement
     picture_control_set_ptr->prev_coded_qp = picture_control_set_ptr->picture_qp;
     picture_control_set_ptr->prev_quant_group_coded_qp = picture_control_set_ptr->picture_qp;
@@ -217,26 +226,59 @@ static void ResetEntropyCodingPicture(
     }
 #endif
 
+    return;
+}
+
+/**************************************************
+ * Reset Entropy Coding Tile
+ *   Each tile starts from the default contexts
+ **************************************************/
+static void ResetEntropyCodingTile(
+    EntropyCodingContext_t  *context_ptr,
+    PictureControlSet_t     *picture_control_set_ptr,
+    SequenceControlSet_t    *sequence_control_set_ptr,
+    uint32_t                 tile_idx,
+    const TileInfo          *tile)
+{
+    EntropyCoder_t *entropy_coder_ptr = picture_control_set_ptr->tile_entropy_coder_ptr_array[tile_idx];
+
+    ResetBitstream(EntropyCoderGetBitstreamPtr(entropy_coder_ptr));
+
+    uint32_t                       entropyCodingQp;
+
+    context_ptr->is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+
+    // QP
+#if ADD_DELTA_QP_SUPPORT
+    uint16_t picture_qp = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
+    context_ptr->qp = picture_qp;
+#else
+    context_ptr->qp = picture_control_set_ptr->picture_qp;
+#endif
+    // Asuming cb and cr offset to be the same for chroma QP in both slice and pps for lambda computation
+
+    context_ptr->chroma_qp = context_ptr->qp;
+    entropyCodingQp = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
+
     // pass the ent
-    OutputBitstreamUnit_t *outputBitstreamPtr = (OutputBitstreamUnit_t*)(picture_control_set_ptr->entropy_coder_ptr->ecOutputBitstreamPtr);
+    OutputBitstreamUnit_t *outputBitstreamPtr = (OutputBitstreamUnit_t*)(entropy_coder_ptr->ecOutputBitstreamPtr);
     //****************************************************************//
 
     uint8_t *data = outputBitstreamPtr->bufferAv1;
-    picture_control_set_ptr->entropy_coder_ptr->ecWriter.allow_update_cdf = !picture_control_set_ptr->parent_pcs_ptr->large_scale_tile;
-    picture_control_set_ptr->entropy_coder_ptr->ecWriter.allow_update_cdf =
-        picture_control_set_ptr->entropy_coder_ptr->ecWriter.allow_update_cdf && !picture_control_set_ptr->parent_pcs_ptr->disable_cdf_update;
-    aom_start_encode(&picture_control_set_ptr->entropy_coder_ptr->ecWriter, data);
-
-    // ADD Reset here
+    entropy_coder_ptr->ecWriter.allow_update_cdf = !picture_control_set_ptr->parent_pcs_ptr->large_scale_tile;
+    entropy_coder_ptr->ecWriter.allow_update_cdf =
+        entropy_coder_ptr->ecWriter.allow_update_cdf && !picture_control_set_ptr->parent_pcs_ptr->disable_cdf_update;
+    aom_start_encode(&entropy_coder_ptr->ecWriter, data, outputBitstreamPtr->size - output_bitstream_written_bytes(outputBitstreamPtr));
 
+    // Reset CABAC Contexts
     ResetEntropyCoder(
         sequence_control_set_ptr->encode_context_ptr,
-        picture_control_set_ptr->entropy_coder_ptr,
+        entropy_coder_ptr,
         entropyCodingQp,
         picture_control_set_ptr->slice_type);
 
-    EntropyCodingResetNeighborArrays(picture_control_set_ptr);
-
+    EntropyCodingResetNeighborArrays(picture_control_set_ptr, tile_idx);
+    EntropyCodingResetTileNeighborArrays(picture_control_set_ptr, tile_idx, tile, context_ptr->sb_sz);
 
     return;
 }
@@ -284,6 +326,7 @@ static void EntropyCodingLcu(
     (void)terminateSliceFlag;
     (void)sequence_control_set_ptr;
     EbPictureBufferDesc_t *coeffPicturePtr = sb_ptr->quantized_coeff;
+    EntropyCoder_t        *entropy_coder_ptr = picture_control_set_ptr->tile_entropy_coder_ptr_array[context_ptr->tile_idx];
 
     //rate Control
     uint32_t                       writtenBitsBeforeQuantizedCoeff;
@@ -295,7 +338,7 @@ static void EntropyCodingLcu(
     // + 32  - bits remaining in interval Low Value
     // + number of buffered byte * 8
     // This should be only for coeffs not any flag
-    writtenBitsBeforeQuantizedCoeff = ((OutputBitstreamUnit_t*)EntropyCoderGetBitstreamPtr(picture_control_set_ptr->entropy_coder_ptr))->writtenBitsCount;
+    writtenBitsBeforeQuantizedCoeff = ((OutputBitstreamUnit_t*)EntropyCoderGetBitstreamPtr(entropy_coder_ptr))->writtenBitsCount;
 
     (void)pictureOriginX;
     (void)pictureOriginY;
@@ -304,7 +347,7 @@ static void EntropyCodingLcu(
         context_ptr,
         sb_ptr,
         picture_control_set_ptr,
-        picture_control_set_ptr->entropy_coder_ptr,
+        entropy_coder_ptr,
         coeffPicturePtr);
 
     //store the number of written bits after coding quantized coeffs (flush is not called yet):
@@ -312,12 +355,10 @@ static void EntropyCodingLcu(
     // number of written bits
     // + 32  - bits remaining in interval Low Value
     // + number of buffered byte * 8
-    writtenBitsAfterQuantizedCoeff = ((OutputBitstreamUnit_t*)EntropyCoderGetBitstreamPtr(picture_control_set_ptr->entropy_coder_ptr))->writtenBitsCount;
+    writtenBitsAfterQuantizedCoeff = ((OutputBitstreamUnit_t*)EntropyCoderGetBitstreamPtr(entropy_coder_ptr))->writtenBitsCount;
 
     sb_ptr->total_bits = writtenBitsAfterQuantizedCoeff - writtenBitsBeforeQuantizedCoeff;
 
-    picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += sb_ptr->quantized_coeffs_bits;
-
     return;
 }
 
@@ -327,17 +368,22 @@ static void EntropyCodingLcu(
  * This function is responsible for synchronizing the
  *   processing of Entropy Coding LCU-rows and starts
  *   processing of LCU-rows as soon as their inputs are
- *   available and the previous LCU-row has completed.
- *   At any given time, only one segment row per picture
- *   is being processed.
+ *   available and the previous LCU-row of the same tile
+ *   has completed. Each tile has its own entropy coder
+ *   and neighbor arrays, so the tiles are independent
+ *   of each other: at any given time, one segment row
+ *   per tile is being processed.
  *
  * The function has two parts:
  *
- * (1) Update the available row index which tracks
+ * (1) Update the availability mask which tracks
  *   which SB Row-inputs are available.
  *
- * (2) Increment the lcu-row counter as the segment-rows
- *   are completed.
+ * (2) Increment the lcu-row counter of the tile as its
+ *   segment-rows are completed, and the tile counter
+ *   as the tiles are completed. The thread completing
+ *   the last tile is the one which completes the
+ *   picture.
  *
  * Since there is the potentential for thread collusion,
  *   a MUTEX a used to protect the sensitive data and
@@ -345,13 +391,13 @@ static void EntropyCodingLcu(
  *
  * (A) Initial update.
  *  -Update the Completion Mask [see (1) above]
- *  -If the picture is not currently being processed,
- *     check to see if the next segment-row is available
+ *  -Look for a tile which is not currently being
+ *     processed and whose next segment-row is available
  *     and start processing.
  * (B) Continued processing
- *  -Upon the completion of a segment-row, check
- *     to see if the next segment-row's inputs have
- *     become available and begin processing if so.
+ *  -Upon the completion of a segment-row, release the
+ *     tile and look for the next segment-row to process,
+ *     starting with the same tile.
  *
  * On last important point is that the thread-safe
  *   code section is kept minimally short. The MUTEX
@@ -359,13 +405,36 @@ static void EntropyCodingLcu(
  *   of the segment-row (B) as this would block other
  *   threads from performing an update (A).
  ******************************************************/
+static void EntropyCodingTileRows(
+    PictureControlSet_t *picture_control_set_ptr,
+    uint32_t             tile_idx,
+    uint32_t             mibSizeLog2,
+    uint32_t            *tileRowStart,
+    uint32_t            *tileRowEnd)
+{
+    const TilesInfo *tiles_info = &picture_control_set_ptr->parent_pcs_ptr->av1_cm->tiles_info;
+    const uint32_t tile_row = tile_idx / picture_control_set_ptr->tile_column_count;
+
+    *tileRowStart = tiles_info->tile_row_start_mi[tile_row] >> mibSizeLog2;
+    *tileRowEnd = (tiles_info->tile_row_start_mi[tile_row + 1] + (1 << mibSizeLog2) - 1) >> mibSizeLog2;
+
+    return;
+}
+
 static EbBool UpdateEntropyCodingRows(
     PictureControlSet_t *picture_control_set_ptr,
     uint32_t              *rowIndex,
+    uint32_t              *tileIndex,
     uint32_t               row_count,
-    EbBool             *initialProcessCall)
+    uint32_t               mibSizeLog2,
+    EbBool             *initialProcessCall,
+    EbBool             *pictureCompleteFlag)
 {
     EbBool processNextRow = EB_FALSE;
+    const uint32_t tile_count = picture_control_set_ptr->tile_column_count * picture_control_set_ptr->tile_row_count;
+    uint32_t tileRowStart;
+    uint32_t tileRowEnd;
+    uint32_t tileItr;
 
     // Note, any writes & reads to status variables (e.g. in_progress) in MD-CTRL must be thread-safe
     EbBlockOnMutex(picture_control_set_ptr->entropy_coding_mutex);
@@ -377,29 +446,36 @@ static EbBool UpdateEntropyCodingRows(
         for (i = *rowIndex; i < *rowIndex + row_count; ++i) {
             picture_control_set_ptr->entropy_coding_row_array[i] = EB_TRUE;
         }
+        *tileIndex = 0;
+    }
+    // Release in_progress token
+    else {
+        EntropyCodingTileRows(picture_control_set_ptr, *tileIndex, mibSizeLog2, &tileRowStart, &tileRowEnd);
+        picture_control_set_ptr->entropy_coding_tile_in_progress[*tileIndex] = EB_FALSE;
 
-        while (picture_control_set_ptr->entropy_coding_row_array[picture_control_set_ptr->entropy_coding_current_available_row] == EB_TRUE &&
-            picture_control_set_ptr->entropy_coding_current_available_row < picture_control_set_ptr->entropy_coding_row_count)
+        if (picture_control_set_ptr->entropy_coding_tile_coded_rows[*tileIndex] == tileRowEnd - tileRowStart &&
+            ++picture_control_set_ptr->entropy_coding_tile_done_count == tile_count)
         {
-            ++picture_control_set_ptr->entropy_coding_current_available_row;
+            *pictureCompleteFlag = EB_TRUE;
         }
     }
 
-    // Release in_progress token
-    if (*initialProcessCall == EB_FALSE && picture_control_set_ptr->entropy_coding_in_progress == EB_TRUE) {
-        picture_control_set_ptr->entropy_coding_in_progress = EB_FALSE;
-    }
+    // Test if the next LCU-row of a tile not currently being worked on by another process is ready to go
+    for (tileItr = 0; tileItr < tile_count && processNextRow == EB_FALSE; ++tileItr) {
+        const uint32_t tile_idx = (*tileIndex + tileItr) % tile_count;
+        uint32_t nextRow;
 
-    // Test if the picture is not already complete AND not currently being worked on by another ENCDEC process
-    if (picture_control_set_ptr->entropy_coding_current_row < picture_control_set_ptr->entropy_coding_row_count &&
-        picture_control_set_ptr->entropy_coding_row_array[picture_control_set_ptr->entropy_coding_current_row] == EB_TRUE &&
-        picture_control_set_ptr->entropy_coding_in_progress == EB_FALSE)
-    {
-        // Test if the next LCU-row is ready to go
-        if (picture_control_set_ptr->entropy_coding_current_row <= picture_control_set_ptr->entropy_coding_current_available_row)
+        EntropyCodingTileRows(picture_control_set_ptr, tile_idx, mibSizeLog2, &tileRowStart, &tileRowEnd);
+        nextRow = tileRowStart + picture_control_set_ptr->entropy_coding_tile_coded_rows[tile_idx];
+
+        if (picture_control_set_ptr->entropy_coding_tile_in_progress[tile_idx] == EB_FALSE &&
+            nextRow < tileRowEnd &&
+            picture_control_set_ptr->entropy_coding_row_array[nextRow] == EB_TRUE)
         {
-            picture_control_set_ptr->entropy_coding_in_progress = EB_TRUE;
-            *rowIndex = picture_control_set_ptr->entropy_coding_current_row++;
+            picture_control_set_ptr->entropy_coding_tile_in_progress[tile_idx] = EB_TRUE;
+            ++picture_control_set_ptr->entropy_coding_tile_coded_rows[tile_idx];
+            *rowIndex = nextRow;
+            *tileIndex = tile_idx;
             processNextRow = EB_TRUE;
         }
     }
@@ -440,8 +516,16 @@ void* EntropyCodingKernel(void *input_ptr)
     uint32_t                                   sb_origin_y;
     EbBool                                  lastLcuFlag;
     uint32_t                                   picture_width_in_sb;
+    // Tile variables
+    uint32_t                                   tile_idx;
+    TileInfo                                   tile;
+    uint32_t                                   tileSbStartX;
+    uint32_t                                   tileSbEndX;
+    uint32_t                                   tileSbStartY;
+    uint32_t                                   tileSbEndY;
     // Variables
     EbBool                                  initialProcessCall;
+    EbBool                                  pictureCompleteFlag;
     for (;;) {
 
         // Get Mode Decision Results
@@ -451,6 +535,7 @@ void* EntropyCodingKernel(void *input_ptr)
         encDecResultsPtr = (EncDecResults_t*)encDecResultsWrapperPtr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)encDecResultsPtr->pictureControlSetWrapperPtr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
         lastLcuFlag = EB_FALSE;
 
         // SB Constants
@@ -462,22 +547,41 @@ void* EntropyCodingKernel(void *input_ptr)
         picture_width_in_sb = (sequence_control_set_ptr->luma_width + sb_sz - 1) >> lcuSizeLog2;
         {
             initialProcessCall = EB_TRUE;
+            pictureCompleteFlag = EB_FALSE;
             yLcuIndex = encDecResultsPtr->completedLcuRowIndexStart;
 
             // LCU-loops
-            while (UpdateEntropyCodingRows(picture_control_set_ptr, &yLcuIndex, encDecResultsPtr->completedLcuRowCount, &initialProcessCall) == EB_TRUE)
+            while (UpdateEntropyCodingRows(picture_control_set_ptr, &yLcuIndex, &tile_idx, encDecResultsPtr->completedLcuRowCount, sequence_control_set_ptr->mib_size_log2, &initialProcessCall, &pictureCompleteFlag) == EB_TRUE)
             {
                 uint32_t rowTotalBits = 0;
-
-                if (yLcuIndex == 0) {
-                    ResetEntropyCodingPicture(
+                uint64_t rowQuantizedCoeffBits = 0;
+                EbBool   rowComplete;
+
+                av1_tile_init(
+                    &tile,
+                    &picture_control_set_ptr->parent_pcs_ptr->av1_cm->tiles_info,
+                    tile_idx / picture_control_set_ptr->tile_column_count,
+                    tile_idx % picture_control_set_ptr->tile_column_count);
+                tileSbStartX = tile.mi_col_start >> sequence_control_set_ptr->mib_size_log2;
+                tileSbEndX = (tile.mi_col_end + sequence_control_set_ptr->mib_size - 1) >> sequence_control_set_ptr->mib_size_log2;
+                tileSbStartY = tile.mi_row_start >> sequence_control_set_ptr->mib_size_log2;
+                tileSbEndY = (tile.mi_row_end + sequence_control_set_ptr->mib_size - 1) >> sequence_control_set_ptr->mib_size_log2;
+                context_ptr->tile_idx = tile_idx;
+
+                if (yLcuIndex == tileSbStartY) {
+                    if (tile_idx == 0) {
+                        ResetEntropyCodingPicture(
+                            picture_control_set_ptr);
+                    }
+                    ResetEntropyCodingTile(
                         context_ptr,
                         picture_control_set_ptr,
-                        sequence_control_set_ptr);
-                    picture_control_set_ptr->entropy_coding_pic_done = EB_FALSE;
+                        sequence_control_set_ptr,
+                        tile_idx,
+                        &tile);
                 }
 
-                for (xLcuIndex = 0; xLcuIndex < picture_width_in_sb; ++xLcuIndex)
+                for (xLcuIndex = tileSbStartX; xLcuIndex < tileSbEndX; ++xLcuIndex)
                 {
 
 
@@ -489,6 +593,7 @@ void* EntropyCodingKernel(void *input_ptr)
                     context_ptr->sb_origin_x = sb_origin_x;
                     context_ptr->sb_origin_y = sb_origin_y;
                     lastLcuFlag = (sb_index == sequence_control_set_ptr->sb_tot_cnt - 1) ? EB_TRUE : EB_FALSE;
+
                     // Configure the LCU
                     EntropyCodingConfigureLcu(
                         context_ptr,
@@ -508,10 +613,26 @@ void* EntropyCodingKernel(void *input_ptr)
                         0);
 
                     rowTotalBits += sb_ptr->total_bits;
+                    rowQuantizedCoeffBits += sb_ptr->quantized_coeffs_bits;
+                }
+
+                // At the end of the tile, terminate its bitstream
+                if (yLcuIndex == tileSbEndY - 1) {
+                    CHECK_REPORT_ERROR(
+                        (EncodeSliceFinish(picture_control_set_ptr->tile_entropy_coder_ptr_array[tile_idx]) == EB_ErrorNone),
+                        sequence_control_set_ptr->encode_context_ptr->app_callback_ptr,
+                        EB_ENC_EC_ERROR17);
                 }
 
+                EbBlockOnMutex(picture_control_set_ptr->entropy_coding_mutex);
+                picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += rowQuantizedCoeffBits;
+                picture_control_set_ptr->entropy_coding_row_bits[yLcuIndex] += rowTotalBits;
+                rowTotalBits = picture_control_set_ptr->entropy_coding_row_bits[yLcuIndex];
+                rowComplete = (++picture_control_set_ptr->entropy_coding_row_tile_done_count[yLcuIndex] == picture_control_set_ptr->tile_column_count) ? EB_TRUE : EB_FALSE;
+                EbReleaseMutex(picture_control_set_ptr->entropy_coding_mutex);
+
                 // At the end of each LCU-row, send the updated bit-count to Entropy Coding
-                {
+                if (rowComplete) {
                     EbObjectWrapper_t *rateControlTaskWrapperPtr;
                     RateControlTasks_t *rateControlTaskPtr;
 
@@ -532,51 +653,39 @@ void* EntropyCodingKernel(void *input_ptr)
                     EbPostFullObject(rateControlTaskWrapperPtr);
                 }
 
-                EbBlockOnMutex(picture_control_set_ptr->entropy_coding_mutex);
-                if (picture_control_set_ptr->entropy_coding_pic_done == EB_FALSE) {
-
-                    // If the picture is complete, terminate the slice
-                    if (picture_control_set_ptr->entropy_coding_current_row == picture_control_set_ptr->entropy_coding_row_count)
-                    {
-                        uint32_t refIdx;
-
-                        picture_control_set_ptr->entropy_coding_pic_done = EB_TRUE;
-
-                        EncodeSliceFinish(picture_control_set_ptr->entropy_coder_ptr);
-
-                        // Release the List 0 Reference Pictures
-                        for (refIdx = 0; refIdx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++refIdx) {
-                            if (picture_control_set_ptr->ref_pic_ptr_array[0] != EB_NULL) {
-
-                                EbReleaseObject(picture_control_set_ptr->ref_pic_ptr_array[0]);
-                            }
-                        }
+            }
 
-                        // Release the List 1 Reference Pictures
-                        for (refIdx = 0; refIdx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++refIdx) {
-                            if (picture_control_set_ptr->ref_pic_ptr_array[1] != EB_NULL) {
+            // If the picture is complete, terminate the slice
+            if (pictureCompleteFlag) {
+                uint32_t refIdx;
 
-                                EbReleaseObject(picture_control_set_ptr->ref_pic_ptr_array[1]);
-                            }
-                        }
+                // Release the List 0 Reference Pictures
+                for (refIdx = 0; refIdx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++refIdx) {
+                    if (picture_control_set_ptr->ref_pic_ptr_array[0] != EB_NULL) {
 
-                        // Get Empty Entropy Coding Results
-                        EbGetEmptyObject(
-                            context_ptr->entropy_coding_output_fifo_ptr,
-                            &entropyCodingResultsWrapperPtr);
-                        entropyCodingResultsPtr = (EntropyCodingResults_t*)entropyCodingResultsWrapperPtr->objectPtr;
-                        entropyCodingResultsPtr->pictureControlSetWrapperPtr = encDecResultsPtr->pictureControlSetWrapperPtr;
+                        EbReleaseObject(picture_control_set_ptr->ref_pic_ptr_array[0]);
+                    }
+                }
 
-                        // Post EntropyCoding Results
-                        EbPostFullObject(entropyCodingResultsWrapperPtr);
+                // Release the List 1 Reference Pictures
+                for (refIdx = 0; refIdx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++refIdx) {
+                    if (picture_control_set_ptr->ref_pic_ptr_array[1] != EB_NULL) {
 
-                    } // End if(PictureCompleteFlag)
+                        EbReleaseObject(picture_control_set_ptr->ref_pic_ptr_array[1]);
+                    }
                 }
-                EbReleaseMutex(picture_control_set_ptr->entropy_coding_mutex);
 
+                // Get Empty Entropy Coding Results
+                EbGetEmptyObject(
+                    context_ptr->entropy_coding_output_fifo_ptr,
+                    &entropyCodingResultsWrapperPtr);
+                entropyCodingResultsPtr = (EntropyCodingResults_t*)entropyCodingResultsWrapperPtr->objectPtr;
+                entropyCodingResultsPtr->pictureControlSetWrapperPtr = encDecResultsPtr->pictureControlSetWrapperPtr;
 
-            }
+                // Post EntropyCoding Results
+                EbPostFullObject(entropyCodingResultsWrapperPtr);
 
+            } // End if(PictureCompleteFlag)
         }
         // Release Mode Decision Results
         EbReleaseObject(encDecResultsWrapperPtr);
@@ -52,6 +52,8 @@ typedef struct EntropyCodingContext_s
     uint32_t                          cu_origin_y;
     uint32_t                          sb_origin_x;
     uint32_t                          sb_origin_y;
+    uint32_t                          tile_idx;        // tile of the SB being coded, in raster order
+    int32_t                           cdef_preset[4];  // cdef strength already signalled for each 64x64 of the SB
     uint32_t                          pu_itr;
     PredictionUnit_t                 *pu_ptr;
     const PredictionUnitStats_t      *pu_stats;
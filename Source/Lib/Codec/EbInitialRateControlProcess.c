@@ -1683,6 +1683,7 @@ void* InitialRateControlKernel(void *input_ptr)
         picture_control_set_ptr = (PictureParentControlSet_t*)inputResultsPtr->pictureControlSetWrapperPtr->objectPtr;
 
         segment_index = inputResultsPtr->segment_index;
+        EbTracePicture(picture_control_set_ptr->picture_number, segment_index);
 
         // Set the segment mask
         SEGMENT_COMPLETION_MASK_SET(picture_control_set_ptr->me_segments_completion_mask, segment_index);
@@ -1881,8 +1882,8 @@ void* InitialRateControlKernel(void *input_ptr)
 
                         queueEntryIndexTemp2 = (queueEntryIndexTemp > INITIAL_RATE_CONTROL_REORDER_QUEUE_MAX_DEPTH - 1) ? queueEntryIndexTemp - INITIAL_RATE_CONTROL_REORDER_QUEUE_MAX_DEPTH : queueEntryIndexTemp;
                         pictureControlSetPtrTemp = ((PictureParentControlSet_t*)(encode_context_ptr->initial_rate_control_reorder_queue[queueEntryIndexTemp2]->parentPcsWrapperPtr)->objectPtr);
-                        if (sequence_control_set_ptr->intra_period_length != -1) {
-                            if (picture_control_set_ptr->picture_number % ((sequence_control_set_ptr->intra_period_length + 1)) == 0) {
+                        if (picture_control_set_ptr->intra_period_length != -1) {
+                            if ((picture_control_set_ptr->picture_number - picture_control_set_ptr->intra_period_start) % ((picture_control_set_ptr->intra_period_length + 1)) == 0) {
                                 picture_control_set_ptr->frames_in_interval[pictureControlSetPtrTemp->temporal_layer_index] ++;
                                 if (pictureControlSetPtrTemp->scene_change_flag)
                                     picture_control_set_ptr->scene_change_in_gop = EB_TRUE;
@@ -879,9 +879,11 @@ void av1_highbd_jnt_convolve_2d_c(const uint16_t *src, int32_t src_stride,
     }
 }
 
-aom_highbd_convolve_fn_t convolveHbd[/*subX*/2][/*subY*/2][/*bi*/2];
+// Fills the convolve tables of the dispatch table bound to the calling thread
 void asmSetConvolveHbdAsmTable(void)
 {
+    aom_highbd_convolve_fn_t (*convolveHbd)[2][2] = currentDispatchTablePtr->convolveHbd;
+
     convolveHbd[0][0][0] = av1_highbd_convolve_2d_copy_sr;
     convolveHbd[0][0][1] = av1_highbd_jnt_convolve_2d_copy;
 
@@ -895,9 +897,10 @@ void asmSetConvolveHbdAsmTable(void)
     convolveHbd[1][1][1] = av1_highbd_jnt_convolve_2d;
 }
 
-aom_convolve_fn_t convolve[/*subX*/2][/*subY*/2][/*bi*/2];
 void asmSetConvolveAsmTable(void)
 {
+    aom_convolve_fn_t (*convolve)[2][2] = currentDispatchTablePtr->convolve;
+
     convolve[0][0][0] = av1_convolve_2d_copy_sr;
     convolve[0][0][1] = av1_jnt_convolve_2d_copy;
 
@@ -1191,7 +1194,7 @@ EbErrorType av1_inter_prediction(
                         &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
 
-                    convolve[subpel_x != 0][subpel_y != 0][is_compound](
+                    currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                         srcPtr,
                         src_stride,
                         dstPtr,
@@ -1225,7 +1228,7 @@ EbErrorType av1_inter_prediction(
                     av1_get_convolve_filter_params(interp_filters, &filter_params_x,
                         &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
-                    convolve[subpel_x != 0][subpel_y != 0][is_compound](
+                    currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                         srcPtr,
                         src_stride,
                         dstPtr,
@@ -1272,7 +1275,7 @@ EbErrorType av1_inter_prediction(
         av1_get_convolve_filter_params(interp_filters, &filter_params_x,
             &filter_params_y, bwidth, bheight);
 
-        convolve[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
             srcPtr,
             src_stride,
             dstPtr,
@@ -1303,7 +1306,7 @@ EbErrorType av1_inter_prediction(
             av1_get_convolve_filter_params(interp_filters, &filter_params_x,
                 &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -1328,7 +1331,7 @@ EbErrorType av1_inter_prediction(
             subpel_y = mv_q4.row & SUBPEL_MASK;
             srcPtr = srcPtr + (mv_q4.row >> SUBPEL_BITS) * src_stride + (mv_q4.col >> SUBPEL_BITS);
             conv_params = get_conv_params_no_round(0, 0, 0, tmp_dstCr, 64, is_compound, EB_8BIT);
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -1363,7 +1366,7 @@ EbErrorType av1_inter_prediction(
         av1_get_convolve_filter_params(interp_filters, &filter_params_x,
             &filter_params_y, bwidth, bheight);
 
-        convolve[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
             srcPtr,
             src_stride,
             dstPtr,
@@ -1395,7 +1398,7 @@ EbErrorType av1_inter_prediction(
                 &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -1419,7 +1422,7 @@ EbErrorType av1_inter_prediction(
             subpel_y = mv_q4.row & SUBPEL_MASK;
             srcPtr = srcPtr + (mv_q4.row >> SUBPEL_BITS) * src_stride + (mv_q4.col >> SUBPEL_BITS);
             conv_params = get_conv_params_no_round(0, (mv_unit->predDirection == BI_PRED) ? 1 : 0, 0, tmp_dstCr, 64, is_compound, EB_8BIT);
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -1681,7 +1684,7 @@ EbErrorType AV1MDInterPrediction(
                         asm_type,
                         8);
 
-                    convolve[subpel_x != 0][subpel_y != 0][is_compound](
+                    currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                         local_buffer->bufferCb + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl1->strideCb),
                         local_buffer->strideCb,
                         dstPtr,
@@ -1728,7 +1731,7 @@ EbErrorType AV1MDInterPrediction(
                         asm_type,
                         8);
 
-                    convolve[subpel_x != 0][subpel_y != 0][is_compound](
+                    currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                         local_buffer->bufferCr + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl1->strideCr),
                         local_buffer->strideCr,
                         dstPtr,
@@ -1789,7 +1792,7 @@ EbErrorType AV1MDInterPrediction(
             asm_type,
             16);
 
-        convolve[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
             context_ptr->mcp_context->local_reference_block8_bitl0->bufferY + 8 + (8 * context_ptr->mcp_context->local_reference_block8_bitl0->strideY),
             context_ptr->mcp_context->local_reference_block8_bitl0->strideY,
             dstPtr,
@@ -1837,7 +1840,7 @@ EbErrorType AV1MDInterPrediction(
                 asm_type,
                 8);
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 context_ptr->mcp_context->local_reference_block8_bitl0->bufferCb + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl0->strideCb),
                 context_ptr->mcp_context->local_reference_block8_bitl0->strideCb,
                 dstPtr,
@@ -1879,7 +1882,7 @@ EbErrorType AV1MDInterPrediction(
                 asm_type,
                 8);
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 context_ptr->mcp_context->local_reference_block8_bitl0->bufferCr + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl1->strideCr),
                 context_ptr->mcp_context->local_reference_block8_bitl0->strideCr,
                 dstPtr,
@@ -1937,7 +1940,7 @@ EbErrorType AV1MDInterPrediction(
             asm_type,
             16);
 
-        convolve[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
             context_ptr->mcp_context->local_reference_block8_bitl1->bufferY + 8 + (8 * context_ptr->mcp_context->local_reference_block8_bitl1->strideY),
             context_ptr->mcp_context->local_reference_block8_bitl1->strideY,
             dstPtr,
@@ -1984,7 +1987,7 @@ EbErrorType AV1MDInterPrediction(
                 asm_type,
                 8);
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 context_ptr->mcp_context->local_reference_block8_bitl1->bufferCb + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl1->strideCb),
                 context_ptr->mcp_context->local_reference_block8_bitl1->strideCb,
                 dstPtr,
@@ -2024,7 +2027,7 @@ EbErrorType AV1MDInterPrediction(
                 asm_type,
                 8);
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 context_ptr->mcp_context->local_reference_block8_bitl1->bufferCr + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl1->strideCr),
                 context_ptr->mcp_context->local_reference_block8_bitl1->strideCr,
                 dstPtr,
@@ -2236,7 +2239,7 @@ EbErrorType av1_inter_prediction_hbd(
                         &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
 
-                    convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+                    currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                         srcPtr,
                         src_stride,
                         dstPtr,
@@ -2270,7 +2273,7 @@ EbErrorType av1_inter_prediction_hbd(
                     av1_get_convolve_filter_params(cu_ptr->interp_filters, &filter_params_x,
                         &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
-                    convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+                    currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                         srcPtr,
                         src_stride,
                         dstPtr,
@@ -2320,7 +2323,7 @@ EbErrorType av1_inter_prediction_hbd(
             &filter_params_y, bwidth, bheight);
 #endif
 
-        convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
             srcPtr,
             src_stride,
             dstPtr,
@@ -2356,7 +2359,7 @@ EbErrorType av1_inter_prediction_hbd(
             av1_get_convolve_filter_params(cu_ptr->interp_filters, &filter_params_x,
                 &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
-            convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2386,7 +2389,7 @@ EbErrorType av1_inter_prediction_hbd(
             subpel_y = mv_q4.row & SUBPEL_MASK;
             srcPtr = srcPtr + (mv_q4.row >> SUBPEL_BITS) * src_stride + (mv_q4.col >> SUBPEL_BITS);
             conv_params = get_conv_params_no_round(0, 0, 0, tmp_dstCr, 64, is_compound, bit_depth);
-            convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2431,7 +2434,7 @@ EbErrorType av1_inter_prediction_hbd(
             &filter_params_y, bwidth, bheight);
 #endif
 
-        convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
             srcPtr,
             src_stride,
             dstPtr,
@@ -2467,7 +2470,7 @@ EbErrorType av1_inter_prediction_hbd(
                 &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 #endif
 
-            convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2497,7 +2500,7 @@ EbErrorType av1_inter_prediction_hbd(
             subpel_y = mv_q4.row & SUBPEL_MASK;
             srcPtr = srcPtr + (mv_q4.row >> SUBPEL_BITS) * src_stride + (mv_q4.col >> SUBPEL_BITS);
             conv_params = get_conv_params_no_round(0, (mv_unit->predDirection == BI_PRED) ? 1 : 0, 0, tmp_dstCr, 64, is_compound, bit_depth);
-            convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2668,7 +2671,7 @@ EbErrorType warped_motion_prediction(
             av1_get_convolve_filter_params(interp_filters, &filter_params_x,
                 &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2692,7 +2695,7 @@ EbErrorType warped_motion_prediction(
             subpel_y = mv_q4.row & SUBPEL_MASK;
             srcPtr = srcPtr + (mv_q4.row >> SUBPEL_BITS) * src_stride + (mv_q4.col >> SUBPEL_BITS);
             conv_params = get_conv_params_no_round(0, 0, 0, tmp_dstCr, 64, is_compound, EB_8BIT);
-            convolve[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2816,7 +2819,7 @@ EbErrorType warped_motion_prediction(
             av1_get_convolve_filter_params(interp_filters, &filter_params_x,
                 &filter_params_y, blk_geom->bwidth_uv, blk_geom->bheight_uv);
 
-            convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -2841,7 +2844,7 @@ EbErrorType warped_motion_prediction(
             subpel_y = mv_q4.row & SUBPEL_MASK;
             srcPtr = srcPtr + (mv_q4.row >> SUBPEL_BITS) * src_stride + (mv_q4.col >> SUBPEL_BITS);
             conv_params = get_conv_params_no_round(0, 0, 0, tmp_dstCr, 64, is_compound, bit_depth);
-            convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
+            currentDispatchTablePtr->convolveHbd[subpel_x != 0][subpel_y != 0][is_compound](
                 srcPtr,
                 src_stride,
                 dstPtr,
@@ -3045,7 +3048,7 @@ EbErrorType warped_motion_prediction_md(
             asm_type,
             8);
 
-        convolve[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
             context_ptr->mcp_context->local_reference_block8_bitl0->bufferCb + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl0->strideCb),
             context_ptr->mcp_context->local_reference_block8_bitl0->strideCb,
             dstPtr,
@@ -3081,7 +3084,7 @@ EbErrorType warped_motion_prediction_md(
             asm_type,
             8);
 
-        convolve[subpel_x != 0][subpel_y != 0][is_compound](
+        currentDispatchTablePtr->convolve[subpel_x != 0][subpel_y != 0][is_compound](
             context_ptr->mcp_context->local_reference_block8_bitl0->bufferCr + 4 + (4 * context_ptr->mcp_context->local_reference_block8_bitl1->strideCr),
             context_ptr->mcp_context->local_reference_block8_bitl0->strideCr,
             dstPtr,
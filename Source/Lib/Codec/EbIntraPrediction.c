@@ -5965,16 +5965,6 @@ static int32_t has_bottom_left(const Av1Common *cm, BlockSize bsize, int32_t mi_
 
 
 
-static intra_pred_fn pred[INTRA_MODES][TX_SIZES_ALL];
-static intra_pred_fn dc_pred[2][2][TX_SIZES_ALL];
-
-#if INTRA_10BIT_SUPPORT
-static intra_high_pred_fn pred_high[INTRA_MODES][TX_SIZES_ALL];
-static intra_high_pred_fn dc_pred_high[2][2][TX_SIZES_ALL];
-#endif
-
-
-
 static INLINE void dc_128_predictor(uint8_t *dst, ptrdiff_t stride, int32_t bw,
     int32_t bh, const uint8_t *above,
     const uint8_t *left) {
@@ -6904,7 +6894,14 @@ void init_intra_dc_predictors_c_internal(void)
 }
 
 
+// Fills the predictor tables of the dispatch table bound to the calling thread
 /*static*/ void init_intra_predictors_internal(void) {
+    intra_pred_fn (*pred)[TX_SIZES_ALL] = currentDispatchTablePtr->pred;
+    intra_pred_fn (*dc_pred)[2][TX_SIZES_ALL] = currentDispatchTablePtr->dc_pred;
+#if INTRA_10BIT_SUPPORT
+    intra_high_pred_fn (*pred_high)[TX_SIZES_ALL] = currentDispatchTablePtr->pred_high;
+    intra_high_pred_fn (*dc_pred_high)[2][TX_SIZES_ALL] = currentDispatchTablePtr->dc_pred_high;
+#endif
 
 #if DISABLE_INTRA_PRED_INTRINSIC
 #if INTRA_ASM
@@ -8010,10 +8007,10 @@ static void dr_predictor(uint8_t *dst, ptrdiff_t stride, TxSize tx_size,
             dy);
     }
     else if (angle == 90) {
-        pred[V_PRED][tx_size](dst, stride, above, left);
+        currentDispatchTablePtr->pred[V_PRED][tx_size](dst, stride, above, left);
     }
     else if (angle == 180) {
-        pred[H_PRED][tx_size](dst, stride, above, left);
+        currentDispatchTablePtr->pred[H_PRED][tx_size](dst, stride, above, left);
     }
 }
 
@@ -8167,10 +8164,10 @@ static void highbd_dr_predictor(uint16_t *dst, ptrdiff_t stride,
             dx, dy, bd);
     }
     else if (angle == 90) {
-        pred_high[V_PRED][tx_size](dst, stride, above, left, bd);
+        currentDispatchTablePtr->pred_high[V_PRED][tx_size](dst, stride, above, left, bd);
     }
     else if (angle == 180) {
-        pred_high[H_PRED][tx_size](dst, stride, above, left, bd);
+        currentDispatchTablePtr->pred_high[H_PRED][tx_size](dst, stride, above, left, bd);
     }
 }
 
@@ -8470,11 +8467,11 @@ static void build_intra_predictors_md(
 
     // predict
     if (mode == DC_PRED) {
-        dc_pred[n_left_px > 0][n_top_px > 0][tx_size](dst, dst_stride, above_row,
+        currentDispatchTablePtr->dc_pred[n_left_px > 0][n_top_px > 0][tx_size](dst, dst_stride, above_row,
             left_col);
     }
     else {
-        pred[mode][tx_size](dst, dst_stride, above_row, left_col);
+        currentDispatchTablePtr->pred[mode][tx_size](dst, dst_stride, above_row, left_col);
     }
 }
 
@@ -8644,8 +8641,9 @@ void generate_intra_reference_samples(
         int32_t mirow = bl_org_y_pict >> 2;
         int32_t micol = bl_org_x_pict >> 2;
 
-        xd->up_available = (mirow > 0);
-        xd->left_available = (micol > 0);
+        xd->tile = md_context_ptr->sb_ptr->tile_info;
+        xd->up_available = (mirow > xd->tile.mi_row_start);
+        xd->left_available = (micol > xd->tile.mi_col_start);
         const int32_t bw = mi_size_wide[bsize];
         const int32_t bh = mi_size_high[bsize];
 
@@ -8653,10 +8651,6 @@ void generate_intra_reference_samples(
         xd->mb_to_bottom_edge = ((cm->mi_rows - bh - mirow) * MI_SIZE) * 8;
         xd->mb_to_left_edge = -((micol * MI_SIZE) * 8);
         xd->mb_to_right_edge = ((cm->mi_cols - bw - micol) * MI_SIZE) * 8;
-        xd->tile.mi_col_start = 0;
-        xd->tile.mi_col_end = cm->mi_cols;
-        xd->tile.mi_row_start = 0;
-        xd->tile.mi_row_end = cm->mi_rows;
         xd->n8_h = bh;
         xd->n8_w = bw;
         xd->is_sec_rect = 0;
@@ -8678,9 +8672,9 @@ void generate_intra_reference_samples(
 
 
         if (ss_x && bw < mi_size_wide[BLOCK_8X8])
-            chroma_left_available = (micol - 1) > 0;//tile->mi_col_start;
+            chroma_left_available = (micol - 1) > xd->tile.mi_col_start;
         if (ss_y && bh < mi_size_high[BLOCK_8X8])
-            chroma_up_available = (mirow - 1) > 0;//tile->mi_row_start;
+            chroma_up_available = (mirow - 1) > xd->tile.mi_row_start;
 
 
         //CHKN  const MbModeInfo *const mbmi = xd->mi[0];
@@ -9071,11 +9065,11 @@ static void build_intra_predictors(
 
     // predict
     if (mode == DC_PRED) {
-        dc_pred[n_left_px > 0][n_top_px > 0][tx_size](dst, dst_stride, above_row,
+        currentDispatchTablePtr->dc_pred[n_left_px > 0][n_top_px > 0][tx_size](dst, dst_stride, above_row,
             left_col);
     }
     else {
-        pred[mode][tx_size](dst, dst_stride, above_row, left_col);
+        currentDispatchTablePtr->pred[mode][tx_size](dst, dst_stride, above_row, left_col);
     }
 }
 #if INTRA_10BIT_SUPPORT
@@ -9305,12 +9299,12 @@ static void build_intra_predictors_high(
     // predict
     if (mode == DC_PRED) {
 
-        dc_pred_high[n_left_px > 0][n_top_px > 0][tx_size](
+        currentDispatchTablePtr->dc_pred_high[n_left_px > 0][n_top_px > 0][tx_size](
             dst, dst_stride, above_row, left_col, bd);
 
     }
     else {
-        pred_high[mode][tx_size](dst, dst_stride, above_row, left_col, bd);
+        currentDispatchTablePtr->pred_high[mode][tx_size](dst, dst_stride, above_row, left_col, bd);
     }
 }
 #endif
@@ -9344,8 +9338,9 @@ extern void av1_predict_intra_block_md(
     MacroBlockD *xd = &xdS;
     int32_t mirow = cuOrgY >> 2;
     int32_t micol = cuOrgX >> 2;
-    xd->up_available = (mirow > 0);
-    xd->left_available = (micol > 0);
+    xd->tile = cu_ptr->sb_ptr->tile_info;
+    xd->up_available = (mirow > xd->tile.mi_row_start);
+    xd->left_available = (micol > xd->tile.mi_col_start);
     const int32_t bw = mi_size_wide[bsize];
     const int32_t bh = mi_size_high[bsize];
 
@@ -9359,10 +9354,6 @@ extern void av1_predict_intra_block_md(
     xd->mb_to_bottom_edge = ((cm->mi_rows - bh - mirow) * MI_SIZE) * 8;
     xd->mb_to_left_edge = -((micol * MI_SIZE) * 8);
     xd->mb_to_right_edge = ((cm->mi_cols - bw - micol) * MI_SIZE) * 8;
-    xd->tile.mi_col_start = 0;
-    xd->tile.mi_col_end = cm->mi_cols;
-    xd->tile.mi_row_start = 0;
-    xd->tile.mi_row_end = cm->mi_rows;
     xd->n8_h = bh;
     xd->n8_w = bw;
     xd->is_sec_rect = 0;
@@ -9520,6 +9511,7 @@ extern void av1_predict_intra_block(
     uint8_t    intra_chroma_left_mode,
     uint8_t    intra_chroma_top_mode,
     const BlockGeom            * blk_geom,
+    const TileInfo             * tile,
     const Av1Common *cm,
     int32_t wpx,
     int32_t hpx,
@@ -9568,8 +9560,8 @@ extern void av1_predict_intra_block(
     int32_t mirow = bl_org_y_pict >> 2;
     int32_t micol = bl_org_x_pict >> 2;
 #if INTRA_CORE_OPT
-    int32_t up_available = (mirow > 0);
-    int32_t left_available = (micol > 0);
+    int32_t up_available = (mirow > tile->mi_row_start);
+    int32_t left_available = (micol > tile->mi_col_start);
     const int32_t bw = mi_size_wide[bsize];
     const int32_t bh = mi_size_high[bsize];
 
@@ -9578,13 +9570,13 @@ extern void av1_predict_intra_block(
     int32_t mb_to_left_edge = -((micol * MI_SIZE) * 8);
     int32_t mb_to_right_edge = ((cm->mi_cols - bw - micol) * MI_SIZE) * 8;
 
-    // OMK to be changed in case of tiles
-    int32_t  tile_mi_col_end = cm->mi_cols;       //  xd->tile.mi_col_end = cm->mi_cols;
-    int32_t  tile_mi_row_end = cm->mi_rows;       //  xd->tile.mi_row_end = cm->mi_rows;
+    int32_t  tile_mi_col_end = tile->mi_col_end;
+    int32_t  tile_mi_row_end = tile->mi_row_end;
 
 #else
-    xd->up_available = (mirow > 0);
-    xd->left_available = (micol > 0);
+    xd->tile = *tile;
+    xd->up_available = (mirow > xd->tile.mi_row_start);
+    xd->left_available = (micol > xd->tile.mi_col_start);
     const int32_t bw = mi_size_wide[bsize];
     const int32_t bh = mi_size_high[bsize];
 
@@ -9592,10 +9584,6 @@ extern void av1_predict_intra_block(
     xd->mb_to_bottom_edge = ((cm->mi_rows - bh - mirow) * MI_SIZE) * 8;
     xd->mb_to_left_edge = -((micol * MI_SIZE) * 8);
     xd->mb_to_right_edge = ((cm->mi_cols - bw - micol) * MI_SIZE) * 8;
-    xd->tile.mi_col_start = 0;
-    xd->tile.mi_col_end = cm->mi_cols;
-    xd->tile.mi_row_start = 0;
-    xd->tile.mi_row_end = cm->mi_rows;
     xd->n8_h = bh;
     xd->n8_w = bw;
     xd->is_sec_rect = 0;
@@ -9638,9 +9626,9 @@ extern void av1_predict_intra_block(
 
 
     if (ss_x && bw < mi_size_wide[BLOCK_8X8])
-        chroma_left_available = (micol - 1) > 0;//tile->mi_col_start;
+        chroma_left_available = (micol - 1) > tile->mi_col_start;
     if (ss_y && bh < mi_size_high[BLOCK_8X8])
-        chroma_up_available = (mirow - 1) > 0;//tile->mi_row_start;
+        chroma_up_available = (mirow - 1) > tile->mi_row_start;
 
 
     //CHKN  const MbModeInfo *const mbmi = xd->mi[0];
@@ -9869,8 +9857,9 @@ void av1_predict_intra_block_16bit(
     int32_t mirow = bl_org_y_pict >> 2;
     int32_t micol = bl_org_x_pict >> 2;
 
-    xd->up_available = (mirow > 0);
-    xd->left_available = (micol > 0);
+    xd->tile = context_ptr->md_context->sb_ptr->tile_info;
+    xd->up_available = (mirow > xd->tile.mi_row_start);
+    xd->left_available = (micol > xd->tile.mi_col_start);
     const int32_t bw = mi_size_wide[bsize];
     const int32_t bh = mi_size_high[bsize];
 
@@ -9878,10 +9867,6 @@ void av1_predict_intra_block_16bit(
     xd->mb_to_bottom_edge = ((cm->mi_rows - bh - mirow) * MI_SIZE) * 8;
     xd->mb_to_left_edge = -((micol * MI_SIZE) * 8);
     xd->mb_to_right_edge = ((cm->mi_cols - bw - micol) * MI_SIZE) * 8;
-    xd->tile.mi_col_start = 0;
-    xd->tile.mi_col_end = cm->mi_cols;
-    xd->tile.mi_row_start = 0;
-    xd->tile.mi_row_end = cm->mi_rows;
 
     xd->n8_h = bh;
     xd->n8_w = bw;
@@ -9922,9 +9907,9 @@ void av1_predict_intra_block_16bit(
 
 
     if (ss_x && bw < mi_size_wide[BLOCK_8X8])
-        chroma_left_available = (micol - 1) > 0;//tile->mi_col_start;
+        chroma_left_available = (micol - 1) > xd->tile.mi_col_start;
     if (ss_y && bh < mi_size_high[BLOCK_8X8])
-        chroma_up_available = (mirow - 1) > 0;//tile->mi_row_start;
+        chroma_up_available = (mirow - 1) > xd->tile.mi_row_start;
 
     //CHKN  const MbModeInfo *const mbmi = xd->mi[0];
     const int32_t txwpx = tx_size_wide[tx_size];
@@ -10142,6 +10127,7 @@ EbErrorType AV1IntraPredictionCL(
             md_context_ptr->intra_chroma_left_mode,
             md_context_ptr->intra_chroma_top_mode,
             md_context_ptr->blk_geom,
+            &md_context_ptr->sb_ptr->tile_info,
             picture_control_set_ptr->parent_pcs_ptr->av1_cm,                                      //const Av1Common *cm,
             plane ? md_context_ptr->blk_geom->bwidth_uv : md_context_ptr->blk_geom->bwidth,          //int32_t wpx,
             plane ? md_context_ptr->blk_geom->bheight_uv : md_context_ptr->blk_geom->bheight,          //int32_t hpx,
@@ -2625,6 +2625,7 @@ void* ModeDecisionConfigurationKernel(void *input_ptr)
         rateControlResultsPtr = (RateControlResults_t*)rateControlResultsWrapperPtr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)rateControlResultsPtr->pictureControlSetWrapperPtr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
       
         context_ptr->qp = picture_control_set_ptr->picture_qp;
 
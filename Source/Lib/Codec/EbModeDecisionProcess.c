@@ -194,6 +194,85 @@ void reset_mode_decision_neighbor_arrays(PictureControlSet_t *picture_control_se
     return;
 }
 
+/**************************************************
+ * Reset Mode Decision Tile Neighbor Arrays
+ *   Called for each SB, resets the context arrays
+ *   along the SB edges that lie on an inner tile
+ *   boundary, the same way EC starts each tile, so
+ *   that MD does not rate blocks with a context
+ *   taken from the tile on the left or above
+ *************************************************/
+void reset_mode_decision_tile_neighbor_arrays(
+    PictureControlSet_t *picture_control_set_ptr,
+    const TileInfo      *tile,
+    uint32_t             sb_origin_x,
+    uint32_t             sb_origin_y,
+    uint32_t             sb_sz)
+{
+    const EbBool resetLeft = (tile->mi_col_start && sb_origin_x == (uint32_t)tile->mi_col_start << MI_SIZE_LOG2) ? EB_TRUE : EB_FALSE;
+    const EbBool resetTop = (tile->mi_row_start && sb_origin_y == (uint32_t)tile->mi_row_start << MI_SIZE_LOG2) ? EB_TRUE : EB_FALSE;
+    uint8_t depth;
+
+    if (!resetLeft && !resetTop)
+        return;
+
+    for (depth = 0; depth < NEIGHBOR_ARRAY_TOTAL_COUNT; depth++) {
+        NeighborArrayUnit_t *modeNeighborArrays[] = {
+            picture_control_set_ptr->md_intra_luma_mode_neighbor_array[depth],
+            picture_control_set_ptr->md_mv_neighbor_array[depth],
+            picture_control_set_ptr->md_skip_flag_neighbor_array[depth],
+            picture_control_set_ptr->md_mode_type_neighbor_array[depth],
+            picture_control_set_ptr->md_leaf_depth_neighbor_array[depth],
+            picture_control_set_ptr->mdleaf_partition_neighbor_array[depth],
+            picture_control_set_ptr->md_skip_coeff_neighbor_array[depth],
+            picture_control_set_ptr->md_inter_pred_dir_neighbor_array[depth],
+            picture_control_set_ptr->md_ref_frame_type_neighbor_array[depth] };
+        NeighborArrayUnit_t *chromaNeighborArray = picture_control_set_ptr->md_intra_chroma_mode_neighbor_array[depth];
+        NeighborArrayUnit_t *dcSignNeighborArrays[] = {
+            picture_control_set_ptr->md_luma_dc_sign_level_coeff_neighbor_array[depth],
+            picture_control_set_ptr->md_cb_dc_sign_level_coeff_neighbor_array[depth],
+            picture_control_set_ptr->md_cr_dc_sign_level_coeff_neighbor_array[depth] };
+        uint32_t arrayIndex;
+
+        for (arrayIndex = 0; arrayIndex < sizeof(modeNeighborArrays) / sizeof(modeNeighborArrays[0]); ++arrayIndex) {
+            if (resetLeft)
+                NeighborArrayUnitResetRegion(modeNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_LEFT, sb_origin_y, sb_sz, (uint8_t)~0);
+            if (resetTop)
+                NeighborArrayUnitResetRegion(modeNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_TOP, sb_origin_x, sb_sz, (uint8_t)~0);
+        }
+        if (resetLeft)
+            NeighborArrayUnitResetRegion(chromaNeighborArray, NEIGHBOR_ARRAY_LEFT, sb_origin_y >> 1, sb_sz >> 1, (uint8_t)~0);
+        if (resetTop)
+            NeighborArrayUnitResetRegion(chromaNeighborArray, NEIGHBOR_ARRAY_TOP, sb_origin_x >> 1, sb_sz >> 1, (uint8_t)~0);
+
+        // dc sign as EC resets it, see EntropyCodingResetTileNeighborArrays
+        for (arrayIndex = 0; arrayIndex < sizeof(dcSignNeighborArrays) / sizeof(dcSignNeighborArrays[0]); ++arrayIndex) {
+            const uint32_t subsamplingShift = arrayIndex ? 1 : 0;
+
+            if (resetLeft)
+                NeighborArrayUnitResetRegion(dcSignNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_LEFT, sb_origin_y >> subsamplingShift, sb_sz >> subsamplingShift, 0);
+            if (resetTop)
+                NeighborArrayUnitResetRegion(dcSignNeighborArrays[arrayIndex], NEIGHBOR_ARRAY_TOP, sb_origin_x >> subsamplingShift, sb_sz >> subsamplingShift, 0);
+        }
+
+        if (resetLeft)
+            NeighborArrayUnitResetRegion32(picture_control_set_ptr->md_interpolation_type_neighbor_array[depth], NEIGHBOR_ARRAY_LEFT, sb_origin_y, sb_sz, (uint8_t)~0);
+        if (resetTop)
+            NeighborArrayUnitResetRegion32(picture_control_set_ptr->md_interpolation_type_neighbor_array[depth], NEIGHBOR_ARRAY_TOP, sb_origin_x, sb_sz, (uint8_t)~0);
+    }
+
+    if (resetLeft) {
+        NeighborArrayUnitResetRegion(picture_control_set_ptr->md_refinement_intra_luma_mode_neighbor_array, NEIGHBOR_ARRAY_LEFT, sb_origin_y, sb_sz, (uint8_t)~0);
+        NeighborArrayUnitResetRegion(picture_control_set_ptr->md_refinement_mode_type_neighbor_array, NEIGHBOR_ARRAY_LEFT, sb_origin_y, sb_sz, (uint8_t)~0);
+    }
+    if (resetTop) {
+        NeighborArrayUnitResetRegion(picture_control_set_ptr->md_refinement_intra_luma_mode_neighbor_array, NEIGHBOR_ARRAY_TOP, sb_origin_x, sb_sz, (uint8_t)~0);
+        NeighborArrayUnitResetRegion(picture_control_set_ptr->md_refinement_mode_type_neighbor_array, NEIGHBOR_ARRAY_TOP, sb_origin_x, sb_sz, (uint8_t)~0);
+    }
+
+    return;
+}
+
 
 void ResetMdRefinmentNeighborArrays(PictureControlSet_t *picture_control_set_ptr)
 {
@@ -242,6 +242,13 @@ extern "C" {
     extern void reset_mode_decision_neighbor_arrays(
         PictureControlSet_t *picture_control_set_ptr);
 
+    extern void reset_mode_decision_tile_neighbor_arrays(
+        PictureControlSet_t *picture_control_set_ptr,
+        const TileInfo      *tile,
+        uint32_t             sb_origin_x,
+        uint32_t             sb_origin_y,
+        uint32_t             sb_sz);
+
     extern void lambda_assign_low_delay(
         uint32_t                    *fast_lambda,
         uint32_t                    *full_lambda,
@@ -430,6 +430,7 @@ void* MotionEstimationKernel(void *input_ptr)
 
         // Segments
         segment_index = inputResultsPtr->segment_index;
+        EbTracePicture(picture_control_set_ptr->picture_number, segment_index);
         picture_width_in_sb = (sequence_control_set_ptr->luma_width + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
         picture_height_in_sb = (sequence_control_set_ptr->luma_height + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz;
         SEGMENT_CONVERT_IDX_TO_XY(segment_index, xSegmentIndex, ySegmentIndex, picture_control_set_ptr->me_segments_column_count);
@@ -35,6 +35,8 @@ EbErrorType NeighborArrayUnitCtor32(
     naUnitPtr->leftArraySize = (uint16_t)((typeMask & NEIGHBOR_ARRAY_UNIT_LEFT_MASK) ? maxPictureHeight >> naUnitPtr->granularityNormalLog2 : 0);
     naUnitPtr->topArraySize = (uint16_t)((typeMask & NEIGHBOR_ARRAY_UNIT_TOP_MASK) ? maxPictureWidth >> naUnitPtr->granularityNormalLog2 : 0);
     naUnitPtr->topLeftArraySize = (uint16_t)((typeMask & NEIGHBOR_ARRAY_UNIT_TOPLEFT_MASK) ? (maxPictureWidth + maxPictureHeight) >> naUnitPtr->granularityTopLeftLog2 : 0);
+    naUnitPtr->originX = 0;
+    naUnitPtr->originY = 0;
 
     if (naUnitPtr->leftArraySize) {
         EB_MALLOC(uint32_t*, naUnitPtr->leftArray, naUnitPtr->unitSize * naUnitPtr->leftArraySize, EB_N_PTR);
@@ -81,6 +83,8 @@ EbErrorType NeighborArrayUnitCtor(
     naUnitPtr->leftArraySize = (uint16_t)((typeMask & NEIGHBOR_ARRAY_UNIT_LEFT_MASK) ? maxPictureHeight >> naUnitPtr->granularityNormalLog2 : 0);
     naUnitPtr->topArraySize = (uint16_t)((typeMask & NEIGHBOR_ARRAY_UNIT_TOP_MASK) ? maxPictureWidth >> naUnitPtr->granularityNormalLog2 : 0);
     naUnitPtr->topLeftArraySize = (uint16_t)((typeMask & NEIGHBOR_ARRAY_UNIT_TOPLEFT_MASK) ? (maxPictureWidth + maxPictureHeight) >> naUnitPtr->granularityTopLeftLog2 : 0);
+    naUnitPtr->originX = 0;
+    naUnitPtr->originY = 0;
 
     if (naUnitPtr->leftArraySize) {
         EB_MALLOC(uint8_t*, naUnitPtr->leftArray, naUnitPtr->unitSize * naUnitPtr->leftArraySize, EB_N_PTR);
@@ -107,6 +111,70 @@ EbErrorType NeighborArrayUnitCtor(
 }
 
 
+/*************************************************
+ * Neighbor Array Unit Region Ctor
+ *   Covers the width x height region at
+ *   (originX, originY) only, and is still
+ *   addressed with picture positions
+ *************************************************/
+EbErrorType NeighborArrayUnitRegionCtor32(
+    NeighborArrayUnit32_t **naUnitDblPtr,
+    uint32_t   originX,
+    uint32_t   originY,
+    uint32_t   width,
+    uint32_t   height,
+    uint32_t   unitSize,
+    uint32_t   granularityNormal,
+    uint32_t   granularityTopLeft,
+    uint32_t   typeMask)
+{
+    EbErrorType return_error = NeighborArrayUnitCtor32(
+        naUnitDblPtr,
+        width,
+        height,
+        unitSize,
+        granularityNormal,
+        granularityTopLeft,
+        typeMask);
+
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+    (*naUnitDblPtr)->originX = (uint16_t)originX;
+    (*naUnitDblPtr)->originY = (uint16_t)originY;
+
+    return EB_ErrorNone;
+}
+
+EbErrorType NeighborArrayUnitRegionCtor(
+    NeighborArrayUnit_t **naUnitDblPtr,
+    uint32_t   originX,
+    uint32_t   originY,
+    uint32_t   width,
+    uint32_t   height,
+    uint32_t   unitSize,
+    uint32_t   granularityNormal,
+    uint32_t   granularityTopLeft,
+    uint32_t   typeMask)
+{
+    EbErrorType return_error = NeighborArrayUnitCtor(
+        naUnitDblPtr,
+        width,
+        height,
+        unitSize,
+        granularityNormal,
+        granularityTopLeft,
+        typeMask);
+
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
+    (*naUnitDblPtr)->originX = (uint16_t)originX;
+    (*naUnitDblPtr)->originY = (uint16_t)originY;
+
+    return EB_ErrorNone;
+}
+
 /*************************************************
  * Neighbor Array Unit Reset
  *************************************************/
@@ -144,6 +212,52 @@ void NeighborArrayUnitReset(NeighborArrayUnit_t *naUnitPtr)
     return;
 }
 
+/*************************************************
+ * Neighbor Array Unit Reset Region
+ *   Resets the [loc, loc + size) span of the left
+ *   (NEIGHBOR_ARRAY_LEFT, loc is vertical) or the
+ *   top (NEIGHBOR_ARRAY_TOP, loc is horizontal) array
+ *************************************************/
+void NeighborArrayUnitResetRegion(
+    NeighborArrayUnit_t *naUnitPtr,
+    uint32_t             neighborArrayType,
+    uint32_t             loc,
+    uint32_t             size,
+    uint8_t              value)
+{
+    uint8_t  *arrayPtr = (neighborArrayType == NEIGHBOR_ARRAY_LEFT) ? naUnitPtr->leftArray : naUnitPtr->topArray;
+    uint32_t  arraySize = (neighborArrayType == NEIGHBOR_ARRAY_LEFT) ? naUnitPtr->leftArraySize : naUnitPtr->topArraySize;
+    uint32_t  origin = (neighborArrayType == NEIGHBOR_ARRAY_LEFT) ? naUnitPtr->originY : naUnitPtr->originX;
+    uint32_t  startIndex = (loc - origin) >> naUnitPtr->granularityNormalLog2;
+    uint32_t  endIndex = MIN((loc + size - origin) >> naUnitPtr->granularityNormalLog2, arraySize);
+
+    if (arrayPtr && startIndex < endIndex) {
+        EB_MEMSET(arrayPtr + startIndex * naUnitPtr->unitSize, value, naUnitPtr->unitSize * (endIndex - startIndex));
+    }
+
+    return;
+}
+
+void NeighborArrayUnitResetRegion32(
+    NeighborArrayUnit32_t *naUnitPtr,
+    uint32_t               neighborArrayType,
+    uint32_t               loc,
+    uint32_t               size,
+    uint8_t                value)
+{
+    uint32_t *arrayPtr = (neighborArrayType == NEIGHBOR_ARRAY_LEFT) ? naUnitPtr->leftArray : naUnitPtr->topArray;
+    uint32_t  arraySize = (neighborArrayType == NEIGHBOR_ARRAY_LEFT) ? naUnitPtr->leftArraySize : naUnitPtr->topArraySize;
+    uint32_t  origin = (neighborArrayType == NEIGHBOR_ARRAY_LEFT) ? naUnitPtr->originY : naUnitPtr->originX;
+    uint32_t  startIndex = (loc - origin) >> naUnitPtr->granularityNormalLog2;
+    uint32_t  endIndex = MIN((loc + size - origin) >> naUnitPtr->granularityNormalLog2, arraySize);
+
+    if (arrayPtr && startIndex < endIndex) {
+        EB_MEMSET(arrayPtr + startIndex, value, naUnitPtr->unitSize * (endIndex - startIndex));
+    }
+
+    return;
+}
+
 
 /*************************************************
  * Neighbor Array Unit Get Left Index
@@ -152,14 +266,14 @@ uint32_t GetNeighborArrayUnitLeftIndex32(
     NeighborArrayUnit32_t *naUnitPtr,
     uint32_t               locY)
 {
-    return (locY >> naUnitPtr->granularityNormalLog2);
+    return ((locY - naUnitPtr->originY) >> naUnitPtr->granularityNormalLog2);
 }
 
 uint32_t GetNeighborArrayUnitLeftIndex(
     NeighborArrayUnit_t *naUnitPtr,
     uint32_t               locY)
 {
-    return (locY >> naUnitPtr->granularityNormalLog2);
+    return ((locY - naUnitPtr->originY) >> naUnitPtr->granularityNormalLog2);
 }
 
 /*************************************************
@@ -169,14 +283,14 @@ uint32_t GetNeighborArrayUnitTopIndex32(
     NeighborArrayUnit32_t *naUnitPtr,
     uint32_t               locX)
 {
-    return (locX >> naUnitPtr->granularityNormalLog2);
+    return ((locX - naUnitPtr->originX) >> naUnitPtr->granularityNormalLog2);
 }
 
 uint32_t GetNeighborArrayUnitTopIndex(
     NeighborArrayUnit_t *naUnitPtr,
     uint32_t               locX)
 {
-    return (locX >> naUnitPtr->granularityNormalLog2);
+    return ((locX - naUnitPtr->originX) >> naUnitPtr->granularityNormalLog2);
 }
 
 /*************************************************
@@ -187,7 +301,7 @@ uint32_t GetNeighborArrayUnitTopLeftIndex32(
     int32_t               locX,
     int32_t               locY)
 {
-    return naUnitPtr->leftArraySize + (locX >> naUnitPtr->granularityTopLeftLog2) - (locY >> naUnitPtr->granularityTopLeftLog2);
+    return naUnitPtr->leftArraySize + ((locX - naUnitPtr->originX) >> naUnitPtr->granularityTopLeftLog2) - ((locY - naUnitPtr->originY) >> naUnitPtr->granularityTopLeftLog2);
 }
 
 uint32_t GetNeighborArrayUnitTopLeftIndex(
@@ -195,7 +309,7 @@ uint32_t GetNeighborArrayUnitTopLeftIndex(
     int32_t               locX,
     int32_t               locY)
 {
-    return naUnitPtr->leftArraySize + (locX >> naUnitPtr->granularityTopLeftLog2) - (locY >> naUnitPtr->granularityTopLeftLog2);
+    return naUnitPtr->leftArraySize + ((locX - naUnitPtr->originX) >> naUnitPtr->granularityTopLeftLog2) - ((locY - naUnitPtr->originY) >> naUnitPtr->granularityTopLeftLog2);
 }
 
 void update_recon_neighbor_array(
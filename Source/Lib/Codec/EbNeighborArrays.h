@@ -47,6 +47,9 @@ extern "C" {
         uint8_t    granularityNormalLog2;
         uint8_t    granularityTopLeft;
         uint8_t    granularityTopLeftLog2;
+        // Position of the first unit, the arrays of a tile only cover the tile
+        uint16_t   originX;
+        uint16_t   originY;
 
     } NeighborArrayUnit_t;
 
@@ -63,6 +66,8 @@ extern "C" {
         uint8_t    granularityNormalLog2;
         uint8_t    granularityTopLeft;
         uint8_t    granularityTopLeftLog2;
+        uint16_t   originX;
+        uint16_t   originY;
 
     } NeighborArrayUnit32_t;
 
@@ -85,12 +90,48 @@ extern "C" {
         uint32_t   granularityTopLeft,
         uint32_t   typeMask);
 
+    extern EbErrorType NeighborArrayUnitRegionCtor32(
+        NeighborArrayUnit32_t **naUnitDblPtr,
+        uint32_t   originX,
+        uint32_t   originY,
+        uint32_t   width,
+        uint32_t   height,
+        uint32_t   unitSize,
+        uint32_t   granularityNormal,
+        uint32_t   granularityTopLeft,
+        uint32_t   typeMask);
+
+    extern EbErrorType NeighborArrayUnitRegionCtor(
+        NeighborArrayUnit_t **naUnitDblPtr,
+        uint32_t   originX,
+        uint32_t   originY,
+        uint32_t   width,
+        uint32_t   height,
+        uint32_t   unitSize,
+        uint32_t   granularityNormal,
+        uint32_t   granularityTopLeft,
+        uint32_t   typeMask);
+
     extern void NeighborArrayUnitDtor(NeighborArrayUnit_t  *naUnitPtr);
 
     extern void NeighborArrayUnitReset(NeighborArrayUnit_t *naUnitPtr);
 
     extern void NeighborArrayUnitReset32(NeighborArrayUnit32_t *naUnitPtr);
 
+    extern void NeighborArrayUnitResetRegion(
+        NeighborArrayUnit_t *naUnitPtr,
+        uint32_t             neighborArrayType,
+        uint32_t             loc,
+        uint32_t             size,
+        uint8_t              value);
+
+    extern void NeighborArrayUnitResetRegion32(
+        NeighborArrayUnit32_t *naUnitPtr,
+        uint32_t               neighborArrayType,
+        uint32_t               loc,
+        uint32_t               size,
+        uint8_t                value);
+
     extern uint32_t GetNeighborArrayUnitLeftIndex32(
         NeighborArrayUnit32_t *naUnitPtr,
         uint32_t               locY);
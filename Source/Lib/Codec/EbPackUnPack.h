@@ -83,16 +83,73 @@ extern "C" {
             // NON_AVX2
             EB_ENC_msbUnPack2D,
             // AVX2
-            EB_ENC_msbUnPack2D,
+            EB_ENC_msbUnPack2D_AVX2_INTRIN,
         },
         {
             // NON_AVX2
             EB_ENC_msbUnPack2D_SSE2_INTRIN,
             // AVX2
-            EB_ENC_msbUnPack2D_SSE2_INTRIN,
+            EB_ENC_msbUnPack2D_AVX2_INTRIN,
         }
     };
 
+    typedef void(*EB_ENC_UnPackShift2D_TYPE)(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *out8BitBuffer,
+        uint8_t       *outnBitBuffer,
+        uint32_t       out8Stride,
+        uint32_t       outnStride,
+        uint32_t       shift,
+        uint32_t       width,
+        uint32_t       height);
+
+    EB_ENC_UnPackShift2D_TYPE UnPackShift2D_funcPtrArray[ASM_TYPE_TOTAL] =
+    {
+        // NON_AVX2
+        EB_ENC_msbUnPackShift2D,
+        // AVX2
+        EB_ENC_msbUnPackShift2D_AVX2_INTRIN,
+    };
+
+    typedef void(*EB_ENC_Deinterleave2D_TYPE)(
+        uint8_t       *inBuffer,
+        uint32_t       inStride,
+        uint8_t       *outCbBuffer,
+        uint8_t       *outCrBuffer,
+        uint32_t       outStride,
+        uint32_t       width,
+        uint32_t       height);
+
+    EB_ENC_Deinterleave2D_TYPE Deinterleave2D_funcPtrArray[ASM_TYPE_TOTAL] =
+    {
+        // NON_AVX2
+        EB_ENC_Deinterleave2D,
+        // AVX2
+        EB_ENC_Deinterleave2D_AVX2_INTRIN,
+    };
+
+    typedef void(*EB_ENC_UnPackDeinterleave2D_TYPE)(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *outCb8BitBuffer,
+        uint8_t       *outCr8BitBuffer,
+        uint8_t       *outCbnBitBuffer,
+        uint8_t       *outCrnBitBuffer,
+        uint32_t       out8Stride,
+        uint32_t       outnStride,
+        uint32_t       shift,
+        uint32_t       width,
+        uint32_t       height);
+
+    EB_ENC_UnPackDeinterleave2D_TYPE UnPackDeinterleave2D_funcPtrArray[ASM_TYPE_TOTAL] =
+    {
+        // NON_AVX2
+        EB_ENC_msbUnPackDeinterleave2D,
+        // AVX2
+        EB_ENC_msbUnPackDeinterleave2D_AVX2_INTRIN,
+    };
+
     typedef void(*EB_ENC_UnpackAvg_TYPE)(
         uint16_t *ref16L0,
         uint32_t  refL0Stride,
@@ -140,13 +197,13 @@ extern "C" {
     {
         {
            UnPack8BitData,
-           UnPack8BitData,
+           EB_ENC_UnPack8BitData_AVX2_INTRIN,
         },
         {
             // NON_AVX2
             EB_ENC_UnPack8BitData_SSE2_INTRIN,
             // AVX2
-            EB_ENC_UnPack8BitData_SSE2_INTRIN,
+            EB_ENC_UnPack8BitData_AVX2_INTRIN,
         }
     };
     typedef void(*EB_ENC_UnPack8BitDataSUB_TYPE)(
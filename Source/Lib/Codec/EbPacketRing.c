@@ -0,0 +1,219 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbPacketRing.h"
+
+#define EB_PacketRingAlign(size)        (((size) + EB_PacketRingAlignment - 1) & ~(EB_PacketRingAlignment - 1))
+#define EB_PacketRingRecordSize         EB_PacketRingAlign((uint32_t)sizeof(EbPacketRingRecord_t))
+#define EB_PacketRingChunkSize          EB_PacketRingAlign((uint32_t)sizeof(EbPacketRingChunk_t))
+
+/**************************************
+ * EbPacketRingChunkCreate
+ *   The chunk and its buffer are one block, so a retired chunk can be
+ *   freed before the memory context of the ring.
+ **************************************/
+static EbPacketRingChunk_t* EbPacketRingChunkCreate(
+    EbPacketRing_t      *ringPtr,
+    uint32_t             size)
+{
+    EbPacketRingChunk_t *chunkPtr;
+
+    chunkPtr = (EbPacketRingChunk_t*)EbAllocMemoryEntry(ringPtr->memoryContextPtr, (uint64_t)EB_PacketRingChunkSize + size, EB_A_PTR);
+    if (chunkPtr == (EbPacketRingChunk_t*)EB_NULL)
+        return (EbPacketRingChunk_t*)EB_NULL;
+
+    chunkPtr->ringPtr = ringPtr;
+    chunkPtr->bufferPtr = (EbByte)chunkPtr + EB_PacketRingChunkSize;
+    chunkPtr->size = size;
+    chunkPtr->headOffset = 0;
+    chunkPtr->tailOffset = 0;
+    chunkPtr->usedSize = 0;
+    chunkPtr->retired = EB_FALSE;
+
+    return chunkPtr;
+}
+
+static void EbPacketRingChunkDestroy(
+    EbPacketRingChunk_t *chunkPtr)
+{
+    EbFreeMemoryEntry(chunkPtr->ringPtr->memoryContextPtr, chunkPtr, (uint64_t)EB_PacketRingChunkSize + chunkPtr->size);
+}
+
+/**************************************
+ * EbPacketRingCtor
+ **************************************/
+EbErrorType EbPacketRingCtor(
+    EbPacketRing_t     **ringDblPtr,
+    uint32_t             size)
+{
+    EbPacketRing_t *ringPtr;
+
+    EB_MALLOC(EbPacketRing_t*, ringPtr, sizeof(EbPacketRing_t), EB_N_PTR);
+    *ringDblPtr = ringPtr;
+
+    EB_CREATEMUTEX(EbHandle, ringPtr->mutex, sizeof(EbHandle), EB_MUTEX);
+    ringPtr->memoryContextPtr = EbGetMemoryContext();
+
+    ringPtr->chunkPtr = EbPacketRingChunkCreate(ringPtr, EB_PacketRingAlign(size));
+    if (ringPtr->chunkPtr == (EbPacketRingChunk_t*)EB_NULL)
+        return EB_ErrorInsufficientResources;
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * EbPacketRingChunkAlloc
+ *   Returns the offset of a record of recordSize bytes in chunkPtr, or
+ *   chunkPtr->size when it does not fit.
+ **************************************/
+static uint32_t EbPacketRingChunkAlloc(
+    EbPacketRingChunk_t *chunkPtr,
+    uint32_t             recordSize)
+{
+    EbPacketRingRecord_t *paddingPtr;
+    uint32_t              recordOffset;
+
+    if (chunkPtr->usedSize == 0)
+        chunkPtr->headOffset = chunkPtr->tailOffset = 0;
+
+    if (chunkPtr->usedSize == chunkPtr->size)
+        return chunkPtr->size;
+
+    if (chunkPtr->headOffset >= chunkPtr->tailOffset) {
+        if (recordSize <= chunkPtr->size - chunkPtr->headOffset) {
+            recordOffset = chunkPtr->headOffset;
+        }
+        else if (recordSize <= chunkPtr->tailOffset) {
+            // Pad the end of the chunk and wrap
+            if (chunkPtr->headOffset < chunkPtr->size) {
+                paddingPtr = (EbPacketRingRecord_t*)(chunkPtr->bufferPtr + chunkPtr->headOffset);
+                paddingPtr->chunkPtr = chunkPtr;
+                paddingPtr->size = chunkPtr->size - chunkPtr->headOffset;
+                paddingPtr->released = EB_TRUE;
+                chunkPtr->usedSize += paddingPtr->size;
+            }
+            recordOffset = 0;
+        }
+        else
+            return chunkPtr->size;
+    }
+    else if (recordSize <= chunkPtr->tailOffset - chunkPtr->headOffset) {
+        recordOffset = chunkPtr->headOffset;
+    }
+    else
+        return chunkPtr->size;
+
+    chunkPtr->headOffset = recordOffset + recordSize;
+    chunkPtr->usedSize += recordSize;
+
+    return recordOffset;
+}
+
+/**************************************
+ * EbPacketRingAlloc
+ **************************************/
+EbByte EbPacketRingAlloc(
+    EbPacketRing_t      *ringPtr,
+    uint32_t             size)
+{
+    EbPacketRingChunk_t  *chunkPtr;
+    EbPacketRingChunk_t  *retiredChunkPtr;
+    EbPacketRingRecord_t *recordPtr;
+    uint32_t              recordSize = EB_PacketRingRecordSize + EB_PacketRingAlign(size);
+    uint32_t              recordOffset;
+    uint32_t              chunkSize;
+
+    EbBlockOnMutex(ringPtr->mutex);
+
+    chunkPtr = ringPtr->chunkPtr;
+    recordOffset = EbPacketRingChunkAlloc(chunkPtr, recordSize);
+    if (recordOffset == chunkPtr->size) {
+        chunkSize = chunkPtr->size << 1;
+        while (chunkSize < recordSize)
+            chunkSize <<= 1;
+
+        retiredChunkPtr = chunkPtr;
+        chunkPtr = EbPacketRingChunkCreate(ringPtr, chunkSize);
+        if (chunkPtr == (EbPacketRingChunk_t*)EB_NULL) {
+            EbReleaseMutex(ringPtr->mutex);
+            return (EbByte)EB_NULL;
+        }
+        ringPtr->chunkPtr = chunkPtr;
+
+        // The packets of the replaced chunk are still released to it, the
+        //   last one frees it
+        if (retiredChunkPtr->usedSize)
+            retiredChunkPtr->retired = EB_TRUE;
+        else
+            EbPacketRingChunkDestroy(retiredChunkPtr);
+
+        recordOffset = EbPacketRingChunkAlloc(chunkPtr, recordSize);
+    }
+
+    recordPtr = (EbPacketRingRecord_t*)(chunkPtr->bufferPtr + recordOffset);
+    recordPtr->chunkPtr = chunkPtr;
+    recordPtr->size = recordSize;
+    recordPtr->released = EB_FALSE;
+
+    EbReleaseMutex(ringPtr->mutex);
+
+    return (EbByte)recordPtr + EB_PacketRingRecordSize;
+}
+
+/**************************************
+ * EbPacketRingShrink
+ **************************************/
+void EbPacketRingShrink(
+    EbByte               payloadPtr,
+    uint32_t             size)
+{
+    EbPacketRingRecord_t *recordPtr = (EbPacketRingRecord_t*)(payloadPtr - EB_PacketRingRecordSize);
+    EbPacketRingChunk_t  *chunkPtr = recordPtr->chunkPtr;
+    EbPacketRing_t       *ringPtr = chunkPtr->ringPtr;
+    uint32_t              recordSize = EB_PacketRingRecordSize + EB_PacketRingAlign(size);
+
+    EbBlockOnMutex(ringPtr->mutex);
+
+    // Only the newest record of the current chunk ends at its head
+    if (chunkPtr == ringPtr->chunkPtr && recordSize < recordPtr->size &&
+        (EbByte)recordPtr + recordPtr->size == chunkPtr->bufferPtr + chunkPtr->headOffset) {
+        chunkPtr->headOffset -= recordPtr->size - recordSize;
+        chunkPtr->usedSize -= recordPtr->size - recordSize;
+        recordPtr->size = recordSize;
+    }
+
+    EbReleaseMutex(ringPtr->mutex);
+}
+
+/**************************************
+ * EbPacketRingFree
+ **************************************/
+void EbPacketRingFree(
+    EbByte               payloadPtr)
+{
+    EbPacketRingRecord_t *recordPtr = (EbPacketRingRecord_t*)(payloadPtr - EB_PacketRingRecordSize);
+    EbPacketRingChunk_t  *chunkPtr = recordPtr->chunkPtr;
+    EbPacketRing_t       *ringPtr = chunkPtr->ringPtr;
+
+    EbBlockOnMutex(ringPtr->mutex);
+
+    recordPtr->released = EB_TRUE;
+
+    // Reclaim the released records at the tail
+    while (chunkPtr->usedSize) {
+        recordPtr = (EbPacketRingRecord_t*)(chunkPtr->bufferPtr + chunkPtr->tailOffset);
+        if (!recordPtr->released)
+            break;
+        chunkPtr->usedSize -= recordPtr->size;
+        chunkPtr->tailOffset += recordPtr->size;
+        if (chunkPtr->tailOffset == chunkPtr->size)
+            chunkPtr->tailOffset = 0;
+    }
+
+    if (chunkPtr->retired && chunkPtr->usedSize == 0)
+        EbPacketRingChunkDestroy(chunkPtr);
+
+    EbReleaseMutex(ringPtr->mutex);
+}
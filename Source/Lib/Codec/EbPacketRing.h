@@ -0,0 +1,97 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbPacketRing_h
+#define EbPacketRing_h
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*********************************
+     * Defines
+     *********************************/
+#define EB_PacketRingAlignment          16          // power of two
+
+    struct EbPacketRing_s;
+    struct EbPacketRingChunk_s;
+
+    /*********************************************************************
+     * PacketRingRecord
+     *   Precedes each packet in a chunk. Records that only pad the end of
+     *   the chunk before a wrap are created released.
+     *********************************************************************/
+    typedef struct EbPacketRingRecord_s {
+        struct EbPacketRingChunk_s *chunkPtr;
+        uint32_t                    size;           // record and payload, aligned
+        uint32_t                    released;
+    } EbPacketRingRecord_t;
+
+    /*********************************************************************
+     * PacketRingChunk
+     *   One circular buffer. Packets are written at headOffset and freed
+     *   from tailOffset, a packet released out of order is only reclaimed
+     *   once the packets written before it are released. A retired chunk
+     *   only takes releases and is freed with its last packet.
+     *********************************************************************/
+    typedef struct EbPacketRingChunk_s {
+        struct EbPacketRing_s      *ringPtr;
+        EbByte                      bufferPtr;
+        uint32_t                    size;
+        uint32_t                    headOffset;
+        uint32_t                    tailOffset;
+        uint32_t                    usedSize;
+        EbBool                      retired;
+    } EbPacketRingChunk_t;
+
+    /*********************************************************************
+     * PacketRing
+     *   Payload memory of the output packets of an encoder instance. When
+     *   the current chunk is full, a chunk of twice its size replaces it
+     *   and the replaced chunk retires. The chunks are blocks of their own
+     *   in the memory context of the encoder instance, a retired chunk is
+     *   freed as soon as its packets are released, the others with the
+     *   encoder instance.
+     *********************************************************************/
+    typedef struct EbPacketRing_s {
+        EbHandle                    mutex;
+        EbMemoryContext_t          *memoryContextPtr;
+        EbPacketRingChunk_t        *chunkPtr;       // current chunk
+    } EbPacketRing_t;
+
+    extern EbErrorType EbPacketRingCtor(
+        EbPacketRing_t     **ringDblPtr,
+        uint32_t             size);
+
+    /*********************************************************************
+     * EbPacketRingAlloc
+     *   Returns size bytes of payload memory, EB_NULL when out of memory.
+     *********************************************************************/
+    extern EbByte EbPacketRingAlloc(
+        EbPacketRing_t      *ringPtr,
+        uint32_t             size);
+
+    /*********************************************************************
+     * EbPacketRingShrink
+     *   Trims payload memory returned by EbPacketRingAlloc to size bytes,
+     *   which is only reclaimed while no other payload was allocated since.
+     *********************************************************************/
+    extern void EbPacketRingShrink(
+        EbByte               payloadPtr,
+        uint32_t             size);
+
+    /*********************************************************************
+     * EbPacketRingFree
+     *   Releases payload memory returned by EbPacketRingAlloc, from any
+     *   thread and in any order.
+     *********************************************************************/
+    extern void EbPacketRingFree(
+        EbByte               payloadPtr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbPacketRing_h
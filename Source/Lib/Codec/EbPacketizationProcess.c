@@ -14,6 +14,7 @@
 #include "EbEntropyCoding.h"
 #include "EbRateControlTasks.h"
 #include "EbTime.h"
+#include "EbErrorCodes.h"
 
 static EbBool IsPassthroughData(EbLinkedListNode* dataNode)
 {
@@ -30,6 +31,30 @@ static EbLinkedListNode* ExtractPassthroughData(EbLinkedListNode** llPtrPtr)
     return llPassPtr;
 }
 
+// Hands the recon pictures posted so far to recon_callback. A picture posts
+//   its recon before its entropy coding results, its recon is delivered
+//   before its packet.
+static void DeliverReconPictures(
+    SequenceControlSet_t  *sequence_control_set_ptr,
+    EncodeContext_t       *encode_context_ptr)
+{
+    EbObjectWrapper_t  *outputReconWrapperPtr;
+    EbBufferHeaderType *outputReconPtr;
+
+    for (;;) {
+        EbGetFullObjectNonBlocking(
+            encode_context_ptr->recon_callback_fifo_ptr,
+            &outputReconWrapperPtr);
+        if (outputReconWrapperPtr == (EbObjectWrapper_t*)EB_NULL)
+            break;
+
+        outputReconPtr = (EbBufferHeaderType*)outputReconWrapperPtr->objectPtr;
+        outputReconPtr->wrapper_ptr = (void*)outputReconWrapperPtr;
+        sequence_control_set_ptr->static_config.recon_callback(
+            sequence_control_set_ptr->static_config.output_callback_context,
+            outputReconPtr);
+    }
+}
 
 EbErrorType PacketizationContextCtor(
     PacketizationContext_t **context_dbl_ptr,
@@ -70,6 +95,11 @@ void* PacketizationKernel(void *input_ptr)
     EbBufferHeaderType             *output_stream_ptr;
     EbObjectWrapper_t              *rateControlTasksWrapperPtr;
     RateControlTasks_t             *rateControlTasksPtr;
+    OutputBitstreamUnit_t          *outputBitstreamPtr;
+    uint32_t                        frameSize;
+    uint32_t                        tilesSize;
+    uint32_t                        tileCount;
+    uint32_t                        tileIdx;
     
     // Queue variables
     int32_t                         queueEntryIndex;
@@ -88,6 +118,7 @@ void* PacketizationKernel(void *input_ptr)
         entropyCodingResultsPtr = (EntropyCodingResults_t*)entropyCodingResultsWrapperPtr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)entropyCodingResultsPtr->pictureControlSetWrapperPtr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
         encode_context_ptr = (EncodeContext_t*)sequence_control_set_ptr->encode_context_ptr;
 
         //****************************************************
@@ -122,59 +153,69 @@ void* PacketizationKernel(void *input_ptr)
         rateControlTasksPtr->pictureControlSetWrapperPtr = picture_control_set_ptr->picture_parent_control_set_wrapper_ptr;
         rateControlTasksPtr->taskType = RC_PACKETIZATION_FEEDBACK_RESULT;
 
-        // slice_type = picture_control_set_ptr->slice_type;
-         // Reset the bitstream before writing to it
-        ResetBitstream(
-            picture_control_set_ptr->bitstreamPtr->outputBitstreamPtr);
-
-
-        if (picture_control_set_ptr->parent_pcs_ptr->showFrame && picture_control_set_ptr->parent_pcs_ptr->temporal_layer_index == 0) {
-            EncodeTDAv1(
-                picture_control_set_ptr->bitstreamPtr);
-        }
-        // Code the SPS
-        if (picture_control_set_ptr->parent_pcs_ptr->av1FrameType == KEY_FRAME) {
-            EncodeSPSAv1(
-                picture_control_set_ptr->bitstreamPtr,
-                sequence_control_set_ptr);
+        // The packet is written in place in the packet ring, in a payload
+        //   bounded by its tiles and headers and trimmed once written
+        outputBitstreamPtr = (OutputBitstreamUnit_t*)picture_control_set_ptr->bitstreamPtr->outputBitstreamPtr;
+        tileCount = picture_control_set_ptr->tile_column_count * picture_control_set_ptr->tile_row_count;
+        tilesSize = 0;
+        for (tileIdx = 0; tileIdx < tileCount; ++tileIdx)
+            tilesSize += picture_control_set_ptr->tile_entropy_coder_ptr_array[tileIdx]->ecWriter.pos + 4;
+        output_stream_ptr->n_alloc_len = tilesSize + PACKETIZATION_HEADERS_MAX_SIZE;
+        output_stream_ptr->p_buffer = EbPacketRingAlloc(
+            encode_context_ptr->packet_ring_ptr,
+            output_stream_ptr->n_alloc_len);
+
+        if (output_stream_ptr->p_buffer == (uint8_t*)EB_NULL) {
+            // The packet goes out in order with the error, eb_svt_get_packet
+            //   returns EB_ErrorMax for it
+            output_stream_ptr->n_alloc_len = 0;
+            output_stream_ptr->flags = EB_ENC_PACKETIZATION_ERROR6;
+            frameSize = tilesSize;
         }
+        else {
+            output_bitstream_set_buffer(
+                outputBitstreamPtr,
+                output_stream_ptr->p_buffer,
+                output_stream_ptr->n_alloc_len);
+
+            if (picture_control_set_ptr->parent_pcs_ptr->showFrame && picture_control_set_ptr->parent_pcs_ptr->temporal_layer_index == 0) {
+                EncodeTDAv1(
+                    picture_control_set_ptr->bitstreamPtr);
+            }
+            // Code the SPS
+            if (picture_control_set_ptr->parent_pcs_ptr->av1FrameType == KEY_FRAME) {
+                EncodeSPSAv1(
+                    picture_control_set_ptr->bitstreamPtr,
+                    sequence_control_set_ptr);
+            }
 
-        WriteFrameHeaderAv1(
-            picture_control_set_ptr->bitstreamPtr,
-            sequence_control_set_ptr,
-            picture_control_set_ptr,
-            0);
-
-        // Copy Slice Header to the Output Bitstream
-        CopyRbspBitstreamToPayload(
-            picture_control_set_ptr->bitstreamPtr,
-            output_stream_ptr->p_buffer,
-            (uint32_t*) &(output_stream_ptr->n_filled_len),
-            (uint32_t*) &(output_stream_ptr->n_alloc_len),
-            encode_context_ptr);
-        if (picture_control_set_ptr->parent_pcs_ptr->hasShowExisting) {
-            // Reset the bitstream before writing to it
-            ResetBitstream(
-                picture_control_set_ptr->bitstreamPtr->outputBitstreamPtr);
             WriteFrameHeaderAv1(
                 picture_control_set_ptr->bitstreamPtr,
                 sequence_control_set_ptr,
                 picture_control_set_ptr,
-                1);
+                0);
+            frameSize = output_bitstream_written_bytes(outputBitstreamPtr);
+
+            if (picture_control_set_ptr->parent_pcs_ptr->hasShowExisting) {
+                // The frame header showing an existing frame follows in the same packet
+                WriteFrameHeaderAv1(
+                    picture_control_set_ptr->bitstreamPtr,
+                    sequence_control_set_ptr,
+                    picture_control_set_ptr,
+                    1);
+
+                output_stream_ptr->flags |= EB_BUFFERFLAG_SHOW_EXT;
+            }
 
-            // Copy Slice Header to the Output Bitstream
-            CopyRbspBitstreamToPayload(
-                picture_control_set_ptr->bitstreamPtr,
+            output_stream_ptr->n_filled_len = output_bitstream_written_bytes(outputBitstreamPtr);
+            output_stream_ptr->n_alloc_len = output_stream_ptr->n_filled_len;
+            EbPacketRingShrink(
                 output_stream_ptr->p_buffer,
-                (uint32_t*)&(output_stream_ptr->n_filled_len),
-                (uint32_t*)&(output_stream_ptr->n_alloc_len),
-                encode_context_ptr);
-
-            output_stream_ptr->flags |= EB_BUFFERFLAG_SHOW_EXT;
+                output_stream_ptr->n_alloc_len);
         }
 
         // Send the number of bytes per frame to RC
-        picture_control_set_ptr->parent_pcs_ptr->total_num_bits = output_stream_ptr->n_filled_len << 3;
+        picture_control_set_ptr->parent_pcs_ptr->total_num_bits = frameSize << 3;
         queueEntryPtr->av1FrameType = picture_control_set_ptr->parent_pcs_ptr->av1FrameType;
         queueEntryPtr->poc = picture_control_set_ptr->picture_number;
         memcpy(&queueEntryPtr->av1RefSignal, &picture_control_set_ptr->parent_pcs_ptr->av1RefSignal, sizeof(Av1RpsNode_t));
@@ -224,6 +265,9 @@ void* PacketizationKernel(void *input_ptr)
         EbReleaseObject(entropyCodingResultsWrapperPtr);
 
 
+        if (encode_context_ptr->recon_callback_fifo_ptr)
+            DeliverReconPictures(sequence_control_set_ptr, encode_context_ptr);
+
         //****************************************************
         // Process the head of the queue
         //****************************************************
@@ -347,7 +391,15 @@ void* PacketizationKernel(void *input_ptr)
 
             output_stream_ptr->n_tick_count = (uint32_t)latency;
             output_stream_ptr->p_app_private = queueEntryPtr->outMetaData;
-            EbPostFullObject(output_stream_wrapper_ptr);
+            if (sequence_control_set_ptr->static_config.packet_callback) {
+                output_stream_ptr->wrapper_ptr = (void*)output_stream_wrapper_ptr;
+                sequence_control_set_ptr->static_config.packet_callback(
+                    sequence_control_set_ptr->static_config.output_callback_context,
+                    output_stream_ptr);
+            }
+            else
+                EbPostFullObject(output_stream_wrapper_ptr);
+            EbTraceAsyncEnd("Picture", queueEntryPtr->poc);
             queueEntryPtr->outMetaData = (EbLinkedListNode *)EB_NULL;
 
             // Reset the Reorder Queue Entry
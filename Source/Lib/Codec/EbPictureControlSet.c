@@ -47,6 +47,78 @@ static void set_restoration_unit_size(int32_t width, int32_t height, int32_t sx,
     rst[2].restoration_unit_size = rst[1].restoration_unit_size;
 }
 
+#define MAX_TILE_WIDTH (4096)        // Max Tile width in pixels
+#define MAX_TILE_AREA (4096 * 2304)  // Maximum tile area in pixels
+// Find smallest k>=0 such that (blk_size << k) >= target
+static int32_t tile_log2(int32_t blk_size, int32_t target) {
+    int32_t k;
+    for (k = 0; (blk_size << k) < target; k++) {
+    }
+    return k;
+}
+
+/*********************************************
+* set_tile_info
+*   Derives the uniformly spaced tile layout of
+*   a picture; the requested log2 tile counts are
+*   clamped to the limits of the AV1 specification
+*********************************************/
+void set_tile_info(
+    TilesInfo *tiles_info,
+    int32_t    mi_cols,
+    int32_t    mi_rows,
+    int32_t    mib_size_log2,
+    int32_t    log2_tile_cols,
+    int32_t    log2_tile_rows)
+{
+    const int32_t sb_cols = ALIGN_POWER_OF_TWO(mi_cols, mib_size_log2) >> mib_size_log2;
+    const int32_t sb_rows = ALIGN_POWER_OF_TWO(mi_rows, mib_size_log2) >> mib_size_log2;
+    const int32_t sb_size_log2 = mib_size_log2 + MI_SIZE_LOG2;
+    const int32_t max_tile_area_sb = MAX_TILE_AREA >> (2 * sb_size_log2);
+    int32_t size_sb;
+    int32_t i, start_sb;
+
+    tiles_info->max_tile_width_sb = MAX_TILE_WIDTH >> sb_size_log2;
+    tiles_info->min_log2_tile_cols = tile_log2(tiles_info->max_tile_width_sb, sb_cols);
+    tiles_info->max_log2_tile_cols = tile_log2(1, AOMMIN(sb_cols, MAX_TILE_COLS));
+    tiles_info->max_log2_tile_rows = tile_log2(1, AOMMIN(sb_rows, MAX_TILE_ROWS));
+    tiles_info->min_log2_tiles = AOMMAX(tiles_info->min_log2_tile_cols, tile_log2(max_tile_area_sb, sb_cols * sb_rows));
+
+    tiles_info->log2_tile_cols = CLIP3(tiles_info->min_log2_tile_cols, tiles_info->max_log2_tile_cols, log2_tile_cols);
+    size_sb = ALIGN_POWER_OF_TWO(sb_cols, tiles_info->log2_tile_cols) >> tiles_info->log2_tile_cols;
+    for (i = 0, start_sb = 0; start_sb < sb_cols; i++) {
+        tiles_info->tile_col_start_mi[i] = start_sb << mib_size_log2;
+        start_sb += size_sb;
+    }
+    tiles_info->tile_cols = i;
+    tiles_info->tile_col_start_mi[i] = mi_cols;
+
+    tiles_info->min_log2_tile_rows = AOMMAX(tiles_info->min_log2_tiles - tiles_info->log2_tile_cols, 0);
+    tiles_info->log2_tile_rows = CLIP3(tiles_info->min_log2_tile_rows, tiles_info->max_log2_tile_rows, log2_tile_rows);
+    size_sb = ALIGN_POWER_OF_TWO(sb_rows, tiles_info->log2_tile_rows) >> tiles_info->log2_tile_rows;
+    for (i = 0, start_sb = 0; start_sb < sb_rows; i++) {
+        tiles_info->tile_row_start_mi[i] = start_sb << mib_size_log2;
+        start_sb += size_sb;
+    }
+    tiles_info->tile_rows = i;
+    tiles_info->tile_row_start_mi[i] = mi_rows;
+}
+
+void av1_tile_init(
+    TileInfo        *tile,
+    const TilesInfo *tiles_info,
+    int32_t          row,
+    int32_t          col)
+{
+    tile->tile_row = row;
+    tile->tile_col = col;
+    tile->mi_row_start = tiles_info->tile_row_start_mi[row];
+    tile->mi_row_end = tiles_info->tile_row_start_mi[row + 1];
+    tile->mi_col_start = tiles_info->tile_col_start_mi[col];
+    tile->mi_col_end = tiles_info->tile_col_start_mi[col + 1];
+    tile->tg_horz_boundary = 0;
+}
+
 
 EbErrorType PictureControlSetCtor(
     EbPtr *object_dbl_ptr,
@@ -170,19 +242,48 @@ EbErrorType PictureControlSetCtor(
     }
 
 
-    // Entropy Coder
-    return_error = EntropyCoderCtor(
-        &objectPtr->entropy_coder_ptr,
-        SEGMENT_ENTROPY_BUFFER_SIZE);
+    // Tiles
+    TilesInfo tiles_info;
+    const int32_t mib_size_log2 = initDataPtr->sb_size_pix == 128 ? 5 : 4;
+    set_tile_info(
+        &tiles_info,
+        initDataPtr->picture_width >> MI_SIZE_LOG2,
+        initDataPtr->picture_height >> MI_SIZE_LOG2,
+        mib_size_log2,
+        initDataPtr->tile_columns,
+        initDataPtr->tile_rows);
+    objectPtr->tile_column_count = (uint16_t)tiles_info.tile_cols;
+    objectPtr->tile_row_count = (uint16_t)tiles_info.tile_rows;
+
+    // Entropy Coders, one per tile sized for the SBs of the tile. The
+    // bitstream unit allocates a quarter of the size it is given, see
+    // output_bitstream_unit_ctor.
+    const uint32_t tile_count = objectPtr->tile_column_count * objectPtr->tile_row_count;
+    EB_MALLOC(EntropyCoder_t**, objectPtr->tile_entropy_coder_ptr_array, sizeof(EntropyCoder_t*) * tile_count, EB_N_PTR);
+    for (uint32_t tile_idx = 0; tile_idx < tile_count; ++tile_idx) {
+        const uint32_t tile_row = tile_idx / objectPtr->tile_column_count;
+        const uint32_t tile_col = tile_idx % objectPtr->tile_column_count;
+        const uint32_t tileSbCols = (tiles_info.tile_col_start_mi[tile_col + 1] - tiles_info.tile_col_start_mi[tile_col] + (1 << mib_size_log2) - 1) >> mib_size_log2;
+        const uint32_t tileSbRows = (tiles_info.tile_row_start_mi[tile_row + 1] - tiles_info.tile_row_start_mi[tile_row] + (1 << mib_size_log2) - 1) >> mib_size_log2;
+
+        return_error = EntropyCoderCtor(
+            &objectPtr->tile_entropy_coder_ptr_array[tile_idx],
+            tileSbCols * tileSbRows * SB_ENTROPY_BUFFER_SIZE(initDataPtr->sb_size_pix, is16bit) * sizeof(uint32_t));
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
     }
+    objectPtr->entropy_coder_ptr = objectPtr->tile_entropy_coder_ptr_array[0];
+    EB_MALLOC(WienerInfo*, objectPtr->wiener_info, sizeof(WienerInfo) * MAX_MB_PLANE * tile_count, EB_N_PTR);
+    EB_MALLOC(SgrprojInfo*, objectPtr->sgrproj_info, sizeof(SgrprojInfo) * MAX_MB_PLANE * tile_count, EB_N_PTR);
+    EB_MALLOC(uint16_t*, objectPtr->entropy_coding_tile_coded_rows, sizeof(uint16_t) * tile_count, EB_N_PTR);
+    EB_MALLOC(EbBool*, objectPtr->entropy_coding_tile_in_progress, sizeof(EbBool) * tile_count, EB_N_PTR);
 
-    // Packetization process Bitstream
+    // Packetization process Bitstream, written in the packet ring
     return_error = BitstreamCtor(
         &objectPtr->bitstreamPtr,
-        PACKETIZATION_PROCESS_BUFFER_SIZE);
+        0);
 
     if (return_error == EB_ErrorInsufficientResources) {
         return EB_ErrorInsufficientResources;
@@ -224,6 +325,17 @@ EbErrorType PictureControlSetCtor(
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
+
+        // Find the tile the SB belongs to
+        {
+            const int32_t sb_mi_row = (sb_index / picture_sb_w) << mib_size_log2;
+            const int32_t sb_mi_col = (sb_index % picture_sb_w) << mib_size_log2;
+            int32_t tile_row = 0;
+            int32_t tile_col = 0;
+            while (sb_mi_row >= tiles_info.tile_row_start_mi[tile_row + 1]) tile_row++;
+            while (sb_mi_col >= tiles_info.tile_col_start_mi[tile_col + 1]) tile_col++;
+            av1_tile_init(&objectPtr->sb_ptr_array[sb_index]->tile_info, &tiles_info, tile_row, tile_col);
+        }
         // Increment the Order in coding order (Raster Scan Order)
         sb_origin_y = (sb_origin_x == picture_sb_w - 1) ? sb_origin_y + 1 : sb_origin_y;
         sb_origin_x = (sb_origin_x == picture_sb_w - 1) ? 0 : sb_origin_x + 1;
@@ -683,145 +795,191 @@ EbErrorType PictureControlSetCtor(
     if (return_error == EB_ErrorInsufficientResources) {
         return EB_ErrorInsufficientResources;
     }
-    // Entropy Coding Neighbor Arrays
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->mode_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
+    // Entropy Coding Neighbor Arrays, one set per tile
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->mode_type_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->partition_context_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->intra_luma_mode_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->skip_flag_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->skip_coeff_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->luma_dc_sign_level_coeff_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->cr_dc_sign_level_coeff_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->cb_dc_sign_level_coeff_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->inter_pred_dir_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit_t**, objectPtr->ref_frame_type_neighbor_array, sizeof(NeighborArrayUnit_t*) * tile_count, EB_N_PTR);
+    EB_MALLOC(NeighborArrayUnit32_t**, objectPtr->interpolation_type_neighbor_array, sizeof(NeighborArrayUnit32_t*) * tile_count, EB_N_PTR);
+    for (uint32_t tile_idx = 0; tile_idx < tile_count; ++tile_idx) {
+        // Each set only covers its tile, rounded up to whole SBs like the tile reset in EC
+        const uint32_t tile_row = tile_idx / objectPtr->tile_column_count;
+        const uint32_t tile_col = tile_idx % objectPtr->tile_column_count;
+        const uint32_t sb_sz = initDataPtr->sb_size_pix;
+        const uint32_t tileOriginX = (uint32_t)tiles_info.tile_col_start_mi[tile_col] << MI_SIZE_LOG2;
+        const uint32_t tileOriginY = (uint32_t)tiles_info.tile_row_start_mi[tile_row] << MI_SIZE_LOG2;
+        const uint32_t tileWidth = ((((uint32_t)tiles_info.tile_col_start_mi[tile_col + 1] << MI_SIZE_LOG2) + sb_sz - 1) / sb_sz) * sb_sz - tileOriginX;
+        const uint32_t tileHeight = ((((uint32_t)tiles_info.tile_row_start_mi[tile_row + 1] << MI_SIZE_LOG2) + sb_sz - 1) / sb_sz) * sb_sz - tileOriginY;
+
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->mode_type_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->partition_context_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(struct PartitionContext),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->partition_context_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(struct PartitionContext),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->skip_flag_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->skip_flag_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->skip_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
-    // for each 4x4
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->luma_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->skip_coeff_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
-    // for each 4x4
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->cr_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+        // for each 4x4
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->luma_dc_sign_level_coeff_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
-    // for each 4x4
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->cb_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+        // for each 4x4
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->cr_dc_sign_level_coeff_neighbor_array[tile_idx],
+            tileOriginX >> 1,
+            tileOriginY >> 1,
+            tileWidth >> 1,
+            tileHeight >> 1,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+        // for each 4x4
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->cb_dc_sign_level_coeff_neighbor_array[tile_idx],
+            tileOriginX >> 1,
+            tileOriginY >> 1,
+            tileWidth >> 1,
+            tileHeight >> 1,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->inter_pred_dir_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->inter_pred_dir_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->ref_frame_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
-    return_error = NeighborArrayUnitCtor32(
-        &objectPtr->interpolation_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint32_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->ref_frame_type_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
-    }
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
+        return_error = NeighborArrayUnitRegionCtor32(
+            &objectPtr->interpolation_type_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint32_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
 
-    return_error = NeighborArrayUnitCtor(
-        &objectPtr->intra_luma_mode_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-    if (return_error == EB_ErrorInsufficientResources) {
-        return EB_ErrorInsufficientResources;
+        return_error = NeighborArrayUnitRegionCtor(
+            &objectPtr->intra_luma_mode_neighbor_array[tile_idx],
+            tileOriginX,
+            tileOriginY,
+            tileWidth,
+            tileHeight,
+            sizeof(uint8_t),
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            PU_NEIGHBOR_ARRAY_GRANULARITY,
+            NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
     }
 
     // Note - non-zero offsets are not supported (to be fixed later in DLF chroma filtering)
@@ -851,6 +1009,9 @@ EbErrorType PictureControlSetCtor(
     EB_CREATEMUTEX(EbHandle, objectPtr->entropy_coding_mutex, sizeof(EbHandle), EB_MUTEX);
 
     EB_CREATEMUTEX(EbHandle, objectPtr->intra_mutex, sizeof(EbHandle), EB_MUTEX);
+#if FILT_PROC
+    EB_CREATEMUTEX(EbHandle, objectPtr->dlf_mutex, sizeof(EbHandle), EB_MUTEX);
+#endif
 
 #if CDEF_M
     EB_CREATEMUTEX(EbHandle, objectPtr->cdef_search_mutex, sizeof(EbHandle), EB_MUTEX);
@@ -924,6 +1085,7 @@ EbErrorType PictureParentControlSetCtor(
     objectPtr->reference_picture_wrapper_ptr = (EbObjectWrapper_t *)EB_NULL;
 
     objectPtr->enhanced_picture_ptr = (EbPictureBufferDesc_t *)EB_NULL;
+    objectPtr->input_release_pending = EB_FALSE;
 
     // GOP
     objectPtr->pred_struct_index = 0;
@@ -1103,6 +1265,14 @@ EbErrorType PictureParentControlSetCtor(
 
     objectPtr->av1_cm->byte_alignment = 0;
 
+    set_tile_info(
+        &objectPtr->av1_cm->tiles_info,
+        objectPtr->av1_cm->mi_cols,
+        objectPtr->av1_cm->mi_rows,
+        initDataPtr->sb_size_pix == 128 ? 5 : 4,
+        initDataPtr->tile_columns,
+        initDataPtr->tile_rows);
+
     set_restoration_unit_size(initDataPtr->picture_width, initDataPtr->picture_height, 1, 1, objectPtr->av1_cm->rst_info);
 
     return_error = av1_alloc_restoration_buffers(objectPtr->av1_cm);
@@ -33,11 +33,17 @@ extern "C" {
 #endif
 
 #define SEGMENT_ENTROPY_BUFFER_SIZE         0x989680// Entropy Bitstream Buffer Size
-#define PACKETIZATION_PROCESS_BUFFER_SIZE SEGMENT_ENTROPY_BUFFER_SIZE
+// Bytes of the temporal delimiter, sequence header and frame headers of a packet,
+// its tiles excluded
+#define PACKETIZATION_HEADERS_MAX_SIZE      0x1000
+// Bitstream bytes of an SB in the worst case, twice its raw 4:2:0 samples (noise
+// at the lowest QP codes to about 1.7 times). A tile coding to more than that
+// fails its encode, see EncodeSliceFinish.
+#define SB_ENTROPY_BUFFER_SIZE(sbSize, is16bit) ((3 * (sbSize) * (sbSize)) << ((is16bit) ? 1 : 0))
 #define HISTOGRAM_NUMBER_OF_BINS            256
 #define MAX_NUMBER_OF_REGIONS_IN_WIDTH      4
 #define MAX_NUMBER_OF_REGIONS_IN_HEIGHT     4
-#define MAX_REF_QP_NUM                      52
+#define MAX_REF_QP_NUM                      64
 
     // Segment Macros
 #define SEGMENT_MAX_COUNT   64
@@ -13572,6 +13578,21 @@ extern "C" {
 
     struct PredictionUnit_s;
 
+    // Uniformly spaced tiles, see tile_info() of the AV1 specification
+    typedef struct TilesInfo {
+        int32_t max_tile_width_sb;
+        int32_t min_log2_tile_cols;
+        int32_t max_log2_tile_cols;
+        int32_t max_log2_tile_rows;
+        int32_t min_log2_tile_rows;
+        int32_t min_log2_tiles;
+        int32_t tile_cols, tile_rows;
+        int32_t log2_tile_cols;
+        int32_t log2_tile_rows;
+        int32_t tile_col_start_mi[MAX_TILE_COLS + 1];  // valid for 0 <= i <= tile_cols
+        int32_t tile_row_start_mi[MAX_TILE_ROWS + 1];  // valid for 0 <= i <= tile_rows
+    } TilesInfo;
+
     typedef struct Av1Common {
 
         int32_t  mi_rows;
@@ -13599,21 +13620,7 @@ extern "C" {
         int32_t *rst_tmpbuf;
         Yv12BufferConfig *frame_to_show;
         int32_t byte_alignment;
-        int32_t tile_cols, tile_rows;
-        int32_t last_tile_cols, last_tile_rows;
-        int32_t max_tile_width_sb;
-        int32_t min_log2_tile_cols;
-        int32_t max_log2_tile_cols;
-        int32_t max_log2_tile_rows;
-        int32_t min_log2_tile_rows;
-        int32_t min_log2_tiles;
-        int32_t max_tile_height_sb;
-        int32_t uniform_tile_spacing_flag;
-        int32_t log2_tile_cols;                        // only valid for uniform tiles
-        int32_t log2_tile_rows;                        // only valid for uniform tiles
-        int32_t tile_col_start_sb[MAX_TILE_COLS + 1];  // valid for 0 <= i <= tile_cols
-        int32_t tile_row_start_sb[MAX_TILE_ROWS + 1];  // valid for 0 <= i <= tile_rows
-        int32_t tile_width, tile_height;               // In MI units
+        TilesInfo tiles_info;
         struct PictureParentControlSet_s               *p_pcs_ptr;
     } Av1Common;
 
@@ -13678,6 +13685,10 @@ extern "C" {
         struct PictureParentControlSet_s     *parent_pcs_ptr;  //The parent of this PCS.
         EbObjectWrapper_t                    *picture_parent_control_set_wrapper_ptr;
         EntropyCoder_t                       *entropy_coder_ptr;
+        // One entropy coder per tile, in raster order, the first one is entropy_coder_ptr
+        EntropyCoder_t                      **tile_entropy_coder_ptr_array;
+        uint16_t                              tile_column_count;
+        uint16_t                              tile_row_count;
         // Packetization (used to encode SPS, PPS, etc)
         Bitstream_t                          *bitstreamPtr;
 
@@ -13694,15 +13705,31 @@ extern "C" {
         EncDecSegments_t                     *enc_dec_segment_ctrl;
 
         // Entropy Process Rows
-        int8_t                                entropy_coding_current_available_row;
         EbBool                                entropy_coding_row_array[MAX_LCU_ROWS];
-        int8_t                                entropy_coding_current_row;
         int8_t                                entropy_coding_row_count;
         EbHandle                              entropy_coding_mutex;
-        EbBool                                entropy_coding_in_progress;
-        EbBool                                entropy_coding_pic_done;
+        // Entropy Process Tiles, each tile is coded row by row independently of the others
+        uint16_t                             *entropy_coding_tile_coded_rows;
+        EbBool                               *entropy_coding_tile_in_progress;
+        uint16_t                              entropy_coding_tile_done_count;
+        uint16_t                              entropy_coding_row_tile_done_count[MAX_LCU_ROWS];
+        uint32_t                              entropy_coding_row_bits[MAX_LCU_ROWS];
         EbHandle                              intra_mutex;
         uint32_t                              intra_coded_area;
+#if FILT_PROC
+        // Deblocking Rows, the SB rows are deblocked as soon as EncDec is done with them
+        EbHandle                              dlf_mutex;
+        uint8_t                               dlf_row_state[MAX_LCU_ROWS];
+        uint16_t                              dlf_row_count;
+        uint16_t                              dlf_encoded_row_count;
+        uint16_t                              dlf_vert_row_index;
+        uint16_t                              dlf_horz_row_index;
+        EbBool                                dlf_horz_in_progress;
+        EbBool                                dlf_level_ready;
+        EbBool                                dlf_level_in_progress;
+        uint16_t                              dlf_feedback_count;
+        EbBool                                dlf_pic_done;
+#endif
 #if CDEF_M
         uint32_t                              tot_seg_searched_cdef;
         EbHandle                              cdef_search_mutex;
@@ -13807,18 +13834,18 @@ extern "C" {
         NeighborArrayUnit_t                  *amvp_mv_merge_mv_neighbor_array;
         NeighborArrayUnit_t                  *amvp_mv_merge_mode_type_neighbor_array;
 
-        // Entropy Coding Neighbor Arrays
-        NeighborArrayUnit_t                  *mode_type_neighbor_array;
-        NeighborArrayUnit_t                  *partition_context_neighbor_array;
-        NeighborArrayUnit_t                  *intra_luma_mode_neighbor_array;
-        NeighborArrayUnit_t                  *skip_flag_neighbor_array;
-        NeighborArrayUnit_t                  *skip_coeff_neighbor_array;
-        NeighborArrayUnit_t                  *luma_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits (COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit_t                  *cr_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit_t                  *cb_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit_t                  *inter_pred_dir_neighbor_array;
-        NeighborArrayUnit_t                  *ref_frame_type_neighbor_array;
-        NeighborArrayUnit32_t                *interpolation_type_neighbor_array;
+        // Entropy Coding Neighbor Arrays, one per tile so that the tiles can be coded concurrently
+        NeighborArrayUnit_t                 **mode_type_neighbor_array;
+        NeighborArrayUnit_t                 **partition_context_neighbor_array;
+        NeighborArrayUnit_t                 **intra_luma_mode_neighbor_array;
+        NeighborArrayUnit_t                 **skip_flag_neighbor_array;
+        NeighborArrayUnit_t                 **skip_coeff_neighbor_array;
+        NeighborArrayUnit_t                 **luma_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits (COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit_t                 **cr_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit_t                 **cb_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit_t                 **inter_pred_dir_neighbor_array;
+        NeighborArrayUnit_t                 **ref_frame_type_neighbor_array;
+        NeighborArrayUnit32_t               **interpolation_type_neighbor_array;
 
         ModeInfo                            **mi_grid_base; //2 SB Rows of mi Data are enough
         ModeInfo                             *mip;
@@ -13842,9 +13869,9 @@ extern "C" {
         uint8_t                               high_intra_slection;
         EB_FRAME_CARACTERICTICS               scene_caracteristic_id;
         EbBool                                limit_intra;
-        int32_t                               cdef_preset[4];
-        WienerInfo                            wiener_info[MAX_MB_PLANE];
-        SgrprojInfo                           sgrproj_info[MAX_MB_PLANE];
+        // Loop restoration coefficient references, MAX_MB_PLANE per tile
+        WienerInfo                           *wiener_info;
+        SgrprojInfo                          *sgrproj_info;
 
     } PictureControlSet_t;
 
@@ -13925,6 +13952,12 @@ extern "C" {
 
         EbBufferHeaderType                   *input_ptr;            // input picture buffer 
 
+        // Zero copy input, enhanced_picture_ptr references the application
+        //   planes until the picture control set is released
+        EbBool                                input_release_pending;
+        void                                 *input_app_private;
+        int64_t                               input_pts;
+
         EbBool                                idr_flag;
         EbBool                                cra_flag;
         EbBool                                open_gop_cra_flag;
@@ -13958,6 +13991,12 @@ extern "C" {
         EbBool                                tables_updated;
         EbBool                                percentage_updated;
         uint32_t                              target_bit_rate;
+        uint8_t                               base_qp;                  // qp of rate_control_mode 0
+        uint8_t                               max_qp_allowed;
+        uint8_t                               min_qp_allowed;
+        int32_t                               intra_period_length;
+        uint64_t                              intra_period_start;       // picture the intra periods are counted from
+        uint32_t                              rate_control_generation;  // updates of the settings above so far
         EbBool                                min_target_rate_assigned;
         uint32_t                              frame_rate;
         uint16_t                              sb_total_count;
@@ -14116,6 +14155,7 @@ extern "C" {
         EbPictureDepthMode                    pic_depth_mode;
         uint8_t                               interpolation_filter_search_mode;
         uint8_t                               loop_filter_mode;
+        LPF_PICK_METHOD                       lpf_pick_method;
         uint8_t                               intra_pred_mode;
         //**********************************************************************************************************//
         FRAME_TYPE                            av1FrameType;
@@ -14292,6 +14332,8 @@ extern "C" {
         uint32_t                           encoder_bit_depth;
         EbBool                             ext_block_flag;
         EbBool                             in_loop_me_flag;
+        uint32_t                           tile_columns;
+        uint32_t                           tile_rows;
 
     } PictureControlSetInitData_t;
 
@@ -14532,6 +14574,20 @@ extern "C" {
         EbPtr *object_dbl_ptr,
         EbPtr object_init_data_ptr);
 
+    extern void set_tile_info(
+        TilesInfo *tiles_info,
+        int32_t    mi_cols,
+        int32_t    mi_rows,
+        int32_t    mib_size_log2,
+        int32_t    log2_tile_cols,
+        int32_t    log2_tile_rows);
+
+    extern void av1_tile_init(
+        TileInfo        *tile,
+        const TilesInfo *tiles_info,
+        int32_t          row,
+        int32_t          col);
+
 
 #ifdef __cplusplus
 }
@@ -401,6 +401,20 @@ EbErrorType signal_derivation_multi_processes_oq(
         picture_control_set_ptr->loop_filter_mode = 0;
     }
 
+    // Loop filter level selection in DLF            Settings
+    // LPF_PICK_FROM_FULL_IMAGE                     Search over the whole picture
+    // LPF_PICK_FROM_SB_SAMPLES                     Search over a sample of the SBs
+    // LPF_PICK_FROM_SUBIMAGE                       Search over a band of SB rows
+    // The LIGHT loop filter mode picks the level from the quantizer in EncDec
+    if (picture_control_set_ptr->loop_filter_mode == 2) {
+        if (picture_control_set_ptr->enc_mode <= ENC_M0)
+            picture_control_set_ptr->lpf_pick_method = LPF_PICK_FROM_FULL_IMAGE;
+        else if (picture_control_set_ptr->enc_mode <= ENC_M1)
+            picture_control_set_ptr->lpf_pick_method = LPF_PICK_FROM_SB_SAMPLES;
+        else
+            picture_control_set_ptr->lpf_pick_method = LPF_PICK_FROM_SUBIMAGE;
+    }
+
     // Loop filter Level                            Settings
     // 0                                            LIGHT: disable_z2_prediction && disable_angle_refinement
     // 1                                            FULL
@@ -546,9 +560,11 @@ void  Av1GenerateRpsInfo(
     {
 
         //Reset miniGop Toggling. The first miniGop after a KEY frame has toggle=0
+        //A shown Key Frame refreshes the whole DPB, also when forced in the middle of the sequence
         if (picture_control_set_ptr->av1FrameType == KEY_FRAME)
         {
             context_ptr->miniGopToggle = 0;
+            av1Rps->refreshFrameMask = 0xFF;
             picture_control_set_ptr->showFrame = EB_TRUE;
             picture_control_set_ptr->hasShowExisting = EB_FALSE;
             return;
@@ -877,6 +893,7 @@ void* PictureDecisionKernel(void *input_ptr)
         picture_control_set_ptr = (PictureParentControlSet_t*)inputResultsPtr->pictureControlSetWrapperPtr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
         encode_context_ptr = (EncodeContext_t*)sequence_control_set_ptr->encode_context_ptr;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
 
         loopCount++;
 
@@ -981,28 +998,32 @@ void* PictureDecisionKernel(void *input_ptr)
 
 
                 picture_control_set_ptr->pred_structure = EB_PRED_RANDOM_ACCESS;
-                picture_control_set_ptr->target_bit_rate = sequence_control_set_ptr->static_config.target_bit_rate;
 
                 ReleasePrevPictureFromReorderQueue(
                     encode_context_ptr);
 
+                // A new intra period length restarts the intra period at the picture
+                if (picture_control_set_ptr->intra_period_start == picture_control_set_ptr->picture_number && picture_control_set_ptr->picture_number != 0) {
+                    encode_context_ptr->intra_period_position = (uint32_t)picture_control_set_ptr->intra_period_length;
+                }
+
                 // If the Intra period length is 0, then introduce an intra for every picture
-                if (sequence_control_set_ptr->intra_period_length == 0) {
+                if (picture_control_set_ptr->intra_period_length == 0) {
                     picture_control_set_ptr->cra_flag = EB_TRUE;
                 }
                 // If an #IntraPeriodLength has passed since the last Intra, then introduce a CRA or IDR based on Intra Refresh type
-                else if (sequence_control_set_ptr->intra_period_length != -1) {
+                else if (picture_control_set_ptr->intra_period_length != -1) {
                     picture_control_set_ptr->cra_flag =
                         (sequence_control_set_ptr->intra_refresh_type != CRA_REFRESH) ?
                         picture_control_set_ptr->cra_flag :
-                        (encode_context_ptr->intra_period_position == (uint32_t)sequence_control_set_ptr->intra_period_length) ?
+                        (encode_context_ptr->intra_period_position == (uint32_t)picture_control_set_ptr->intra_period_length) ?
                         EB_TRUE :
                         picture_control_set_ptr->cra_flag;
 
                     picture_control_set_ptr->idr_flag =
                         (sequence_control_set_ptr->intra_refresh_type != IDR_REFRESH) ?
                         picture_control_set_ptr->idr_flag :
-                        (encode_context_ptr->intra_period_position == (uint32_t)sequence_control_set_ptr->intra_period_length) ?
+                        (encode_context_ptr->intra_period_position == (uint32_t)picture_control_set_ptr->intra_period_length) ?
                         EB_TRUE :
                         picture_control_set_ptr->idr_flag;
 
@@ -1018,12 +1039,12 @@ void* PictureDecisionKernel(void *input_ptr)
                 if (sequence_control_set_ptr->static_config.rate_control_mode)
                 {
                     // Increment the Intra Period Position
-                    encode_context_ptr->intra_period_position = (encode_context_ptr->intra_period_position == (uint32_t)sequence_control_set_ptr->intra_period_length) ? 0 : encode_context_ptr->intra_period_position + 1;
+                    encode_context_ptr->intra_period_position = (encode_context_ptr->intra_period_position == (uint32_t)picture_control_set_ptr->intra_period_length) ? 0 : encode_context_ptr->intra_period_position + 1;
                 }
                 else
                 {
                     // Increment the Intra Period Position
-                    encode_context_ptr->intra_period_position = ((encode_context_ptr->intra_period_position == (uint32_t)sequence_control_set_ptr->intra_period_length) || (picture_control_set_ptr->scene_change_flag == EB_TRUE)) ? 0 : encode_context_ptr->intra_period_position + 1;
+                    encode_context_ptr->intra_period_position = ((encode_context_ptr->intra_period_position == (uint32_t)picture_control_set_ptr->intra_period_length) || (picture_control_set_ptr->scene_change_flag == EB_TRUE)) ? 0 : encode_context_ptr->intra_period_position + 1;
                 }
 
                 // Determine if Pictures can be released from the Pre-Assignment Buffer
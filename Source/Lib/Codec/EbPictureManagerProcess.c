@@ -156,6 +156,7 @@ void* PictureManagerKernel(void *input_ptr)
 
             picture_control_set_ptr = (PictureParentControlSet_t*)inputPictureDemuxPtr->pictureControlSetWrapperPtr->objectPtr;
             sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+            EbTracePicture(picture_control_set_ptr->picture_number, 0);
             encode_context_ptr = sequence_control_set_ptr->encode_context_ptr;
 
             //printf("\nPicture Manager Process @ %d \n ", picture_control_set_ptr->picture_number);
@@ -538,15 +539,33 @@ void* PictureManagerKernel(void *input_ptr)
                         {
                             unsigned rowIndex;
 
-                            ChildPictureControlSetPtr->entropy_coding_current_row = 0;
-                            ChildPictureControlSetPtr->entropy_coding_current_available_row = 0;
+                            const uint32_t tile_count = ChildPictureControlSetPtr->tile_column_count * ChildPictureControlSetPtr->tile_row_count;
+
                             ChildPictureControlSetPtr->entropy_coding_row_count = picture_height_in_sb;
-                            ChildPictureControlSetPtr->entropy_coding_in_progress = EB_FALSE;
+                            ChildPictureControlSetPtr->entropy_coding_tile_done_count = 0;
 
                             for (rowIndex = 0; rowIndex < MAX_LCU_ROWS; ++rowIndex) {
                                 ChildPictureControlSetPtr->entropy_coding_row_array[rowIndex] = EB_FALSE;
+                                ChildPictureControlSetPtr->entropy_coding_row_tile_done_count[rowIndex] = 0;
+                                ChildPictureControlSetPtr->entropy_coding_row_bits[rowIndex] = 0;
                             }
+
+                            EB_MEMSET(ChildPictureControlSetPtr->entropy_coding_tile_coded_rows, 0, sizeof(uint16_t) * tile_count);
+                            EB_MEMSET(ChildPictureControlSetPtr->entropy_coding_tile_in_progress, 0, sizeof(EbBool) * tile_count);
                         }
+#if FILT_PROC
+                        // Deblocking Rows
+                        ChildPictureControlSetPtr->dlf_row_count = (uint16_t)picture_height_in_sb;
+                        ChildPictureControlSetPtr->dlf_encoded_row_count = 0;
+                        ChildPictureControlSetPtr->dlf_vert_row_index = 0;
+                        ChildPictureControlSetPtr->dlf_horz_row_index = 0;
+                        ChildPictureControlSetPtr->dlf_horz_in_progress = EB_FALSE;
+                        ChildPictureControlSetPtr->dlf_level_ready = EB_FALSE;
+                        ChildPictureControlSetPtr->dlf_level_in_progress = EB_FALSE;
+                        ChildPictureControlSetPtr->dlf_feedback_count = 0;
+                        ChildPictureControlSetPtr->dlf_pic_done = EB_FALSE;
+                        EB_MEMSET(ChildPictureControlSetPtr->dlf_row_state, 0, sizeof(uint8_t) * MAX_LCU_ROWS);
+#endif
                         // Picture edges
                         ConfigurePictureEdges(entrySequenceControlSetPtr, ChildPictureControlSetPtr);
 
@@ -663,6 +663,81 @@ void UnPack2D(
         height);
 }
 
+void UnPackShift2D(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *out8BitBuffer,
+    uint32_t       out8Stride,
+    uint8_t       *outnBitBuffer,
+    uint32_t       outnStride,
+    uint32_t       shift,
+    uint32_t       width,
+    uint32_t       height,
+    EbAsm       asm_type
+)
+{
+    UnPackShift2D_funcPtrArray[asm_type](
+        in16BitBuffer,
+        inStride,
+        out8BitBuffer,
+        outnBitBuffer,
+        out8Stride,
+        outnStride,
+        shift,
+        width,
+        height);
+}
+
+void Deinterleave2D(
+    uint8_t       *inBuffer,
+    uint32_t       inStride,
+    uint8_t       *outCbBuffer,
+    uint8_t       *outCrBuffer,
+    uint32_t       outStride,
+    uint32_t       width,
+    uint32_t       height,
+    EbAsm       asm_type
+)
+{
+    Deinterleave2D_funcPtrArray[asm_type](
+        inBuffer,
+        inStride,
+        outCbBuffer,
+        outCrBuffer,
+        outStride,
+        width,
+        height);
+}
+
+void UnPackDeinterleave2D(
+    uint16_t      *in16BitBuffer,
+    uint32_t       inStride,
+    uint8_t       *outCb8BitBuffer,
+    uint8_t       *outCr8BitBuffer,
+    uint32_t       out8Stride,
+    uint8_t       *outCbnBitBuffer,
+    uint8_t       *outCrnBitBuffer,
+    uint32_t       outnStride,
+    uint32_t       shift,
+    uint32_t       width,
+    uint32_t       height,
+    EbAsm       asm_type
+)
+{
+    UnPackDeinterleave2D_funcPtrArray[asm_type](
+        in16BitBuffer,
+        inStride,
+        outCb8BitBuffer,
+        outCr8BitBuffer,
+        outCbnBitBuffer,
+        outCrnBitBuffer,
+        out8Stride,
+        outnStride,
+        shift,
+        width,
+        height);
+}
+
 void Pack2D_SRC(
     uint8_t     *in8BitBuffer,
     uint32_t     in8Stride,
@@ -115,6 +115,44 @@ extern "C" {
         uint32_t       height,
         EbAsm          asm_type);
 
+    // 10 bit samples shifted left by shift bits within their 16 bit words
+    void UnPackShift2D(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *out8BitBuffer,
+        uint32_t       out8Stride,
+        uint8_t       *outnBitBuffer,
+        uint32_t       outnStride,
+        uint32_t       shift,
+        uint32_t       width,
+        uint32_t       height,
+        EbAsm          asm_type);
+
+    // Splits an interleaved Cb Cr plane, width in samples of one component
+    void Deinterleave2D(
+        uint8_t       *inBuffer,
+        uint32_t       inStride,
+        uint8_t       *outCbBuffer,
+        uint8_t       *outCrBuffer,
+        uint32_t       outStride,
+        uint32_t       width,
+        uint32_t       height,
+        EbAsm          asm_type);
+
+    void UnPackDeinterleave2D(
+        uint16_t      *in16BitBuffer,
+        uint32_t       inStride,
+        uint8_t       *outCb8BitBuffer,
+        uint8_t       *outCr8BitBuffer,
+        uint32_t       out8Stride,
+        uint8_t       *outCbnBitBuffer,
+        uint8_t       *outCrnBitBuffer,
+        uint32_t       outnStride,
+        uint32_t       shift,
+        uint32_t       width,
+        uint32_t       height,
+        EbAsm          asm_type);
+
     void extract_8bit_data(
         uint16_t      *in16BitBuffer,
         uint32_t       inStride,
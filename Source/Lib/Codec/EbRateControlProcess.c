@@ -343,9 +343,74 @@ EbErrorType RateControlContextCtor(
     context_ptr->extraBitsGen = 0;
     context_ptr->maxRateAdjustDeltaQP = 0;
 
+    context_ptr->virtualBufferSize = 0;
+    context_ptr->rateControlGeneration = 0;
+    context_ptr->intraPeriodStart = 0;
+
 
     return EB_ErrorNone;
 }
+
+/*****************************************************
+* Sets the channel bit rates and the virtual buffer of
+* the high level RC for a new target bit rate. The
+* buffer levels keep their fullness.
+*****************************************************/
+static void RateControlSetTargetBitRate(
+    RateControlContext_t              *context_ptr,
+    SequenceControlSet_t              *sequence_control_set_ptr,
+    uint32_t                           target_bit_rate)
+{
+    HighLevelRateControlContext_t *highLevelRateControlPtr = context_ptr->highLevelRateControlPtr;
+    uint64_t                       previousVirtualBufferSize = context_ptr->virtualBufferSize;
+
+    highLevelRateControlPtr->target_bit_rate = target_bit_rate;
+    highLevelRateControlPtr->channelBitRatePerFrame = (uint64_t)MAX((int64_t)1, (int64_t)((highLevelRateControlPtr->target_bit_rate << RC_PRECISION) / highLevelRateControlPtr->frame_rate));
+
+    highLevelRateControlPtr->channelBitRatePerSw = highLevelRateControlPtr->channelBitRatePerFrame * (sequence_control_set_ptr->static_config.look_ahead_distance + 1);
+    highLevelRateControlPtr->bitConstraintPerSw = highLevelRateControlPtr->channelBitRatePerSw;
+
+#if RC_UPDATE_TARGET_RATE
+    highLevelRateControlPtr->previousUpdatedBitConstraintPerSw = highLevelRateControlPtr->channelBitRatePerSw;
+#endif
+
+    context_ptr->virtualBufferSize = (((uint64_t)target_bit_rate * 3) << RC_PRECISION) / (context_ptr->frame_rate);
+    context_ptr->vbFillThreshold1 = (context_ptr->virtualBufferSize * 6) >> 3;
+    context_ptr->vbFillThreshold2 = (context_ptr->virtualBufferSize << 3) >> 3;
+
+    if (previousVirtualBufferSize) {
+        context_ptr->virtualBufferLevelInitialValue = context_ptr->virtualBufferSize >> 1;
+        context_ptr->virtualBufferLevel = context_ptr->virtualBufferLevel * (int64_t)context_ptr->virtualBufferSize / (int64_t)previousVirtualBufferSize;
+        context_ptr->previousVirtualBufferLevel = context_ptr->previousVirtualBufferLevel * (int64_t)context_ptr->virtualBufferSize / (int64_t)previousVirtualBufferSize;
+    }
+}
+
+/*****************************************************
+* Lays the intervals out from firstPoc on for a new
+* intra period length. The interval holding firstPoc
+* ends before it.
+*****************************************************/
+static void RateControlSetIntraPeriod(
+    RateControlContext_t              *context_ptr,
+    uint64_t                           firstPoc,
+    int32_t                            intra_period_length)
+{
+    uint32_t intervalIndex = 0;
+
+    context_ptr->intraPeriodStart = firstPoc;
+
+    while (intervalIndex < PARALLEL_GOP_MAX_NUMBER && context_ptr->rateControlParamQueue[intervalIndex]->lastPoc < firstPoc)
+        intervalIndex++;
+
+    if (intervalIndex < PARALLEL_GOP_MAX_NUMBER && context_ptr->rateControlParamQueue[intervalIndex]->firstPoc < firstPoc)
+        context_ptr->rateControlParamQueue[intervalIndex++]->lastPoc = firstPoc - 1;
+
+    for (; intervalIndex < PARALLEL_GOP_MAX_NUMBER; intervalIndex++) {
+        context_ptr->rateControlParamQueue[intervalIndex]->firstPoc = firstPoc;
+        context_ptr->rateControlParamQueue[intervalIndex]->lastPoc = firstPoc + intra_period_length;
+        firstPoc += intra_period_length + 1;
+    }
+}
 void HighLevelRcInputPictureMode2(
     PictureParentControlSet_t         *picture_control_set_ptr,
     SequenceControlSet_t              *sequence_control_set_ptr,
@@ -428,7 +493,7 @@ void HighLevelRcInputPictureMode2(
 
         }
         // For the case that number of frames in the sliding window is less than size of the look ahead or intra Refresh. i.e. end of sequence
-        if ((picture_control_set_ptr->frames_in_sw < MIN(sequence_control_set_ptr->static_config.look_ahead_distance + 1, (uint32_t)sequence_control_set_ptr->intra_period_length + 1))) {
+        if ((picture_control_set_ptr->frames_in_sw < MIN(sequence_control_set_ptr->static_config.look_ahead_distance + 1, (uint32_t)picture_control_set_ptr->intra_period_length + 1))) {
 
             selectedRefQp = max_coded_poc_selected_ref_qp;
 
@@ -446,11 +511,11 @@ void HighLevelRcInputPictureMode2(
                 selectedRefQp += 1;
             }
 
-            if ((picture_control_set_ptr->frames_in_sw < (uint32_t)(sequence_control_set_ptr->intra_period_length + 1)) &&
-                (picture_control_set_ptr->picture_number % ((sequence_control_set_ptr->intra_period_length + 1)) == 0)) {
+            if ((picture_control_set_ptr->frames_in_sw < (uint32_t)(picture_control_set_ptr->intra_period_length + 1)) &&
+                ((picture_control_set_ptr->picture_number - picture_control_set_ptr->intra_period_start) % ((picture_control_set_ptr->intra_period_length + 1)) == 0)) {
                 selectedRefQp = (uint32_t)CLIP3(
-                    sequence_control_set_ptr->static_config.min_qp_allowed,
-                    sequence_control_set_ptr->static_config.max_qp_allowed,
+                    picture_control_set_ptr->min_qp_allowed,
+                    picture_control_set_ptr->max_qp_allowed,
                     selectedRefQp + 1);
             }
 
@@ -466,8 +531,8 @@ void HighLevelRcInputPictureMode2(
                 hlRateControlHistogramPtrTemp = (encode_context_ptr->hl_rate_control_historgram_queue[queueEntryIndexTemp]);
                 refQpIndexTemp = selectedRefQp + QP_OFFSET_LAYER_ARRAY[hlRateControlHistogramPtrTemp->temporal_layer_index];
                 refQpIndexTemp = (uint32_t)CLIP3(
-                    sequence_control_set_ptr->static_config.min_qp_allowed,
-                    sequence_control_set_ptr->static_config.max_qp_allowed,
+                    picture_control_set_ptr->min_qp_allowed,
+                    picture_control_set_ptr->max_qp_allowed,
                     refQpIndexTemp);
 
                 if (hlRateControlHistogramPtrTemp->slice_type == I_SLICE) {
@@ -526,13 +591,13 @@ void HighLevelRcInputPictureMode2(
             // Loop over the QPs and find the best QP
             minLaBitDistance = MAX_UNSIGNED_VALUE;
             qpSearchMin = (uint8_t)CLIP3(
-                sequence_control_set_ptr->static_config.min_qp_allowed,
-                sequence_control_set_ptr->static_config.max_qp_allowed,
+                picture_control_set_ptr->min_qp_allowed,
+                picture_control_set_ptr->max_qp_allowed,
                 (uint32_t)MAX((int32_t)sequence_control_set_ptr->qp - 20, 0));
 
             qpSearchMax = (uint8_t)CLIP3(
-                sequence_control_set_ptr->static_config.min_qp_allowed,
-                sequence_control_set_ptr->static_config.max_qp_allowed,
+                picture_control_set_ptr->min_qp_allowed,
+                picture_control_set_ptr->max_qp_allowed,
                 sequence_control_set_ptr->qp + 20);
 
             for (refQpTableIndex = qpSearchMin; refQpTableIndex < qpSearchMax; refQpTableIndex++) {
@@ -570,8 +635,8 @@ void HighLevelRcInputPictureMode2(
             while (refQpTableIndex >= qpSearchMin && refQpTableIndex <= qpSearchMax && !bestQpFound) {
 
                 refQpIndex = CLIP3(
-                    sequence_control_set_ptr->static_config.min_qp_allowed,
-                    sequence_control_set_ptr->static_config.max_qp_allowed,
+                    picture_control_set_ptr->min_qp_allowed,
+                    picture_control_set_ptr->max_qp_allowed,
                     refQpListTable[refQpTableIndex]);
                 highLevelRateControlPtr->predBitsRefQpPerSw[refQpIndex] = 0;
 
@@ -594,8 +659,8 @@ void HighLevelRcInputPictureMode2(
 
                     refQpIndexTemp = refQpIndex + QP_OFFSET_LAYER_ARRAY[hlRateControlHistogramPtrTemp->temporal_layer_index];
                     refQpIndexTemp = (uint32_t)CLIP3(
-                        sequence_control_set_ptr->static_config.min_qp_allowed,
-                        sequence_control_set_ptr->static_config.max_qp_allowed,
+                        picture_control_set_ptr->min_qp_allowed,
+                        picture_control_set_ptr->max_qp_allowed,
                         refQpIndexTemp);
 
                     if (hlRateControlHistogramPtrTemp->slice_type == I_SLICE) {
@@ -687,8 +752,8 @@ void HighLevelRcInputPictureMode2(
 
 #if RC_UPDATE_TARGET_RATE
         selectedOrgRefQp = selectedRefQp;
-        if (sequence_control_set_ptr->intra_period_length != -1 && picture_control_set_ptr->picture_number % ((sequence_control_set_ptr->intra_period_length + 1)) == 0 &&
-            (int32_t)picture_control_set_ptr->frames_in_sw > sequence_control_set_ptr->intra_period_length) {
+        if (picture_control_set_ptr->intra_period_length != -1 && (picture_control_set_ptr->picture_number - picture_control_set_ptr->intra_period_start) % ((picture_control_set_ptr->intra_period_length + 1)) == 0 &&
+            (int32_t)picture_control_set_ptr->frames_in_sw > picture_control_set_ptr->intra_period_length) {
             if (picture_control_set_ptr->picture_number > 0) {
                 picture_control_set_ptr->intra_selected_org_qp = (uint8_t)selectedRefQp;
             }
@@ -724,8 +789,8 @@ void HighLevelRcInputPictureMode2(
 
                     refQpIndexTemp = refQpIndex + QP_OFFSET_LAYER_ARRAY[hlRateControlHistogramPtrTemp->temporal_layer_index];
                     refQpIndexTemp = (uint32_t)CLIP3(
-                        sequence_control_set_ptr->static_config.min_qp_allowed,
-                        sequence_control_set_ptr->static_config.max_qp_allowed,
+                        picture_control_set_ptr->min_qp_allowed,
+                        picture_control_set_ptr->max_qp_allowed,
                         refQpIndexTemp);
 
                     if (hlRateControlHistogramPtrTemp->slice_type == I_SLICE) {
@@ -800,12 +865,12 @@ void HighLevelRcInputPictureMode2(
         picture_control_set_ptr->tables_updated = tables_updated;
         EbBool expensiveISlice = EB_FALSE;
         // Looping over the window to find the percentage of bit allocation in each layer
-        if ((sequence_control_set_ptr->intra_period_length != -1) &&
-            ((int32_t)picture_control_set_ptr->frames_in_sw > sequence_control_set_ptr->intra_period_length) &&
-            ((int32_t)picture_control_set_ptr->frames_in_sw > sequence_control_set_ptr->intra_period_length)) {
+        if ((picture_control_set_ptr->intra_period_length != -1) &&
+            ((int32_t)picture_control_set_ptr->frames_in_sw > picture_control_set_ptr->intra_period_length) &&
+            ((int32_t)picture_control_set_ptr->frames_in_sw > picture_control_set_ptr->intra_period_length)) {
             uint64_t iSliceBits = 0;
 
-            if (picture_control_set_ptr->picture_number % ((sequence_control_set_ptr->intra_period_length + 1)) == 0) {
+            if ((picture_control_set_ptr->picture_number - picture_control_set_ptr->intra_period_start) % ((picture_control_set_ptr->intra_period_length + 1)) == 0) {
 
                 queueEntryIndexHeadTemp = (int32_t)(picture_control_set_ptr->picture_number - encode_context_ptr->hl_rate_control_historgram_queue[encode_context_ptr->hl_rate_control_historgram_queue_head_index]->picture_number);
                 queueEntryIndexHeadTemp += encode_context_ptr->hl_rate_control_historgram_queue_head_index;
@@ -819,15 +884,15 @@ void HighLevelRcInputPictureMode2(
                 end_of_sequence_flag = EB_FALSE;
 
                 while (!end_of_sequence_flag &&
-                    queueEntryIndexTemp <= queueEntryIndexHeadTemp + sequence_control_set_ptr->intra_period_length) {
+                    queueEntryIndexTemp <= queueEntryIndexHeadTemp + picture_control_set_ptr->intra_period_length) {
 
                     queueEntryIndexTemp2 = (queueEntryIndexTemp > HIGH_LEVEL_RATE_CONTROL_HISTOGRAM_QUEUE_MAX_DEPTH - 1) ? queueEntryIndexTemp - HIGH_LEVEL_RATE_CONTROL_HISTOGRAM_QUEUE_MAX_DEPTH : queueEntryIndexTemp;
                     hlRateControlHistogramPtrTemp = (encode_context_ptr->hl_rate_control_historgram_queue[queueEntryIndexTemp2]);
 
                     refQpIndexTemp = selectedRefQp + QP_OFFSET_LAYER_ARRAY[hlRateControlHistogramPtrTemp->temporal_layer_index];
                     refQpIndexTemp = (uint32_t)CLIP3(
-                        sequence_control_set_ptr->static_config.min_qp_allowed,
-                        sequence_control_set_ptr->static_config.max_qp_allowed,
+                        picture_control_set_ptr->min_qp_allowed,
+                        picture_control_set_ptr->max_qp_allowed,
                         refQpIndexTemp);
 
                     if (hlRateControlHistogramPtrTemp->slice_type == I_SLICE) {
@@ -866,8 +931,8 @@ void HighLevelRcInputPictureMode2(
                 selectedRefQp = (uint32_t)MAX((int32_t)selectedRefQp - 3, 0);
             }
             selectedRefQp = (uint32_t)CLIP3(
-                sequence_control_set_ptr->static_config.min_qp_allowed,
-                sequence_control_set_ptr->static_config.max_qp_allowed,
+                picture_control_set_ptr->min_qp_allowed,
+                picture_control_set_ptr->max_qp_allowed,
                 selectedRefQp);
         }
         // Set the QP
@@ -882,8 +947,8 @@ void HighLevelRcInputPictureMode2(
 
         }
         picture_control_set_ptr->best_pred_qp = (uint8_t)CLIP3(
-            sequence_control_set_ptr->static_config.min_qp_allowed,
-            sequence_control_set_ptr->static_config.max_qp_allowed,
+            picture_control_set_ptr->min_qp_allowed,
+            picture_control_set_ptr->max_qp_allowed,
             selectedRefQp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]);
         if (picture_control_set_ptr->slice_type == I_SLICE) {
             picture_control_set_ptr->best_pred_qp = (uint8_t)MAX((int32_t)picture_control_set_ptr->best_pred_qp + RC_INTRA_QP_OFFSET, 0);
@@ -893,8 +958,8 @@ void HighLevelRcInputPictureMode2(
             highLevelRateControlPtr->prevIntraSelectedRefQp = selectedRefQp;
             highLevelRateControlPtr->prevIntraOrgSelectedRefQp = selectedRefQp;
         }
-        if (sequence_control_set_ptr->intra_period_length != -1) {
-            if (picture_control_set_ptr->picture_number % ((sequence_control_set_ptr->intra_period_length + 1)) == 0) {
+        if (picture_control_set_ptr->intra_period_length != -1) {
+            if ((picture_control_set_ptr->picture_number - picture_control_set_ptr->intra_period_start) % ((picture_control_set_ptr->intra_period_length + 1)) == 0) {
                 highLevelRateControlPtr->prevIntraSelectedRefQp = selectedRefQp;
                 highLevelRateControlPtr->prevIntraOrgSelectedRefQp = selectedOrgRefQp;
             }
@@ -1023,25 +1088,21 @@ void* RateControlKernel(void *input_ptr)
 
             picture_control_set_ptr = (PictureControlSet_t*)rateControlTasksPtr->pictureControlSetWrapperPtr->objectPtr;
             sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+            EbTracePicture(picture_control_set_ptr->picture_number, 0);
 
             // High level RC
             if (picture_control_set_ptr->picture_number == 0) {
 
                 rate_control_model_init(rc_model_ptr, sequence_control_set_ptr);
-                context_ptr->highLevelRateControlPtr->target_bit_rate = sequence_control_set_ptr->static_config.target_bit_rate;
                 context_ptr->highLevelRateControlPtr->frame_rate = sequence_control_set_ptr->frame_rate;
-                context_ptr->highLevelRateControlPtr->channelBitRatePerFrame = (uint64_t)MAX((int64_t)1, (int64_t)((context_ptr->highLevelRateControlPtr->target_bit_rate << RC_PRECISION) / context_ptr->highLevelRateControlPtr->frame_rate));
-
-                context_ptr->highLevelRateControlPtr->channelBitRatePerSw = context_ptr->highLevelRateControlPtr->channelBitRatePerFrame * (sequence_control_set_ptr->static_config.look_ahead_distance + 1);
-                context_ptr->highLevelRateControlPtr->bitConstraintPerSw = context_ptr->highLevelRateControlPtr->channelBitRatePerSw;
-
-#if RC_UPDATE_TARGET_RATE
-                context_ptr->highLevelRateControlPtr->previousUpdatedBitConstraintPerSw = context_ptr->highLevelRateControlPtr->channelBitRatePerSw;
-#endif
+                context_ptr->frame_rate = sequence_control_set_ptr->frame_rate;
+                RateControlSetTargetBitRate(
+                    context_ptr,
+                    sequence_control_set_ptr,
+                    picture_control_set_ptr->parent_pcs_ptr->target_bit_rate);
 
-                int32_t totalFrameInInterval = sequence_control_set_ptr->intra_period_length;
+                int32_t totalFrameInInterval = picture_control_set_ptr->parent_pcs_ptr->intra_period_length;
                 uint32_t gopPeriod = (1 << picture_control_set_ptr->parent_pcs_ptr->hierarchical_levels);
-                context_ptr->frame_rate = sequence_control_set_ptr->frame_rate;
                 while (totalFrameInInterval >= 0) {
                     if (totalFrameInInterval % (gopPeriod) == 0)
                         context_ptr->frames_in_interval[0] ++;
@@ -1057,15 +1118,36 @@ void* RateControlKernel(void *input_ptr)
                         context_ptr->frames_in_interval[5] ++;
                     totalFrameInInterval--;
                 }
-                context_ptr->virtualBufferSize = (((uint64_t)sequence_control_set_ptr->static_config.target_bit_rate * 3) << RC_PRECISION) / (context_ptr->frame_rate);
                 context_ptr->rateAveragePeriodinFrames = (uint64_t)sequence_control_set_ptr->static_config.intra_period_length + 1;
                 context_ptr->virtualBufferLevelInitialValue = context_ptr->virtualBufferSize >> 1;
                 context_ptr->virtualBufferLevel = context_ptr->virtualBufferSize >> 1;
                 context_ptr->previousVirtualBufferLevel = context_ptr->virtualBufferSize >> 1;
-                context_ptr->vbFillThreshold1 = (context_ptr->virtualBufferSize * 6) >> 3;
-                context_ptr->vbFillThreshold2 = (context_ptr->virtualBufferSize << 3) >> 3;
                 context_ptr->baseLayerFramesAvgQp = sequence_control_set_ptr->qp;
                 context_ptr->baseLayerIntraFramesAvgQp = sequence_control_set_ptr->qp;
+                context_ptr->rateControlGeneration = picture_control_set_ptr->parent_pcs_ptr->rate_control_generation;
+                if (sequence_control_set_ptr->intra_period_length != -1) {
+                    RateControlSetIntraPeriod(
+                        context_ptr,
+                        0,
+                        picture_control_set_ptr->parent_pcs_ptr->intra_period_length);
+                }
+            }
+            // Settings updated from this picture on, the pictures of the
+            // previous settings still to come use the new ones
+            else if (picture_control_set_ptr->parent_pcs_ptr->rate_control_generation > context_ptr->rateControlGeneration) {
+                context_ptr->rateControlGeneration = picture_control_set_ptr->parent_pcs_ptr->rate_control_generation;
+                if (picture_control_set_ptr->parent_pcs_ptr->target_bit_rate != context_ptr->highLevelRateControlPtr->target_bit_rate) {
+                    RateControlSetTargetBitRate(
+                        context_ptr,
+                        sequence_control_set_ptr,
+                        picture_control_set_ptr->parent_pcs_ptr->target_bit_rate);
+                }
+                if (picture_control_set_ptr->parent_pcs_ptr->intra_period_start > context_ptr->intraPeriodStart && sequence_control_set_ptr->intra_period_length != -1) {
+                    RateControlSetIntraPeriod(
+                        context_ptr,
+                        picture_control_set_ptr->parent_pcs_ptr->intra_period_start,
+                        picture_control_set_ptr->parent_pcs_ptr->intra_period_length);
+                }
             }
             if (sequence_control_set_ptr->static_config.rate_control_mode)
             {
@@ -1122,7 +1204,7 @@ void* RateControlKernel(void *input_ptr)
 #endif
                 if (sequence_control_set_ptr->static_config.enable_qp_scaling_flag && picture_control_set_ptr->parent_pcs_ptr->qp_on_the_fly == EB_FALSE) {
 #if NEW_QPS
-                    const int32_t qindex = quantizer_to_qindex[(uint8_t)sequence_control_set_ptr->qp];
+                    const int32_t qindex = quantizer_to_qindex[picture_control_set_ptr->parent_pcs_ptr->base_qp];
                     const double q_val = av1_convert_qindex_to_q(qindex, (aom_bit_depth_t)sequence_control_set_ptr->static_config.encoder_bit_depth);
                     if (picture_control_set_ptr->slice_type == I_SLICE) {
 
@@ -1132,8 +1214,8 @@ void* RateControlKernel(void *input_ptr)
                             (aom_bit_depth_t)sequence_control_set_ptr->static_config.encoder_bit_depth);
                         picture_control_set_ptr->parent_pcs_ptr->base_qindex =
                             (uint8_t)CLIP3(
-                            (int32_t)quantizer_to_qindex[sequence_control_set_ptr->static_config.min_qp_allowed],
-                                (int32_t)quantizer_to_qindex[sequence_control_set_ptr->static_config.max_qp_allowed],
+                            (int32_t)quantizer_to_qindex[picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed],
+                                (int32_t)quantizer_to_qindex[picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed],
                                 (int32_t)(qindex + delta_qindex));
 
                     }
@@ -1148,15 +1230,15 @@ void* RateControlKernel(void *input_ptr)
 
                         picture_control_set_ptr->parent_pcs_ptr->base_qindex =
                             (uint8_t)CLIP3(
-                            (int32_t)quantizer_to_qindex[sequence_control_set_ptr->static_config.min_qp_allowed],
-                                (int32_t)quantizer_to_qindex[sequence_control_set_ptr->static_config.max_qp_allowed],
+                            (int32_t)quantizer_to_qindex[picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed],
+                                (int32_t)quantizer_to_qindex[picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed],
                                 (int32_t)(qindex + delta_qindex));
 
                     }
 #endif
 
                     if (picture_control_set_ptr->slice_type == I_SLICE) {
-                        picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, (int32_t)(sequence_control_set_ptr->qp) + context_ptr->maxRateAdjustDeltaQP);
+                        picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, (int32_t)(picture_control_set_ptr->parent_pcs_ptr->base_qp) + context_ptr->maxRateAdjustDeltaQP);
                     }
                     else {
 
@@ -1164,7 +1246,7 @@ void* RateControlKernel(void *input_ptr)
 #if V2_QP_SCALING
                         if (/*picture_control_set_ptr->enc_mode == ENC_M0 &&*/ 0/*sequence_control_set_ptr->static_config.tune == TUNE_VMAF*/) {
 #endif
-                            picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, (int32_t)(sequence_control_set_ptr->qp + DEFAULT_QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
+                            picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, (int32_t)(picture_control_set_ptr->parent_pcs_ptr->base_qp + DEFAULT_QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
                         }
                         else {
 #if NEW_QP_SCALING
@@ -1173,26 +1255,26 @@ void* RateControlKernel(void *input_ptr)
 #else
                             if (picture_control_set_ptr->enc_mode <= ENC_M1 /*&&sequence_control_set_ptr->static_config.tune != TUNE_VQ*/) {
 #endif
-                                picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, (int32_t)(sequence_control_set_ptr->qp + QP_OFFSET_LAYER_ARRAY_BDRATE[picture_control_set_ptr->temporal_layer_index]));
+                                picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, (int32_t)(picture_control_set_ptr->parent_pcs_ptr->base_qp + QP_OFFSET_LAYER_ARRAY_BDRATE[picture_control_set_ptr->temporal_layer_index]));
                             }
                             else {
-                                picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, (int32_t)(sequence_control_set_ptr->qp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
+                                picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, (int32_t)(picture_control_set_ptr->parent_pcs_ptr->base_qp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
                             }
 #else
-                            picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, (int32_t)(sequence_control_set_ptr->qp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
+                            picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, (int32_t)(picture_control_set_ptr->parent_pcs_ptr->base_qp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
 #endif
 #if V2_QP_SCALING
                         }
 #endif
 #else
-                        picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, (int32_t)(sequence_control_set_ptr->qp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
+                        picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, (int32_t)(picture_control_set_ptr->parent_pcs_ptr->base_qp + QP_OFFSET_LAYER_ARRAY[picture_control_set_ptr->temporal_layer_index]));
 #endif
                     }
                 }
 
                 else if (picture_control_set_ptr->parent_pcs_ptr->qp_on_the_fly == EB_TRUE) {
 
-                    picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)sequence_control_set_ptr->static_config.min_qp_allowed, (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed, picture_control_set_ptr->parent_pcs_ptr->picture_qp);
+                    picture_control_set_ptr->picture_qp = (uint8_t)CLIP3((int32_t)picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed, (int32_t)picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed, picture_control_set_ptr->parent_pcs_ptr->picture_qp);
 #if NEW_QPS
                     picture_control_set_ptr->parent_pcs_ptr->base_qindex = quantizer_to_qindex[picture_control_set_ptr->picture_qp];
 #endif
@@ -1279,8 +1361,8 @@ void* RateControlKernel(void *input_ptr)
                     }
                 }
                 picture_control_set_ptr->picture_qp = (uint8_t)CLIP3(
-                    sequence_control_set_ptr->static_config.min_qp_allowed,
-                    sequence_control_set_ptr->static_config.max_qp_allowed,
+                    picture_control_set_ptr->parent_pcs_ptr->min_qp_allowed,
+                    picture_control_set_ptr->parent_pcs_ptr->max_qp_allowed,
                     picture_control_set_ptr->picture_qp);
 #if NEW_QPS
                 picture_control_set_ptr->parent_pcs_ptr->base_qindex = quantizer_to_qindex[picture_control_set_ptr->picture_qp];
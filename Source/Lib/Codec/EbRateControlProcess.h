@@ -268,6 +268,11 @@ typedef struct RateControlContext_s
     int64_t                       extraBitsGen;
     int16_t                      maxRateAdjustDeltaQP;
 
+    // Rate control settings updates applied so far, and the first picture of
+    // the intra period layout of the intervals
+    uint32_t                       rateControlGeneration;
+    uint64_t                       intraPeriodStart;
+
 
 } RateControlContext_t;
 
@@ -559,6 +559,81 @@ void SpeedBufferControl(
     context_ptr->prevEncMod = sequence_control_set_ptr->encode_context_ptr->enc_mode;
 }
 
+//******************************************************************************//
+// Apply the rate control updates due at the picture number, and restart the
+// intra period at a key frame forced by the input picture type
+// Output: rate control settings of the picture
+//******************************************************************************//
+void SetPictureRateControl(
+    PictureParentControlSet_t       *picture_control_set_ptr,
+    SequenceControlSet_t            *sequence_control_set_ptr,
+    uint64_t                         picture_number)
+{
+    EncodeContext_t        *encode_context_ptr = sequence_control_set_ptr->encode_context_ptr;
+    EbSvtRateControlUpdate *settings = &encode_context_ptr->rate_control_settings;
+    EbSvtRateControlUpdate *update;
+    uint32_t                updateIndex = 0;
+
+    if (encode_context_ptr->initial_picture) {
+        settings->picture_number = 0;
+        settings->flags = 0;
+        settings->target_bit_rate = sequence_control_set_ptr->static_config.target_bit_rate;
+        settings->qp = sequence_control_set_ptr->qp;
+        settings->max_qp_allowed = sequence_control_set_ptr->static_config.max_qp_allowed;
+        settings->min_qp_allowed = sequence_control_set_ptr->static_config.min_qp_allowed;
+        settings->intra_period_length = sequence_control_set_ptr->intra_period_length;
+    }
+
+    EbBlockOnMutex(encode_context_ptr->rate_control_update_mutex);
+
+    while (updateIndex < encode_context_ptr->rate_control_update_count &&
+        encode_context_ptr->rate_control_update_queue[updateIndex].picture_number <= picture_number) {
+
+        update = &encode_context_ptr->rate_control_update_queue[updateIndex++];
+        settings->flags |= update->flags;
+        if (update->flags & EB_RATE_CONTROL_UPDATE_TARGET_BIT_RATE)
+            settings->target_bit_rate = update->target_bit_rate;
+        if (update->flags & EB_RATE_CONTROL_UPDATE_QP)
+            settings->qp = update->qp;
+        if (update->flags & EB_RATE_CONTROL_UPDATE_QP_RANGE) {
+            settings->max_qp_allowed = update->max_qp_allowed;
+            settings->min_qp_allowed = update->min_qp_allowed;
+        }
+        // A late update restarts the intra period at the current picture
+        if (update->flags & EB_RATE_CONTROL_UPDATE_INTRA_PERIOD) {
+            settings->intra_period_length = update->intra_period_length;
+            encode_context_ptr->intra_period_start = picture_number;
+        }
+        settings->picture_number = picture_number;
+        encode_context_ptr->rate_control_generation++;
+    }
+
+    if (updateIndex) {
+        encode_context_ptr->rate_control_update_count -= updateIndex;
+        memmove(
+            encode_context_ptr->rate_control_update_queue,
+            encode_context_ptr->rate_control_update_queue + updateIndex,
+            encode_context_ptr->rate_control_update_count * sizeof(EbSvtRateControlUpdate));
+    }
+
+    EbReleaseMutex(encode_context_ptr->rate_control_update_mutex);
+
+    // A key frame forced by the input picture type restarts the intra period too
+    if (!encode_context_ptr->initial_picture && settings->intra_period_length > 0 &&
+        (picture_control_set_ptr->idr_flag || picture_control_set_ptr->cra_flag)) {
+        encode_context_ptr->intra_period_start = picture_number;
+        encode_context_ptr->rate_control_generation++;
+    }
+
+    picture_control_set_ptr->target_bit_rate = settings->target_bit_rate;
+    picture_control_set_ptr->base_qp = (uint8_t)settings->qp;
+    picture_control_set_ptr->max_qp_allowed = (uint8_t)settings->max_qp_allowed;
+    picture_control_set_ptr->min_qp_allowed = (uint8_t)settings->min_qp_allowed;
+    picture_control_set_ptr->intra_period_length = settings->intra_period_length;
+    picture_control_set_ptr->intra_period_start = encode_context_ptr->intra_period_start;
+    picture_control_set_ptr->rate_control_generation = encode_context_ptr->rate_control_generation;
+}
+
 void ResetPcsAv1(
     PictureParentControlSet_t       *picture_control_set_ptr) {
     picture_control_set_ptr->is_skip_mode_allowed = 0;
@@ -842,6 +917,10 @@ void* ResourceCoordinationKernel(void *input_ptr)
         picture_control_set_ptr->sequence_control_set_wrapper_ptr = context_ptr->sequenceControlSetActiveArray[instanceIndex];
         picture_control_set_ptr->sequence_control_set_ptr = sequence_control_set_ptr;
         picture_control_set_ptr->input_picture_wrapper_ptr = input_picture_wrapper_ptr;
+        // The planes of an end of sequence without picture are not referenced
+        picture_control_set_ptr->input_release_pending = (sequence_control_set_ptr->static_config.zero_copy_input && picture_control_set_ptr->enhanced_picture_ptr->bufferY) ? EB_TRUE : EB_FALSE;
+        picture_control_set_ptr->input_app_private = ebInputPtr->p_app_private;
+        picture_control_set_ptr->input_pts = ebInputPtr->pts;
         picture_control_set_ptr->end_of_sequence_flag = end_of_sequence_flag;
 
         // Set Picture Control Flags
@@ -927,23 +1006,30 @@ void* ResourceCoordinationKernel(void *input_ptr)
             EB_MEMSET(picture_control_set_ptr->ois_distortion_histogram, 0, NUMBER_OF_INTRA_SAD_INTERVALS * sizeof(uint16_t));
         }
         picture_control_set_ptr->full_sb_count = 0;
+
+        SetPictureRateControl(
+            picture_control_set_ptr,
+            sequence_control_set_ptr,
+            context_ptr->pictureNumberArray[instanceIndex]);
     
         if (sequence_control_set_ptr->static_config.use_qp_file == 1) {
             picture_control_set_ptr->qp_on_the_fly = EB_TRUE;
             if (picture_control_set_ptr->input_ptr->qp > MAX_QP_VALUE){
                 SVT_LOG("SVT [WARNING]: INPUT QP OUTSIDE OF RANGE\n");
                 picture_control_set_ptr->qp_on_the_fly = EB_FALSE;
-                picture_control_set_ptr->picture_qp = (uint8_t)sequence_control_set_ptr->qp;
+                picture_control_set_ptr->picture_qp = picture_control_set_ptr->base_qp;
             }
             picture_control_set_ptr->picture_qp = (uint8_t)picture_control_set_ptr->input_ptr->qp;
         }
         else {
             picture_control_set_ptr->qp_on_the_fly = EB_FALSE;
-            picture_control_set_ptr->picture_qp = (uint8_t)sequence_control_set_ptr->qp;
+            picture_control_set_ptr->picture_qp = picture_control_set_ptr->base_qp;
         }
 
         // Picture Stats
         picture_control_set_ptr->picture_number = context_ptr->pictureNumberArray[instanceIndex]++;
+        EbTracePicture(picture_control_set_ptr->picture_number, 0);
+        EbTraceAsyncBegin("Picture", picture_control_set_ptr->picture_number);
         ResetPcsAv1(picture_control_set_ptr);
 
         sequence_control_set_ptr->encode_context_ptr->initial_picture = EB_FALSE;
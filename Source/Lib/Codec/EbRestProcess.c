@@ -219,6 +219,9 @@ void* rest_kernel(void *input_ptr)
     RestResults_t*                          rest_results_ptr;
     EbObjectWrapper_t                       *picture_demux_results_wrapper_ptr;
     PictureDemuxResults_t                   *picture_demux_results_rtr;
+#if REST_M
+    EbBool                                   last_segment;
+#endif
     // SB Loop variables
 
 
@@ -232,6 +235,7 @@ void* rest_kernel(void *input_ptr)
         cdef_results_ptr = (CdefResults_t*)cdef_results_wrapper_ptr->objectPtr;
         picture_control_set_ptr = (PictureControlSet_t*)cdef_results_ptr->picture_control_set_wrapper_ptr->objectPtr;
         sequence_control_set_ptr = (SequenceControlSet_t*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->objectPtr;
+        EbTracePicture(picture_control_set_ptr->picture_number, cdef_results_ptr->segment_index);
         uint8_t lcuSizeLog2 = (uint8_t)Log2f(sequence_control_set_ptr->sb_size_pix);
         EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
         Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
@@ -267,13 +271,19 @@ void* rest_kernel(void *input_ptr)
         }
 
         //all seg based search is done. update total processed segments. if all done, finish the search and perfrom application.
+        //the last segment finishes the picture outside of the mutex so that it can wait for its output buffers
         EbBlockOnMutex(picture_control_set_ptr->rest_search_mutex);
 
         picture_control_set_ptr->tot_seg_searched_rest++;
-        if (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count)
+        last_segment = (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count) ? EB_TRUE : EB_FALSE;
+
+        EbReleaseMutex(picture_control_set_ptr->rest_search_mutex);
+
+        if (last_segment)
         {
 
 #endif
+            EbTraceBegin("RestFinish", picture_control_set_ptr->picture_number, 0);
 
 
 
@@ -446,10 +456,10 @@ void* rest_kernel(void *input_ptr)
             rest_results_ptr->completed_lcu_row_count = ((sequence_control_set_ptr->luma_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
             // Post Rest Results
             EbPostFullObject(rest_results_wrapper_ptr);
+            EbTraceEnd("RestFinish");
 
 #if REST_M
         }
-        EbReleaseMutex(picture_control_set_ptr->rest_search_mutex);
 #endif
 
 
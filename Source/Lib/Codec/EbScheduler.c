@@ -0,0 +1,414 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+
+#include "EbScheduler.h"
+
+#if LOCK_FREE_FIFO
+// Worker owning the calling thread, NULL outside of the scheduler pool
+static EB_THREAD_LOCAL EbSchedulerWorker_t *currentWorkerPtr = (EbSchedulerWorker_t*)EB_NULL;
+
+/**************************************
+ * EbSchedulerDequeCtor
+ **************************************/
+static EbErrorType EbSchedulerDequeCtor(
+    EbSchedulerDeque_t  *dequePtr,
+    uint32_t             taskTotalCount)
+{
+    uint64_t taskArraySize = 1;
+
+    // Round the capacity up to a power of two so positions wrap with a mask
+    while (taskArraySize < taskTotalCount)
+        taskArraySize <<= 1;
+
+    EB_MALLOC(EbSchedulerTask_t**, dequePtr->taskArray, sizeof(EbSchedulerTask_t*) * taskArraySize, EB_N_PTR);
+
+    dequePtr->taskMask = taskArraySize - 1;
+    dequePtr->top = 0;
+    dequePtr->bottom = 0;
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * EbSchedulerDequePush
+ *   Owner only.
+ **************************************/
+static void EbSchedulerDequePush(
+    EbSchedulerDeque_t  *dequePtr,
+    EbSchedulerTask_t   *taskPtr)
+{
+    uint64_t bottom = dequePtr->bottom;
+
+    dequePtr->taskArray[bottom & dequePtr->taskMask] = taskPtr;
+    EbAtomicStore64(&dequePtr->bottom, bottom + 1);
+}
+
+/**************************************
+ * EbSchedulerDequePop
+ *   Owner only, pops the most recently pushed task so that a consumer
+ *   runs on the worker that produced its input while it is still hot
+ *   in the cache.
+ **************************************/
+static EbSchedulerTask_t* EbSchedulerDequePop(
+    EbSchedulerDeque_t  *dequePtr)
+{
+    EbSchedulerTask_t *taskPtr = (EbSchedulerTask_t*)EB_NULL;
+    uint64_t bottom = dequePtr->bottom - 1;
+    uint64_t top;
+
+    EbAtomicStore64(&dequePtr->bottom, bottom);
+    EbAtomicFence();
+    top = EbAtomicLoad64(&dequePtr->top);
+
+    if ((int64_t)(bottom - top) >= 0) {
+        taskPtr = dequePtr->taskArray[bottom & dequePtr->taskMask];
+
+        // Last task, race the thieves for it
+        if (top == bottom) {
+            if (EbAtomicCompareExchange64(&dequePtr->top, top, top + 1) == EB_FALSE)
+                taskPtr = (EbSchedulerTask_t*)EB_NULL;
+            EbAtomicStore64(&dequePtr->bottom, bottom + 1);
+        }
+    }
+    else
+        EbAtomicStore64(&dequePtr->bottom, bottom + 1);
+
+    return taskPtr;
+}
+
+/**************************************
+ * EbSchedulerDequeSteal
+ *   Any thread, takes the oldest task.
+ **************************************/
+static EbSchedulerTask_t* EbSchedulerDequeSteal(
+    EbSchedulerDeque_t  *dequePtr)
+{
+    EbSchedulerTask_t *taskPtr;
+    uint64_t top = EbAtomicLoad64(&dequePtr->top);
+    uint64_t bottom;
+
+    EbAtomicFence();
+    bottom = EbAtomicLoad64(&dequePtr->bottom);
+
+    if ((int64_t)(bottom - top) <= 0)
+        return (EbSchedulerTask_t*)EB_NULL;
+
+    taskPtr = dequePtr->taskArray[top & dequePtr->taskMask];
+    if (EbAtomicCompareExchange64(&dequePtr->top, top, top + 1) == EB_FALSE)
+        return (EbSchedulerTask_t*)EB_NULL;
+
+    return taskPtr;
+}
+
+/**************************************
+ * EbSchedulerInjectionPop
+ **************************************/
+static EbSchedulerTask_t* EbSchedulerInjectionPop(
+    EbScheduler_t       *schedulerPtr)
+{
+    EbSchedulerTask_t *taskPtr = (EbSchedulerTask_t*)EB_NULL;
+
+    if (EbAtomicLoad32(&schedulerPtr->injectionCount) == 0)
+        return taskPtr;
+
+    EbBlockOnMutex(schedulerPtr->injectionMutex);
+    if (schedulerPtr->injectionCount) {
+        taskPtr = schedulerPtr->injectionArray[schedulerPtr->injectionHead];
+        schedulerPtr->injectionHead = (schedulerPtr->injectionHead == schedulerPtr->taskTotalCount - 1) ? 0 : schedulerPtr->injectionHead + 1;
+        EbAtomicAdd32(&schedulerPtr->injectionCount, -1);
+    }
+    EbReleaseMutex(schedulerPtr->injectionMutex);
+
+    return taskPtr;
+}
+
+/**************************************
+ * EbSchedulerFindTask
+ *   Own deque first, then the injection queue, then steal starting
+ *   from a pseudo-random victim.
+ **************************************/
+static EbSchedulerTask_t* EbSchedulerFindTask(
+    EbSchedulerWorker_t *workerPtr)
+{
+    EbScheduler_t     *schedulerPtr = workerPtr->schedulerPtr;
+    EbSchedulerTask_t *taskPtr;
+    uint32_t           victimIndex;
+    uint32_t           victimCount;
+
+    taskPtr = EbSchedulerDequePop(&workerPtr->deque);
+    if (taskPtr)
+        return taskPtr;
+
+    taskPtr = EbSchedulerInjectionPop(schedulerPtr);
+    if (taskPtr)
+        return taskPtr;
+
+    workerPtr->stealSeed = workerPtr->stealSeed * 1103515245 + 12345;
+    victimIndex = (workerPtr->stealSeed >> 16) % schedulerPtr->workerCount;
+
+    for (victimCount = 0; victimCount < schedulerPtr->workerCount; ++victimCount) {
+        if (victimIndex != workerPtr->workerIndex) {
+            taskPtr = EbSchedulerDequeSteal(&schedulerPtr->workerArray[victimIndex].deque);
+            if (taskPtr)
+                return taskPtr;
+        }
+        victimIndex = (victimIndex == schedulerPtr->workerCount - 1) ? 0 : victimIndex + 1;
+    }
+
+    return (EbSchedulerTask_t*)EB_NULL;
+}
+
+/**************************************
+ * EbSchedulerClaimParked
+ *   Takes one worker off parkedCount, the caller owes it a post.
+ **************************************/
+static EbBool EbSchedulerClaimParked(
+    EbScheduler_t       *schedulerPtr)
+{
+    uint32_t parkedCount;
+
+    while ((parkedCount = EbAtomicLoad32(&schedulerPtr->parkedCount)) != 0) {
+        if (EbAtomicCompareExchange32(&schedulerPtr->parkedCount, parkedCount, parkedCount - 1))
+            return EB_TRUE;
+    }
+
+    return EB_FALSE;
+}
+
+/**************************************
+ * EbSchedulerTaskKernel
+ *   Entry of the task fibers.
+ **************************************/
+static void EbSchedulerTaskKernel(void *input_ptr)
+{
+    EbSchedulerTask_t *taskPtr = (EbSchedulerTask_t*)input_ptr;
+
+    taskPtr->kernel(taskPtr->contextPtr);
+}
+
+/**************************************
+ * EbSchedulerRunTask
+ *   Resumes the task fiber until the task suspends, then parks it from
+ *   the worker stack so that whoever resumes it next finds its fiber
+ *   saved.
+ **************************************/
+static void EbSchedulerRunTask(
+    EbSchedulerWorker_t *workerPtr,
+    EbSchedulerTask_t   *taskPtr)
+{
+    workerPtr->currentTaskPtr = taskPtr;
+    EbSwitchFiber(workerPtr->fiberHandle, taskPtr->fiberHandle);
+    workerPtr->currentTaskPtr = (EbSchedulerTask_t*)EB_NULL;
+
+    workerPtr->parkFunction(taskPtr, workerPtr->parkContext);
+}
+
+/*********************************************************************
+ * EbSchedulerCtor
+ *********************************************************************/
+EbErrorType EbSchedulerCtor(
+    EbScheduler_t      **schedulerDblPtr,
+    uint32_t             workerCount,
+    uint32_t             taskTotalCount)
+{
+    EbScheduler_t *schedulerPtr;
+    uint32_t       workerIndex;
+    EbErrorType    return_error = EB_ErrorNone;
+
+    EB_MALLOC(EbScheduler_t*, schedulerPtr, sizeof(EbScheduler_t), EB_N_PTR);
+    *schedulerDblPtr = schedulerPtr;
+
+    schedulerPtr->workerCount = workerCount;
+    schedulerPtr->taskTotalCount = taskTotalCount;
+    schedulerPtr->taskCount = 0;
+    schedulerPtr->injectionHead = 0;
+    schedulerPtr->injectionCount = 0;
+    schedulerPtr->parkedCount = 0;
+
+    EB_MALLOC(EbSchedulerTask_t*, schedulerPtr->taskArray, sizeof(EbSchedulerTask_t) * taskTotalCount, EB_N_PTR);
+    EB_MALLOC(EbSchedulerTask_t**, schedulerPtr->injectionArray, sizeof(EbSchedulerTask_t*) * taskTotalCount, EB_N_PTR);
+    EB_CREATEMUTEX(EbHandle, schedulerPtr->injectionMutex, sizeof(EbHandle), EB_MUTEX);
+    EB_CREATESEMAPHORE(EbHandle, schedulerPtr->parkSemaphore, sizeof(EbHandle), EB_SEMAPHORE, 0, EB_SchedulerParkMaxCount);
+
+    EB_MALLOC(EbSchedulerWorker_t*, schedulerPtr->workerArray, sizeof(EbSchedulerWorker_t) * workerCount, EB_N_PTR);
+
+    for (workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+        EbSchedulerWorker_t *workerPtr = &schedulerPtr->workerArray[workerIndex];
+
+        return_error = EbSchedulerDequeCtor(
+            &workerPtr->deque,
+            taskTotalCount);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+        workerPtr->schedulerPtr = schedulerPtr;
+        workerPtr->workerIndex = workerIndex;
+        workerPtr->stealSeed = workerIndex + 1;
+        workerPtr->currentTaskPtr = (EbSchedulerTask_t*)EB_NULL;
+        workerPtr->parkFunction = (EbSchedulerParkFunction)EB_NULL;
+        workerPtr->parkContext = EB_NULL;
+        EB_CREATEFIBER(EbHandle, workerPtr->fiberHandle, sizeof(EbHandle), EB_FIBER, NULL, EB_NULL);
+    }
+
+    return return_error;
+}
+
+/*********************************************************************
+ * EbSchedulerTaskCtor
+ *********************************************************************/
+EbErrorType EbSchedulerTaskCtor(
+    EbScheduler_t       *schedulerPtr,
+    EbFifo_t            *inputFifoPtr,
+    void                *kernel(void *),
+    EbPtr                contextPtr)
+{
+    EbSchedulerTask_t *taskPtr;
+
+    if (schedulerPtr->taskCount >= schedulerPtr->taskTotalCount)
+        return EB_ErrorInsufficientResources;
+
+    taskPtr = &schedulerPtr->taskArray[schedulerPtr->taskCount++];
+    taskPtr->kernel = kernel;
+    taskPtr->contextPtr = contextPtr;
+    taskPtr->schedulerPtr = schedulerPtr;
+    taskPtr->state = EB_SchedulerTaskIdle;
+    taskPtr->nextWaiterPtr = (EbSchedulerTask_t*)EB_NULL;
+    EB_CREATEFIBER(EbHandle, taskPtr->fiberHandle, sizeof(EbHandle), EB_FIBER, EbSchedulerTaskKernel, taskPtr);
+
+    inputFifoPtr->taskPtr = taskPtr;
+
+    return EB_ErrorNone;
+}
+
+/*********************************************************************
+ * EbSchedulerWorkerKernel
+ *********************************************************************/
+EB_TLS_ACCESS void* EbSchedulerWorkerKernel(void *input_ptr)
+{
+    EbSchedulerWorker_t *workerPtr = (EbSchedulerWorker_t*)input_ptr;
+    EbScheduler_t       *schedulerPtr = workerPtr->schedulerPtr;
+    EbSchedulerTask_t   *taskPtr;
+    uint32_t             spinCount = 0;
+
+    currentWorkerPtr = workerPtr;
+
+    for (;;) {
+        taskPtr = EbSchedulerFindTask(workerPtr);
+        if (taskPtr) {
+            EbSchedulerRunTask(workerPtr, taskPtr);
+            spinCount = 0;
+            continue;
+        }
+
+        if (spinCount < EB_SchedulerSpinCount) {
+            ++spinCount;
+            EbCpuPause();
+            continue;
+        }
+
+        // Announce the parked worker before the last look so that a
+        //   submit in between sees it and posts the semaphore. A worker
+        //   that finds a task withdraws itself, or takes the post of the
+        //   submit that claimed it first.
+        EbAtomicAdd32(&schedulerPtr->parkedCount, 1);
+        EbAtomicFence();
+
+        taskPtr = EbSchedulerFindTask(workerPtr);
+        if (taskPtr == NULL || EbSchedulerClaimParked(schedulerPtr) == EB_FALSE)
+            EbBlockOnSemaphore(schedulerPtr->parkSemaphore);
+
+        if (taskPtr)
+            EbSchedulerRunTask(workerPtr, taskPtr);
+        spinCount = 0;
+    }
+
+    return EB_NULL;
+}
+
+/*********************************************************************
+ * EbSchedulerCurrentTask
+ *   Task running on the calling thread, NULL when called from a
+ *   dedicated process thread or from the application.
+ *********************************************************************/
+EB_TLS_ACCESS EbSchedulerTask_t* EbSchedulerCurrentTask(void)
+{
+    return currentWorkerPtr ? currentWorkerPtr->currentTaskPtr : (EbSchedulerTask_t*)EB_NULL;
+}
+
+/*********************************************************************
+ * EbSchedulerTaskActivate
+ *   Moves an Idle task to Active. Only the caller that wins the
+ *   transition may submit the task. Blocked tasks are left to the
+ *   empty queue they wait on.
+ *********************************************************************/
+EbBool EbSchedulerTaskActivate(
+    EbSchedulerTask_t   *taskPtr)
+{
+    if (EbAtomicLoad32(&taskPtr->state) != EB_SchedulerTaskIdle)
+        return EB_FALSE;
+
+    return EbAtomicCompareExchange32(&taskPtr->state, EB_SchedulerTaskIdle, EB_SchedulerTaskActive);
+}
+
+/*********************************************************************
+ * EbSchedulerTaskDeactivate
+ *   Marks the running task Idle. The fence orders the store against
+ *   the caller's final look at the input Fifo, pairs with the fence
+ *   between the publication and the task scan in EbPostFullObject.
+ *********************************************************************/
+void EbSchedulerTaskDeactivate(
+    EbSchedulerTask_t   *taskPtr)
+{
+    taskPtr->state = EB_SchedulerTaskIdle;
+    EbAtomicFence();
+}
+
+/*********************************************************************
+ * EbSchedulerSubmit
+ *   Queues a task that has just been activated and wakes a parked
+ *   worker, if any.
+ *********************************************************************/
+EB_TLS_ACCESS void EbSchedulerSubmit(
+    EbSchedulerTask_t   *taskPtr)
+{
+    EbScheduler_t       *schedulerPtr = taskPtr->schedulerPtr;
+    EbSchedulerWorker_t *workerPtr = currentWorkerPtr;
+
+    if (workerPtr && workerPtr->schedulerPtr == schedulerPtr)
+        EbSchedulerDequePush(&workerPtr->deque, taskPtr);
+    else {
+        EbBlockOnMutex(schedulerPtr->injectionMutex);
+        schedulerPtr->injectionArray[(schedulerPtr->injectionHead + schedulerPtr->injectionCount) % schedulerPtr->taskTotalCount] = taskPtr;
+        EbAtomicAdd32(&schedulerPtr->injectionCount, 1);
+        EbReleaseMutex(schedulerPtr->injectionMutex);
+    }
+
+    // Pairs with the parkedCount increment in EbSchedulerWorkerKernel
+    EbAtomicFence();
+    if (EbSchedulerClaimParked(schedulerPtr))
+        EbPostSemaphore(schedulerPtr->parkSemaphore);
+}
+
+/*********************************************************************
+ * EbSchedulerSuspend
+ *   Only the worker fiber touches the worker once the task fiber is
+ *   switched away from, the task may already run elsewhere when the
+ *   switch returns.
+ *********************************************************************/
+EB_TLS_ACCESS void EbSchedulerSuspend(
+    EbSchedulerParkFunction parkFunction,
+    void                   *parkContext)
+{
+    EbSchedulerWorker_t *workerPtr = currentWorkerPtr;
+    EbSchedulerTask_t   *taskPtr = workerPtr->currentTaskPtr;
+
+    workerPtr->parkFunction = parkFunction;
+    workerPtr->parkContext = parkContext;
+
+    EbSwitchFiber(taskPtr->fiberHandle, workerPtr->fiberHandle);
+}
+#endif
@@ -0,0 +1,169 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbScheduler_h
+#define EbScheduler_h
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbSystemResourceManager.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*********************************
+     * Defines
+     *********************************/
+#define EB_SchedulerTaskIdle            0
+#define EB_SchedulerTaskActive          1
+#define EB_SchedulerTaskBlocked         2
+#define EB_SchedulerSpinCount           256
+#define EB_SchedulerParkMaxCount        0x7FFFFFFF
+
+    struct EbScheduler_s;
+
+    /*********************************************************************
+     * SchedulerTask
+     *   One instance of a process kernel (i.e. one EncDec context) bound
+     *   to the Fifo it consumes. The kernel runs on a fiber of its own,
+     *   a task waiting for an object suspends its fiber and gives the
+     *   worker back instead of blocking it. A task is Active while it is
+     *   queued on a worker or running, Idle while it waits for its input
+     *   Fifo and Blocked while it waits for an empty object. Only the
+     *   thread that moves it to Active may queue it, so a task never runs
+     *   twice at the same time.
+     *********************************************************************/
+    typedef struct EbSchedulerTask_s {
+        void                    *(*kernel)(void *);
+        EbPtr                    contextPtr;
+        struct EbScheduler_s    *schedulerPtr;
+        EbHandle                 fiberHandle;
+        volatile uint32_t        state;
+        // nextWaiterPtr - next Blocked task waiting on the same empty queue
+        struct EbSchedulerTask_s *nextWaiterPtr;
+    } EbSchedulerTask_t;
+
+    // Called on the worker stack once the fiber of a suspended task is
+    //   saved, to publish the task to whoever resumes it
+    typedef void (*EbSchedulerParkFunction)(EbSchedulerTask_t *taskPtr, void *parkContext);
+
+    /*********************************************************************
+     * SchedulerDeque
+     *   Chase-Lev work-stealing deque. The owning worker pushes and pops
+     *   at the bottom, the other workers steal from the top. The deque is
+     *   sized to hold every task of the scheduler so it never grows.
+     *********************************************************************/
+    typedef struct EbSchedulerDeque_s {
+        EbSchedulerTask_t      **taskArray;
+        uint64_t                 taskMask;
+
+        uint8_t                  pad0[64];
+        volatile uint64_t        top;
+        uint8_t                  pad1[64 - sizeof(uint64_t)];
+        volatile uint64_t        bottom;
+        uint8_t                  pad2[64 - sizeof(uint64_t)];
+    } EbSchedulerDeque_t;
+
+    /*********************************************************************
+     * SchedulerWorker
+     *********************************************************************/
+    typedef struct EbSchedulerWorker_s {
+        EbSchedulerDeque_t       deque;
+        struct EbScheduler_s    *schedulerPtr;
+        uint32_t                 workerIndex;
+        uint32_t                 stealSeed;
+
+        // Fiber of the worker thread, the task currently executing on the
+        //   worker and how to park it once it suspends
+        EbHandle                 fiberHandle;
+        EbSchedulerTask_t       *currentTaskPtr;
+        EbSchedulerParkFunction  parkFunction;
+        void                    *parkContext;
+    } EbSchedulerWorker_t;
+
+    /*********************************************************************
+     * Scheduler
+     *   Fixed pool of worker threads running all the processes of an
+     *   encoder. Tasks made runnable by a worker go to its own deque,
+     *   tasks made runnable by any other thread (i.e. the application)
+     *   go to the injection queue. Idle workers steal, spin for
+     *   EB_SchedulerSpinCount rounds, then park on parkSemaphore. A
+     *   submit claims one of the workers counted in parkedCount before it
+     *   posts, the same way EbLockFreeQueue wakes its consumers.
+     *********************************************************************/
+    typedef struct EbScheduler_s {
+        uint32_t                 workerCount;
+        EbSchedulerWorker_t     *workerArray;
+
+        uint32_t                 taskTotalCount;
+        uint32_t                 taskCount;
+        EbSchedulerTask_t       *taskArray;
+
+        // Injection queue
+        EbHandle                 injectionMutex;
+        EbSchedulerTask_t      **injectionArray;
+        uint32_t                 injectionHead;
+        volatile uint32_t        injectionCount;
+
+        EbHandle                 parkSemaphore;
+        uint8_t                  pad0[64];
+        volatile uint32_t        parkedCount;
+        uint8_t                  pad1[64 - sizeof(uint32_t)];
+    } EbScheduler_t;
+
+    /*********************************************************************
+     * EbSchedulerCtor
+     *   Constructs the scheduler with workerCount deques and room for
+     *   taskTotalCount tasks. The worker threads are created by the
+     *   caller with EbSchedulerWorkerKernel.
+     *********************************************************************/
+    extern EbErrorType EbSchedulerCtor(
+        EbScheduler_t      **schedulerDblPtr,
+        uint32_t             workerCount,
+        uint32_t             taskTotalCount);
+
+    /*********************************************************************
+     * EbSchedulerTaskCtor
+     *   Binds a process kernel and its context to the Fifo it consumes.
+     *   The kernel is entered on the task fiber the first time an object
+     *   is posted to the task and must never return.
+     *********************************************************************/
+    extern EbErrorType EbSchedulerTaskCtor(
+        EbScheduler_t       *schedulerPtr,
+        EbFifo_t            *inputFifoPtr,
+        void                *kernel(void *),
+        EbPtr                contextPtr);
+
+    extern void* EbSchedulerWorkerKernel(void *input_ptr);
+
+    /*********************************************************************
+     * Task interface used by the System Resource Manager
+     *********************************************************************/
+    extern EbSchedulerTask_t* EbSchedulerCurrentTask(void);
+
+    extern EbBool EbSchedulerTaskActivate(
+        EbSchedulerTask_t   *taskPtr);
+
+    extern void EbSchedulerTaskDeactivate(
+        EbSchedulerTask_t   *taskPtr);
+
+    extern void EbSchedulerSubmit(
+        EbSchedulerTask_t   *taskPtr);
+
+    /*********************************************************************
+     * EbSchedulerSuspend
+     *   Suspends the running task and returns once it was resumed, maybe
+     *   on another worker. parkFunction is called with parkContext on
+     *   the worker that ran the task, it owns the task from then on. The
+     *   caller must not hold a mutex nor keep the address of a thread
+     *   local variable across the call.
+     *********************************************************************/
+    extern void EbSchedulerSuspend(
+        EbSchedulerParkFunction parkFunction,
+        void                   *parkContext);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbScheduler_h
@@ -281,6 +281,7 @@ EbErrorType copy_sequence_control_set(
     dst->film_grain_denoise_strength = src->film_grain_denoise_strength;          writeCount += sizeof(int32_t);
     dst->film_grain_params_present = src->film_grain_params_present;              writeCount += sizeof(int32_t);
     dst->film_grain_params_present = src->film_grain_params_present;              writeCount += sizeof(int32_t);
+    dst->picture_pool_min_count = src->picture_pool_min_count; writeCount += sizeof(int32_t);
     dst->picture_control_set_pool_init_count = src->picture_control_set_pool_init_count;            writeCount += sizeof(int32_t);
     dst->picture_control_set_pool_init_count_child = src->picture_control_set_pool_init_count_child; writeCount += sizeof(int32_t);
     dst->pa_reference_picture_buffer_init_count = src->pa_reference_picture_buffer_init_count; writeCount += sizeof(int32_t);
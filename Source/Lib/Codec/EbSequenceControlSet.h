@@ -138,6 +138,9 @@ extern "C" {
         uint32_t                                rest_segment_row_count;
 #endif
         // Buffers
+        // picture_pool_min_count - Pictures the pipeline needs in flight,
+        //   the buffer pools do not start smaller under a memory budget
+        uint32_t                                picture_pool_min_count;
         uint32_t                                picture_control_set_pool_init_count;
         uint32_t                                picture_control_set_pool_init_count_child;
         uint32_t                                pa_reference_picture_buffer_init_count;
@@ -173,6 +176,7 @@ extern "C" {
         uint32_t                                rest_process_init_count;
 #endif
         uint32_t                                total_process_init_count;
+        uint32_t                                scheduler_worker_count;
         
         uint16_t                                film_grain_random_seed;
         SbParams_t                             *sb_params_array;
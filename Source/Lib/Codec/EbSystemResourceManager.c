@@ -3,10 +3,183 @@
 * SPDX - License - Identifier: BSD - 2 - Clause - Patent
 */
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "EbSystemResourceManager.h"
+#include "EbScheduler.h"
 
+#if LOCK_FREE_FIFO
+/**************************************
+ * EbLockFreeQueueCtor
+ **************************************/
+static EbErrorType EbLockFreeQueueCtor(
+    EbLockFreeQueue_t  *queuePtr,
+    uint32_t            objectTotalCount)
+{
+    uint64_t cellTotalCount = 1;
+    uint64_t cellIndex;
+
+    // Round the capacity up to a power of two so positions wrap with a mask
+    while (cellTotalCount < objectTotalCount)
+        cellTotalCount <<= 1;
+
+    EB_MALLOC(EbLockFreeQueueCell_t*, queuePtr->cellArray, sizeof(EbLockFreeQueueCell_t) * cellTotalCount, EB_N_PTR);
+
+    for (cellIndex = 0; cellIndex < cellTotalCount; ++cellIndex) {
+        queuePtr->cellArray[cellIndex].sequence = cellIndex;
+        queuePtr->cellArray[cellIndex].wrapper_ptr = (EbObjectWrapper_t*)EB_NULL;
+    }
+
+    queuePtr->cellMask = cellTotalCount - 1;
+    queuePtr->enqueuePos = 0;
+    queuePtr->dequeuePos = 0;
+    queuePtr->waiterCount = 0;
+
+    // Park Semaphore, posts are bounded by the number of consumer threads
+    //   which the queue does not know of
+    EB_CREATESEMAPHORE(EbHandle, queuePtr->parkSemaphore, sizeof(EbHandle), EB_SEMAPHORE, 0, EB_LockFreeQueueParkMaxCount);
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * EbLockFreeQueueClaimWaiter
+ *   Takes one waiter off waiterCount. The caller owes the semaphore
+ *   post of a claimed waiter, or consumes it when withdrawing its own
+ *   registration fails.
+ **************************************/
+static EbBool EbLockFreeQueueClaimWaiter(
+    EbLockFreeQueue_t  *queuePtr)
+{
+    uint32_t waiterCount;
+
+    while ((waiterCount = EbAtomicLoad32(&queuePtr->waiterCount)) != 0) {
+        if (EbAtomicCompareExchange32(&queuePtr->waiterCount, waiterCount, waiterCount - 1))
+            return EB_TRUE;
+    }
+
+    return EB_FALSE;
+}
+
+/**************************************
+ * EbLockFreeQueuePush
+ *   The queue is sized to hold every object of the SystemResource, so
+ *   a push never fails. A cell that is still being read by a consumer
+ *   of the previous lap is waited on.
+ **************************************/
+static void EbLockFreeQueuePush(
+    EbLockFreeQueue_t  *queuePtr,
+    EbObjectWrapper_t  *wrapper_ptr)
+{
+    EbLockFreeQueueCell_t *cellPtr;
+    uint64_t pos = EbAtomicLoad64(&queuePtr->enqueuePos);
+
+    for (;;) {
+        cellPtr = &queuePtr->cellArray[pos & queuePtr->cellMask];
+        int64_t diff = (int64_t)EbAtomicLoad64(&cellPtr->sequence) - (int64_t)pos;
+
+        if (diff == 0) {
+            if (EbAtomicCompareExchange64(&queuePtr->enqueuePos, pos, pos + 1))
+                break;
+        }
+        else if (diff < 0)
+            EbCpuPause();
+
+        pos = EbAtomicLoad64(&queuePtr->enqueuePos);
+    }
+
+    cellPtr->wrapper_ptr = wrapper_ptr;
+    EbAtomicStore64(&cellPtr->sequence, pos + 1);
+
+    // Order the publication against the waiterCount read, pairs with
+    //   the waiterCount increment in EbLockFreeQueuePop
+    EbAtomicFence();
+    if (EbLockFreeQueueClaimWaiter(queuePtr))
+        EbPostSemaphore(queuePtr->parkSemaphore);
+}
+
+/**************************************
+ * EbLockFreeQueueTryPop
+ **************************************/
+static EbBool EbLockFreeQueueTryPop(
+    EbLockFreeQueue_t   *queuePtr,
+    EbObjectWrapper_t  **wrapperDblPtr)
+{
+    EbLockFreeQueueCell_t *cellPtr;
+    uint64_t pos = EbAtomicLoad64(&queuePtr->dequeuePos);
+
+    for (;;) {
+        cellPtr = &queuePtr->cellArray[pos & queuePtr->cellMask];
+        int64_t diff = (int64_t)EbAtomicLoad64(&cellPtr->sequence) - (int64_t)(pos + 1);
+
+        if (diff == 0) {
+            if (EbAtomicCompareExchange64(&queuePtr->dequeuePos, pos, pos + 1))
+                break;
+        }
+        else if (diff < 0)
+            return EB_FALSE;
+
+        pos = EbAtomicLoad64(&queuePtr->dequeuePos);
+    }
+
+    *wrapperDblPtr = cellPtr->wrapper_ptr;
+    EbAtomicStore64(&cellPtr->sequence, pos + queuePtr->cellMask + 1);
+
+    return EB_TRUE;
+}
+
+/**************************************
+ * EbLockFreeQueueEmptyCheck
+ **************************************/
+static EbBool EbLockFreeQueueEmptyCheck(
+    EbLockFreeQueue_t   *queuePtr)
+{
+    uint64_t pos = EbAtomicLoad64(&queuePtr->dequeuePos);
+    EbLockFreeQueueCell_t *cellPtr = &queuePtr->cellArray[pos & queuePtr->cellMask];
+
+    return ((int64_t)EbAtomicLoad64(&cellPtr->sequence) - (int64_t)(pos + 1) < 0) ? EB_TRUE : EB_FALSE;
+}
+
+/**************************************
+ * EbLockFreeQueuePop
+ *   Spins for EB_LockFreeQueueSpinCount attempts, then parks on the
+ *   queue semaphore until a producer posts. A waiter that finds an
+ *   object after registering withdraws itself from waiterCount, or
+ *   takes the post of the producer that claimed it first.
+ **************************************/
+static void EbLockFreeQueuePop(
+    EbLockFreeQueue_t   *queuePtr,
+    EbObjectWrapper_t  **wrapperDblPtr)
+{
+    uint32_t spinCount = 0;
+    EbBool   found;
+
+    for (;;) {
+        if (EbLockFreeQueueTryPop(queuePtr, wrapperDblPtr))
+            return;
+
+        if (spinCount < EB_LockFreeQueueSpinCount) {
+            ++spinCount;
+            EbCpuPause();
+            continue;
+        }
+
+        // Announce the waiter before the last attempt so that a producer
+        //   publishing in between sees it and posts the semaphore
+        EbAtomicAdd32(&queuePtr->waiterCount, 1);
+        EbAtomicFence();
+
+        found = EbLockFreeQueueTryPop(queuePtr, wrapperDblPtr);
+        if (found == EB_FALSE || EbLockFreeQueueClaimWaiter(queuePtr) == EB_FALSE)
+            EbBlockOnSemaphore(queuePtr->parkSemaphore);
+
+        if (found)
+            return;
+    }
+}
+#else
 /**************************************
  * EbFifoCtor
  **************************************/
@@ -184,6 +357,7 @@ static EbErrorType EbCircularBufferPushFront(
 
     return return_error;
 }
+#endif
 
 /**************************************
  * EbMuxingQueueCtor
@@ -202,7 +376,22 @@ static EbErrorType EbMuxingQueueCtor(
     *queueDblPtr = queuePtr;
 
     queuePtr->processTotalCount = processTotalCount;
+    queuePtr->statsPtr = (EbStageStats_t*)EB_NULL;
+
+#if LOCK_FREE_FIFO
+    // Construct the Object Queue shared by all the Process Fifos
+    return_error = EbLockFreeQueueCtor(
+        &queuePtr->lockFreeQueue,
+        objectTotalCount);
+    if (return_error == EB_ErrorInsufficientResources) {
+        return EB_ErrorInsufficientResources;
+    }
 
+    EB_CREATEMUTEX(EbHandle, queuePtr->taskWaiterMutex, sizeof(EbHandle), EB_MUTEX);
+    queuePtr->taskWaiterHeadPtr = (struct EbSchedulerTask_s*)EB_NULL;
+    queuePtr->taskWaiterTailPtr = (struct EbSchedulerTask_s*)EB_NULL;
+    queuePtr->taskWaiterCount = 0;
+#else
     // Lockout Mutex
     EB_CREATEMUTEX(EbHandle, queuePtr->lockoutMutex, sizeof(EbHandle), EB_MUTEX);
 
@@ -220,11 +409,16 @@ static EbErrorType EbMuxingQueueCtor(
     if (return_error == EB_ErrorInsufficientResources) {
         return EB_ErrorInsufficientResources;
     }
+#endif
     // Construct the Process Fifos
     EB_MALLOC(EbFifo_t**, queuePtr->processFifoPtrArray, sizeof(EbFifo_t*) * queuePtr->processTotalCount, EB_N_PTR);
 
     for (processIndex = 0; processIndex < queuePtr->processTotalCount; ++processIndex) {
         EB_MALLOC(EbFifo_t*, queuePtr->processFifoPtrArray[processIndex], sizeof(EbFifo_t) * queuePtr->processTotalCount, EB_N_PTR);
+#if LOCK_FREE_FIFO
+        queuePtr->processFifoPtrArray[processIndex]->queuePtr = queuePtr;
+        queuePtr->processFifoPtrArray[processIndex]->taskPtr = (struct EbSchedulerTask_s*)EB_NULL;
+#else
         return_error = EbFifoCtor(
             queuePtr->processFifoPtrArray[processIndex],
             0,
@@ -235,6 +429,7 @@ static EbErrorType EbMuxingQueueCtor(
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
+#endif
     }
 
     *processFifoPtrArrayPtr = queuePtr->processFifoPtrArray;
@@ -242,6 +437,35 @@ static EbErrorType EbMuxingQueueCtor(
     return return_error;
 }
 
+#if LOCK_FREE_FIFO
+/**************************************
+ * EbMuxingQueueObjectPushBack
+ **************************************/
+static EbErrorType EbMuxingQueueObjectPushBack(
+    EbMuxingQueue_t    *queuePtr,
+    EbObjectWrapper_t  *objectPtr)
+{
+    EbLockFreeQueuePush(
+        &queuePtr->lockFreeQueue,
+        objectPtr);
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+* EbMuxingQueueObjectPushFront
+*   The lock-free queue has no front insertion, released objects are
+*   recycled in FIFO order instead.
+**************************************/
+static EbErrorType EbMuxingQueueObjectPushFront(
+    EbMuxingQueue_t    *queuePtr,
+    EbObjectWrapper_t  *objectPtr)
+{
+    return EbMuxingQueueObjectPushBack(
+        queuePtr,
+        objectPtr);
+}
+#else
 /**************************************
  * EbMuxingQueueAssignation
  **************************************/
@@ -318,6 +542,7 @@ static EbErrorType EbMuxingQueueObjectPushFront(
 
     return return_error;
 }
+#endif
 
 /*********************************************************************
  * EbObjectReleaseEnable
@@ -338,11 +563,16 @@ EbErrorType EbObjectReleaseEnable(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    wrapper_ptr->releaseEnable = EB_TRUE;
+    EbAtomicFence();
+#else
     EbBlockOnMutex(wrapper_ptr->systemResourcePtr->emptyQueue->lockoutMutex);
 
     wrapper_ptr->releaseEnable = EB_TRUE;
 
     EbReleaseMutex(wrapper_ptr->systemResourcePtr->emptyQueue->lockoutMutex);
+#endif
 
     return return_error;
 }
@@ -366,11 +596,16 @@ EbErrorType EbObjectReleaseDisable(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    wrapper_ptr->releaseEnable = EB_FALSE;
+    EbAtomicFence();
+#else
     EbBlockOnMutex(wrapper_ptr->systemResourcePtr->emptyQueue->lockoutMutex);
 
     wrapper_ptr->releaseEnable = EB_FALSE;
 
     EbReleaseMutex(wrapper_ptr->systemResourcePtr->emptyQueue->lockoutMutex);
+#endif
 
     return return_error;
 }
@@ -395,11 +630,15 @@ EbErrorType EbObjectIncLiveCount(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    EbAtomicAdd32(&wrapper_ptr->liveCount, incrementNumber);
+#else
     EbBlockOnMutex(wrapper_ptr->systemResourcePtr->emptyQueue->lockoutMutex);
 
     wrapper_ptr->liveCount += incrementNumber;
 
     EbReleaseMutex(wrapper_ptr->systemResourcePtr->emptyQueue->lockoutMutex);
+#endif
 
     return return_error;
 }
@@ -442,47 +681,129 @@ EbErrorType EbSystemResourceCtor(
     EbBool              fullFifoEnabled,
     EB_CTOR              ObjectCtor,
     EbPtr               object_init_data_ptr)
+{
+    return EbSystemResourceElasticCtor(
+        resourceDblPtr,
+        objectTotalCount,
+        objectTotalCount,
+        producerProcessTotalCount,
+        consumerProcessTotalCount,
+        producerFifoPtrArrayPtr,
+        consumerFifoPtrArrayPtr,
+        fullFifoEnabled,
+        ObjectCtor,
+        object_init_data_ptr,
+        0);
+}
+
+/*********************************************************************
+ * EbSystemResourceAddObject
+ *   Constructs the EbObjectWrapper wrapperIndex and its object.
+ *********************************************************************/
+static EbErrorType EbSystemResourceAddObject(
+    EbSystemResource_t  *resourcePtr,
+    uint32_t             wrapperIndex)
+{
+    EbObjectWrapper_t *wrapper_ptr;
+    EbErrorType return_error = EB_ErrorNone;
+
+    EB_MALLOC(EbObjectWrapper_t*, wrapper_ptr, sizeof(EbObjectWrapper_t), EB_N_PTR);
+    resourcePtr->wrapperPtrPool[wrapperIndex] = wrapper_ptr;
+
+    wrapper_ptr->liveCount = 0;
+    wrapper_ptr->releaseEnable = EB_TRUE;
+    wrapper_ptr->systemResourcePtr = resourcePtr;
+
+    // Call the Constructor for each element
+    if (resourcePtr->ObjectCtor) {
+        return_error = resourcePtr->ObjectCtor(
+            &wrapper_ptr->objectPtr,
+            resourcePtr->object_init_data_ptr);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
+        }
+    }
+
+    return return_error;
+}
+
+/*********************************************************************
+ * EbSystemResourceElasticCtor
+ *********************************************************************/
+EbErrorType EbSystemResourceElasticCtor(
+    EbSystemResource_t **resourceDblPtr,
+    uint32_t               objectInitCount,
+    uint32_t               objectMaxCount,
+    uint32_t               producerProcessTotalCount,
+    uint32_t               consumerProcessTotalCount,
+    EbFifo_t          ***producerFifoPtrArrayPtr,
+    EbFifo_t          ***consumerFifoPtrArrayPtr,
+    EbBool              fullFifoEnabled,
+    EB_CTOR              ObjectCtor,
+    EbPtr               object_init_data_ptr,
+    uint32_t               initDataSize)
 {
     uint32_t wrapperIndex;
+    uint64_t memoryUsed;
     EbErrorType return_error = EB_ErrorNone;
     // Allocate the System Resource
     EbSystemResource_t *resourcePtr;
 
+    if (objectInitCount > objectMaxCount)
+        objectInitCount = objectMaxCount;
+
     EB_MALLOC(EbSystemResource_t*, resourcePtr, sizeof(EbSystemResource_t), EB_N_PTR);
     *resourceDblPtr = resourcePtr;
 
-    resourcePtr->objectTotalCount = objectTotalCount;
+    resourcePtr->objectTotalCount = objectInitCount;
+    resourcePtr->objectMaxCount = objectMaxCount;
+    resourcePtr->ObjectCtor = ObjectCtor;
+    resourcePtr->object_init_data_ptr = object_init_data_ptr;
+    resourcePtr->memoryContextPtr = EbGetMemoryContext();
+    resourcePtr->growthMutex = (EbHandle)EB_NULL;
+    resourcePtr->growthFailed = EB_FALSE;
+    resourcePtr->objectSize = 0;
+    resourcePtr->ReleaseCallback = EB_NULL;
+
+    // The init data of the pools built by eb_init_encoder live on its
+    //   stack, keep a copy for the objects constructed later
+    if (objectMaxCount > objectInitCount && initDataSize) {
+        EB_MALLOC(EbPtr, resourcePtr->object_init_data_ptr, initDataSize, EB_N_PTR);
+        memcpy(resourcePtr->object_init_data_ptr, object_init_data_ptr, initDataSize);
+    }
+    if (objectMaxCount > objectInitCount) {
+        EB_CREATEMUTEX(EbHandle, resourcePtr->growthMutex, sizeof(EbHandle), EB_MUTEX);
+    }
 
     // Allocate array for wrapper pointers
-    EB_MALLOC(EbObjectWrapper_t**, resourcePtr->wrapperPtrPool, sizeof(EbObjectWrapper_t*) * resourcePtr->objectTotalCount, EB_N_PTR);
+    EB_MALLOC(EbObjectWrapper_t**, resourcePtr->wrapperPtrPool, sizeof(EbObjectWrapper_t*) * resourcePtr->objectMaxCount, EB_N_PTR);
 
-    // Initialize each wrapper
+    // Initialize each wrapper, the memory they ask for is the object size
+    //   the memory budget is shared out with. totalLibMemory moves a slab
+    //   at a time, requestedLibMemory by what each allocation took.
+    memoryUsed = resourcePtr->memoryContextPtr ? resourcePtr->memoryContextPtr->requestedLibMemory : 0;
     for (wrapperIndex = 0; wrapperIndex < resourcePtr->objectTotalCount; ++wrapperIndex) {
-        EB_MALLOC(EbObjectWrapper_t*, resourcePtr->wrapperPtrPool[wrapperIndex], sizeof(EbObjectWrapper_t), EB_N_PTR);
-        resourcePtr->wrapperPtrPool[wrapperIndex]->liveCount = 0;
-        resourcePtr->wrapperPtrPool[wrapperIndex]->releaseEnable = EB_TRUE;
-        resourcePtr->wrapperPtrPool[wrapperIndex]->systemResourcePtr = resourcePtr;
-
-        // Call the Constructor for each element
-        if (ObjectCtor) {
-            return_error = ObjectCtor(
-                &resourcePtr->wrapperPtrPool[wrapperIndex]->objectPtr,
-                object_init_data_ptr);
-            if (return_error == EB_ErrorInsufficientResources) {
-                return EB_ErrorInsufficientResources;
-            }
+        return_error = EbSystemResourceAddObject(
+            resourcePtr,
+            wrapperIndex);
+        if (return_error == EB_ErrorInsufficientResources) {
+            return EB_ErrorInsufficientResources;
         }
     }
+    if (resourcePtr->memoryContextPtr && resourcePtr->objectTotalCount)
+        resourcePtr->objectSize = (resourcePtr->memoryContextPtr->requestedLibMemory - memoryUsed) / resourcePtr->objectTotalCount;
 
     // Initialize the Empty Queue
     return_error = EbMuxingQueueCtor(
         &resourcePtr->emptyQueue,
-        resourcePtr->objectTotalCount,
+        resourcePtr->objectMaxCount,
         producerProcessTotalCount,
         producerFifoPtrArrayPtr);
     if (return_error == EB_ErrorInsufficientResources) {
         return EB_ErrorInsufficientResources;
     }
+    resourcePtr->emptyQueue->systemResourcePtr = resourcePtr;
+
     // Fill the Empty Fifo with every ObjectWrapper
     for (wrapperIndex = 0; wrapperIndex < resourcePtr->objectTotalCount; ++wrapperIndex) {
         EbMuxingQueueObjectPushBack(
@@ -494,12 +815,13 @@ EbErrorType EbSystemResourceCtor(
     if (fullFifoEnabled == EB_TRUE) {
         return_error = EbMuxingQueueCtor(
             &resourcePtr->fullQueue,
-            resourcePtr->objectTotalCount,
+            resourcePtr->objectMaxCount,
             consumerProcessTotalCount,
             consumerFifoPtrArrayPtr);
         if (return_error == EB_ErrorInsufficientResources) {
             return EB_ErrorInsufficientResources;
         }
+        resourcePtr->fullQueue->systemResourcePtr = resourcePtr;
     }
     else {
         resourcePtr->fullQueue = (EbMuxingQueue_t *)EB_NULL;
@@ -509,8 +831,282 @@ EbErrorType EbSystemResourceCtor(
     return return_error;
 }
 
+/*********************************************************************
+ * EbSystemResourceSetMaxCount
+ *********************************************************************/
+EbErrorType EbSystemResourceSetMaxCount(
+    EbSystemResource_t  *resourcePtr,
+    uint32_t             objectMaxCount,
+    EbBool               elastic)
+{
+    uint32_t wrapperIndex;
+    EbErrorType return_error = EB_ErrorNone;
+
+    // The queues can not hold more than the count they were built for
+    if (objectMaxCount < resourcePtr->objectMaxCount)
+        resourcePtr->objectMaxCount = objectMaxCount;
+    if (resourcePtr->objectMaxCount < resourcePtr->objectTotalCount)
+        resourcePtr->objectMaxCount = resourcePtr->objectTotalCount;
+
+    if (elastic == EB_FALSE) {
+        for (wrapperIndex = resourcePtr->objectTotalCount; wrapperIndex < resourcePtr->objectMaxCount; ++wrapperIndex) {
+            return_error = EbSystemResourceAddObject(
+                resourcePtr,
+                wrapperIndex);
+            if (return_error == EB_ErrorInsufficientResources) {
+                return EB_ErrorInsufficientResources;
+            }
+            EbMuxingQueueObjectPushBack(
+                resourcePtr->emptyQueue,
+                resourcePtr->wrapperPtrPool[wrapperIndex]);
+            resourcePtr->objectTotalCount = wrapperIndex + 1;
+        }
+    }
+
+    return return_error;
+}
+
+#if LOCK_FREE_FIFO
+/*********************************************************************
+ * EbSystemResourceGrow
+ *   Constructs one more object for a caller of EbGetEmptyObject that
+ *   would block. Returns EB_FALSE once the SystemResource reached
+ *   objectMaxCount. objectTotalCount only counts the objects that
+ *   were constructed, the growthMutex keeps one construction at a time.
+ *********************************************************************/
+static EbBool EbSystemResourceGrow(
+    EbSystemResource_t  *resourcePtr,
+    EbObjectWrapper_t  **wrapperDblPtr)
+{
+    EbMemoryContext_t *callerContextPtr;
+    EbErrorType        return_error;
+    uint32_t           wrapperIndex;
+
+    if (EbAtomicLoad32(&resourcePtr->objectTotalCount) >= resourcePtr->objectMaxCount || EbAtomicLoad32(&resourcePtr->growthFailed))
+        return EB_FALSE;
+
+    EbBlockOnMutex(resourcePtr->growthMutex);
+
+    wrapperIndex = resourcePtr->objectTotalCount;
+    if (wrapperIndex >= resourcePtr->objectMaxCount || resourcePtr->growthFailed) {
+        EbReleaseMutex(resourcePtr->growthMutex);
+        return EB_FALSE;
+    }
+
+    // The caller may be an application thread (i.e. the input buffers)
+    callerContextPtr = EbSetMemoryContext(resourcePtr->memoryContextPtr);
+    return_error = EbSystemResourceAddObject(
+        resourcePtr,
+        wrapperIndex);
+    EbSetMemoryContext(callerContextPtr);
+
+    if (return_error == EB_ErrorInsufficientResources) {
+        // Keep going with the objects constructed so far
+        SVT_LOG("SVT [Warning]: Could not grow a buffer pool past %u objects\n", wrapperIndex);
+        resourcePtr->growthFailed = EB_TRUE;
+        EbReleaseMutex(resourcePtr->growthMutex);
+        return EB_FALSE;
+    }
+
+    *wrapperDblPtr = resourcePtr->wrapperPtrPool[wrapperIndex];
+    EbAtomicAdd32(&resourcePtr->objectTotalCount, 1);
+
+    EbReleaseMutex(resourcePtr->growthMutex);
+
+    return EB_TRUE;
+}
+#endif
+
+
+
+/*********************************************************************
+ * EbSystemResourceSetStageStats
+ *********************************************************************/
+void EbSystemResourceSetStageStats(
+    EbSystemResource_t  *resourcePtr,
+    EbStageStats_t      *statsPtr)
+{
+    resourcePtr->fullQueue->statsPtr = statsPtr;
+}
+
+/*********************************************************************
+ * EbSystemResourceSetReleaseCallback
+ *********************************************************************/
+void EbSystemResourceSetReleaseCallback(
+    EbSystemResource_t  *resourcePtr,
+    void               (*ReleaseCallback)(EbPtr objectPtr))
+{
+    resourcePtr->ReleaseCallback = ReleaseCallback;
+}
+
+/*********************************************************************
+ * Stage statistics
+ *   A thread works for the process of the last Fifo it got a full
+ *   object from, activeStartTime is 0 while it is not working on one.
+ *   The helpers are EB_TLS_ACCESS so that a scheduler task resumed on
+ *   another worker does not use the variables of the previous one.
+ *********************************************************************/
+static EB_THREAD_LOCAL EbStageStats_t *currentStatsPtr = (EbStageStats_t*)EB_NULL;
+static EB_THREAD_LOCAL uint64_t        activeStartTime = 0;
+
+// Stats of the process the thread works for, and the start of its active time
+static EB_TLS_ACCESS EbStageStats_t* EbStageStatsGetCurrent(
+    uint64_t        *activeStartTimePtr)
+{
+    *activeStartTimePtr = activeStartTime;
+
+    return currentStatsPtr;
+}
+
+static void EbStageStatsPost(
+    EbStageStats_t  *statsPtr)
+{
+    uint32_t queueDepth = EbAtomicAdd32(&statsPtr->queueDepth, 1);
+    uint32_t maxQueueDepth;
+
+    do {
+        maxQueueDepth = EbAtomicLoad32(&statsPtr->maxQueueDepth);
+        if (queueDepth <= maxQueueDepth)
+            break;
+    } while (EbAtomicCompareExchange32(&statsPtr->maxQueueDepth, maxQueueDepth, queueDepth) == EB_FALSE);
+}
+
+// Closes the active time of the previous object, returns the time the
+//   thread starts to wait for the next one
+static EB_TLS_ACCESS uint64_t EbStageStatsGetStart(
+    EbStageStats_t  *statsPtr)
+{
+    uint64_t currentTime = EbGetTimeUs();
+
+    if (currentStatsPtr == statsPtr && activeStartTime) {
+        EbAtomicAdd64(&statsPtr->activeTime, (int64_t)(currentTime - activeStartTime));
+        if (statsPtr->tracePtr)
+            EbTraceStageEnd(statsPtr->name);
+    }
+    activeStartTime = 0;
+
+    return currentTime;
+}
+
+static EB_TLS_ACCESS void EbStageStatsGetEnd(
+    EbStageStats_t  *statsPtr,
+    uint64_t         blockStartTime)
+{
+    uint64_t currentTime = EbGetTimeUs();
+
+    EbAtomicAdd64(&statsPtr->inputBlockedTime, (int64_t)(currentTime - blockStartTime));
+    EbAtomicAdd64(&statsPtr->processedCount, 1);
+    EbAtomicAdd32(&statsPtr->queueDepth, -1);
+
+    currentStatsPtr = statsPtr;
+    activeStartTime = currentTime;
+
+    if (statsPtr->tracePtr)
+        EbTraceStageBegin(statsPtr->tracePtr, statsPtr->name);
+}
+
+#if LOCK_FREE_FIFO
+// A scheduler task waiting for an empty object leaves the thread to
+//   other tasks, which must not close its active time or its trace spans
+//   as their own. EbStageStatsEmptyEnd gives them back to the task, the
+//   trace spans are saved in traceSpanPtr unless it is NULL.
+static EB_TLS_ACCESS void EbStageStatsSuspend(
+    EbTraceSpan_t   *traceSpanPtr)
+{
+    if (traceSpanPtr)
+        EbTraceSuspend(traceSpanPtr);
+
+    currentStatsPtr = (EbStageStats_t*)EB_NULL;
+    activeStartTime = 0;
+}
+#endif
+
+// The time spent waiting for an empty object is not active time, the
+//   scheduler tasks run by the thread meanwhile have their own stats
+static EB_TLS_ACCESS void EbStageStatsEmptyEnd(
+    EbStageStats_t      *statsPtr,
+    uint64_t             savedActiveStartTime,
+    uint64_t             blockStartTime,
+    const EbTraceSpan_t *traceSpanPtr)
+{
+    uint64_t blockedTime = EbGetTimeUs() - blockStartTime;
+
+    EbAtomicAdd64(&statsPtr->outputBlockedTime, (int64_t)blockedTime);
+
+    currentStatsPtr = statsPtr;
+    activeStartTime = savedActiveStartTime ? savedActiveStartTime + blockedTime : 0;
+
+    if (traceSpanPtr)
+        EbTraceResume(traceSpanPtr);
+}
+
+#if LOCK_FREE_FIFO
+/*********************************************************************
+ * Scheduler task parking
+ *   Run on the worker stack once the task fiber is saved. Each park
+ *   function publishes the task, then looks at the queue again so that
+ *   an object pushed in between resumes it.
+ *********************************************************************/
+static void EbParkOnFullQueue(
+    EbSchedulerTask_t   *taskPtr,
+    void                *parkContext)
+{
+    EbMuxingQueue_t *queuePtr = (EbMuxingQueue_t*)parkContext;
 
+    EbSchedulerTaskDeactivate(taskPtr);
+    if (EbLockFreeQueueEmptyCheck(&queuePtr->lockFreeQueue) == EB_FALSE && EbSchedulerTaskActivate(taskPtr))
+        EbSchedulerSubmit(taskPtr);
+}
+
+// Resumes the task waiting the longest for an empty object, if any
+static void EbMuxingQueueResumeWaiter(
+    EbMuxingQueue_t     *queuePtr)
+{
+    EbSchedulerTask_t *taskPtr;
+
+    EbBlockOnMutex(queuePtr->taskWaiterMutex);
+    taskPtr = queuePtr->taskWaiterHeadPtr;
+    if (taskPtr) {
+        queuePtr->taskWaiterHeadPtr = taskPtr->nextWaiterPtr;
+        if (queuePtr->taskWaiterHeadPtr == NULL)
+            queuePtr->taskWaiterTailPtr = (EbSchedulerTask_t*)EB_NULL;
+        EbAtomicAdd32(&queuePtr->taskWaiterCount, -1);
+    }
+    EbReleaseMutex(queuePtr->taskWaiterMutex);
+
+    if (taskPtr) {
+        taskPtr->state = EB_SchedulerTaskActive;
+        EbSchedulerSubmit(taskPtr);
+    }
+}
+
+static void EbParkOnEmptyQueue(
+    EbSchedulerTask_t   *taskPtr,
+    void                *parkContext)
+{
+    EbMuxingQueue_t *queuePtr = (EbMuxingQueue_t*)parkContext;
+
+    taskPtr->state = EB_SchedulerTaskBlocked;
+    taskPtr->nextWaiterPtr = (EbSchedulerTask_t*)EB_NULL;
+
+    EbBlockOnMutex(queuePtr->taskWaiterMutex);
+    if (queuePtr->taskWaiterTailPtr)
+        queuePtr->taskWaiterTailPtr->nextWaiterPtr = taskPtr;
+    else
+        queuePtr->taskWaiterHeadPtr = taskPtr;
+    queuePtr->taskWaiterTailPtr = taskPtr;
+    EbAtomicAdd32(&queuePtr->taskWaiterCount, 1);
+    EbReleaseMutex(queuePtr->taskWaiterMutex);
+
+    // Pairs with the fence between the push and the taskWaiterCount
+    //   read in EbReleaseObject
+    EbAtomicFence();
+    if (EbLockFreeQueueEmptyCheck(&queuePtr->lockFreeQueue) == EB_FALSE)
+        EbMuxingQueueResumeWaiter(queuePtr);
+}
+#endif
 
+#if !LOCK_FREE_FIFO
 /*********************************************************************
  * EbSystemResourceReleaseProcess
  *********************************************************************/
@@ -531,6 +1127,7 @@ static EbErrorType EbReleaseProcess(
 
     return return_error;
 }
+#endif
 
 /*********************************************************************
  * EbSystemResourcePostObject
@@ -551,6 +1148,33 @@ EbErrorType EbPostFullObject(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    EbMuxingQueue_t *queuePtr = objectPtr->systemResourcePtr->fullQueue;
+    uint32_t processIndex;
+
+    // Counted before the object can be taken
+    if (queuePtr->statsPtr)
+        EbStageStatsPost(queuePtr->statsPtr);
+
+    EbMuxingQueueObjectPushBack(
+        queuePtr,
+        objectPtr);
+
+    // Scheduler mode, hand the object to an idle consumer task. Active
+    //   tasks keep draining the queue before they go idle.
+    if (queuePtr->processFifoPtrArray[0]->taskPtr) {
+        EbAtomicFence();
+        for (processIndex = 0; processIndex < queuePtr->processTotalCount; ++processIndex) {
+            if (EbSchedulerTaskActivate(queuePtr->processFifoPtrArray[processIndex]->taskPtr)) {
+                EbSchedulerSubmit(queuePtr->processFifoPtrArray[processIndex]->taskPtr);
+                break;
+            }
+        }
+    }
+#else
+    if (objectPtr->systemResourcePtr->fullQueue->statsPtr)
+        EbStageStatsPost(objectPtr->systemResourcePtr->fullQueue->statsPtr);
+
     EbBlockOnMutex(objectPtr->systemResourcePtr->fullQueue->lockoutMutex);
 
     EbMuxingQueueObjectPushBack(
@@ -558,6 +1182,7 @@ EbErrorType EbPostFullObject(
         objectPtr);
 
     EbReleaseMutex(objectPtr->systemResourcePtr->fullQueue->lockoutMutex);
+#endif
 
     return return_error;
 }
@@ -577,6 +1202,35 @@ EbErrorType EbReleaseObject(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    uint32_t liveCount;
+    uint32_t newLiveCount;
+
+    do {
+        liveCount = EbAtomicLoad32(&objectPtr->liveCount);
+
+        // Decrement liveCount
+        newLiveCount = (liveCount == 0) ? liveCount : liveCount - 1;
+
+        // Set liveCount to EB_ObjectWrapperReleasedValue
+        if ((objectPtr->releaseEnable == EB_TRUE) && (newLiveCount == 0))
+            newLiveCount = EB_ObjectWrapperReleasedValue;
+
+    } while (EbAtomicCompareExchange32(&objectPtr->liveCount, liveCount, newLiveCount) == EB_FALSE);
+
+    if (newLiveCount == EB_ObjectWrapperReleasedValue) {
+        if (objectPtr->systemResourcePtr->ReleaseCallback)
+            objectPtr->systemResourcePtr->ReleaseCallback(objectPtr->objectPtr);
+
+        EbMuxingQueueObjectPushFront(
+            objectPtr->systemResourcePtr->emptyQueue,
+            objectPtr);
+
+        EbAtomicFence();
+        if (EbAtomicLoad32(&objectPtr->systemResourcePtr->emptyQueue->taskWaiterCount))
+            EbMuxingQueueResumeWaiter(objectPtr->systemResourcePtr->emptyQueue);
+    }
+#else
     EbBlockOnMutex(objectPtr->systemResourcePtr->emptyQueue->lockoutMutex);
 
     // Decrement liveCount
@@ -587,6 +1241,9 @@ EbErrorType EbReleaseObject(
         // Set liveCount to EB_ObjectWrapperReleasedValue
         objectPtr->liveCount = EB_ObjectWrapperReleasedValue;
 
+        if (objectPtr->systemResourcePtr->ReleaseCallback)
+            objectPtr->systemResourcePtr->ReleaseCallback(objectPtr->objectPtr);
+
         EbMuxingQueueObjectPushFront(
             objectPtr->systemResourcePtr->emptyQueue,
             objectPtr);
@@ -594,6 +1251,7 @@ EbErrorType EbReleaseObject(
     }
 
     EbReleaseMutex(objectPtr->systemResourcePtr->emptyQueue->lockoutMutex);
+#endif
 
     return return_error;
 }
@@ -619,12 +1277,58 @@ EbErrorType EbGetEmptyObject(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+    uint64_t savedActiveStartTime;
+    EbStageStats_t *statsPtr = EbStageStatsGetCurrent(&savedActiveStartTime);
+    uint64_t blockStartTime;
+
+#if LOCK_FREE_FIFO
+    EbTraceSpan_t traceSpan;
+    EbBool suspended = EB_FALSE;
+
+    // Block until an empty buffer is available, an elastic SystemResource
+    //   grows instead and a scheduler task suspends, unless it holds a
+    //   mutex another task could need
+    if (EbLockFreeQueueTryPop(&emptyFifoPtr->queuePtr->lockFreeQueue, wrapperDblPtr) == EB_FALSE) {
+        blockStartTime = statsPtr ? EbGetTimeUs() : 0;
+
+        while (EbLockFreeQueueTryPop(&emptyFifoPtr->queuePtr->lockFreeQueue, wrapperDblPtr) == EB_FALSE) {
+            if (EbSystemResourceGrow(emptyFifoPtr->queuePtr->systemResourcePtr, wrapperDblPtr))
+                break;
+            if (EbSchedulerCurrentTask() == NULL || EbMutexHeldCount()) {
+                EbLockFreeQueuePop(
+                    &emptyFifoPtr->queuePtr->lockFreeQueue,
+                    wrapperDblPtr);
+                break;
+            }
+            // The spans are saved once, the task may be resumed on a
+            //   thread that has none open
+            if (statsPtr)
+                EbStageStatsSuspend(suspended ? (EbTraceSpan_t*)EB_NULL : &traceSpan);
+            suspended = EB_TRUE;
+            EbSchedulerSuspend(EbParkOnEmptyQueue, emptyFifoPtr->queuePtr);
+        }
+
+        if (statsPtr)
+            EbStageStatsEmptyEnd(statsPtr, savedActiveStartTime, blockStartTime, suspended ? &traceSpan : (EbTraceSpan_t*)EB_NULL);
+    }
+
+    // Reset the wrapper's liveCount
+    (*wrapperDblPtr)->liveCount = 0;
+
+    // Object release enable
+    (*wrapperDblPtr)->releaseEnable = EB_TRUE;
+#else
+    blockStartTime = statsPtr ? EbGetTimeUs() : 0;
+
     // Queue the Fifo requesting the empty fifo
     EbReleaseProcess(emptyFifoPtr);
 
     // Block on the counting Semaphore until an empty buffer is available
     EbBlockOnSemaphore(emptyFifoPtr->countingSemaphore);
 
+    if (statsPtr)
+        EbStageStatsEmptyEnd(statsPtr, savedActiveStartTime, blockStartTime, (EbTraceSpan_t*)EB_NULL);
+
     // Acquire lockout Mutex
     EbBlockOnMutex(emptyFifoPtr->lockoutMutex);
 
@@ -641,6 +1345,7 @@ EbErrorType EbGetEmptyObject(
 
     // Release Mutex
     EbReleaseMutex(emptyFifoPtr->lockoutMutex);
+#endif
 
     return return_error;
 }
@@ -665,7 +1370,22 @@ EbErrorType EbGetFullObject(
     EbObjectWrapper_t **wrapperDblPtr)
 {
     EbErrorType return_error = EB_ErrorNone;
-
+    EbStageStats_t *statsPtr = fullFifoPtr->queuePtr->statsPtr;
+    uint64_t blockStartTime = statsPtr ? EbStageStatsGetStart(statsPtr) : 0;
+
+#if LOCK_FREE_FIFO
+    if (fullFifoPtr->taskPtr && fullFifoPtr->taskPtr == EbSchedulerCurrentTask()) {
+        // Scheduler task, give the worker back once the Fifo is drained
+        while (EbLockFreeQueueTryPop(&fullFifoPtr->queuePtr->lockFreeQueue, wrapperDblPtr) == EB_FALSE)
+            EbSchedulerSuspend(EbParkOnFullQueue, fullFifoPtr->queuePtr);
+    }
+    else {
+        // Block until a full buffer is available
+        EbLockFreeQueuePop(
+            &fullFifoPtr->queuePtr->lockFreeQueue,
+            wrapperDblPtr);
+    }
+#else
     // Queue the Fifo requesting the full fifo
     EbReleaseProcess(fullFifoPtr);
 
@@ -681,10 +1401,27 @@ EbErrorType EbGetFullObject(
 
     // Release Mutex
     EbReleaseMutex(fullFifoPtr->lockoutMutex);
+#endif
+
+    if (statsPtr)
+        EbStageStatsGetEnd(statsPtr, blockStartTime);
 
     return return_error;
 }
 
+#if LOCK_FREE_FIFO
+EbErrorType EbGetFullObjectNonBlocking(
+    EbFifo_t   *fullFifoPtr,
+    EbObjectWrapper_t **wrapperDblPtr)
+{
+    if (EbLockFreeQueueTryPop(&fullFifoPtr->queuePtr->lockFreeQueue, wrapperDblPtr) == EB_FALSE)
+        *wrapperDblPtr = (EbObjectWrapper_t*)EB_NULL;
+    else if (fullFifoPtr->queuePtr->statsPtr)
+        EbAtomicAdd32(&fullFifoPtr->queuePtr->statsPtr->queueDepth, -1);
+
+    return EB_ErrorNone;
+}
+#else
 /**************************************
 * EbFifoPopFront
 **************************************/
@@ -728,4 +1465,5 @@ EbErrorType EbGetFullObjectNonBlocking(
         *wrapperDblPtr = (EbObjectWrapper_t*)EB_NULL;
 
     return return_error;
-}
\ No newline at end of file
+}
+#endif
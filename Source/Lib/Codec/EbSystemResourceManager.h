@@ -8,6 +8,7 @@
 
 #include "EbDefinitions.h"
 #include "EbThreads.h"
+#include "EbTrace.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,6 +16,8 @@ extern "C" {
      * Defines
      *********************************/
 #define EB_ObjectWrapperReleasedValue   ~0u
+#define EB_LockFreeQueueSpinCount       256
+#define EB_LockFreeQueueParkMaxCount    0x7FFFFFFF
 
      /*********************************************************************
       * Object Wrapper
@@ -28,7 +31,8 @@ extern "C" {
 
         // liveCount - a count of the number of pictures actively being
         //   encoded in the pipeline at any given time.  Modification
-        //   of this value by any process must be protected by a mutex.
+        //   of this value by any process must be protected by a mutex
+        //   (or done atomically when LOCK_FREE_FIFO is enabled).
         uint32_t                    liveCount;
 
         // releaseEnable - a flag that enables the release of
@@ -55,6 +59,7 @@ extern "C" {
      *   and dynamic EbObjectWrapper counting.
      *********************************************************************/
     typedef struct EbFifo_s {
+#if !LOCK_FREE_FIFO
         // countingSemaphore - used for OS thread-blocking & dynamically
         //   counting the number of EbObjectWrappers currently in the
         //   EbFifo.
@@ -69,11 +74,18 @@ extern "C" {
 
         // lastPtr - pointer to the tail of the Fifo
         EbObjectWrapper_t *lastPtr;
+#endif
 
         // queuePtr - pointer to MuxingQueue that the EbFifo is
         //   associated with.
         struct EbMuxingQueue_s *queuePtr;
 
+#if LOCK_FREE_FIFO
+        // taskPtr - scheduler task consuming the EbFifo, NULL when the
+        //   consumer is a dedicated thread.
+        struct EbSchedulerTask_s *taskPtr;
+#endif
+
     } EbFifo_t;
 
     /*********************************************************************
@@ -88,15 +100,88 @@ extern "C" {
 
     } EbCircularBuffer_t;
 
+    /*********************************************************************
+     * LockFreeQueue
+     *   Bounded multi-producer/multi-consumer ring of EbObjectWrapper
+     *   pointers. Each cell carries a sequence number that tells producers
+     *   and consumers whether the cell is free or filled for the current
+     *   lap, so enqueue and dequeue only need a CAS on their position.
+     *   Consumers spin for EB_LockFreeQueueSpinCount iterations before
+     *   parking on parkSemaphore. A producer claims one of the waiters
+     *   counted in waiterCount before it posts, so the semaphore never
+     *   holds more posts than there are parked consumers.
+     *********************************************************************/
+    typedef struct EbLockFreeQueueCell_s {
+        volatile uint64_t   sequence;
+        EbObjectWrapper_t  *wrapper_ptr;
+    } EbLockFreeQueueCell_t;
+
+    typedef struct EbLockFreeQueue_s {
+        EbLockFreeQueueCell_t *cellArray;
+        uint64_t               cellMask;
+        EbHandle               parkSemaphore;
+
+        // The positions and the waiter count are written by different
+        //   threads, keep them on separate cache lines.
+        uint8_t                pad0[64];
+        volatile uint64_t      enqueuePos;
+        uint8_t                pad1[64 - sizeof(uint64_t)];
+        volatile uint64_t      dequeuePos;
+        uint8_t                pad2[64 - sizeof(uint64_t)];
+        volatile uint32_t      waiterCount;
+        uint8_t                pad3[64 - sizeof(uint32_t)];
+    } EbLockFreeQueue_t;
+
+    /*********************************************************************
+     * StageStats
+     *   Counters of a pipeline process, shared by all its threads (or
+     *   scheduler tasks), in microseconds. The input blocked time is spent
+     *   in EbGetFullObject on the process input Fifo, the output blocked
+     *   time in EbGetEmptyObject, and the active time runs from
+     *   EbGetFullObject returning to the next call. queueDepth counts the
+     *   objects posted to the input Fifo and not yet taken. With a
+     *   tracePtr the kernel iterations are recorded in the trace as well.
+     *********************************************************************/
+    typedef struct EbStageStats_s {
+        const char          *name;
+        uint32_t             threadCount;
+        volatile uint64_t    processedCount;
+        volatile uint64_t    activeTime;
+        volatile uint64_t    inputBlockedTime;
+        volatile uint64_t    outputBlockedTime;
+        volatile uint32_t    queueDepth;
+        volatile uint32_t    maxQueueDepth;
+        EbTrace_t           *tracePtr;
+    } EbStageStats_t;
+
     /*********************************************************************
      * MuxingQueue
+     *   With LOCK_FREE_FIFO all the process Fifos of a MuxingQueue share
+     *   the same lockFreeQueue, objects go to whichever process dequeues
+     *   first, which matches the first-come first-served assignation of
+     *   the mutex implementation. Scheduler tasks waiting for an empty
+     *   object are suspended on the taskWaiter list and resumed in order
+     *   by EbReleaseObject.
      *********************************************************************/
     typedef struct EbMuxingQueue_s {
+#if LOCK_FREE_FIFO
+        EbLockFreeQueue_t   lockFreeQueue;
+        EbHandle            taskWaiterMutex;
+        struct EbSchedulerTask_s *taskWaiterHeadPtr;
+        struct EbSchedulerTask_s *taskWaiterTailPtr;
+        volatile uint32_t   taskWaiterCount;
+#else
         EbHandle           lockoutMutex;
         EbCircularBuffer_t *objectQueue;
         EbCircularBuffer_t *processQueue;
+#endif
         uint32_t              processTotalCount;
         EbFifo_t          **processFifoPtrArray;
+        // systemResourcePtr - SystemResource the queue belongs to
+        struct EbSystemResource_s *systemResourcePtr;
+        // statsPtr - process consuming the full queue, NULL for the
+        //   empty queues and the queues the application consumes
+        EbStageStats_t     *statsPtr;
 
     } EbMuxingQueue_t;
 
@@ -112,7 +197,10 @@ extern "C" {
     typedef struct EbSystemResource_s {
         // objectTotalCount - A count of the number of objects contained in the
         //   System Resoruce.
-        uint32_t              objectTotalCount;
+        volatile uint32_t     objectTotalCount;
+        // objectMaxCount - Number of objects an elastic SystemResource may
+        //   grow to, equal to objectTotalCount otherwise.
+        uint32_t              objectMaxCount;
 
         // wrapperPtrPool - An array of pointers to the EbObjectWrappers used
         //   to construct and destruct the SystemResource.
@@ -126,6 +214,20 @@ extern "C" {
         //EbFifo_t           *fullFifo;
         EbMuxingQueue_t     *fullQueue;
 
+        // Elastic growth, the objects past objectTotalCount are constructed
+        //   with ObjectCtor in the memory context of the SystemResource
+        EB_CTOR              ObjectCtor;
+        EbPtr                object_init_data_ptr;
+        EbMemoryContext_t   *memoryContextPtr;
+        EbHandle             growthMutex;
+        volatile uint32_t    growthFailed;
+        // objectSize - Memory asked for by one object, measured while the
+        //   first objects were constructed.
+        uint64_t             objectSize;
+        // ReleaseCallback - called with the object when its last live
+        //   count is released, before it goes back to the empty queue.
+        void               (*ReleaseCallback)(EbPtr objectPtr);
+
     } EbSystemResource_t;
 
     /*********************************************************************
@@ -221,6 +323,67 @@ extern "C" {
         EB_CTOR              ObjectCtor,
         EbPtr               object_init_data_ptr);
 
+    /*********************************************************************
+     * EbSystemResourceElasticCtor
+     *   Constructs an elastic SystemResource. Only objectInitCount objects
+     *   are constructed, EbGetEmptyObject constructs another one instead
+     *   of blocking as long as there are less than objectMaxCount. The
+     *   queues are sized for objectMaxCount.
+     *
+     *   initDataSize
+     *     Size of the block pointed by object_init_data_ptr, which is copied
+     *     when the SystemResource may grow. 0 when object_init_data_ptr
+     *     outlives the SystemResource.
+     *
+     *   Elastic growth needs LOCK_FREE_FIFO, without it the objects past
+     *   objectInitCount have to be constructed with
+     *   EbSystemResourceSetMaxCount.
+     *********************************************************************/
+    extern EbErrorType EbSystemResourceElasticCtor(
+        EbSystemResource_t **resourceDblPtr,
+        uint32_t               objectInitCount,
+        uint32_t               objectMaxCount,
+        uint32_t               producerProcessTotalCount,
+        uint32_t               consumerProcessTotalCount,
+        EbFifo_t          ***producerFifoPtrArrayPtr,
+        EbFifo_t          ***consumerFifoPtrArrayPtr,
+        EbBool              fullFifoEnabled,
+        EB_CTOR              ObjectCtor,
+        EbPtr               object_init_data_ptr,
+        uint32_t               initDataSize);
+
+    /*********************************************************************
+     * EbSystemResourceSetMaxCount
+     *   Lowers the number of objects the SystemResource may hold to
+     *   objectMaxCount, never below the objects already constructed.
+     *   Unless elastic, the missing objects are constructed right away.
+     *   Must be called before the SystemResource is in use.
+     *********************************************************************/
+    extern EbErrorType EbSystemResourceSetMaxCount(
+        EbSystemResource_t  *resourcePtr,
+        uint32_t             objectMaxCount,
+        EbBool               elastic);
+
+    /*********************************************************************
+     * EbSystemResourceSetStageStats
+     *   Accounts the objects posted to the full queue of the
+     *   SystemResource and the processes consuming them to statsPtr.
+     *********************************************************************/
+    extern void EbSystemResourceSetStageStats(
+        EbSystemResource_t  *resourcePtr,
+        EbStageStats_t      *statsPtr);
+
+    /*********************************************************************
+     * EbSystemResourceSetReleaseCallback
+     *   Calls ReleaseCallback each time an object of the SystemResource
+     *   is released for reuse, from the thread releasing it. Without
+     *   LOCK_FREE_FIFO the emptyFifo lockoutMutex is held meanwhile.
+     *   Must be called before the SystemResource is in use.
+     *********************************************************************/
+    extern void EbSystemResourceSetReleaseCallback(
+        EbSystemResource_t  *resourcePtr,
+        void               (*ReleaseCallback)(EbPtr objectPtr));
+
     /*********************************************************************
      * EbSystemResourceDtor
      *   Destructor for EbSystemResource.  Fully destructs all members
@@ -9,10 +9,16 @@
 // and mutexs.  The goal is to eliminiate platform #define
 // in the code.
 
+// ucontext is only exposed with the X/Open interfaces on macOS
+#if defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 600
+#endif
+
 /****************************************
  * Universal Includes
  ****************************************/
 #include <stdlib.h>
+#include <string.h>
 #include "EbDefinitions.h"
 #include "EbThreads.h"
  /****************************************
@@ -28,6 +34,8 @@
 #include <semaphore.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <ucontext.h>
 #else
 #error OS/Platform not supported.
 #endif // _WIN32
@@ -45,22 +53,56 @@ void printfTime(const char *fmt, ...)
 #endif
 #endif
 
+// Memory context of the encoder instance the calling thread works for
+static EB_THREAD_LOCAL EbMemoryContext_t *memoryContextPtr = (EbMemoryContext_t*)EB_NULL;
+
+EB_THREAD_LOCAL_EXEC struct EbDispatchTable_s *currentDispatchTablePtr = (struct EbDispatchTable_s*)EB_NULL;
+
+// Start arguments of a thread, lets it inherit the memory context and the
+//   dispatch table of its creator before entering threadFunction
+typedef struct EbThreadStart_s {
+    void                *(*threadFunction)(void *);
+    void                *threadContext;
+    EbMemoryContext_t   *memoryContextPtr;
+    struct EbDispatchTable_s *dispatchTablePtr;
+} EbThreadStart_t;
+
+static EB_TLS_ACCESS void* EbThreadStartKernel(
+    void *input_ptr)
+{
+    EbThreadStart_t threadStart = *(EbThreadStart_t*)input_ptr;
+
+    free(input_ptr);
+    memoryContextPtr = threadStart.memoryContextPtr;
+    currentDispatchTablePtr = threadStart.dispatchTablePtr;
+
+    return threadStart.threadFunction(threadStart.threadContext);
+}
+
 /****************************************
  * EbCreateThread
  ****************************************/
-EbHandle EbCreateThread(
+EB_TLS_ACCESS EbHandle EbCreateThread(
     void *threadFunction(void *),
     void *threadContext)
 {
     EbHandle threadHandle = NULL;
+    EbThreadStart_t *threadStart = (EbThreadStart_t*)malloc(sizeof(EbThreadStart_t));
+
+    if (threadStart == NULL)
+        return NULL;
+    threadStart->threadFunction = threadFunction;
+    threadStart->threadContext = threadContext;
+    threadStart->memoryContextPtr = memoryContextPtr;
+    threadStart->dispatchTablePtr = currentDispatchTablePtr;
 
 #ifdef _WIN32
 
     threadHandle = (EbHandle)CreateThread(
         NULL,                           // default security attributes
         0,                              // default stack size
-        (LPTHREAD_START_ROUTINE)threadFunction, // function to be tied to the new thread
-        threadContext,                  // context to be tied to the new thread
+        (LPTHREAD_START_ROUTINE)EbThreadStartKernel, // function to be tied to the new thread
+        threadStart,                    // context to be tied to the new thread
         0,                              // thread active when created
         NULL);                          // new thread ID
 
@@ -70,6 +112,8 @@ EbHandle EbCreateThread(
     struct sched_param param = {
         .sched_priority = 99
     };
+    int32_t ret;
+
     pthread_attr_init(&attr);
     pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
     pthread_attr_setschedparam(&attr, &param);
@@ -77,30 +121,39 @@ EbHandle EbCreateThread(
     pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
 
     threadHandle = (pthread_t*)malloc(sizeof(pthread_t));
-    int32_t ret = pthread_create(
+    if (threadHandle == NULL) {
+        pthread_attr_destroy(&attr);
+        free(threadStart);
+        return NULL;
+    }
+
+    ret = pthread_create(
         (pthread_t*)threadHandle,      // Thread handle
         &attr,                       // attributes
-        threadFunction,                 // function to be run by new thread
-        threadContext);
-
-    if (ret != 0)
-        if (ret == EPERM) {
-
-            pthread_cancel(*((pthread_t*)threadHandle));
-            pthread_join(*((pthread_t*)threadHandle), NULL);
-            free(threadHandle);
-
-            threadHandle = (pthread_t*)malloc(sizeof(pthread_t));
-
-            pthread_create(
-                (pthread_t*)threadHandle,      // Thread handle
-                (const pthread_attr_t*)EB_NULL,                        // attributes
-                threadFunction,                 // function to be run by new thread
-                threadContext);
-        }
+        EbThreadStartKernel,            // function to be run by new thread
+        threadStart);
+
+    // Real-time scheduling needs privileges, no thread was created so
+    //   retry with the default attributes
+    if (ret == EPERM)
+        ret = pthread_create(
+            (pthread_t*)threadHandle,      // Thread handle
+            (const pthread_attr_t*)EB_NULL,                        // attributes
+            EbThreadStartKernel,            // function to be run by new thread
+            threadStart);
+
+    pthread_attr_destroy(&attr);
+
+    if (ret != 0) {
+        free(threadHandle);
+        threadHandle = NULL;
+    }
 
 #endif // _WIN32
 
+    if (threadHandle == NULL)
+        free(threadStart);
+
     return threadHandle;
 }
 
@@ -274,6 +327,10 @@ EbErrorType EbDestroySemaphore(EbHandle semaphoreHandle)
 
     return return_error;
 }
+// Mutexes held by the calling thread, lets the task scheduler know when
+//   it is not safe to run another task on a blocked worker
+static EB_THREAD_LOCAL uint32_t mutexHeldCount = 0;
+
 /***************************************
  * EbCreateMutex
  ***************************************/
@@ -304,7 +361,7 @@ EbHandle EbCreateMutex(
 /***************************************
  * EbPostMutex
  ***************************************/
-EbErrorType EbReleaseMutex(
+EB_TLS_ACCESS EbErrorType EbReleaseMutex(
     EbHandle mutexHandle)
 {
     EbErrorType return_error = EB_ErrorNone;
@@ -315,13 +372,15 @@ EbErrorType EbReleaseMutex(
     return_error = pthread_mutex_unlock((pthread_mutex_t*)mutexHandle) ? EB_ErrorCreateMutexFailed : EB_ErrorNone;
 #endif // _WIN32
 
+    --mutexHeldCount;
+
     return return_error;
 }
 
 /***************************************
  * EbBlockOnMutex
  ***************************************/
-EbErrorType EbBlockOnMutex(
+EB_TLS_ACCESS EbErrorType EbBlockOnMutex(
     EbHandle mutexHandle)
 {
     EbErrorType return_error = EB_ErrorNone;
@@ -332,13 +391,16 @@ EbErrorType EbBlockOnMutex(
     return_error = pthread_mutex_lock((pthread_mutex_t*)mutexHandle) ? EB_ErrorMutexUnresponsive : EB_ErrorNone;
 #endif // _WIN32
 
+    if (return_error == EB_ErrorNone)
+        ++mutexHeldCount;
+
     return return_error;
 }
 
 /***************************************
  * EbBlockOnMutexTimeout
  ***************************************/
-EbErrorType EbBlockOnMutexTimeout(
+EB_TLS_ACCESS EbErrorType EbBlockOnMutexTimeout(
     EbHandle mutexHandle,
     uint32_t    timeout)
 {
@@ -351,6 +413,9 @@ EbErrorType EbBlockOnMutexTimeout(
     (void)timeout;
 #endif // _WIN32
 
+    if (return_error == EB_ErrorNone)
+        ++mutexHeldCount;
+
     return return_error;
 }
 
@@ -371,3 +436,525 @@ EbErrorType EbDestroyMutex(
 
     return return_error;
 }
+
+/***************************************
+ * EbMutexHeldCount
+ ***************************************/
+EB_TLS_ACCESS uint32_t EbMutexHeldCount(
+    void)
+{
+    return mutexHeldCount;
+}
+
+/***************************************
+ * Fibers
+ *   The stack is only reserved, the pages get committed as the fiber
+ *   grows into them like the stack of a thread.
+ ***************************************/
+typedef struct EbFiber_s {
+#ifdef _WIN32
+    LPVOID                   fiber;
+#else
+    ucontext_t               context;
+    uint8_t                 *stackPtr;
+    size_t                   stackSize;
+#endif
+    void                   (*fiberFunction)(void *);
+    void                    *fiberContext;
+} EbFiber_t;
+
+#ifdef _WIN32
+static VOID CALLBACK EbFiberStartKernel(
+    LPVOID input_ptr)
+{
+    EbFiber_t *fiberPtr = (EbFiber_t*)input_ptr;
+
+    fiberPtr->fiberFunction(fiberPtr->fiberContext);
+}
+#else
+// makecontext only passes int arguments, the fiber pointer comes in two halves
+static void EbFiberStartKernel(
+    uint32_t fiberPtrHigh,
+    uint32_t fiberPtrLow)
+{
+    EbFiber_t *fiberPtr = (EbFiber_t*)(uintptr_t)(((uint64_t)fiberPtrHigh << 32) | fiberPtrLow);
+
+    fiberPtr->fiberFunction(fiberPtr->fiberContext);
+}
+#endif
+
+/***************************************
+ * EbCreateFiber
+ ***************************************/
+EbHandle EbCreateFiber(
+    void fiberFunction(void *),
+    void *fiberContext)
+{
+    // volatile, getcontext returns twice as far as the compiler knows
+    EbFiber_t *volatile fiberPtr = (EbFiber_t*)calloc(1, sizeof(EbFiber_t));
+
+    if (fiberPtr == (EbFiber_t*)EB_NULL)
+        return NULL;
+    fiberPtr->fiberFunction = fiberFunction;
+    fiberPtr->fiberContext = fiberContext;
+
+    // Fiber of a thread, set up by the first switch away from it
+    if (fiberFunction == NULL)
+        return (EbHandle)fiberPtr;
+
+#ifdef _WIN32
+    fiberPtr->fiber = CreateFiberEx(
+        0,                              // default committed stack size
+        EB_FiberStackSize,              // reserved stack size
+        FIBER_FLAG_FLOAT_SWITCH,        // keep the floating point state per fiber
+        EbFiberStartKernel,
+        fiberPtr);
+    if (fiberPtr->fiber == NULL) {
+        free(fiberPtr);
+        return NULL;
+    }
+#else
+    {
+        size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+        uintptr_t fiberAddress = (uintptr_t)fiberPtr;
+
+        fiberPtr->stackSize = EB_FiberStackSize;
+        fiberPtr->stackPtr = (uint8_t*)mmap(NULL, fiberPtr->stackSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (fiberPtr->stackPtr == (uint8_t*)MAP_FAILED) {
+            free(fiberPtr);
+            return NULL;
+        }
+        // Guard page, an overflow faults instead of running into other memory
+        mprotect(fiberPtr->stackPtr, pageSize, PROT_NONE);
+
+        getcontext(&fiberPtr->context);
+        fiberPtr->context.uc_stack.ss_sp = fiberPtr->stackPtr;
+        fiberPtr->context.uc_stack.ss_size = fiberPtr->stackSize;
+        fiberPtr->context.uc_link = (ucontext_t*)EB_NULL;
+        makecontext(&fiberPtr->context, (void(*)(void))EbFiberStartKernel, 2, (uint32_t)((uint64_t)fiberAddress >> 32), (uint32_t)fiberAddress);
+    }
+#endif
+
+    return (EbHandle)fiberPtr;
+}
+
+/***************************************
+ * EbSwitchFiber
+ ***************************************/
+void EbSwitchFiber(
+    EbHandle currentFiberHandle,
+    EbHandle nextFiberHandle)
+{
+    EbFiber_t *currentFiberPtr = (EbFiber_t*)currentFiberHandle;
+    EbFiber_t *nextFiberPtr = (EbFiber_t*)nextFiberHandle;
+
+#ifdef _WIN32
+    if (currentFiberPtr->fiber == NULL)
+        currentFiberPtr->fiber = ConvertThreadToFiberEx(NULL, FIBER_FLAG_FLOAT_SWITCH);
+    SwitchToFiber(nextFiberPtr->fiber);
+#else
+    swapcontext(&currentFiberPtr->context, &nextFiberPtr->context);
+#endif
+}
+
+/***************************************
+ * EbDestroyFiber
+ ***************************************/
+EbErrorType EbDestroyFiber(
+    EbHandle fiberHandle)
+{
+    EbErrorType return_error = EB_ErrorNone;
+    EbFiber_t *fiberPtr = (EbFiber_t*)fiberHandle;
+
+    if (fiberPtr->fiberFunction) {
+#ifdef _WIN32
+        DeleteFiber(fiberPtr->fiber);
+#else
+        return_error = munmap(fiberPtr->stackPtr, fiberPtr->stackSize) ? EB_ErrorMax : EB_ErrorNone;
+#endif
+    }
+    free(fiberPtr);
+
+    return return_error;
+}
+
+/***************************************
+ * EbGetTimeUs
+ ***************************************/
+uint64_t EbGetTimeUs(
+    void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 +
+        (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+#endif
+}
+
+/***************************************
+ * EbGetMemoryContext
+ ***************************************/
+EB_TLS_ACCESS EbMemoryContext_t* EbGetMemoryContext(
+    void)
+{
+    return memoryContextPtr;
+}
+
+/***************************************
+ * EbSetMemoryContext
+ ***************************************/
+EB_TLS_ACCESS EbMemoryContext_t* EbSetMemoryContext(
+    EbMemoryContext_t  *contextPtr)
+{
+    EbMemoryContext_t *previousContextPtr = memoryContextPtr;
+
+    memoryContextPtr = contextPtr;
+
+    return previousContextPtr;
+}
+
+/***************************************
+ * EbSetDispatchTable
+ ***************************************/
+EB_TLS_ACCESS struct EbDispatchTable_s* EbSetDispatchTable(
+    struct EbDispatchTable_s *tablePtr)
+{
+    struct EbDispatchTable_s *previousTablePtr = currentDispatchTablePtr;
+
+    currentDispatchTablePtr = tablePtr;
+
+    return previousTablePtr;
+}
+
+static void EbLockMemoryContext(
+    EbMemoryContext_t  *contextPtr)
+{
+    while (!EbAtomicCompareExchange32(&contextPtr->lock, 0, 1))
+        EbCpuPause();
+}
+
+static void EbUnlockMemoryContext(
+    EbMemoryContext_t  *contextPtr)
+{
+    EbAtomicCompareExchange32(&contextPtr->lock, 1, 0);
+}
+
+/***************************************
+ * EbPushMemoryEntry
+ *   Appends ptr to the table of contextPtr, the lock must be held
+ ***************************************/
+static EbErrorType EbPushMemoryEntry(
+    EbMemoryContext_t  *contextPtr,
+    EbPtr               ptr,
+    EbPtrType           ptrType)
+{
+    EbMemoryMapChunk_t *chunkPtr = contextPtr->memoryMapPtr;
+
+    if (chunkPtr == (EbMemoryMapChunk_t*)EB_NULL || chunkPtr->entryCount == EB_MemoryMapChunkSize) {
+        chunkPtr = (EbMemoryMapChunk_t*)malloc(sizeof(EbMemoryMapChunk_t));
+        if (chunkPtr == (EbMemoryMapChunk_t*)EB_NULL)
+            return EB_ErrorInsufficientResources;
+
+        chunkPtr->nextPtr = contextPtr->memoryMapPtr;
+        chunkPtr->entryCount = 0;
+        contextPtr->memoryMapPtr = chunkPtr;
+        contextPtr->totalLibMemory += sizeof(EbMemoryMapChunk_t);
+    }
+
+    chunkPtr->entryArray[chunkPtr->entryCount].ptrType = ptrType;
+    chunkPtr->entryArray[chunkPtr->entryCount].ptr = ptr;
+    ++chunkPtr->entryCount;
+
+    return EB_ErrorNone;
+}
+
+static EbPtr EbAllocateBlock(
+    uint64_t            size,
+    EbPtrType           ptrType,
+    EbBool              zero)
+{
+    EbPtr ptr;
+
+    if (ptrType != EB_A_PTR)
+        return zero ? calloc(1, (size_t)size) : malloc((size_t)size);
+
+#ifdef _WIN32
+    ptr = _aligned_malloc((size_t)size, ALVALUE);
+#else
+    if (posix_memalign(&ptr, ALVALUE, (size_t)size) != 0)
+        ptr = EB_NULL;
+#endif
+    if (ptr != EB_NULL && zero)
+        memset(ptr, 0, (size_t)size);
+
+    return ptr;
+}
+
+static void EbFreeBlock(
+    EbPtr               ptr,
+    EbPtrType           ptrType)
+{
+#ifdef _WIN32
+    if (ptrType == EB_A_PTR) {
+        _aligned_free(ptr);
+        return;
+    }
+#else
+    (void)ptrType;
+#endif
+    free(ptr);
+}
+
+/***************************************
+ * EbAddMemoryEntry
+ ***************************************/
+EB_TLS_ACCESS EbErrorType EbAddMemoryEntry(
+    EbPtr               ptr,
+    EbPtrType           ptrType,
+    uint64_t            size)
+{
+    EbMemoryContext_t *contextPtr = memoryContextPtr;
+    EbErrorType        return_error;
+
+    if (contextPtr == (EbMemoryContext_t*)EB_NULL)
+        return EB_ErrorUndefined;
+
+    EbLockMemoryContext(contextPtr);
+
+    return_error = EbPushMemoryEntry(contextPtr, ptr, ptrType);
+    if (return_error == EB_ErrorNone) {
+        contextPtr->totalLibMemory += (size + 7) & ~(uint64_t)7;
+        contextPtr->requestedLibMemory += (size + 7) & ~(uint64_t)7;
+
+        switch (ptrType) {
+        case EB_THREAD:
+            ++contextPtr->libThreadCount;
+            break;
+        case EB_SEMAPHORE:
+            ++contextPtr->libSemaphoreCount;
+            break;
+        case EB_MUTEX:
+            ++contextPtr->libMutexCount;
+            break;
+        default:
+            ++contextPtr->libMallocCount;
+            break;
+        }
+    }
+
+    EbUnlockMemoryContext(contextPtr);
+
+    return return_error;
+}
+
+/***************************************
+ * EbArenaAlloc
+ ***************************************/
+EB_TLS_ACCESS EbPtr EbArenaAlloc(
+    uint64_t            size,
+    EbPtrType           ptrType,
+    EbBool              zero)
+{
+    EbMemoryContext_t *contextPtr = memoryContextPtr;
+    uint64_t           alignment = (ptrType == EB_A_PTR) ? ALVALUE : EB_ArenaAlignment;
+    uint64_t           offset;
+    EbPtr              ptr;
+
+    if (contextPtr == (EbMemoryContext_t*)EB_NULL)
+        return EB_NULL;
+
+    if (size > EB_ArenaMaxCarveSize) {
+        // Block of its own, left to the allocator so it stays untouched
+        //   until used
+        ptr = EbAllocateBlock(size, ptrType, zero);
+        if (ptr != EB_NULL && EbAddMemoryEntry(ptr, ptrType, size) != EB_ErrorNone) {
+            EbFreeBlock(ptr, ptrType);
+            ptr = EB_NULL;
+        }
+        return ptr;
+    }
+
+    EbLockMemoryContext(contextPtr);
+
+    offset = (contextPtr->slabOffset + alignment - 1) & ~(alignment - 1);
+    if (contextPtr->slabPtr == (uint8_t*)EB_NULL || offset + size > EB_ArenaSlabSize) {
+        uint8_t *slabPtr = (uint8_t*)EbAllocateBlock(EB_ArenaSlabSize, EB_A_PTR, EB_FALSE);
+
+        if (slabPtr != (uint8_t*)EB_NULL && EbPushMemoryEntry(contextPtr, slabPtr, EB_A_PTR) != EB_ErrorNone) {
+            EbFreeBlock(slabPtr, EB_A_PTR);
+            slabPtr = (uint8_t*)EB_NULL;
+        }
+        if (slabPtr == (uint8_t*)EB_NULL) {
+            EbUnlockMemoryContext(contextPtr);
+            return EB_NULL;
+        }
+
+        contextPtr->slabPtr = slabPtr;
+        contextPtr->totalLibMemory += EB_ArenaSlabSize;
+        ++contextPtr->libMallocCount;
+        offset = 0;
+    }
+    ptr = contextPtr->slabPtr + offset;
+    contextPtr->slabOffset = offset + size;
+    contextPtr->requestedLibMemory += size;
+
+    EbUnlockMemoryContext(contextPtr);
+
+    if (zero)
+        memset(ptr, 0, (size_t)size);
+
+    return ptr;
+}
+
+/***************************************
+ * EbAllocMemoryEntry
+ ***************************************/
+EbPtr EbAllocMemoryEntry(
+    EbMemoryContext_t  *contextPtr,
+    uint64_t            size,
+    EbPtrType           ptrType)
+{
+    EbPtr ptr = EbAllocateBlock(size, ptrType, EB_FALSE);
+
+    if (ptr == EB_NULL)
+        return EB_NULL;
+
+    EbLockMemoryContext(contextPtr);
+
+    if (EbPushMemoryEntry(contextPtr, ptr, ptrType) != EB_ErrorNone) {
+        EbUnlockMemoryContext(contextPtr);
+        EbFreeBlock(ptr, ptrType);
+        return EB_NULL;
+    }
+    contextPtr->totalLibMemory += (size + 7) & ~(uint64_t)7;
+    contextPtr->requestedLibMemory += (size + 7) & ~(uint64_t)7;
+    ++contextPtr->libMallocCount;
+
+    EbUnlockMemoryContext(contextPtr);
+
+    return ptr;
+}
+
+/***************************************
+ * EbFreeMemoryEntry
+ *   Looks ptr up from the newest entry, its slot is left empty
+ ***************************************/
+void EbFreeMemoryEntry(
+    EbMemoryContext_t  *contextPtr,
+    EbPtr               ptr,
+    uint64_t            size)
+{
+    EbMemoryMapChunk_t *chunkPtr;
+    EbMemoryMapEntry   *memoryEntry;
+    EbPtrType           ptrType;
+    int32_t             entryIndex;
+
+    EbLockMemoryContext(contextPtr);
+
+    for (chunkPtr = contextPtr->memoryMapPtr; chunkPtr != (EbMemoryMapChunk_t*)EB_NULL; chunkPtr = chunkPtr->nextPtr) {
+        for (entryIndex = (int32_t)chunkPtr->entryCount - 1; entryIndex >= 0; --entryIndex) {
+            memoryEntry = &chunkPtr->entryArray[entryIndex];
+            if (memoryEntry->ptr == ptr) {
+                ptrType = memoryEntry->ptrType;
+                memoryEntry->ptr = EB_NULL;
+                contextPtr->totalLibMemory -= (size + 7) & ~(uint64_t)7;
+                contextPtr->requestedLibMemory -= (size + 7) & ~(uint64_t)7;
+                --contextPtr->libMallocCount;
+                EbUnlockMemoryContext(contextPtr);
+                EbFreeBlock(ptr, ptrType);
+                return;
+            }
+        }
+    }
+
+    EbUnlockMemoryContext(contextPtr);
+}
+
+/***************************************
+ * EbStopMemoryContextThreads
+ ***************************************/
+void EbStopMemoryContextThreads(
+    EbMemoryContext_t  *contextPtr)
+{
+    EbMemoryMapChunk_t *chunkPtr;
+    EbMemoryMapEntry   *memoryEntry;
+    int32_t             entryIndex;
+
+    for (chunkPtr = contextPtr->memoryMapPtr; chunkPtr != (EbMemoryMapChunk_t*)EB_NULL; chunkPtr = chunkPtr->nextPtr) {
+        for (entryIndex = (int32_t)chunkPtr->entryCount - 1; entryIndex >= 0; --entryIndex) {
+            memoryEntry = &chunkPtr->entryArray[entryIndex];
+            if (memoryEntry->ptrType == EB_THREAD && memoryEntry->ptr) {
+                EbDestroyThread(memoryEntry->ptr);
+                memoryEntry->ptr = EB_NULL;
+                --contextPtr->libThreadCount;
+            }
+        }
+    }
+}
+
+/***************************************
+ * EbReleaseMemoryContext
+ ***************************************/
+EbErrorType EbReleaseMemoryContext(
+    EbMemoryContext_t  *contextPtr)
+{
+    EbErrorType         return_error = EB_ErrorNone;
+    EbMemoryMapChunk_t *chunkPtr;
+    EbMemoryMapEntry   *memoryEntry;
+    int32_t             entryIndex;
+
+    // Any other object may still be in use by a thread
+    EbStopMemoryContextThreads(contextPtr);
+
+    while ((chunkPtr = contextPtr->memoryMapPtr) != (EbMemoryMapChunk_t*)EB_NULL) {
+        for (entryIndex = (int32_t)chunkPtr->entryCount - 1; entryIndex >= 0; --entryIndex) {
+            memoryEntry = &chunkPtr->entryArray[entryIndex];
+            switch (memoryEntry->ptrType) {
+            case EB_N_PTR:
+            case EB_A_PTR:
+                // Empty once freed by EbFreeMemoryEntry
+                if (memoryEntry->ptr) {
+                    EbFreeBlock(memoryEntry->ptr, memoryEntry->ptrType);
+                    --contextPtr->libMallocCount;
+                }
+                break;
+            case EB_SEMAPHORE:
+                EbDestroySemaphore(memoryEntry->ptr);
+                --contextPtr->libSemaphoreCount;
+                break;
+            case EB_MUTEX:
+                EbDestroyMutex(memoryEntry->ptr);
+                --contextPtr->libMutexCount;
+                break;
+            case EB_FIBER:
+                EbDestroyFiber(memoryEntry->ptr);
+                --contextPtr->libMallocCount;
+                break;
+            case EB_THREAD:
+                break;
+            default:
+                return_error = EB_ErrorMax;
+                break;
+            }
+        }
+        contextPtr->memoryMapPtr = chunkPtr->nextPtr;
+        free(chunkPtr);
+    }
+
+    contextPtr->slabPtr = (uint8_t*)EB_NULL;
+    contextPtr->slabOffset = 0;
+
+    return return_error;
+}
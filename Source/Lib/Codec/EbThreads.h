@@ -58,10 +58,152 @@ extern "C" {
         uint32_t timeout);
     extern EbErrorType EbDestroyMutex(
         EbHandle mutexHandle);
+    // Number of mutexes held by the calling thread
+    extern uint32_t EbMutexHeldCount(
+        void);
+
+    /**************************************
+     * Fibers
+     *   A fiber runs fiberFunction, which must not return, on a stack of
+     *   its own. It only runs when a thread switches to it and may be
+     *   resumed by another thread than the one it left. Code running on
+     *   a fiber must not keep the address of a thread local variable
+     *   across a switch.
+     **************************************/
+#define EB_FiberStackSize               (8 << 20)
+
+    // With a NULL fiberFunction, creates the fiber of the thread that
+    //   first switches away from it
+    extern EbHandle EbCreateFiber(
+        void fiberFunction(void *),
+        void *fiberContext);
+    // Saves the calling thread state in currentFiberHandle and resumes
+    //   nextFiberHandle
+    extern void EbSwitchFiber(
+        EbHandle currentFiberHandle,
+        EbHandle nextFiberHandle);
+    extern EbErrorType EbDestroyFiber(
+        EbHandle fiberHandle);
+
+    /**************************************
+     * Time
+     **************************************/
+    // Monotonic time in microseconds
+    extern uint64_t EbGetTimeUs(
+        void);
+
+    /**************************************
+     * Atomics
+     **************************************/
+#ifdef _MSC_VER
+#define EB_THREAD_LOCAL __declspec(thread)
+#define EB_THREAD_LOCAL_EXEC __declspec(thread)
+// /GT keeps the compiler from caching thread-local addresses, see EB_TLS_ACCESS
+#define EB_TLS_ACCESS
+    static inline uint64_t EbAtomicLoad64(volatile uint64_t *ptr) {
+        uint64_t value = *ptr;
+        _ReadWriteBarrier();
+        return value;
+    }
+    static inline void EbAtomicStore64(volatile uint64_t *ptr, uint64_t value) {
+        _ReadWriteBarrier();
+        *ptr = value;
+    }
+    static inline EbBool EbAtomicCompareExchange64(volatile uint64_t *ptr, uint64_t expected, uint64_t desired) {
+        return (uint64_t)InterlockedCompareExchange64((volatile LONG64*)ptr, (LONG64)desired, (LONG64)expected) == expected ? EB_TRUE : EB_FALSE;
+    }
+    static inline uint32_t EbAtomicLoad32(volatile uint32_t *ptr) {
+        uint32_t value = *ptr;
+        _ReadWriteBarrier();
+        return value;
+    }
+    static inline EbBool EbAtomicCompareExchange32(volatile uint32_t *ptr, uint32_t expected, uint32_t desired) {
+        return (uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, (LONG)desired, (LONG)expected) == expected ? EB_TRUE : EB_FALSE;
+    }
+    static inline uint32_t EbAtomicAdd32(volatile uint32_t *ptr, int32_t value) {
+        return (uint32_t)InterlockedExchangeAdd((volatile LONG*)ptr, (LONG)value) + value;
+    }
+    static inline uint64_t EbAtomicAdd64(volatile uint64_t *ptr, int64_t value) {
+        return (uint64_t)InterlockedExchangeAdd64((volatile LONG64*)ptr, (LONG64)value) + value;
+    }
+    static inline void EbAtomicFence(void) {
+        MemoryBarrier();
+    }
+    static inline void EbCpuPause(void) {
+        YieldProcessor();
+    }
+#else
+#define EB_THREAD_LOCAL __thread
+// Static TLS, reached without the __tls_get_addr call of PIC code. For the
+//   variables read on hot paths, the library only needs a few bytes of it.
+#define EB_THREAD_LOCAL_EXEC __thread __attribute__((tls_model("initial-exec")))
+// GCC and Clang have no counterpart of the MSVC /GT, a function may compute
+//   the address of a thread-local variable once and keep it across the fiber
+//   switch of a scheduler task that resumes on another worker. Functions that
+//   read or write EB_THREAD_LOCAL variables are EB_TLS_ACCESS, never inlined
+//   or analyzed into their callers, so that each call sees the variables of
+//   the thread it runs on.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 8
+#define EB_TLS_ACCESS __attribute__((noipa))
+#else
+#define EB_TLS_ACCESS __attribute__((noinline))
+#endif
+    static inline uint64_t EbAtomicLoad64(volatile uint64_t *ptr) {
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    }
+    static inline void EbAtomicStore64(volatile uint64_t *ptr, uint64_t value) {
+        __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+    }
+    static inline EbBool EbAtomicCompareExchange64(volatile uint64_t *ptr, uint64_t expected, uint64_t desired) {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? EB_TRUE : EB_FALSE;
+    }
+    static inline uint32_t EbAtomicLoad32(volatile uint32_t *ptr) {
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    }
+    static inline EbBool EbAtomicCompareExchange32(volatile uint32_t *ptr, uint32_t expected, uint32_t desired) {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? EB_TRUE : EB_FALSE;
+    }
+    static inline uint32_t EbAtomicAdd32(volatile uint32_t *ptr, int32_t value) {
+        return __atomic_add_fetch(ptr, (uint32_t)value, __ATOMIC_SEQ_CST);
+    }
+    static inline uint64_t EbAtomicAdd64(volatile uint64_t *ptr, int64_t value) {
+        return __atomic_add_fetch(ptr, (uint64_t)value, __ATOMIC_SEQ_CST);
+    }
+    static inline void EbAtomicFence(void) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+    static inline void EbCpuPause(void) {
+#if defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#endif
+    }
+#endif
 
-    extern    EbMemoryMapEntry        *memoryMap;               // library Memory table
-    extern    uint32_t                  *memoryMapIndex;          // library memory index
-    extern    uint64_t                  *totalLibMemory;          // library Memory malloc'd
+    /**************************************
+     * Dispatch table
+     **************************************/
+    struct EbDispatchTable_s;
+
+    // Kernel dispatch table of the encoder instance the calling thread
+    //   works for, see aom_dsp_rtcd.h. The kernels read it directly, not
+    //   through an EB_TLS_ACCESS function: the scheduler workers of an
+    //   encoder instance all inherit its table, a task resumed on another
+    //   worker reads the same value.
+    extern EB_THREAD_LOCAL_EXEC struct EbDispatchTable_s *currentDispatchTablePtr;
+
+    // Binds the calling thread to tablePtr, returns the previous binding.
+    //   Threads created by EbCreateThread inherit the binding.
+    extern struct EbDispatchTable_s* EbSetDispatchTable(
+        struct EbDispatchTable_s *tablePtr);
+
+#define EB_CREATEFIBER(type, pointer, nElements, pointerClass, fiberFunction, fiberContext) \
+    pointer = EbCreateFiber(fiberFunction, fiberContext); \
+    if (pointer == (type)EB_NULL) { \
+        return EB_ErrorInsufficientResources; \
+    } \
+    if (EbAddMemoryEntry(pointer, pointerClass, nElements) != EB_ErrorNone) { \
+        return EB_ErrorInsufficientResources; \
+    }
 
 #ifdef _MSC_VER
     extern    GROUP_AFFINITY           groupAffinity;
@@ -73,14 +215,6 @@ extern "C" {
         return EB_ErrorInsufficientResources; \
     } \
     else { \
-        memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-        memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-        if (nElements % 8 == 0) { \
-            *totalLibMemory += (nElements); \
-        } \
-        else { \
-            *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-        } \
         if (numGroups == 2 && alternateGroups){ \
             groupAffinity.Group = 1 - groupAffinity.Group; \
             SetThreadGroupAffinity(pointer,&groupAffinity,NULL); \
@@ -89,33 +223,20 @@ extern "C" {
             SetThreadGroupAffinity(pointer,&groupAffinity,NULL); \
         } \
     } \
-    if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
+    if (EbAddMemoryEntry(pointer, pointerClass, nElements) != EB_ErrorNone) { \
         return EB_ErrorInsufficientResources; \
-    } \
-    libThreadCount++;
+    }
 #else
 #define EB_CREATETHREAD(type, pointer, nElements, pointerClass, threadFunction, threadContext) \
     pointer = EbCreateThread(threadFunction, threadContext); \
     if (pointer == (type)EB_NULL) { \
         return EB_ErrorInsufficientResources; \
     } \
-    else { \
-        memoryMap[*(memoryMapIndex)].ptrType = pointerClass; \
-        memoryMap[(*(memoryMapIndex))++].ptr = pointer; \
-        if (nElements % 8 == 0) { \
-            *totalLibMemory += (nElements); \
-        } \
-        else { \
-            *totalLibMemory += ((nElements) + (8 - ((nElements) % 8))); \
-        } \
-    } \
-    if (*(memoryMapIndex) >= MAX_NUM_PTR) { \
+    if (EbAddMemoryEntry(pointer, pointerClass, nElements) != EB_ErrorNone) { \
         return EB_ErrorInsufficientResources; \
-    } \
-    libThreadCount++;
+    }
 #endif
 
-
 #ifdef __cplusplus
 }
 #endif
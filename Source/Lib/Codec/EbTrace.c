@@ -0,0 +1,357 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbTrace.h"
+
+// Ring the calling thread claimed, only valid while threadTraceId is the
+//   traceId of the trace asking for it. The ring is freed by EbTraceDump.
+static EB_THREAD_LOCAL EbTraceRing_t *threadRingPtr = (EbTraceRing_t*)EB_NULL;
+static EB_THREAD_LOCAL uint32_t       threadTraceId = 0;
+
+// Ring of the kernel iteration the calling thread is in, NULL outside of
+//   one. Set by EbTraceStageBegin, cleared by EbTraceStageEnd.
+static EB_THREAD_LOCAL EbTraceRing_t *activeRingPtr = (EbTraceRing_t*)EB_NULL;
+
+// Last traceId handed out, 0 is never one
+static volatile uint32_t traceIdCount = 0;
+
+/**************************************
+ * EbTraceCtor
+ **************************************/
+EbErrorType EbTraceCtor(
+    EbTrace_t          **traceDblPtr,
+    const char          *filePath,
+    uint32_t             processId)
+{
+    EbTrace_t *tracePtr;
+    size_t     filePathSize = strlen(filePath) + 1;
+
+    EB_MALLOC(EbTrace_t*, tracePtr, sizeof(EbTrace_t), EB_N_PTR);
+    *traceDblPtr = tracePtr;
+
+    // The application string only has to live until eb_init_encoder returns
+    EB_MALLOC(char*, tracePtr->filePath, filePathSize, EB_N_PTR);
+    memcpy(tracePtr->filePath, filePath, filePathSize);
+
+    tracePtr->processId = processId;
+    tracePtr->traceId = EbAtomicAdd32(&traceIdCount, 1);
+    tracePtr->startTime = EbGetTimeUs();
+    tracePtr->ringCount = 0;
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * EbTraceRingGet
+ *   Claims a ring of tracePtr for the calling thread. Lock free, the
+ *   slot index is the thread id of the trace.
+ **************************************/
+static EB_TLS_ACCESS EbTraceRing_t* EbTraceRingGet(
+    EbTrace_t           *tracePtr)
+{
+    EbTraceRing_t *ringPtr;
+    uint32_t       ringIndex;
+
+    if (threadTraceId == tracePtr->traceId)
+        return threadRingPtr;
+
+    threadTraceId = tracePtr->traceId;
+    threadRingPtr = (EbTraceRing_t*)EB_NULL;
+
+    ringIndex = EbAtomicAdd32(&tracePtr->ringCount, 1) - 1;
+    if (ringIndex >= EB_TraceMaxRingCount)
+        return (EbTraceRing_t*)EB_NULL;
+
+    tracePtr->ringArray[ringIndex] = (EbTraceRing_t*)EB_NULL;
+    ringPtr = (EbTraceRing_t*)malloc(sizeof(EbTraceRing_t));
+    if (ringPtr == (EbTraceRing_t*)EB_NULL)
+        return (EbTraceRing_t*)EB_NULL;
+
+    ringPtr->eventArray = (EbTraceEvent_t*)malloc(sizeof(EbTraceEvent_t) * EB_TraceRingEventCount);
+    if (ringPtr->eventArray == (EbTraceEvent_t*)EB_NULL) {
+        free(ringPtr);
+        return (EbTraceRing_t*)EB_NULL;
+    }
+
+    ringPtr->tracePtr = tracePtr;
+    ringPtr->writeIndex = 0;
+    ringPtr->stageEventIndex = 0;
+    ringPtr->threadIndex = ringIndex;
+    ringPtr->threadName = (const char*)EB_NULL;
+    ringPtr->stageName = (const char*)EB_NULL;
+    ringPtr->nestedName = (const char*)EB_NULL;
+    tracePtr->ringArray[ringIndex] = ringPtr;
+
+    return threadRingPtr = ringPtr;
+}
+
+static EbTraceEvent_t* EbTraceRecord(
+    EbTraceRing_t       *ringPtr,
+    const char          *name,
+    uint32_t             phase,
+    uint64_t             pictureNumber,
+    uint32_t             segmentIndex)
+{
+    EbTraceEvent_t *eventPtr = &ringPtr->eventArray[ringPtr->writeIndex++ & (EB_TraceRingEventCount - 1)];
+
+    eventPtr->timestamp = EbGetTimeUs();
+    eventPtr->name = name;
+    eventPtr->pictureNumber = pictureNumber;
+    eventPtr->segmentIndex = segmentIndex;
+    eventPtr->phase = phase;
+
+    return eventPtr;
+}
+
+/**************************************
+ * EbTraceStageBegin
+ **************************************/
+EB_TLS_ACCESS void EbTraceStageBegin(
+    EbTrace_t           *tracePtr,
+    const char          *name)
+{
+    EbTraceRing_t *ringPtr = EbTraceRingGet(tracePtr);
+
+    activeRingPtr = ringPtr;
+    if (ringPtr == (EbTraceRing_t*)EB_NULL)
+        return;
+
+    // Threads of the task scheduler run the kernels of several processes
+    if (ringPtr->threadName == (const char*)EB_NULL)
+        ringPtr->threadName = name;
+    else if (ringPtr->threadName != name)
+        ringPtr->threadName = "Worker";
+
+    ringPtr->stageName = name;
+    ringPtr->nestedName = (const char*)EB_NULL;
+    ringPtr->stageEventIndex = ringPtr->writeIndex;
+    EbTraceRecord(ringPtr, name, EB_TracePhaseBegin, EB_TraceNoPicture, 0);
+}
+
+/**************************************
+ * EbTraceStageEnd
+ **************************************/
+EB_TLS_ACCESS void EbTraceStageEnd(
+    const char          *name)
+{
+    EbTraceRing_t *ringPtr = activeRingPtr;
+
+    if (ringPtr == (EbTraceRing_t*)EB_NULL)
+        return;
+
+    if (ringPtr->nestedName) {
+        EbTraceRecord(ringPtr, ringPtr->nestedName, EB_TracePhaseEnd, EB_TraceNoPicture, 0);
+        ringPtr->nestedName = (const char*)EB_NULL;
+    }
+    EbTraceRecord(ringPtr, name, EB_TracePhaseEnd, EB_TraceNoPicture, 0);
+    activeRingPtr = (EbTraceRing_t*)EB_NULL;
+}
+
+/**************************************
+ * EbTraceSuspend
+ **************************************/
+EB_TLS_ACCESS void EbTraceSuspend(
+    EbTraceSpan_t       *spanPtr)
+{
+    EbTraceRing_t  *ringPtr = activeRingPtr;
+    EbTraceEvent_t *eventPtr;
+
+    if (ringPtr == (EbTraceRing_t*)EB_NULL) {
+        spanPtr->tracePtr = (EbTrace_t*)EB_NULL;
+        return;
+    }
+
+    spanPtr->tracePtr = ringPtr->tracePtr;
+    spanPtr->stageName = ringPtr->stageName;
+    spanPtr->stagePictureNumber = EB_TraceNoPicture;
+    spanPtr->stageSegmentIndex = 0;
+    if (ringPtr->writeIndex - ringPtr->stageEventIndex <= EB_TraceRingEventCount) {
+        eventPtr = &ringPtr->eventArray[ringPtr->stageEventIndex & (EB_TraceRingEventCount - 1)];
+        spanPtr->stagePictureNumber = eventPtr->pictureNumber;
+        spanPtr->stageSegmentIndex = eventPtr->segmentIndex;
+    }
+    spanPtr->name = ringPtr->nestedName;
+    spanPtr->pictureNumber = ringPtr->nestedPictureNumber;
+    spanPtr->segmentIndex = ringPtr->nestedSegmentIndex;
+
+    EbTraceStageEnd(ringPtr->stageName);
+}
+
+/**************************************
+ * EbTraceResume
+ **************************************/
+void EbTraceResume(
+    const EbTraceSpan_t *spanPtr)
+{
+    if (spanPtr->tracePtr == (EbTrace_t*)EB_NULL)
+        return;
+
+    EbTraceStageBegin(spanPtr->tracePtr, spanPtr->stageName);
+    if (spanPtr->stagePictureNumber != EB_TraceNoPicture)
+        EbTracePicture(spanPtr->stagePictureNumber, spanPtr->stageSegmentIndex);
+    if (spanPtr->name)
+        EbTraceBegin(spanPtr->name, spanPtr->pictureNumber, spanPtr->segmentIndex);
+}
+
+/**************************************
+ * EbTracePicture
+ **************************************/
+EB_TLS_ACCESS void EbTracePicture(
+    uint64_t             pictureNumber,
+    uint32_t             segmentIndex)
+{
+    EbTraceRing_t  *ringPtr = activeRingPtr;
+    EbTraceEvent_t *eventPtr;
+
+    if (ringPtr == (EbTraceRing_t*)EB_NULL || ringPtr->writeIndex - ringPtr->stageEventIndex > EB_TraceRingEventCount)
+        return;
+
+    eventPtr = &ringPtr->eventArray[ringPtr->stageEventIndex & (EB_TraceRingEventCount - 1)];
+    eventPtr->pictureNumber = pictureNumber;
+    eventPtr->segmentIndex = segmentIndex;
+}
+
+/**************************************
+ * EbTraceBegin
+ **************************************/
+EB_TLS_ACCESS void EbTraceBegin(
+    const char          *name,
+    uint64_t             pictureNumber,
+    uint32_t             segmentIndex)
+{
+    EbTraceRing_t *ringPtr = activeRingPtr;
+
+    if (ringPtr == (EbTraceRing_t*)EB_NULL)
+        return;
+
+    ringPtr->nestedName = name;
+    ringPtr->nestedPictureNumber = pictureNumber;
+    ringPtr->nestedSegmentIndex = segmentIndex;
+    EbTraceRecord(ringPtr, name, EB_TracePhaseBegin, pictureNumber, segmentIndex);
+}
+
+/**************************************
+ * EbTraceEnd
+ **************************************/
+EB_TLS_ACCESS void EbTraceEnd(
+    const char          *name)
+{
+    EbTraceRing_t *ringPtr = activeRingPtr;
+
+    if (ringPtr == (EbTraceRing_t*)EB_NULL)
+        return;
+
+    ringPtr->nestedName = (const char*)EB_NULL;
+    EbTraceRecord(ringPtr, name, EB_TracePhaseEnd, EB_TraceNoPicture, 0);
+}
+
+/**************************************
+ * EbTraceAsyncBegin
+ **************************************/
+EB_TLS_ACCESS void EbTraceAsyncBegin(
+    const char          *name,
+    uint64_t             pictureNumber)
+{
+    if (activeRingPtr)
+        EbTraceRecord(activeRingPtr, name, EB_TracePhaseAsyncBegin, pictureNumber, 0);
+}
+
+/**************************************
+ * EbTraceAsyncEnd
+ **************************************/
+EB_TLS_ACCESS void EbTraceAsyncEnd(
+    const char          *name,
+    uint64_t             pictureNumber)
+{
+    if (activeRingPtr)
+        EbTraceRecord(activeRingPtr, name, EB_TracePhaseAsyncEnd, pictureNumber, 0);
+}
+
+/**************************************
+ * EbTraceDump
+ **************************************/
+EbErrorType EbTraceDump(
+    EbTrace_t           *tracePtr)
+{
+    EbErrorType     return_error = EB_ErrorNone;
+    FILE           *filePtr;
+    EbTraceRing_t  *ringPtr;
+    EbTraceEvent_t *eventPtr;
+    const char     *separator = "";
+    uint32_t        ringCount = EbAtomicLoad32(&tracePtr->ringCount);
+    uint32_t        ringIndex;
+    uint64_t        eventIndex;
+
+    if (ringCount > EB_TraceMaxRingCount)
+        ringCount = EB_TraceMaxRingCount;
+
+    FOPEN(filePtr, tracePtr->filePath, "w");
+    if (filePtr == (FILE*)EB_NULL) {
+        SVT_LOG("SVT [WARNING]: Could not open trace file %s\n", tracePtr->filePath);
+        return_error = EB_ErrorBadParameter;
+    }
+    else {
+        fprintf(filePtr, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        fprintf(filePtr, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"SVT-AV1 Encoder %u\"}}",
+            tracePtr->processId,
+            tracePtr->processId);
+        separator = ",\n";
+    }
+
+    for (ringIndex = 0; ringIndex < ringCount; ++ringIndex) {
+        ringPtr = tracePtr->ringArray[ringIndex];
+        if (ringPtr == (EbTraceRing_t*)EB_NULL)
+            continue;
+
+        if (filePtr) {
+            fprintf(filePtr, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}",
+                separator,
+                tracePtr->processId,
+                ringPtr->threadIndex,
+                ringPtr->threadName ? ringPtr->threadName : "Thread",
+                ringPtr->threadIndex);
+
+            // The ring only keeps the last EB_TraceRingEventCount events
+            eventIndex = ringPtr->writeIndex > EB_TraceRingEventCount ? ringPtr->writeIndex - EB_TraceRingEventCount : 0;
+            for (; eventIndex < ringPtr->writeIndex; ++eventIndex) {
+                eventPtr = &ringPtr->eventArray[eventIndex & (EB_TraceRingEventCount - 1)];
+
+                fprintf(filePtr, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":%u,\"tid\":%u",
+                    separator,
+                    eventPtr->name,
+                    (char)eventPtr->phase,
+                    (unsigned long long)(eventPtr->timestamp > tracePtr->startTime ? eventPtr->timestamp - tracePtr->startTime : 0),
+                    tracePtr->processId,
+                    ringPtr->threadIndex);
+
+                if (eventPtr->phase == EB_TracePhaseAsyncBegin || eventPtr->phase == EB_TracePhaseAsyncEnd)
+                    fprintf(filePtr, ",\"cat\":\"picture\",\"id\":%llu", (unsigned long long)eventPtr->pictureNumber);
+                if (eventPtr->pictureNumber != EB_TraceNoPicture)
+                    fprintf(filePtr, ",\"args\":{\"picture\":%llu,\"segment\":%u}", (unsigned long long)eventPtr->pictureNumber, eventPtr->segmentIndex);
+                fprintf(filePtr, "}");
+            }
+        }
+
+        free(ringPtr->eventArray);
+        free(ringPtr);
+        tracePtr->ringArray[ringIndex] = (EbTraceRing_t*)EB_NULL;
+    }
+
+    // The threads that recorded into the trace keep a pointer to their
+    //   freed ring, a new traceId keeps it from being used
+    tracePtr->ringCount = 0;
+    tracePtr->traceId = EbAtomicAdd32(&traceIdCount, 1);
+
+    if (filePtr) {
+        fprintf(filePtr, "\n]}\n");
+        fclose(filePtr);
+    }
+
+    return return_error;
+}
@@ -0,0 +1,156 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbTrace_h
+#define EbTrace_h
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /*********************************
+     * Defines
+     *********************************/
+#define EB_TraceRingEventCount          (1 << 15)   // power of two
+#define EB_TraceMaxRingCount            1024
+#define EB_TraceNoPicture               (~(uint64_t)0)
+
+#define EB_TracePhaseBegin              'B'
+#define EB_TracePhaseEnd                'E'
+#define EB_TracePhaseAsyncBegin         'b'
+#define EB_TracePhaseAsyncEnd           'e'
+
+    struct EbTrace_s;
+
+    /*********************************************************************
+     * TraceEvent
+     *   name points to a string literal, it is only read at dump time.
+     *********************************************************************/
+    typedef struct EbTraceEvent_s {
+        uint64_t                 timestamp;
+        const char              *name;
+        uint64_t                 pictureNumber;
+        uint32_t                 segmentIndex;
+        uint32_t                 phase;
+    } EbTraceEvent_t;
+
+    /*********************************************************************
+     * TraceRing
+     *   Events of one thread. Only the owning thread writes, the oldest
+     *   events are overwritten once the ring is full. stageEventIndex is
+     *   the Begin event of the process kernel iteration the thread is in,
+     *   nestedName the EbTraceBegin span open in it, if any.
+     *********************************************************************/
+    typedef struct EbTraceRing_s {
+        struct EbTrace_s        *tracePtr;
+        EbTraceEvent_t          *eventArray;
+        uint64_t                 writeIndex;
+        uint64_t                 stageEventIndex;
+        uint32_t                 threadIndex;
+        const char              *threadName;
+        const char              *stageName;
+        const char              *nestedName;
+        uint64_t                 nestedPictureNumber;
+        uint32_t                 nestedSegmentIndex;
+    } EbTraceRing_t;
+
+    /*********************************************************************
+     * Trace
+     *   Timeline of an encoder instance written as a Chrome trace event
+     *   file (chrome://tracing, Perfetto) by EbTraceDump. Each thread
+     *   claims a ring the first time it records an event. traceId tells
+     *   the rings of a trace from those of a trace dumped before.
+     *********************************************************************/
+    typedef struct EbTrace_s {
+        char                    *filePath;
+        uint32_t                 processId;
+        volatile uint32_t        traceId;
+        uint64_t                 startTime;
+
+        volatile uint32_t        ringCount;
+        EbTraceRing_t           *ringArray[EB_TraceMaxRingCount];
+    } EbTrace_t;
+
+    extern EbErrorType EbTraceCtor(
+        EbTrace_t          **traceDblPtr,
+        const char          *filePath,
+        uint32_t             processId);
+
+    /*********************************************************************
+     * EbTraceDump
+     *   Writes the trace file and frees the rings. The threads recording
+     *   into the trace have to be stopped.
+     *********************************************************************/
+    extern EbErrorType EbTraceDump(
+        EbTrace_t           *tracePtr);
+
+    /*********************************************************************
+     * Process kernel iterations, recorded by the System Resource Manager
+     *   from EbGetFullObject returning to the next call.
+     *********************************************************************/
+    extern void EbTraceStageBegin(
+        EbTrace_t           *tracePtr,
+        const char          *name);
+
+    extern void EbTraceStageEnd(
+        const char          *name);
+
+    /*********************************************************************
+     * TraceSpan
+     *   The spans a scheduler task had open on its thread when it
+     *   suspended. EbTraceSuspend ends them, EbTraceResume begins them
+     *   again on the thread the task is resumed on.
+     *********************************************************************/
+    typedef struct EbTraceSpan_s {
+        EbTrace_t               *tracePtr;          // NULL if no span was open
+        const char              *stageName;
+        uint64_t                 stagePictureNumber;
+        uint32_t                 stageSegmentIndex;
+        const char              *name;              // EbTraceBegin span, or NULL
+        uint64_t                 pictureNumber;
+        uint32_t                 segmentIndex;
+    } EbTraceSpan_t;
+
+    extern void EbTraceSuspend(
+        EbTraceSpan_t       *spanPtr);
+
+    extern void EbTraceResume(
+        const EbTraceSpan_t *spanPtr);
+
+    /*********************************************************************
+     * EbTracePicture
+     *   Tags the kernel iteration of the calling thread with the picture
+     *   and segment it works on, called right after EbGetFullObject.
+     *********************************************************************/
+    extern void EbTracePicture(
+        uint64_t             pictureNumber,
+        uint32_t             segmentIndex);
+
+    // Nested event on the calling thread (i.e. one EncDec segment). The
+    //   events below are only recorded within a kernel iteration of a
+    //   traced process, see EbTraceStageBegin.
+    extern void EbTraceBegin(
+        const char          *name,
+        uint64_t             pictureNumber,
+        uint32_t             segmentIndex);
+
+    extern void EbTraceEnd(
+        const char          *name);
+
+    // Event spanning threads, from the picture entering the pipeline to
+    //   its packet being output
+    extern void EbTraceAsyncBegin(
+        const char          *name,
+        uint64_t             pictureNumber);
+
+    extern void EbTraceAsyncEnd(
+        const char          *name,
+        uint64_t             pictureNumber);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbTrace_h
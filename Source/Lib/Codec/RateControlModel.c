@@ -29,6 +29,16 @@ static uint32_t    get_inter_qp_for_size(EbRateControlModel *model_ptr, uint32_t
  */
 static void record_new_gop(EbRateControlModel *model_ptr, PictureParentControlSet_t *picture_ptr);
 
+/*
+ * @private
+ * @function update_settings. Take the rate control settings of the picture
+ * starting a new group of picture, updated with eb_svt_enc_update_rate_control
+ * @param {EbRateControlModel*} model_ptr.
+ * @param {PictureParentControlSet_t*} picture_ptr. Picture holding the intra frame.
+ * @return {void}.
+ */
+static void update_settings(EbRateControlModel *model_ptr, PictureParentControlSet_t *picture_ptr);
+
 /*
  * Average size in bits for and intra frame per QP for a 1920x1080 reference video clip
  */
@@ -144,10 +154,22 @@ uint32_t get_inter_qp_for_size(EbRateControlModel *model_ptr, uint32_t desired_s
     return qp;
 }
 
+static void update_settings(EbRateControlModel *model_ptr, PictureParentControlSet_t *picture_ptr) {
+    if (picture_ptr->target_bit_rate != model_ptr->desired_bitrate) {
+        // The frames reported so far keep the previous bitrate
+        model_ptr->desired_bytes_base += (model_ptr->desired_bitrate / model_ptr->frame_rate) * (model_ptr->reported_frames - model_ptr->reported_frames_base);
+        model_ptr->reported_frames_base = model_ptr->reported_frames;
+        model_ptr->desired_bitrate = picture_ptr->target_bit_rate;
+    }
+    model_ptr->intra_period = picture_ptr->intra_period_length;
+}
+
 static void record_new_gop(EbRateControlModel *model_ptr, PictureParentControlSet_t *picture_ptr) {
     uint64_t                pictureNumber = picture_ptr->picture_number;
     EbRateControlGopInfo    *gop = &model_ptr->gop_infos[pictureNumber];
 
+    update_settings(model_ptr, picture_ptr);
+
     gop->index = pictureNumber;
     gop->exists = EB_TRUE;
     gop->desired_size = get_gop_size_in_bytes(model_ptr);
@@ -168,7 +190,7 @@ static void record_new_gop(EbRateControlModel *model_ptr, PictureParentControlSe
 uint32_t get_gop_size_in_bytes(EbRateControlModel *model_ptr) {
     uint32_t    gop_per_second = (model_ptr->frame_rate << 8)  / model_ptr->intra_period;
     uint32_t    gop_size = ((model_ptr->desired_bitrate << 8) / gop_per_second);
-    uint32_t    desired_total_bytes = (model_ptr->desired_bitrate / model_ptr->frame_rate) * model_ptr->reported_frames;
+    uint32_t    desired_total_bytes = (uint32_t)(model_ptr->desired_bytes_base + (model_ptr->desired_bitrate / model_ptr->frame_rate) * (model_ptr->reported_frames - model_ptr->reported_frames_base));
     int64_t     delta_bytes = desired_total_bytes - model_ptr->total_bytes;
     float       extra = 1;
 
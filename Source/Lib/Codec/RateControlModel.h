@@ -28,17 +28,31 @@ typedef struct    RateControlModel_s {
     size_t      inter_size_predictions[64];
 
     /*
-     * @variable uint32_t. Desired bitrate set in the configuration
+     * @variable uint32_t. Desired bitrate set in the configuration, or by the
+     * last rate control update
      */
     uint32_t    desired_bitrate;
 
+    /*
+     * @variable uint64_t. Bytes desired for the frames reported before the
+     * last change of desired_bitrate
+     */
+    uint64_t    desired_bytes_base;
+
+    /*
+     * @variable uint64_t. Number of frames reported before the last change of
+     * desired_bitrate
+     */
+    uint64_t    reported_frames_base;
+
     /*
      * @variable EB_U32. Desired frame rate set in the configuration
      */
     uint32_t    frame_rate;
 
     /*
-     * @variable EB_S32. Intra period length set in the configuration
+     * @variable EB_S32. Intra period length set in the configuration, or by
+     * the last rate control update
      */
     int32_t     intra_period;
 
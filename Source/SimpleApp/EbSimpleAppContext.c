@@ -179,6 +179,15 @@ EbErrorType CopyConfigurationParameters(
     //callbackData->ebEncParameters.code_eos_nal        = 1;
     callbackData->ebEncParameters.recon_enabled      = config->reconFile ? 1 : 0;
 
+    // Low latency: the packets are written from the encoder thread as soon
+    //   as they are ready, nothing is buffered for a look ahead
+    if (config->latencyMode) {
+        callbackData->ebEncParameters.look_ahead_distance     = 0;
+        callbackData->ebEncParameters.packet_callback         = OutputPacketCallback;
+        callbackData->ebEncParameters.recon_callback          = config->reconFile ? OutputReconCallback : NULL;
+        callbackData->ebEncParameters.output_callback_context = callbackData;
+    }
+
     return return_error;
 
 }
@@ -210,12 +219,14 @@ EbErrorType InitEncoder(
     return_error = eb_init_encoder(callbackData->svtEncoderHandle);
     // Get ivf header
     if (config->bitstreamFile) {
-        EbBufferHeaderType *outputStreamBuffer;
+        EbBufferHeaderType *outputStreamBuffer = NULL;
         return_error = eb_svt_enc_stream_header(callbackData->svtEncoderHandle, &outputStreamBuffer);
         if (return_error != EB_ErrorNone) {
             return return_error;
         }
-        fwrite(outputStreamBuffer->p_buffer, 1, outputStreamBuffer->n_filled_len, config->bitstreamFile);
+        // The library does not write a stream header yet
+        if (outputStreamBuffer)
+            fwrite(outputStreamBuffer->p_buffer, 1, outputStreamBuffer->n_filled_len, config->bitstreamFile);
     }
     ///************************* LIBRARY INIT [END] *********************///
     return return_error;
@@ -44,7 +44,7 @@ typedef struct EbConfig_s
     int64_t                      bufferedInput;
     uint8_t                   **sequenceBuffer;
 
-    uint8_t                     latencyMode;
+    uint8_t                     latencyMode;        // 1: output delivered by the encoder callbacks
 
     /****************************************
      * // Interlaced Video
@@ -186,6 +186,11 @@ typedef struct EbAppContext_s {
 
     uint32_t instanceIdx;
 
+    // Low latency output
+    EbConfig_t                         *config;
+    void                               *eosSemaphore;  // posted by the EOS packet
+    int64_t                             packetCount;
+
 } EbAppContext_t;
 
 
@@ -196,5 +201,7 @@ extern EbErrorType EbAppContextCtor(EbAppContext_t *contextPtr, EbConfig_t *conf
 extern void EbAppContextDtor(EbAppContext_t *contextPtr);
 extern EbErrorType InitEncoder(EbConfig_t *config, EbAppContext_t *callbackData, uint32_t instanceIdx);
 extern EbErrorType DeInitEncoder(EbAppContext_t *callbackDataPtr, uint32_t instanceIndex);
+extern void OutputPacketCallback(void *context, EbBufferHeaderType *headerPtr);
+extern void OutputReconCallback(void *context, EbBufferHeaderType *headerPtr);
 
 #endif // EbAppContext_h
@@ -19,7 +19,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #if _WIN32
+#include <windows.h>
 #define fseeko64 _fseeki64
 #define ftello64 _ftelli64
 #define FOPEN(f,s,m) fopen_s(&f,s,m)
@@ -65,6 +67,7 @@ static void EbConfigCtor(EbConfig_t *config_ptr)
     config_ptr->framesToBeEncoded = 0;
     config_ptr->channel_id = 0;
     config_ptr->stopEncoder = 0;
+    config_ptr->latencyMode = 0;
 
     return;
 }
@@ -93,6 +96,30 @@ static void EbConfigDtor(EbConfig_t *config_ptr)
     return;
 }
 
+// Writes the recon picture at the position of its picture number
+static int32_t WriteReconBuffer(
+    EbConfig_t             *config,
+    EbBufferHeaderType     *headerPtr)
+{
+    int32_t fseekReturnVal;
+
+    //Sets the File position to the beginning of the file.
+    rewind(config->reconFile);
+    uint64_t frameNum = headerPtr->pts;
+    while (frameNum>0) {
+        fseekReturnVal = fseeko64(config->reconFile, headerPtr->n_filled_len, SEEK_CUR);
+
+        if (fseekReturnVal != 0) {
+            printf("Error in fseeko64  returnVal %i\n", fseekReturnVal);
+            return fseekReturnVal;
+        }
+        frameNum = frameNum - 1;
+    }
+
+    fwrite(headerPtr->p_buffer, 1, headerPtr->n_filled_len, config->reconFile);
+    return 0;
+}
+
 APPEXITCONDITIONTYPE ProcessOutputReconBuffer(
     EbConfig_t             *config,
     EbAppContext_t         *appCallBack)
@@ -101,7 +128,6 @@ APPEXITCONDITIONTYPE ProcessOutputReconBuffer(
     EbComponentType       *componentHandle = (EbComponentType*)appCallBack->svtEncoderHandle;
     APPEXITCONDITIONTYPE    return_value = APP_ExitConditionNone;
     EbErrorType            recon_status = EB_ErrorNone;
-    int32_t fseekReturnVal;
     // non-blocking call until all input frames are sent
     recon_status = eb_svt_get_recon(componentHandle, headerPtr);
 
@@ -110,20 +136,8 @@ APPEXITCONDITIONTYPE ProcessOutputReconBuffer(
         return APP_ExitConditionError;
     }
     else if (recon_status != EB_NoErrorEmptyQueue) {
-        //Sets the File position to the beginning of the file.
-        rewind(config->reconFile);
-        uint64_t frameNum = headerPtr->pts;
-        while (frameNum>0) {
-            fseekReturnVal = fseeko64(config->reconFile, headerPtr->n_filled_len, SEEK_CUR);
-
-            if (fseekReturnVal != 0) {
-                printf("Error in fseeko64  returnVal %i\n", fseekReturnVal);
-                return APP_ExitConditionError;
-            }
-            frameNum = frameNum - 1;
-        }
-
-        fwrite(headerPtr->p_buffer, 1, headerPtr->n_filled_len, config->reconFile);
+        if (WriteReconBuffer(config, headerPtr) != 0)
+            return APP_ExitConditionError;
 
         // Update Output Port Activity State
         return_value = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : APP_ExitConditionNone;
@@ -165,6 +179,61 @@ APPEXITCONDITIONTYPE ProcessOutputStreamBuffer(
     return return_value;
 }
 
+/***************************************
+ * Low latency output
+ *   The encoder calls these from its Packetization thread as soon as a
+ *   packet or recon picture is ready, the recon of a picture comes before
+ *   its packet and the EOS packet comes last.
+ ***************************************/
+#if _WIN32
+static void* CreateEosSemaphore(void)              { return (void*)CreateSemaphore(NULL, 0, 1, NULL); }
+static void PostEosSemaphore(void *semaphore)      { ReleaseSemaphore((HANDLE)semaphore, 1, NULL); }
+static void WaitEosSemaphore(void *semaphore)      { WaitForSingleObject((HANDLE)semaphore, INFINITE); }
+static void DestroyEosSemaphore(void *semaphore)   { CloseHandle((HANDLE)semaphore); }
+#else
+static void* CreateEosSemaphore(void)
+{
+    sem_t *semaphore = (sem_t*)malloc(sizeof(sem_t));
+    if (semaphore && sem_init(semaphore, 0, 0) != 0) {
+        free(semaphore);
+        semaphore = NULL;
+    }
+    return (void*)semaphore;
+}
+static void PostEosSemaphore(void *semaphore)      { sem_post((sem_t*)semaphore); }
+static void WaitEosSemaphore(void *semaphore)      { while (sem_wait((sem_t*)semaphore) != 0 && errno == EINTR); }
+static void DestroyEosSemaphore(void *semaphore)   { sem_destroy((sem_t*)semaphore); free(semaphore); }
+#endif
+
+void OutputPacketCallback(
+    void                   *context,
+    EbBufferHeaderType     *headerPtr)
+{
+    EbAppContext_t *appCallback = (EbAppContext_t*)context;
+    EbConfig_t     *config = appCallback->config;
+    EbBool          eos = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? EB_TRUE : EB_FALSE;
+
+    fwrite(headerPtr->p_buffer, 1, headerPtr->n_filled_len, config->bitstreamFile);
+    fflush(config->bitstreamFile);
+    printf("\nDecode Order:\t%ld\tdts:\t%ld\tpts:\t%ld\tSliceType:\t%d\tLatency:\t%u ms", (long int)appCallback->packetCount++, (long int)headerPtr->dts, (long int)headerPtr->pts, (int)headerPtr->pic_type, headerPtr->n_tick_count);
+    fflush(stdout);
+
+    eb_svt_release_out_buffer(&headerPtr);
+
+    if (eos)
+        PostEosSemaphore(appCallback->eosSemaphore);
+}
+
+void OutputReconCallback(
+    void                   *context,
+    EbBufferHeaderType     *headerPtr)
+{
+    EbAppContext_t *appCallback = (EbAppContext_t*)context;
+
+    WriteReconBuffer(appCallback->config, headerPtr);
+    eb_svt_release_out_buffer(&headerPtr);
+}
+
 #define SIZE_OF_ONE_FRAME_IN_BYTES(width, height,is16bit) ( ( ((width)*(height)*3)>>1 )<<is16bit)
 void ReadInputFrames(
     EbConfig_t                  *config,
@@ -336,8 +405,13 @@ int32_t main(int32_t argc, char* argv[])
         config = (EbConfig_t*)malloc(sizeof(EbConfig_t));
         if (config){
             EbConfigCtor(config);
+            if (argc > 1 && strcmp(argv[1], "-low-latency") == 0) {
+                config->latencyMode = 1;
+                argc--;
+                argv++;
+            }
             if (argc != 6 && argc != 7) {
-                printf("Usage: ./SvtHevcEncSimpleApp in.yuv out.ivf width height bitdepth recon.yuv(optional)\n");
+                printf("Usage: ./SvtAv1EncSimpleApp [-low-latency] in.yuv out.ivf width height bitdepth recon.yuv(optional)\n");
                 return_error = EB_ErrorBadParameter;
             }
             else {
@@ -398,14 +472,28 @@ int32_t main(int32_t argc, char* argv[])
             appCallback = (EbAppContext_t*)malloc(sizeof(EbAppContext_t));
             if (appCallback){
                 EbAppContextCtor(appCallback,config);
+                appCallback->config = config;
+                appCallback->packetCount = 0;
+                appCallback->eosSemaphore = config->latencyMode ? CreateEosSemaphore() : NULL;
+                if (config->latencyMode && appCallback->eosSemaphore == NULL)
+                    return_error = EB_ErrorInsufficientResources;
 
-                return_error = InitEncoder(config, appCallback, 0);
+                if (return_error == EB_ErrorNone)
+                    return_error = InitEncoder(config, appCallback, 0);
 
                 printf("Encoding          ");
                 fflush(stdout);
 
+                if (config->latencyMode) {
+                    // Only send the pictures, the encoder thread writes the output
+                    if (return_error == EB_ErrorNone) {
+                        while (ProcessInputBuffer(config, appCallback) == APP_ExitConditionNone);
+                        WaitEosSemaphore(appCallback->eosSemaphore);
+                    }
+                    exitConditionOutput = APP_ExitConditionFinished;
+                }
+
                 // Input Loop Thread
-                exitConditionOutput = APP_ExitConditionNone;
                 exitConditionRecon = APP_ExitConditionNone;
                 while (exitConditionOutput == APP_ExitConditionNone) {
                     exitConditionInput = ProcessInputBuffer(config, appCallback);
@@ -415,6 +503,8 @@ int32_t main(int32_t argc, char* argv[])
                     exitConditionOutput = ProcessOutputStreamBuffer(config, appCallback, (exitConditionInput == APP_ExitConditionNone || (exitConditionRecon == APP_ExitConditionNone && config->reconFile) ? 0 : 1));
                 }
                 return_error = DeInitEncoder(appCallback, 0);
+                if (appCallback->eosSemaphore)
+                    DestroyEosSemaphore(appCallback->eosSemaphore);
                 // Destruct the App memory variables
                 EbAppContextDtor(appCallback);
                 free(appCallback);
@@ -0,0 +1,137 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// EbEncHandleStressTest.c
+//  -Creates and destroys encoder handles from several threads at once
+//  -Checks that the memory context of each handle gives back every
+//   allocation, semaphore, mutex and thread it recorded
+//  -Checks that the process is left with the threads it started with
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#include "EbApi.h"
+#include "EbEncHandle.h"
+
+#define TEST_ThreadCount        4
+#define TEST_IterationCount     8
+
+static volatile int32_t failCount = 0;
+
+static void ReportFailure(
+    uint32_t     threadIndex,
+    uint32_t     iteration,
+    const char  *what)
+{
+    printf("thread %u iteration %u: %s\n", threadIndex, iteration, what);
+    __sync_fetch_and_add(&failCount, 1);
+}
+
+// Threads of the process, from /proc/self/task
+static int32_t GetThreadCount(void)
+{
+    DIR           *dir = opendir("/proc/self/task");
+    struct dirent *entry;
+    int32_t        threadCount = 0;
+
+    if (dir == NULL)
+        return -1;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] != '.')
+            ++threadCount;
+    }
+    closedir(dir);
+
+    return threadCount;
+}
+
+/***************************************
+ * Handle Loop
+ *   Alternates the dedicated threads and the task scheduler, and the
+ *   picture sizes across the threads so the handles differ.
+ ***************************************/
+static void* HandleLoopKernel(void *input_ptr)
+{
+    uint32_t threadIndex = (uint32_t)(uintptr_t)input_ptr;
+    uint32_t iteration;
+
+    for (iteration = 0; iteration < TEST_IterationCount; ++iteration) {
+        EbComponentType          *handle = NULL;
+        EbSvtAv1EncConfiguration  config;
+        EbMemoryContext_t        *contextPtr;
+
+        memset(&config, 0, sizeof(config));
+        if (eb_init_handle(&handle, NULL, &config) != EB_ErrorNone) {
+            ReportFailure(threadIndex, iteration, "eb_init_handle failed");
+            continue;
+        }
+
+        config.source_width = 320 + 64 * threadIndex;
+        config.source_height = 240;
+        config.framesToBeEncoded = 10;
+        config.logical_processors = 1;
+        config.task_scheduler = (EbBool)(iteration & 1);
+
+        if (eb_svt_enc_set_parameter(handle, &config) != EB_ErrorNone)
+            ReportFailure(threadIndex, iteration, "eb_svt_enc_set_parameter failed");
+        else if (eb_init_encoder(handle) != EB_ErrorNone)
+            ReportFailure(threadIndex, iteration, "eb_init_encoder failed");
+
+        if (eb_deinit_encoder(handle) != EB_ErrorNone)
+            ReportFailure(threadIndex, iteration, "eb_deinit_encoder failed");
+
+        // The handle itself is still there until eb_deinit_handle
+        contextPtr = &((EbEncHandle_t*)handle->pComponentPrivate)->memoryContext;
+        if (contextPtr->memoryMapPtr != NULL)
+            ReportFailure(threadIndex, iteration, "memory table not released");
+        if (contextPtr->libMallocCount)
+            ReportFailure(threadIndex, iteration, "allocations leaked");
+        if (contextPtr->libSemaphoreCount)
+            ReportFailure(threadIndex, iteration, "semaphores leaked");
+        if (contextPtr->libMutexCount)
+            ReportFailure(threadIndex, iteration, "mutexes leaked");
+        if (contextPtr->libThreadCount)
+            ReportFailure(threadIndex, iteration, "threads leaked");
+
+        if (eb_deinit_handle(handle) != EB_ErrorNone)
+            ReportFailure(threadIndex, iteration, "eb_deinit_handle failed");
+    }
+
+    return NULL;
+}
+
+int32_t main(int32_t argc, char *argv[])
+{
+    pthread_t threadArray[TEST_ThreadCount];
+    uint32_t  threadIndex;
+    int32_t   threadCount = GetThreadCount();
+
+    (void)argc;
+    (void)argv;
+
+    for (threadIndex = 0; threadIndex < TEST_ThreadCount; ++threadIndex) {
+        if (pthread_create(&threadArray[threadIndex], NULL, HandleLoopKernel, (void*)(uintptr_t)threadIndex) != 0) {
+            printf("could not create thread %u\n", threadIndex);
+            return 1;
+        }
+    }
+    for (threadIndex = 0; threadIndex < TEST_ThreadCount; ++threadIndex)
+        pthread_join(threadArray[threadIndex], NULL);
+
+    if (GetThreadCount() != threadCount) {
+        printf("%d threads left running, %d before\n", GetThreadCount(), threadCount);
+        ++failCount;
+    }
+
+    printf("%s: %d failures\n", failCount ? "FAILED" : "PASSED", failCount);
+
+    return failCount ? 1 : 0;
+}
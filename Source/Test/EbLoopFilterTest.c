@@ -0,0 +1,396 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// EbLoopFilterTest.c
+//  -Runs the SSE2 edge filters against their C references
+//  -Runs the AVX2 multi-edge filters against their C references, for
+//   1 to TEST_MaxSegmentCount segments
+//  -Runs the multi-edge filters, as batched by av1_filter_block_plane_vert()
+//   and av1_filter_block_plane_horz(), against one edge filter call per
+//   4-sample segment
+//  -Covers the 4, 6, 8 and 14-tap filters, horizontal and vertical edges,
+//   8, 10 and 12-bit, with random samples and thresholds
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aom_dsp_rtcd.h"
+
+#define TEST_IterationCount     500
+#define TEST_MaxSegmentCount    16
+#define TEST_Border             8
+#define TEST_Stride             (TEST_MaxSegmentCount * 4 + 2 * TEST_Border)
+#define TEST_Height             (TEST_MaxSegmentCount * 4 + 2 * TEST_Border)
+#define TEST_SegmentSize        4
+
+typedef void(*LpfFunc)(uint8_t *s, int32_t pitch, const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh);
+typedef void(*LpfMultiFunc)(uint8_t *s, int32_t pitch, const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh, int32_t count);
+typedef void(*HighbdLpfFunc)(uint16_t *s, int32_t pitch, const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh, int32_t bd);
+typedef void(*HighbdLpfMultiFunc)(uint16_t *s, int32_t pitch, const uint8_t *blimit, const uint8_t *limit, const uint8_t *thresh, int32_t count, int32_t bd);
+
+typedef struct LpfTest_s
+{
+    const char             *name;
+    EbBool                  vertical;
+    LpfFunc                 refFunc;
+    LpfFunc                 testFunc;
+} LpfTest_t;
+
+typedef struct LpfMultiTest_s
+{
+    const char             *name;
+    EbBool                  vertical;
+    LpfMultiFunc            refFunc;
+    LpfMultiFunc            testFunc;
+} LpfMultiTest_t;
+
+typedef struct HighbdLpfTest_s
+{
+    const char             *name;
+    EbBool                  vertical;
+    HighbdLpfFunc           refFunc;
+    HighbdLpfFunc           testFunc;
+} HighbdLpfTest_t;
+
+typedef struct HighbdLpfMultiTest_s
+{
+    const char             *name;
+    EbBool                  vertical;
+    HighbdLpfMultiFunc      refFunc;
+    HighbdLpfMultiFunc      testFunc;
+} HighbdLpfMultiTest_t;
+
+static const LpfTest_t lpfSse2Tests[] = {
+    { "aom_lpf_horizontal_4_sse2", EB_FALSE, aom_lpf_horizontal_4_c, aom_lpf_horizontal_4_sse2 },
+    { "aom_lpf_horizontal_6_sse2", EB_FALSE, aom_lpf_horizontal_6_c, aom_lpf_horizontal_6_sse2 },
+    { "aom_lpf_horizontal_8_sse2", EB_FALSE, aom_lpf_horizontal_8_c, aom_lpf_horizontal_8_sse2 },
+    { "aom_lpf_horizontal_14_sse2", EB_FALSE, aom_lpf_horizontal_14_c, aom_lpf_horizontal_14_sse2 },
+    { "aom_lpf_vertical_4_sse2", EB_TRUE, aom_lpf_vertical_4_c, aom_lpf_vertical_4_sse2 },
+    { "aom_lpf_vertical_6_sse2", EB_TRUE, aom_lpf_vertical_6_c, aom_lpf_vertical_6_sse2 },
+    { "aom_lpf_vertical_8_sse2", EB_TRUE, aom_lpf_vertical_8_c, aom_lpf_vertical_8_sse2 },
+    { "aom_lpf_vertical_14_sse2", EB_TRUE, aom_lpf_vertical_14_c, aom_lpf_vertical_14_sse2 } };
+
+static const HighbdLpfTest_t highbdLpfSse2Tests[] = {
+    { "aom_highbd_lpf_horizontal_4_sse2", EB_FALSE, aom_highbd_lpf_horizontal_4_c, aom_highbd_lpf_horizontal_4_sse2 },
+    { "aom_highbd_lpf_horizontal_6_sse2", EB_FALSE, aom_highbd_lpf_horizontal_6_c, aom_highbd_lpf_horizontal_6_sse2 },
+    { "aom_highbd_lpf_horizontal_8_sse2", EB_FALSE, aom_highbd_lpf_horizontal_8_c, aom_highbd_lpf_horizontal_8_sse2 },
+    { "aom_highbd_lpf_horizontal_14_sse2", EB_FALSE, aom_highbd_lpf_horizontal_14_c, aom_highbd_lpf_horizontal_14_sse2 },
+    { "aom_highbd_lpf_vertical_4_sse2", EB_TRUE, aom_highbd_lpf_vertical_4_c, aom_highbd_lpf_vertical_4_sse2 },
+    { "aom_highbd_lpf_vertical_6_sse2", EB_TRUE, aom_highbd_lpf_vertical_6_c, aom_highbd_lpf_vertical_6_sse2 },
+    { "aom_highbd_lpf_vertical_8_sse2", EB_TRUE, aom_highbd_lpf_vertical_8_c, aom_highbd_lpf_vertical_8_sse2 },
+    { "aom_highbd_lpf_vertical_14_sse2", EB_TRUE, aom_highbd_lpf_vertical_14_c, aom_highbd_lpf_vertical_14_sse2 } };
+
+static const LpfMultiTest_t lpfAvx2Tests[] = {
+    { "aom_lpf_horizontal_4_multi_avx2", EB_FALSE, aom_lpf_horizontal_4_multi_c, aom_lpf_horizontal_4_multi_avx2 },
+    { "aom_lpf_horizontal_6_multi_avx2", EB_FALSE, aom_lpf_horizontal_6_multi_c, aom_lpf_horizontal_6_multi_avx2 },
+    { "aom_lpf_horizontal_8_multi_avx2", EB_FALSE, aom_lpf_horizontal_8_multi_c, aom_lpf_horizontal_8_multi_avx2 },
+    { "aom_lpf_horizontal_14_multi_avx2", EB_FALSE, aom_lpf_horizontal_14_multi_c, aom_lpf_horizontal_14_multi_avx2 },
+    { "aom_lpf_vertical_4_multi_avx2", EB_TRUE, aom_lpf_vertical_4_multi_c, aom_lpf_vertical_4_multi_avx2 },
+    { "aom_lpf_vertical_6_multi_avx2", EB_TRUE, aom_lpf_vertical_6_multi_c, aom_lpf_vertical_6_multi_avx2 },
+    { "aom_lpf_vertical_8_multi_avx2", EB_TRUE, aom_lpf_vertical_8_multi_c, aom_lpf_vertical_8_multi_avx2 },
+    { "aom_lpf_vertical_14_multi_avx2", EB_TRUE, aom_lpf_vertical_14_multi_c, aom_lpf_vertical_14_multi_avx2 } };
+
+static const HighbdLpfMultiTest_t highbdLpfAvx2Tests[] = {
+    { "aom_highbd_lpf_horizontal_4_multi_avx2", EB_FALSE, aom_highbd_lpf_horizontal_4_multi_c, aom_highbd_lpf_horizontal_4_multi_avx2 },
+    { "aom_highbd_lpf_horizontal_6_multi_avx2", EB_FALSE, aom_highbd_lpf_horizontal_6_multi_c, aom_highbd_lpf_horizontal_6_multi_avx2 },
+    { "aom_highbd_lpf_horizontal_8_multi_avx2", EB_FALSE, aom_highbd_lpf_horizontal_8_multi_c, aom_highbd_lpf_horizontal_8_multi_avx2 },
+    { "aom_highbd_lpf_horizontal_14_multi_avx2", EB_FALSE, aom_highbd_lpf_horizontal_14_multi_c, aom_highbd_lpf_horizontal_14_multi_avx2 },
+    { "aom_highbd_lpf_vertical_4_multi_avx2", EB_TRUE, aom_highbd_lpf_vertical_4_multi_c, aom_highbd_lpf_vertical_4_multi_avx2 },
+    { "aom_highbd_lpf_vertical_6_multi_avx2", EB_TRUE, aom_highbd_lpf_vertical_6_multi_c, aom_highbd_lpf_vertical_6_multi_avx2 },
+    { "aom_highbd_lpf_vertical_8_multi_avx2", EB_TRUE, aom_highbd_lpf_vertical_8_multi_c, aom_highbd_lpf_vertical_8_multi_avx2 },
+    { "aom_highbd_lpf_vertical_14_multi_avx2", EB_TRUE, aom_highbd_lpf_vertical_14_multi_c, aom_highbd_lpf_vertical_14_multi_avx2 } };
+
+// 8-bit goes through the aom_lpf_* kernels
+static const int32_t highbdBitDepths[] = { 10, 12 };
+
+static int32_t failCount = 0;
+
+// The SIMD kernels load whole registers of the thresholds
+typedef struct LpfThresholds_s
+{
+    DECLARE_ALIGNED(16, uint8_t, blimit[16]);
+    DECLARE_ALIGNED(16, uint8_t, limit[16]);
+    DECLARE_ALIGNED(16, uint8_t, thresh[16]);
+} LpfThresholds_t;
+
+static uint32_t randomState = 1;
+
+static uint32_t GetRandom(void)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 8) & 0xFFFFFF;
+}
+
+// Thresholds in the range of the filter levels, see update_sharpness()
+static void SetRandomThresholds(LpfThresholds_t *thrPtr)
+{
+    const uint32_t level = GetRandom() % 64;
+    const uint32_t limit = 1 + GetRandom() % 63;
+
+    memset(thrPtr->blimit, (int32_t)(2 * (level + 2) + limit), sizeof(thrPtr->blimit));
+    memset(thrPtr->limit, (int32_t)limit, sizeof(thrPtr->limit));
+    memset(thrPtr->thresh, (int32_t)(level >> 4), sizeof(thrPtr->thresh));
+}
+
+/***************************************
+ * Random Block
+ *   Either noise over the whole range, which
+ *   mostly fails the filter masks, or a flat
+ *   area on each side of the edge with a little
+ *   noise, which passes them
+ ***************************************/
+static void SetRandomBlock(
+    uint16_t *bufferPtr,
+    EbBool    vertical,
+    int32_t   bitDepth)
+{
+    const uint32_t maxValue = (1 << bitDepth) - 1;
+    const EbBool   smooth = (GetRandom() & 3) ? EB_TRUE : EB_FALSE;
+    const uint32_t noise = 1 + (GetRandom() % 4 << (bitDepth - 8));
+    const uint32_t baseValue = GetRandom() & maxValue;
+    const uint32_t step = GetRandom() % (8 << (bitDepth - 8));
+    int32_t x, y;
+
+    for (y = 0; y < TEST_Height; ++y) {
+        for (x = 0; x < TEST_Stride; ++x) {
+            uint32_t value;
+
+            if (smooth) {
+                const int32_t side = vertical ? (x >= TEST_Border) : (y >= TEST_Border);
+                value = baseValue + (side ? step : 0) + GetRandom() % noise;
+                value = value > maxValue ? maxValue : value;
+            }
+            else
+                value = GetRandom() & maxValue;
+            bufferPtr[y * TEST_Stride + x] = (uint16_t)value;
+        }
+    }
+}
+
+static void ReportMismatch(
+    const char *name,
+    int32_t     bitDepth,
+    int32_t     count,
+    uint32_t    iteration)
+{
+    printf("%s: mismatch, bit depth %d, %d segments, iteration %u\n", name, bitDepth, count, iteration);
+    ++failCount;
+}
+
+/***************************************
+ * 8-bit Tests
+ *   The edge is TEST_Border samples into the
+ *   buffer, the filters reach 7 samples across
+ ***************************************/
+static void TestLpf(
+    const char  *name,
+    EbBool       vertical,
+    LpfFunc      refFunc,
+    LpfFunc      testFunc,
+    LpfMultiFunc refMultiFunc,
+    LpfMultiFunc testMultiFunc,
+    int32_t      count)
+{
+    static uint16_t sourceBuffer[TEST_Stride * TEST_Height];
+    static uint8_t  refBuffer[TEST_Stride * TEST_Height];
+    static uint8_t  testBuffer[TEST_Stride * TEST_Height];
+    const int32_t   edgeOffset = vertical ? TEST_Border : TEST_Border * TEST_Stride;
+    LpfThresholds_t thr;
+    uint32_t        iteration;
+    int32_t         i;
+
+    for (iteration = 0; iteration < TEST_IterationCount; ++iteration) {
+        SetRandomBlock(sourceBuffer, vertical, 8);
+        SetRandomThresholds(&thr);
+        for (i = 0; i < TEST_Stride * TEST_Height; ++i)
+            refBuffer[i] = testBuffer[i] = (uint8_t)sourceBuffer[i];
+
+        if (refMultiFunc) {
+            refMultiFunc(refBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, count);
+            testMultiFunc(testBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, count);
+        }
+        else {
+            refFunc(refBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh);
+            testFunc(testBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh);
+        }
+
+        if (memcmp(refBuffer, testBuffer, sizeof(refBuffer))) {
+            ReportMismatch(name, 8, count, iteration);
+            return;
+        }
+    }
+}
+
+/***************************************
+ * High Bit Depth Tests
+ ***************************************/
+static void TestHighbdLpf(
+    const char         *name,
+    EbBool              vertical,
+    HighbdLpfFunc       refFunc,
+    HighbdLpfFunc       testFunc,
+    HighbdLpfMultiFunc  refMultiFunc,
+    HighbdLpfMultiFunc  testMultiFunc,
+    int32_t             count,
+    int32_t             bitDepth)
+{
+    static uint16_t refBuffer[TEST_Stride * TEST_Height];
+    static uint16_t testBuffer[TEST_Stride * TEST_Height];
+    const int32_t   edgeOffset = vertical ? TEST_Border : TEST_Border * TEST_Stride;
+    LpfThresholds_t thr;
+    uint32_t        iteration;
+
+    for (iteration = 0; iteration < TEST_IterationCount; ++iteration) {
+        SetRandomBlock(refBuffer, vertical, bitDepth);
+        SetRandomThresholds(&thr);
+        memcpy(testBuffer, refBuffer, sizeof(testBuffer));
+
+        if (refMultiFunc) {
+            refMultiFunc(refBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, count, bitDepth);
+            testMultiFunc(testBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, count, bitDepth);
+        }
+        else {
+            refFunc(refBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, bitDepth);
+            testFunc(testBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, bitDepth);
+        }
+
+        if (memcmp(refBuffer, testBuffer, sizeof(refBuffer))) {
+            ReportMismatch(name, bitDepth, count, iteration);
+            return;
+        }
+    }
+}
+
+/***************************************
+ * Batched Edge Tests
+ *   The segments of a vertical edge are stacked
+ *   along y, those of a horizontal edge side by
+ *   side along x
+ ***************************************/
+static void TestLpfBatched(
+    const char  *name,
+    EbBool       vertical,
+    LpfFunc      edgeFunc,
+    LpfMultiFunc multiFunc,
+    int32_t      count)
+{
+    static uint16_t sourceBuffer[TEST_Stride * TEST_Height];
+    static uint8_t  refBuffer[TEST_Stride * TEST_Height];
+    static uint8_t  testBuffer[TEST_Stride * TEST_Height];
+    const int32_t   edgeOffset = vertical ? TEST_Border : TEST_Border * TEST_Stride;
+    const int32_t   segmentStep = vertical ? TEST_SegmentSize * TEST_Stride : TEST_SegmentSize;
+    LpfThresholds_t thr;
+    uint32_t        iteration;
+    int32_t         i;
+
+    for (iteration = 0; iteration < TEST_IterationCount; ++iteration) {
+        SetRandomBlock(sourceBuffer, vertical, 8);
+        SetRandomThresholds(&thr);
+        for (i = 0; i < TEST_Stride * TEST_Height; ++i)
+            refBuffer[i] = testBuffer[i] = (uint8_t)sourceBuffer[i];
+
+        for (i = 0; i < count; ++i)
+            edgeFunc(refBuffer + edgeOffset + i * segmentStep, TEST_Stride, thr.blimit, thr.limit, thr.thresh);
+        multiFunc(testBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, count);
+
+        if (memcmp(refBuffer, testBuffer, sizeof(refBuffer))) {
+            ReportMismatch(name, 8, count, iteration);
+            return;
+        }
+    }
+}
+
+static void TestHighbdLpfBatched(
+    const char         *name,
+    EbBool              vertical,
+    HighbdLpfFunc       edgeFunc,
+    HighbdLpfMultiFunc  multiFunc,
+    int32_t             count,
+    int32_t             bitDepth)
+{
+    static uint16_t refBuffer[TEST_Stride * TEST_Height];
+    static uint16_t testBuffer[TEST_Stride * TEST_Height];
+    const int32_t   edgeOffset = vertical ? TEST_Border : TEST_Border * TEST_Stride;
+    const int32_t   segmentStep = vertical ? TEST_SegmentSize * TEST_Stride : TEST_SegmentSize;
+    LpfThresholds_t thr;
+    uint32_t        iteration;
+    int32_t         i;
+
+    for (iteration = 0; iteration < TEST_IterationCount; ++iteration) {
+        SetRandomBlock(refBuffer, vertical, bitDepth);
+        SetRandomThresholds(&thr);
+        memcpy(testBuffer, refBuffer, sizeof(testBuffer));
+
+        for (i = 0; i < count; ++i)
+            edgeFunc(refBuffer + edgeOffset + i * segmentStep, TEST_Stride, thr.blimit, thr.limit, thr.thresh, bitDepth);
+        multiFunc(testBuffer + edgeOffset, TEST_Stride, thr.blimit, thr.limit, thr.thresh, count, bitDepth);
+
+        if (memcmp(refBuffer, testBuffer, sizeof(refBuffer))) {
+            ReportMismatch(name, bitDepth, count, iteration);
+            return;
+        }
+    }
+}
+
+int32_t main(int32_t argc, char *argv[])
+{
+    const EbBool avx2 = __builtin_cpu_supports("avx2") ? EB_TRUE : EB_FALSE;
+    uint32_t     testIndex;
+    uint32_t     bitDepthIndex;
+    int32_t      count;
+
+    (void)argc;
+    (void)argv;
+
+    for (testIndex = 0; testIndex < sizeof(lpfSse2Tests) / sizeof(lpfSse2Tests[0]); ++testIndex) {
+        const LpfTest_t *testPtr = &lpfSse2Tests[testIndex];
+        TestLpf(testPtr->name, testPtr->vertical, testPtr->refFunc, testPtr->testFunc, NULL, NULL, 1);
+    }
+    for (testIndex = 0; testIndex < sizeof(highbdLpfSse2Tests) / sizeof(highbdLpfSse2Tests[0]); ++testIndex) {
+        const HighbdLpfTest_t *testPtr = &highbdLpfSse2Tests[testIndex];
+        for (bitDepthIndex = 0; bitDepthIndex < sizeof(highbdBitDepths) / sizeof(highbdBitDepths[0]); ++bitDepthIndex)
+            TestHighbdLpf(testPtr->name, testPtr->vertical, testPtr->refFunc, testPtr->testFunc, NULL, NULL, 1, highbdBitDepths[bitDepthIndex]);
+    }
+
+    if (avx2) {
+        for (testIndex = 0; testIndex < sizeof(lpfAvx2Tests) / sizeof(lpfAvx2Tests[0]); ++testIndex) {
+            const LpfMultiTest_t *testPtr = &lpfAvx2Tests[testIndex];
+            for (count = 1; count <= TEST_MaxSegmentCount; ++count)
+                TestLpf(testPtr->name, testPtr->vertical, NULL, NULL, testPtr->refFunc, testPtr->testFunc, count);
+        }
+        for (testIndex = 0; testIndex < sizeof(highbdLpfAvx2Tests) / sizeof(highbdLpfAvx2Tests[0]); ++testIndex) {
+            const HighbdLpfMultiTest_t *testPtr = &highbdLpfAvx2Tests[testIndex];
+            for (bitDepthIndex = 0; bitDepthIndex < sizeof(highbdBitDepths) / sizeof(highbdBitDepths[0]); ++bitDepthIndex) {
+                for (count = 1; count <= TEST_MaxSegmentCount; ++count)
+                    TestHighbdLpf(testPtr->name, testPtr->vertical, NULL, NULL, testPtr->refFunc, testPtr->testFunc, count, highbdBitDepths[bitDepthIndex]);
+            }
+        }
+
+        // The multi-edge tables follow the order of the edge filter tables,
+        // the batched filters must match the SSE2 edge filters they replaced
+        for (testIndex = 0; testIndex < sizeof(lpfAvx2Tests) / sizeof(lpfAvx2Tests[0]); ++testIndex) {
+            const LpfMultiTest_t *testPtr = &lpfAvx2Tests[testIndex];
+            for (count = 1; count <= TEST_MaxSegmentCount; ++count)
+                TestLpfBatched(testPtr->name, testPtr->vertical, lpfSse2Tests[testIndex].testFunc, testPtr->testFunc, count);
+        }
+        for (testIndex = 0; testIndex < sizeof(highbdLpfAvx2Tests) / sizeof(highbdLpfAvx2Tests[0]); ++testIndex) {
+            const HighbdLpfMultiTest_t *testPtr = &highbdLpfAvx2Tests[testIndex];
+            for (bitDepthIndex = 0; bitDepthIndex < sizeof(highbdBitDepths) / sizeof(highbdBitDepths[0]); ++bitDepthIndex) {
+                for (count = 1; count <= TEST_MaxSegmentCount; ++count)
+                    TestHighbdLpfBatched(testPtr->name, testPtr->vertical, highbdLpfSse2Tests[testIndex].testFunc, testPtr->testFunc, count, highbdBitDepths[bitDepthIndex]);
+            }
+        }
+    }
+    else
+        printf("AVX2 not available, the multi-edge filters are not tested\n");
+
+    printf("%s: %d failures\n", failCount ? "FAILED" : "PASSED", failCount);
+
+    return failCount ? 1 : 0;
+}